@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_COMPILEROPTIONS_HPP
+#define GULC_COMPILEROPTIONS_HPP
+
+#include <string>
+#include <vector>
+
+namespace gulc {
+    /**
+     * Options that change how the compiler generates code, these are set from the command line in `main`
+     */
+    struct CompilerOptions {
+        /// How `requires` and `ensures` contracts are lowered to IR
+        enum class ContractMode {
+            // Contracts are parsed and validated but nothing is generated for them
+            Ignore,
+            // Contracts are trusted and passed to the optimizer as `llvm.assume`, `!range`, etc.
+            Assume,
+            // Contracts are checked at runtime, failing a contract traps
+            Check
+        };
+
+        /// Profile guided optimization
+        enum class ProfileMode {
+            None,
+            // `--profile-generate[=<file.profraw>]`, instrument the output to write a profile when `main` returns
+            Generate,
+            // `--profile-use=<file.profdata>`, attach the merged profile to the IR before it is optimized
+            Use
+        };
+
+        std::vector<std::string> filePaths;
+        ContractMode contractMode;
+        // Print the final memory layout (offsets, padding, etc.) of every struct after `CodeProcessor`
+        bool printStructLayouts;
+        ProfileMode profileMode;
+        // For `Generate` this is where the instrumented program writes its profile (empty uses the LLVM runtime's
+        // default of `default.profraw`), for `Use` this is the `.profdata` file merged with `llvm-profdata merge`
+        std::string profilePath;
+        // `--emit-module-interface=<file.gmi>`, write the declarations of the compiled files for other modules to import
+        std::string moduleInterfacePath;
+        // Module interfaces (`.gmi`) to load the imported declarations from
+        std::vector<std::string> moduleInterfaces;
+        // `--ast-cache=<dir>`, cache the parsed AST of every file in `<dir>` so unchanged files aren't parsed again
+        std::string astCacheDirectory;
+
+        // Linker options
+        // `-o <path>`
+        std::string outputPath;
+        // `--gc-sections`, every function and global gets its own section so unreferenced ones can be dropped
+        bool gcSections;
+        // `--icf`, identical code folding (requires `ld.lld` or `ld.gold`)
+        bool icf;
+        // Object files, static archives (`.a`), and shared libraries (`.so`) passed directly to the linker
+        std::vector<std::string> linkerInputs;
+        // `-L<dir>`
+        std::vector<std::string> librarySearchPaths;
+        // `-l<name>`
+        std::vector<std::string> libraries;
+
+        CompilerOptions()
+                : filePaths(), contractMode(ContractMode::Check), printStructLayouts(false),
+                  profileMode(ProfileMode::None), profilePath(), moduleInterfacePath(), moduleInterfaces(),
+                  astCacheDirectory(),
+                  outputPath("a.out"), gcSections(false), icf(false),
+                  linkerInputs(), librarySearchPaths(), libraries() {}
+
+    };
+}
+
+#endif //GULC_COMPILEROPTIONS_HPP
@@ -0,0 +1,1219 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_ASTVISITOR_HPP
+#define GULC_ASTVISITOR_HPP
+
+#include <tuple>
+#include <vector>
+#include <llvm/Support/Casting.h>
+#include <parsing/ASTFile.hpp>
+#include <ast/Decl.hpp>
+#include <ast/Stmt.hpp>
+#include <ast/Expr.hpp>
+#include <ast/conts/EnsuresCont.hpp>
+#include <ast/conts/RequiresCont.hpp>
+#include <ast/decls/CallOperatorDecl.hpp>
+#include <ast/decls/ConstructorDecl.hpp>
+#include <ast/decls/DestructorDecl.hpp>
+#include <ast/decls/EnumConstDecl.hpp>
+#include <ast/decls/EnumDecl.hpp>
+#include <ast/decls/ExtensionDecl.hpp>
+#include <ast/decls/FunctionDecl.hpp>
+#include <ast/decls/NamespaceDecl.hpp>
+#include <ast/decls/OperatorDecl.hpp>
+#include <ast/decls/ParameterDecl.hpp>
+#include <ast/decls/PropertyDecl.hpp>
+#include <ast/decls/StructDecl.hpp>
+#include <ast/decls/SubscriptOperatorDecl.hpp>
+#include <ast/decls/TemplateFunctionDecl.hpp>
+#include <ast/decls/TemplateFunctionInstDecl.hpp>
+#include <ast/decls/TemplateStructDecl.hpp>
+#include <ast/decls/TemplateStructInstDecl.hpp>
+#include <ast/decls/TemplateTraitDecl.hpp>
+#include <ast/decls/TemplateTraitInstDecl.hpp>
+#include <ast/decls/TraitDecl.hpp>
+#include <ast/decls/TraitPrototypeDecl.hpp>
+#include <ast/decls/TypeAliasDecl.hpp>
+#include <ast/decls/TypeSuffixDecl.hpp>
+#include <ast/decls/VariableDecl.hpp>
+#include <ast/stmts/BreakStmt.hpp>
+#include <ast/stmts/CaseStmt.hpp>
+#include <ast/stmts/CatchStmt.hpp>
+#include <ast/stmts/CompoundStmt.hpp>
+#include <ast/stmts/ContinueStmt.hpp>
+#include <ast/stmts/DoCatchStmt.hpp>
+#include <ast/stmts/DoStmt.hpp>
+#include <ast/stmts/FallthroughStmt.hpp>
+#include <ast/stmts/ForStmt.hpp>
+#include <ast/stmts/GotoStmt.hpp>
+#include <ast/stmts/IfStmt.hpp>
+#include <ast/stmts/LabeledStmt.hpp>
+#include <ast/stmts/RepeatWhileStmt.hpp>
+#include <ast/stmts/ReturnStmt.hpp>
+#include <ast/stmts/SwitchStmt.hpp>
+#include <ast/stmts/ThrowStmt.hpp>
+#include <ast/stmts/WhileStmt.hpp>
+#include <ast/exprs/ArrayLiteralExpr.hpp>
+#include <ast/exprs/AsExpr.hpp>
+#include <ast/exprs/AssignmentOperatorExpr.hpp>
+#include <ast/exprs/BoolLiteralExpr.hpp>
+#include <ast/exprs/CallOperatorReferenceExpr.hpp>
+#include <ast/exprs/CheckExtendsTypeExpr.hpp>
+#include <ast/exprs/ConstructorCallExpr.hpp>
+#include <ast/exprs/ConstructorReferenceExpr.hpp>
+#include <ast/exprs/CurrentSelfExpr.hpp>
+#include <ast/exprs/DeleteExpr.hpp>
+#include <ast/exprs/DestructorCallExpr.hpp>
+#include <ast/exprs/DestructorReferenceExpr.hpp>
+#include <ast/exprs/EnumConstRefExpr.hpp>
+#include <ast/exprs/FlatArrayIndexExpr.hpp>
+#include <ast/exprs/FunctionCallExpr.hpp>
+#include <ast/exprs/FunctionReferenceExpr.hpp>
+#include <ast/exprs/HasExpr.hpp>
+#include <ast/exprs/IdentifierExpr.hpp>
+#include <ast/exprs/ImaginaryRefExpr.hpp>
+#include <ast/exprs/ImplicitCastExpr.hpp>
+#include <ast/exprs/ImplicitDerefExpr.hpp>
+#include <ast/exprs/InfixOperatorExpr.hpp>
+#include <ast/exprs/IsExpr.hpp>
+#include <ast/exprs/LabeledArgumentExpr.hpp>
+#include <ast/exprs/LocalVariableRefExpr.hpp>
+#include <ast/exprs/LValueToRValueExpr.hpp>
+#include <ast/exprs/MemberAccessCallExpr.hpp>
+#include <ast/exprs/MemberFunctionCallExpr.hpp>
+#include <ast/exprs/MemberInfixOperatorCallExpr.hpp>
+#include <ast/exprs/MemberPostfixOperatorCallExpr.hpp>
+#include <ast/exprs/MemberPrefixOperatorCallExpr.hpp>
+#include <ast/exprs/MemberPropertyRefExpr.hpp>
+#include <ast/exprs/MemberSubscriptOperatorRefExpr.hpp>
+#include <ast/exprs/MemberVariableRefExpr.hpp>
+#include <ast/exprs/NewExpr.hpp>
+#include <ast/exprs/ParameterRefExpr.hpp>
+#include <ast/exprs/ParenExpr.hpp>
+#include <ast/exprs/PostfixOperatorExpr.hpp>
+#include <ast/exprs/PrefixOperatorExpr.hpp>
+#include <ast/exprs/PropertyGetCallExpr.hpp>
+#include <ast/exprs/PropertyRefExpr.hpp>
+#include <ast/exprs/PropertySetCallExpr.hpp>
+#include <ast/exprs/RefExpr.hpp>
+#include <ast/exprs/RValueToInRefExpr.hpp>
+#include <ast/exprs/SimdBuiltInCallExpr.hpp>
+#include <ast/exprs/SolvedConstExpr.hpp>
+#include <ast/exprs/StoreTemporaryValueExpr.hpp>
+#include <ast/exprs/StructAssignmentOperatorExpr.hpp>
+#include <ast/exprs/SubscriptCallExpr.hpp>
+#include <ast/exprs/SubscriptOperatorGetCallExpr.hpp>
+#include <ast/exprs/SubscriptOperatorRefExpr.hpp>
+#include <ast/exprs/SubscriptOperatorSetCallExpr.hpp>
+#include <ast/exprs/TemplateConstRefExpr.hpp>
+#include <ast/exprs/TemporaryValueRefExpr.hpp>
+#include <ast/exprs/TernaryExpr.hpp>
+#include <ast/exprs/TryExpr.hpp>
+#include <ast/exprs/TypeExpr.hpp>
+#include <ast/exprs/ValueLiteralExpr.hpp>
+#include <ast/exprs/VariableDeclExpr.hpp>
+#include <ast/exprs/VariableRefExpr.hpp>
+#include <ast/exprs/VTableFunctionReferenceExpr.hpp>
+#include <ast/exprs/WitnessFunctionReferenceExpr.hpp>
+
+namespace gulc {
+    /**
+     * `ASTVisitor` walks every `Decl`, `Stmt` and `Expr` of the processed AST (the AST as it is after `CodeProcessor`
+     * and `CodeTransformer`) using CRTP so every hook is resolved at compile time instead of through a `switch` and
+     * `dyn_cast` chain in every pass.
+     *
+     * A pass derives from `ASTVisitor<Pass>` and provides `bool visit(SomeNode* node)` for only the nodes it cares
+     * about. The hook is called before the children of the node are walked, returning `false` skips the children.
+     * `void endVisit(SomeDecl* decl)` is called after the children of an `ASTFile` or `Decl` were walked, passes use it
+     * to pop whatever state they pushed in `visit`.
+     *
+     * NOTES:
+     *  * Hooks are matched by the exact class of the node (e.g. `visit(FunctionDecl*)` isn't called for a
+     *    `PropertyGetDecl`), every class without a hook goes to the default `visit` that does nothing.
+     *  * Declaring any `visit` hides the default one, passes have to add `using ASTVisitor<Pass>::visit;` (the same
+     *    goes for `endVisit`)
+     *  * Protected hooks need `friend class ASTVisitor<Pass>;`
+     *  * Template declarations aren't walked, only their instantiations are. Passes that run before `DeclInstantiator`
+     *    set `walksParsedAST` instead, then the templates themselves, trait members and enum cases are walked as they
+     *    were parsed. Contracts are left to those passes, they belong to the scope around the declaration.
+     */
+    template<typename Derived>
+    class ASTVisitor {
+    public:
+        static constexpr bool walksParsedAST = false;
+
+        void traverseFiles(std::vector<ASTFile>& files) {
+            for (ASTFile& file : files) {
+                if (derived().visit(&file)) {
+                    for (Decl* decl : file.declarations) {
+                        traverseDecl(decl);
+                    }
+
+                    derived().endVisit(&file);
+                }
+            }
+        }
+
+        void traverseDecl(Decl* decl) {
+            switch (decl->getDeclKind()) {
+                case Decl::Kind::CallOperator:
+                    traverseFunctionDecl(llvm::dyn_cast<CallOperatorDecl>(decl));
+                    break;
+                case Decl::Kind::Constructor:
+                    traverseFunctionDecl(llvm::dyn_cast<ConstructorDecl>(decl));
+                    break;
+                case Decl::Kind::Destructor:
+                    traverseFunctionDecl(llvm::dyn_cast<DestructorDecl>(decl));
+                    break;
+                case Decl::Kind::Enum: {
+                    auto enumDecl = llvm::dyn_cast<EnumDecl>(decl);
+
+                    if (derived().visit(enumDecl)) {
+                        if constexpr (Derived::walksParsedAST) {
+                            for (EnumConstDecl* enumConst : enumDecl->enumConsts()) {
+                                traverseDecl(enumConst);
+                            }
+                        }
+
+                        for (Decl* member : enumDecl->ownedMembers()) {
+                            traverseDecl(member);
+                        }
+
+                        derived().endVisit(enumDecl);
+                    }
+
+                    break;
+                }
+                case Decl::Kind::EnumConst: {
+                    auto enumConstDecl = llvm::dyn_cast<EnumConstDecl>(decl);
+
+                    if (derived().visit(enumConstDecl) && enumConstDecl->constValue != nullptr) {
+                        traverseExpr(enumConstDecl->constValue);
+                    }
+
+                    break;
+                }
+                case Decl::Kind::Extension: {
+                    auto extensionDecl = llvm::dyn_cast<ExtensionDecl>(decl);
+
+                    if (derived().visit(extensionDecl)) {
+                        for (ConstructorDecl* constructor : extensionDecl->constructors()) {
+                            traverseDecl(constructor);
+                        }
+
+                        for (Decl* member : extensionDecl->ownedMembers()) {
+                            traverseDecl(member);
+                        }
+
+                        derived().endVisit(extensionDecl);
+                    }
+
+                    break;
+                }
+                case Decl::Kind::Function:
+                    traverseFunctionDecl(llvm::dyn_cast<FunctionDecl>(decl));
+                    break;
+                case Decl::Kind::Namespace: {
+                    auto namespaceDecl = llvm::dyn_cast<NamespaceDecl>(decl);
+
+                    if (derived().visit(namespaceDecl)) {
+                        for (Decl* nestedDecl : namespaceDecl->nestedDecls()) {
+                            traverseDecl(nestedDecl);
+                        }
+
+                        derived().endVisit(namespaceDecl);
+                    }
+
+                    break;
+                }
+                case Decl::Kind::Operator:
+                    traverseFunctionDecl(llvm::dyn_cast<OperatorDecl>(decl));
+                    break;
+                case Decl::Kind::Parameter: {
+                    auto parameterDecl = llvm::dyn_cast<ParameterDecl>(decl);
+
+                    if (derived().visit(parameterDecl) && parameterDecl->defaultValue != nullptr) {
+                        traverseExpr(parameterDecl->defaultValue);
+                    }
+
+                    break;
+                }
+                case Decl::Kind::Property: {
+                    auto propertyDecl = llvm::dyn_cast<PropertyDecl>(decl);
+
+                    if (derived().visit(propertyDecl)) {
+                        for (PropertyGetDecl* getter : propertyDecl->getters()) {
+                            traverseFunctionDecl(getter);
+                        }
+
+                        if (propertyDecl->hasSetter()) {
+                            traverseFunctionDecl(propertyDecl->setter());
+                        }
+
+                        derived().endVisit(propertyDecl);
+                    }
+
+                    break;
+                }
+                case Decl::Kind::PropertyGet:
+                    traverseFunctionDecl(llvm::dyn_cast<PropertyGetDecl>(decl));
+                    break;
+                case Decl::Kind::PropertySet:
+                    traverseFunctionDecl(llvm::dyn_cast<PropertySetDecl>(decl));
+                    break;
+                case Decl::Kind::TemplateStructInst:
+                case Decl::Kind::Struct:
+                    traverseStructDecl(llvm::dyn_cast<StructDecl>(decl));
+                    break;
+                case Decl::Kind::SubscriptOperator: {
+                    auto subscriptOperatorDecl = llvm::dyn_cast<SubscriptOperatorDecl>(decl);
+
+                    if (derived().visit(subscriptOperatorDecl)) {
+                        for (ParameterDecl* parameter : subscriptOperatorDecl->parameters()) {
+                            traverseDecl(parameter);
+                        }
+
+                        for (SubscriptOperatorGetDecl* getter : subscriptOperatorDecl->getters()) {
+                            traverseFunctionDecl(getter);
+                        }
+
+                        if (subscriptOperatorDecl->hasSetter()) {
+                            traverseFunctionDecl(subscriptOperatorDecl->setter());
+                        }
+
+                        derived().endVisit(subscriptOperatorDecl);
+                    }
+
+                    break;
+                }
+                case Decl::Kind::SubscriptOperatorGet:
+                    traverseFunctionDecl(llvm::dyn_cast<SubscriptOperatorGetDecl>(decl));
+                    break;
+                case Decl::Kind::SubscriptOperatorSet:
+                    traverseFunctionDecl(llvm::dyn_cast<SubscriptOperatorSetDecl>(decl));
+                    break;
+                case Decl::Kind::TemplateFunction: {
+                    auto templateFunctionDecl = llvm::dyn_cast<TemplateFunctionDecl>(decl);
+
+                    if constexpr (Derived::walksParsedAST) {
+                        traverseFunctionDecl(templateFunctionDecl);
+                    } else if (derived().visit(templateFunctionDecl)) {
+                        for (TemplateFunctionInstDecl* templateFunctionInst :
+                                templateFunctionDecl->templateInstantiations()) {
+                            traverseDecl(templateFunctionInst);
+                        }
+
+                        derived().endVisit(templateFunctionDecl);
+                    }
+
+                    break;
+                }
+                case Decl::Kind::TemplateFunctionInst:
+                    traverseFunctionDecl(llvm::dyn_cast<TemplateFunctionInstDecl>(decl));
+                    break;
+                case Decl::Kind::TemplateStruct: {
+                    auto templateStructDecl = llvm::dyn_cast<TemplateStructDecl>(decl);
+
+                    if constexpr (Derived::walksParsedAST) {
+                        traverseStructDecl(templateStructDecl);
+                    } else if (derived().visit(templateStructDecl)) {
+                        for (TemplateStructInstDecl* templateStructInst :
+                                templateStructDecl->templateInstantiations()) {
+                            traverseDecl(templateStructInst);
+                        }
+
+                        derived().endVisit(templateStructDecl);
+                    }
+
+                    break;
+                }
+                case Decl::Kind::TemplateTrait: {
+                    auto templateTraitDecl = llvm::dyn_cast<TemplateTraitDecl>(decl);
+
+                    if constexpr (Derived::walksParsedAST) {
+                        traverseTraitDecl(templateTraitDecl);
+                    } else if (derived().visit(templateTraitDecl)) {
+                        for (TemplateTraitInstDecl* templateTraitInst : templateTraitDecl->templateInstantiations()) {
+                            traverseDecl(templateTraitInst);
+                        }
+
+                        derived().endVisit(templateTraitDecl);
+                    }
+
+                    break;
+                }
+                case Decl::Kind::TemplateTraitInst:
+                case Decl::Kind::Trait:
+                    traverseTraitDecl(llvm::dyn_cast<TraitDecl>(decl));
+                    break;
+                case Decl::Kind::TraitPrototype:
+                    derived().visit(llvm::dyn_cast<TraitPrototypeDecl>(decl));
+                    break;
+                case Decl::Kind::TypeAlias:
+                    derived().visit(llvm::dyn_cast<TypeAliasDecl>(decl));
+                    break;
+                case Decl::Kind::TypeSuffix:
+                    traverseFunctionDecl(llvm::dyn_cast<TypeSuffixDecl>(decl));
+                    break;
+                case Decl::Kind::Variable: {
+                    auto variableDecl = llvm::dyn_cast<VariableDecl>(decl);
+
+                    if (derived().visit(variableDecl) && variableDecl->initialValue != nullptr) {
+                        traverseExpr(variableDecl->initialValue);
+                    }
+
+                    break;
+                }
+                default:
+                    // Imports, template parameters, etc. don't contain anything to walk
+                    derived().visit(decl);
+                    break;
+            }
+        }
+
+        void traverseStmt(Stmt* stmt) {
+            if (stmt == nullptr) {
+                return;
+            }
+
+            if (stmt->getStmtKind() == Stmt::Kind::Expr) {
+                traverseExpr(llvm::dyn_cast<Expr>(stmt));
+                return;
+            }
+
+            for (VariableDeclExpr* temporaryValue : stmt->temporaryValues) {
+                traverseExpr(temporaryValue);
+            }
+
+            switch (stmt->getStmtKind()) {
+                case Stmt::Kind::Break: {
+                    auto breakStmt = llvm::dyn_cast<BreakStmt>(stmt);
+
+                    if (derived().visit(breakStmt)) {
+                        traverseExprs(breakStmt->preBreakDeferred);
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::Case: {
+                    auto caseStmt = llvm::dyn_cast<CaseStmt>(stmt);
+
+                    if (derived().visit(caseStmt)) {
+                        if (caseStmt->condition != nullptr) {
+                            traverseExpr(caseStmt->condition);
+                        }
+
+                        for (Stmt* statement : caseStmt->body) {
+                            traverseStmt(statement);
+                        }
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::Catch: {
+                    auto catchStmt = llvm::dyn_cast<CatchStmt>(stmt);
+
+                    if (derived().visit(catchStmt)) {
+                        if (catchStmt->exceptionVariable != nullptr) {
+                            traverseExpr(catchStmt->exceptionVariable);
+                        }
+
+                        traverseStmt(catchStmt->body());
+
+                        for (ReturnCleanup& errorCleanup : catchStmt->errorCleanups) {
+                            traverseExpr(errorCleanup.destructExpr);
+                        }
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::Compound: {
+                    auto compoundStmt = llvm::dyn_cast<CompoundStmt>(stmt);
+
+                    if (derived().visit(compoundStmt)) {
+                        for (Stmt* statement : compoundStmt->statements) {
+                            traverseStmt(statement);
+                        }
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::Continue: {
+                    auto continueStmt = llvm::dyn_cast<ContinueStmt>(stmt);
+
+                    if (derived().visit(continueStmt)) {
+                        traverseExprs(continueStmt->preContinueDeferred);
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::Do: {
+                    auto doStmt = llvm::dyn_cast<DoStmt>(stmt);
+
+                    if (derived().visit(doStmt)) {
+                        traverseStmt(doStmt->body());
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::DoCatch: {
+                    auto doCatchStmt = llvm::dyn_cast<DoCatchStmt>(stmt);
+
+                    if (derived().visit(doCatchStmt)) {
+                        traverseStmt(doCatchStmt->body());
+
+                        for (CatchStmt* catchStmt : doCatchStmt->catchStatements()) {
+                            traverseStmt(catchStmt);
+                        }
+
+                        traverseStmt(doCatchStmt->finallyStatement());
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::Fallthrough:
+                    derived().visit(llvm::dyn_cast<FallthroughStmt>(stmt));
+                    break;
+                case Stmt::Kind::For: {
+                    auto forStmt = llvm::dyn_cast<ForStmt>(stmt);
+
+                    if (derived().visit(forStmt)) {
+                        if (forStmt->init != nullptr) {
+                            traverseExpr(forStmt->init);
+                        }
+
+                        if (forStmt->condition != nullptr) {
+                            traverseExpr(forStmt->condition);
+                        }
+
+                        if (forStmt->iteration != nullptr) {
+                            traverseExpr(forStmt->iteration);
+                        }
+
+                        traverseStmt(forStmt->body());
+                        traverseExprs(forStmt->postLoopCleanup);
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::Goto: {
+                    auto gotoStmt = llvm::dyn_cast<GotoStmt>(stmt);
+
+                    if (derived().visit(gotoStmt)) {
+                        traverseExprs(gotoStmt->preGotoDeferred);
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::If: {
+                    auto ifStmt = llvm::dyn_cast<IfStmt>(stmt);
+
+                    if (derived().visit(ifStmt)) {
+                        traverseExpr(ifStmt->condition);
+                        traverseStmt(ifStmt->trueBody());
+                        traverseStmt(ifStmt->falseBody());
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::Labeled: {
+                    auto labeledStmt = llvm::dyn_cast<LabeledStmt>(stmt);
+
+                    if (derived().visit(labeledStmt)) {
+                        traverseStmt(labeledStmt->labeledStmt);
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::RepeatWhile: {
+                    auto repeatWhileStmt = llvm::dyn_cast<RepeatWhileStmt>(stmt);
+
+                    if (derived().visit(repeatWhileStmt)) {
+                        traverseStmt(repeatWhileStmt->body());
+                        traverseExpr(repeatWhileStmt->condition);
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::Return: {
+                    auto returnStmt = llvm::dyn_cast<ReturnStmt>(stmt);
+
+                    if (derived().visit(returnStmt) && returnStmt->returnValue != nullptr) {
+                        traverseExpr(returnStmt->returnValue);
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::Switch: {
+                    auto switchStmt = llvm::dyn_cast<SwitchStmt>(stmt);
+
+                    if (derived().visit(switchStmt)) {
+                        traverseExpr(switchStmt->condition);
+
+                        for (CaseStmt* caseStmt : switchStmt->cases) {
+                            traverseStmt(caseStmt);
+                        }
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::Throw: {
+                    auto throwStmt = llvm::dyn_cast<ThrowStmt>(stmt);
+
+                    if (derived().visit(throwStmt) && throwStmt->thrownValue != nullptr) {
+                        traverseExpr(throwStmt->thrownValue);
+                    }
+
+                    break;
+                }
+                case Stmt::Kind::While: {
+                    auto whileStmt = llvm::dyn_cast<WhileStmt>(stmt);
+
+                    if (derived().visit(whileStmt)) {
+                        traverseExpr(whileStmt->condition);
+                        traverseStmt(whileStmt->body());
+                    }
+
+                    break;
+                }
+                default:
+                    derived().visit(stmt);
+                    break;
+            }
+        }
+
+        void traverseExpr(Expr* expr) {
+            switch (expr->getExprKind()) {
+                case Expr::Kind::ArrayLiteral: {
+                    auto arrayLiteralExpr = llvm::dyn_cast<ArrayLiteralExpr>(expr);
+
+                    if (derived().visit(arrayLiteralExpr)) {
+                        traverseExprs(arrayLiteralExpr->indexes);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::As: {
+                    auto asExpr = llvm::dyn_cast<AsExpr>(expr);
+
+                    if (derived().visit(asExpr)) {
+                        traverseExpr(asExpr->expr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::AssignmentOperator: {
+                    auto assignmentOperatorExpr = llvm::dyn_cast<AssignmentOperatorExpr>(expr);
+
+                    if (derived().visit(assignmentOperatorExpr)) {
+                        traverseExpr(assignmentOperatorExpr->leftValue);
+                        traverseExpr(assignmentOperatorExpr->rightValue);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::BoolLiteral:
+                    derived().visit(llvm::dyn_cast<BoolLiteralExpr>(expr));
+                    break;
+                case Expr::Kind::CallOperatorReference:
+                    derived().visit(llvm::dyn_cast<CallOperatorReferenceExpr>(expr));
+                    break;
+                case Expr::Kind::CheckExtendsType:
+                    derived().visit(llvm::dyn_cast<CheckExtendsTypeExpr>(expr));
+                    break;
+                case Expr::Kind::ConstructorCall: {
+                    auto constructorCallExpr = llvm::dyn_cast<ConstructorCallExpr>(expr);
+
+                    if (derived().visit(constructorCallExpr)) {
+                        if (constructorCallExpr->objectRef != nullptr) {
+                            traverseExpr(constructorCallExpr->objectRef);
+                        }
+
+                        traverseFunctionCallChildren(constructorCallExpr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::ConstructorReference:
+                    derived().visit(llvm::dyn_cast<ConstructorReferenceExpr>(expr));
+                    break;
+                case Expr::Kind::CurrentSelf:
+                    derived().visit(llvm::dyn_cast<CurrentSelfExpr>(expr));
+                    break;
+                case Expr::Kind::Delete: {
+                    auto deleteExpr = llvm::dyn_cast<DeleteExpr>(expr);
+
+                    if (derived().visit(deleteExpr)) {
+                        traverseExpr(deleteExpr->pointer);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::DestructorCall: {
+                    auto destructorCallExpr = llvm::dyn_cast<DestructorCallExpr>(expr);
+
+                    if (derived().visit(destructorCallExpr)) {
+                        if (destructorCallExpr->objectRef != nullptr) {
+                            traverseExpr(destructorCallExpr->objectRef);
+                        }
+
+                        traverseFunctionCallChildren(destructorCallExpr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::DestructorReference:
+                    derived().visit(llvm::dyn_cast<DestructorReferenceExpr>(expr));
+                    break;
+                case Expr::Kind::EnumConstRef:
+                    derived().visit(llvm::dyn_cast<EnumConstRefExpr>(expr));
+                    break;
+                case Expr::Kind::FlatArrayIndex: {
+                    auto flatArrayIndexExpr = llvm::dyn_cast<FlatArrayIndexExpr>(expr);
+
+                    if (derived().visit(flatArrayIndexExpr)) {
+                        traverseExpr(flatArrayIndexExpr->array);
+                        traverseExpr(flatArrayIndexExpr->index);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::FunctionCall: {
+                    auto functionCallExpr = llvm::dyn_cast<FunctionCallExpr>(expr);
+
+                    if (derived().visit(functionCallExpr)) {
+                        traverseFunctionCallChildren(functionCallExpr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::FunctionReference:
+                    derived().visit(llvm::dyn_cast<FunctionReferenceExpr>(expr));
+                    break;
+                case Expr::Kind::Has: {
+                    auto hasExpr = llvm::dyn_cast<HasExpr>(expr);
+
+                    if (derived().visit(hasExpr)) {
+                        traverseExpr(hasExpr->expr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::Identifier: {
+                    auto identifierExpr = llvm::dyn_cast<IdentifierExpr>(expr);
+
+                    if (derived().visit(identifierExpr)) {
+                        traverseExprs(identifierExpr->templateArguments());
+                    }
+
+                    break;
+                }
+                case Expr::Kind::ImaginaryRef:
+                    derived().visit(llvm::dyn_cast<ImaginaryRefExpr>(expr));
+                    break;
+                case Expr::Kind::ImplicitCast: {
+                    auto implicitCastExpr = llvm::dyn_cast<ImplicitCastExpr>(expr);
+
+                    if (derived().visit(implicitCastExpr)) {
+                        traverseExpr(implicitCastExpr->expr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::ImplicitDeref: {
+                    auto implicitDerefExpr = llvm::dyn_cast<ImplicitDerefExpr>(expr);
+
+                    if (derived().visit(implicitDerefExpr)) {
+                        traverseExpr(implicitDerefExpr->nestedExpr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::InfixOperator: {
+                    auto infixOperatorExpr = llvm::dyn_cast<InfixOperatorExpr>(expr);
+
+                    if (derived().visit(infixOperatorExpr)) {
+                        traverseExpr(infixOperatorExpr->leftValue);
+                        traverseExpr(infixOperatorExpr->rightValue);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::Is: {
+                    auto isExpr = llvm::dyn_cast<IsExpr>(expr);
+
+                    if (derived().visit(isExpr)) {
+                        traverseExpr(isExpr->expr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::LabeledArgument: {
+                    auto labeledArgumentExpr = llvm::dyn_cast<LabeledArgumentExpr>(expr);
+
+                    if (derived().visit(labeledArgumentExpr)) {
+                        traverseExpr(labeledArgumentExpr->argument);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::LocalVariableRef:
+                    derived().visit(llvm::dyn_cast<LocalVariableRefExpr>(expr));
+                    break;
+                case Expr::Kind::LValueToRValue: {
+                    auto lValueToRValueExpr = llvm::dyn_cast<LValueToRValueExpr>(expr);
+
+                    if (derived().visit(lValueToRValueExpr)) {
+                        traverseExpr(lValueToRValueExpr->lvalue);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::MemberAccessCall: {
+                    auto memberAccessCallExpr = llvm::dyn_cast<MemberAccessCallExpr>(expr);
+
+                    if (derived().visit(memberAccessCallExpr)) {
+                        traverseExpr(memberAccessCallExpr->objectRef);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::MemberFunctionCall: {
+                    auto memberFunctionCallExpr = llvm::dyn_cast<MemberFunctionCallExpr>(expr);
+
+                    if (derived().visit(memberFunctionCallExpr)) {
+                        if (memberFunctionCallExpr->selfArgument != nullptr) {
+                            traverseExpr(memberFunctionCallExpr->selfArgument);
+                        }
+
+                        traverseFunctionCallChildren(memberFunctionCallExpr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::MemberInfixOperatorCall: {
+                    auto memberInfixOperatorCallExpr = llvm::dyn_cast<MemberInfixOperatorCallExpr>(expr);
+
+                    if (derived().visit(memberInfixOperatorCallExpr)) {
+                        traverseExpr(memberInfixOperatorCallExpr->leftValue);
+                        traverseExpr(memberInfixOperatorCallExpr->rightValue);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::MemberPostfixOperatorCall: {
+                    auto memberPostfixOperatorCallExpr = llvm::dyn_cast<MemberPostfixOperatorCallExpr>(expr);
+
+                    if (derived().visit(memberPostfixOperatorCallExpr)) {
+                        traverseExpr(memberPostfixOperatorCallExpr->nestedExpr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::MemberPrefixOperatorCall: {
+                    auto memberPrefixOperatorCallExpr = llvm::dyn_cast<MemberPrefixOperatorCallExpr>(expr);
+
+                    if (derived().visit(memberPrefixOperatorCallExpr)) {
+                        traverseExpr(memberPrefixOperatorCallExpr->nestedExpr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::MemberPropertyRef: {
+                    auto memberPropertyRefExpr = llvm::dyn_cast<MemberPropertyRefExpr>(expr);
+
+                    if (derived().visit(memberPropertyRefExpr)) {
+                        traverseExpr(memberPropertyRefExpr->object);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::MemberSubscriptOperatorRef: {
+                    auto memberSubscriptOperatorRefExpr = llvm::dyn_cast<MemberSubscriptOperatorRefExpr>(expr);
+
+                    if (derived().visit(memberSubscriptOperatorRefExpr)) {
+                        traverseExpr(memberSubscriptOperatorRefExpr->object);
+                        traverseExprs(memberSubscriptOperatorRefExpr->arguments);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::MemberVariableRef: {
+                    auto memberVariableRefExpr = llvm::dyn_cast<MemberVariableRefExpr>(expr);
+
+                    if (derived().visit(memberVariableRefExpr)) {
+                        traverseExpr(memberVariableRefExpr->object);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::New: {
+                    auto newExpr = llvm::dyn_cast<NewExpr>(expr);
+
+                    if (derived().visit(newExpr)) {
+                        traverseExpr(newExpr->initializer);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::ParameterRef:
+                    derived().visit(llvm::dyn_cast<ParameterRefExpr>(expr));
+                    break;
+                case Expr::Kind::Paren: {
+                    auto parenExpr = llvm::dyn_cast<ParenExpr>(expr);
+
+                    if (derived().visit(parenExpr)) {
+                        traverseExpr(parenExpr->nestedExpr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::PostfixOperator: {
+                    auto postfixOperatorExpr = llvm::dyn_cast<PostfixOperatorExpr>(expr);
+
+                    if (derived().visit(postfixOperatorExpr)) {
+                        traverseExpr(postfixOperatorExpr->nestedExpr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::PrefixOperator: {
+                    auto prefixOperatorExpr = llvm::dyn_cast<PrefixOperatorExpr>(expr);
+
+                    if (derived().visit(prefixOperatorExpr)) {
+                        traverseExpr(prefixOperatorExpr->nestedExpr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::PropertyGetCall: {
+                    auto propertyGetCallExpr = llvm::dyn_cast<PropertyGetCallExpr>(expr);
+
+                    if (derived().visit(propertyGetCallExpr)) {
+                        traverseExpr(propertyGetCallExpr->propertyReference);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::PropertyRef:
+                    derived().visit(llvm::dyn_cast<PropertyRefExpr>(expr));
+                    break;
+                case Expr::Kind::PropertySetCall: {
+                    auto propertySetCallExpr = llvm::dyn_cast<PropertySetCallExpr>(expr);
+
+                    if (derived().visit(propertySetCallExpr)) {
+                        traverseExpr(propertySetCallExpr->propertyReference);
+                        traverseExpr(propertySetCallExpr->value);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::Ref: {
+                    auto refExpr = llvm::dyn_cast<RefExpr>(expr);
+
+                    if (derived().visit(refExpr)) {
+                        traverseExpr(refExpr->nestedExpr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::RValueToInRef: {
+                    auto rvalueToInRefExpr = llvm::dyn_cast<RValueToInRefExpr>(expr);
+
+                    if (derived().visit(rvalueToInRefExpr)) {
+                        traverseExpr(rvalueToInRefExpr->rvalue);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::SimdBuiltInCall: {
+                    auto simdBuiltInCallExpr = llvm::dyn_cast<SimdBuiltInCallExpr>(expr);
+
+                    if (derived().visit(simdBuiltInCallExpr)) {
+                        traverseExprs(simdBuiltInCallExpr->arguments);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::SolvedConst: {
+                    auto solvedConstExpr = llvm::dyn_cast<SolvedConstExpr>(expr);
+
+                    // NOTE: `original` is only kept for error messages, `CodeGen` only ever sees the `solution`
+                    if (derived().visit(solvedConstExpr)) {
+                        traverseExpr(solvedConstExpr->solution);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::StoreTemporaryValue: {
+                    auto storeTemporaryValueExpr = llvm::dyn_cast<StoreTemporaryValueExpr>(expr);
+
+                    if (derived().visit(storeTemporaryValueExpr)) {
+                        traverseExpr(storeTemporaryValueExpr->storeValue);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::StructAssignmentOperator: {
+                    auto structAssignmentOperatorExpr = llvm::dyn_cast<StructAssignmentOperatorExpr>(expr);
+
+                    if (derived().visit(structAssignmentOperatorExpr)) {
+                        traverseExpr(structAssignmentOperatorExpr->leftValue);
+                        traverseExpr(structAssignmentOperatorExpr->rightValue);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::SubscriptCall: {
+                    auto subscriptCallExpr = llvm::dyn_cast<SubscriptCallExpr>(expr);
+
+                    if (derived().visit(subscriptCallExpr)) {
+                        traverseExpr(subscriptCallExpr->subscriptReference);
+                        traverseExprs(subscriptCallExpr->arguments);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::SubscriptOperatorGetCall: {
+                    auto subscriptOperatorGetCallExpr = llvm::dyn_cast<SubscriptOperatorGetCallExpr>(expr);
+
+                    if (derived().visit(subscriptOperatorGetCallExpr)) {
+                        traverseExpr(subscriptOperatorGetCallExpr->subscriptOperatorReference);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::SubscriptOperatorRef: {
+                    auto subscriptOperatorRefExpr = llvm::dyn_cast<SubscriptOperatorRefExpr>(expr);
+
+                    if (derived().visit(subscriptOperatorRefExpr)) {
+                        traverseExprs(subscriptOperatorRefExpr->arguments);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::SubscriptOperatorSetCall: {
+                    auto subscriptOperatorSetCallExpr = llvm::dyn_cast<SubscriptOperatorSetCallExpr>(expr);
+
+                    if (derived().visit(subscriptOperatorSetCallExpr)) {
+                        traverseExpr(subscriptOperatorSetCallExpr->subscriptOperatorReference);
+                        traverseExpr(subscriptOperatorSetCallExpr->value);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::TemplateConstRef:
+                    derived().visit(llvm::dyn_cast<TemplateConstRefExpr>(expr));
+                    break;
+                case Expr::Kind::TemporaryValueRef:
+                    derived().visit(llvm::dyn_cast<TemporaryValueRefExpr>(expr));
+                    break;
+                case Expr::Kind::Ternary: {
+                    auto ternaryExpr = llvm::dyn_cast<TernaryExpr>(expr);
+
+                    if (derived().visit(ternaryExpr)) {
+                        traverseExpr(ternaryExpr->condition);
+                        traverseExpr(ternaryExpr->trueExpr);
+                        traverseExpr(ternaryExpr->falseExpr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::Try: {
+                    auto tryExpr = llvm::dyn_cast<TryExpr>(expr);
+
+                    if (derived().visit(tryExpr)) {
+                        traverseExpr(tryExpr->nestedExpr);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::Type:
+                    derived().visit(llvm::dyn_cast<TypeExpr>(expr));
+                    break;
+                case Expr::Kind::ValueLiteral:
+                    derived().visit(llvm::dyn_cast<ValueLiteralExpr>(expr));
+                    break;
+                case Expr::Kind::VariableDecl: {
+                    auto variableDeclExpr = llvm::dyn_cast<VariableDeclExpr>(expr);
+
+                    if (derived().visit(variableDeclExpr) && variableDeclExpr->initialValue != nullptr) {
+                        traverseExpr(variableDeclExpr->initialValue);
+                    }
+
+                    break;
+                }
+                case Expr::Kind::VariableRef:
+                    derived().visit(llvm::dyn_cast<VariableRefExpr>(expr));
+                    break;
+                case Expr::Kind::VTableFunctionReference:
+                    derived().visit(llvm::dyn_cast<VTableFunctionReferenceExpr>(expr));
+                    break;
+                case Expr::Kind::WitnessFunctionReference:
+                    derived().visit(llvm::dyn_cast<WitnessFunctionReferenceExpr>(expr));
+                    break;
+                default:
+                    derived().visit(expr);
+                    break;
+            }
+        }
+
+        /// The default hook for every node the derived pass doesn't handle, does nothing and walks the children
+        template<typename T>
+        bool visit(T*) { return true; }
+
+        template<typename T>
+        void endVisit(T*) {}
+
+    protected:
+        Derived& derived() { return *static_cast<Derived*>(this); }
+
+        template<typename T>
+        void traverseStructDecl(T* structDecl) {
+            if (!derived().visit(structDecl)) {
+                return;
+            }
+
+            for (ConstructorDecl* constructor : structDecl->constructors()) {
+                traverseDecl(constructor);
+            }
+
+            if (structDecl->destructor != nullptr) {
+                traverseDecl(structDecl->destructor);
+            }
+
+            for (Decl* member : structDecl->ownedMembers()) {
+                traverseDecl(member);
+            }
+
+            derived().endVisit(structDecl);
+        }
+
+        template<typename T>
+        void traverseTraitDecl(T* traitDecl) {
+            if (!derived().visit(traitDecl)) {
+                return;
+            }
+
+            // NOTE: Trait members are only prototypes until default implementations are supported, only the front end
+            //       has anything to do with them
+            if constexpr (Derived::walksParsedAST) {
+                for (Decl* member : traitDecl->ownedMembers()) {
+                    traverseDecl(member);
+                }
+            }
+
+            derived().endVisit(traitDecl);
+        }
+
+        template<typename T>
+        void traverseFunctionDecl(T* functionDecl) {
+            if (!derived().visit(functionDecl)) {
+                return;
+            }
+
+            for (ParameterDecl* parameter : functionDecl->parameters()) {
+                traverseDecl(parameter);
+            }
+
+            if constexpr (!Derived::walksParsedAST) {
+                for (Cont* contract : functionDecl->contracts()) {
+                    if (auto requiresCont = llvm::dyn_cast<RequiresCont>(contract)) {
+                        traverseExpr(requiresCont->condition);
+                    } else if (auto ensuresCont = llvm::dyn_cast<EnsuresCont>(contract)) {
+                        traverseExpr(ensuresCont->condition);
+                    }
+                }
+            }
+
+            if (auto constructorDecl = llvm::dyn_cast<ConstructorDecl>(functionDecl)) {
+                if (constructorDecl->baseConstructorCall != nullptr) {
+                    traverseExpr(constructorDecl->baseConstructorCall);
+                }
+            }
+
+            // NOTE: Template members that were never referenced don't have a body of their own
+            if (functionDecl->body() != nullptr) {
+                traverseStmt(functionDecl->body());
+            }
+
+            for (ReturnCleanup& returnCleanup : functionDecl->returnCleanups) {
+                traverseExpr(returnCleanup.destructExpr);
+            }
+
+            derived().endVisit(functionDecl);
+        }
+
+        void traverseFunctionCallChildren(FunctionCallExpr* functionCallExpr) {
+            traverseExpr(functionCallExpr->functionReference);
+            traverseExprs(functionCallExpr->arguments);
+        }
+
+        template<typename T>
+        void traverseExprs(std::vector<T*>& exprs) {
+            for (T* expr : exprs) {
+                traverseExpr(expr);
+            }
+        }
+
+    };
+
+    /**
+     * Runs several `ASTVisitor` passes in a single walk of the AST, every node is handed to each pass in the order the
+     * passes are listed before any children are walked and `endVisit` is handed to them in the same order. The
+     * children of a node are walked if any of the passes asks for them.
+     *
+     * A pass must not need the result of a later pass for any node, nor the result of any pass for a node that comes
+     * later in the walk. The passes have to agree on `walksParsedAST` and need `template<typename...> friend class
+     * FusedASTVisitor;` if their hooks are protected.
+     */
+    template<typename... Visitors>
+    class FusedASTVisitor : public ASTVisitor<FusedASTVisitor<Visitors...>> {
+    public:
+        static constexpr bool walksParsedAST = (Visitors::walksParsedAST || ...);
+        static_assert(((Visitors::walksParsedAST == walksParsedAST) && ...),
+                      "fused passes must all walk the same AST");
+
+        explicit FusedASTVisitor(Visitors&... visitors)
+                : _visitors(visitors...) {}
+
+        template<typename T>
+        bool visit(T* node) {
+            bool visitChildren = false;
+
+            std::apply([&](auto&... visitors) {
+                ((visitChildren = visitors.visit(node) || visitChildren), ...);
+            }, _visitors);
+
+            return visitChildren;
+        }
+
+        template<typename T>
+        void endVisit(T* node) {
+            std::apply([&](auto&... visitors) {
+                (visitors.endVisit(node), ...);
+            }, _visitors);
+        }
+
+    protected:
+        std::tuple<Visitors&...> _visitors;
+
+    };
+}
+
+#endif //GULC_ASTVISITOR_HPP
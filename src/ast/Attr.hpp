@@ -32,7 +32,11 @@ namespace gulc {
             // An unresolved attribute. Could be `pod` or something custom
             Unresolved,
 
-            Pod
+            Pod,
+            Soa,
+            FunctionHint,
+            BranchHint,
+            Dyn
         };
 
         Attr::Kind getAttrKind() const { return _attrKind; }
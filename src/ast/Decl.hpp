@@ -98,6 +98,7 @@ namespace gulc {
         Identifier const& identifier() const { return _identifier; }
         // `const` in GUL, `constexpr` in ulang
         bool isConstExpr() const { return _isConstExpr; }
+        DeclModifiers declModifiers() const { return _declModifiers; }
 
         virtual Decl* deepCopy() const = 0;
         virtual std::string getPrototypeString() const = 0;
@@ -108,6 +109,17 @@ namespace gulc {
             _attributes = std::move(attributes);
         }
 
+        // NOTE: Only resolved attributes will be found, `UnresolvedAttr` will always return false
+        bool hasAttr(Attr::Kind attrKind) const {
+            for (Attr const* attribute : _attributes) {
+                if (attribute->getAttrKind() == attrKind) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
         bool isStatic() const { return (_declModifiers & DeclModifiers::Static) == DeclModifiers::Static; }
         bool isMutable() const { return (_declModifiers & DeclModifiers::Mut) == DeclModifiers::Mut; }
         bool isVolatile() const { return (_declModifiers & DeclModifiers::Volatile) == DeclModifiers::Volatile; }
@@ -123,23 +135,31 @@ namespace gulc {
         std::string const& mangledName() const { return _mangledName; }
         void setMangledName(std::string mangledName) { _mangledName = std::move(mangledName); }
 
+    protected:
+        // NOTE: The members are ordered to avoid padding, `_declKind` fits in the padding at the end of `Node` and the
+        //       flags are packed together with the other small members.
+        Kind _declKind;
+
+    public:
         // The namespace, struct, trait, etc. that the Decl is contained within. Null when contained in a file.
         Decl* container;
+        // If the decl has been copied then this will point to the original decl that was copied
+        Decl const* originalDecl;
         // True if the container or the container of the container (ad infinitum) is a template
         // The reason we need this is because a `StructDecl` (or any other Decl type) contained in any way within a
         // template will always be unique to the template instantiation. (`Example<i32>::Type` != `Example<i8>::Type`)
-        bool containedInTemplate;
-        // If the decl has been copied then this will point to the original decl that was copied
-        Decl const* originalDecl;
+        bool containedInTemplate : 1;
+        // Set to false by `DeadDeclEliminator` when nothing reachable from `main`, the exported API or an `extern`
+        // references this decl. `CodeGen` never generates unreachable decls.
+        bool isReachable : 1;
 
     protected:
-        Kind _declKind;
+        bool _isConstExpr : 1;
+        Visibility _declVisibility;
+        DeclModifiers _declModifiers;
         unsigned int _sourceFileID;
         std::vector<Attr*> _attributes;
-        Visibility _declVisibility;
         Identifier _identifier;
-        bool _isConstExpr;
-        DeclModifiers _declModifiers;
         std::string _mangledName;
 
         Decl(Kind declKind, unsigned int sourceFileID, std::vector<Attr*> attributes, Visibility declVisibility,
@@ -148,10 +168,10 @@ namespace gulc {
                        isConstExpr, std::move(identifier), declModifiers) {}
         Decl(Node::Kind nodeKind, Kind declKind, unsigned int sourceFileID, std::vector<Attr*> attributes,
              Visibility declVisibility, bool isConstExpr, Identifier identifier, DeclModifiers declModifiers)
-                : Node(nodeKind), container(nullptr), containedInTemplate(false), originalDecl(nullptr),
-                  _declKind(declKind), _declVisibility(declVisibility), _sourceFileID(sourceFileID),
-                  _attributes(std::move(attributes)), _isConstExpr(isConstExpr), _identifier(std::move(identifier)),
-                  _declModifiers(declModifiers) {}
+                : Node(nodeKind), _declKind(declKind), container(nullptr), originalDecl(nullptr),
+                  containedInTemplate(false), isReachable(true), _isConstExpr(isConstExpr),
+                  _declVisibility(declVisibility), _declModifiers(declModifiers), _sourceFileID(sourceFileID),
+                  _attributes(std::move(attributes)), _identifier(std::move(identifier)) {}
 
     };
 }
@@ -52,9 +52,11 @@ namespace gulc {
             ConstructorCall,
             ConstructorReference,
             CurrentSelf,
+            Delete,
             DestructorCall,
             DestructorReference,
             EnumConstRef,
+            FlatArrayIndex,
             FunctionCall,
             FunctionReference,
             Has,
@@ -75,6 +77,7 @@ namespace gulc {
             MemberPropertyRef,
             MemberSubscriptOperatorRef,
             MemberVariableRef,
+            New,
             ParameterRef,
             Paren,
             PostfixOperator,
@@ -84,6 +87,7 @@ namespace gulc {
             PropertySetCall,
             Ref,
             RValueToInRef,
+            SimdBuiltInCall,
             SolvedConst,
             StoreTemporaryValue,
             StructAssignmentOperator,
@@ -100,6 +104,7 @@ namespace gulc {
             VariableDecl,
             VariableRef,
             VTableFunctionReference,
+            WitnessFunctionReference,
         };
 
         Expr::Kind getExprKind() const { return _exprKind; }
@@ -16,3 +16,12 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 #include "Node.hpp"
+#include "SourceManager.hpp"
+
+unsigned int gulc::TextPosition::line() const {
+    return SourceManager::get().getLine(*this);
+}
+
+unsigned int gulc::TextPosition::column() const {
+    return SourceManager::get().getColumn(*this);
+}
@@ -19,16 +19,23 @@
 #define GULC_NODE_HPP
 
 namespace gulc {
+    /**
+     * A position within the source code, only the offset into the `SourceManager` is stored. The file, line and
+     * column are looked up on demand, they are only ever needed for diagnostics and there are far more positions
+     * created than there are diagnostics printed.
+     */
     struct TextPosition {
+        // `0` is an unknown position (i.e. a node created by a pass rather than parsed from a file)
         unsigned int index;
-        unsigned int line;
-        unsigned int column;
 
         TextPosition()
-                : index(0), line(0), column(0) {}
+                : index(0) {}
+
+        explicit TextPosition(unsigned int index)
+                : index(index) {}
 
-        TextPosition(unsigned int index, unsigned int line, unsigned int column)
-                : index(index), line(line), column(column) {}
+        unsigned int line() const;
+        unsigned int column() const;
     };
 
     /**
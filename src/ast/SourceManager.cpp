@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include "SourceManager.hpp"
+
+gulc::SourceManager& gulc::SourceManager::get() {
+    static SourceManager sourceManager;
+    return sourceManager;
+}
+
+unsigned int gulc::SourceManager::addFile(std::string filePath, std::string const& sourceCode) {
+    // The extra offset after the last character is the position of the file's EOF token
+    if (sourceCode.size() >= std::numeric_limits<unsigned int>::max() - _nextOffset) {
+        std::cout << "gulc error: source file `" << filePath << "` does not fit in the remaining source positions!"
+                  << std::endl;
+        std::exit(1);
+    }
+
+    SourceFile sourceFile;
+    sourceFile.filePath = std::move(filePath);
+    sourceFile.sourceCode = sourceCode;
+    sourceFile.startOffset = _nextOffset;
+    sourceFile.endOffset = _nextOffset + sourceCode.size();
+    sourceFile.lineStarts.push_back(0);
+
+    for (std::size_t i = 0; i < sourceCode.size(); ++i) {
+        if (sourceCode[i] == '\r') {
+            // `\r\n` is a single line break
+            if (i + 1 < sourceCode.size() && sourceCode[i + 1] == '\n') {
+                ++i;
+            }
+
+            sourceFile.lineStarts.push_back(i + 1);
+        } else if (sourceCode[i] == '\n') {
+            sourceFile.lineStarts.push_back(i + 1);
+        }
+    }
+
+    _nextOffset = sourceFile.endOffset + 1;
+    _files.push_back(std::move(sourceFile));
+
+    return _files.back().startOffset;
+}
+
+std::string const* gulc::SourceManager::getSourceCode(std::string const& filePath) const {
+    // The files being compiled are registered before any declarations loaded from module interfaces (which are
+    // registered under the path of the file they were exported from) so the first match is the file itself
+    for (SourceFile const& sourceFile : _files) {
+        if (sourceFile.filePath == filePath) {
+            return &sourceFile.sourceCode;
+        }
+    }
+
+    return nullptr;
+}
+
+std::string const& gulc::SourceManager::getFilePath(gulc::TextPosition position) const {
+    static std::string const unknownFilePath;
+
+    SourceFile const* sourceFile = findFile(position);
+
+    if (sourceFile == nullptr) {
+        return unknownFilePath;
+    }
+
+    return sourceFile->filePath;
+}
+
+unsigned int gulc::SourceManager::getFileOffset(gulc::TextPosition position) const {
+    SourceFile const* sourceFile = findFile(position);
+
+    if (sourceFile == nullptr) {
+        return 0;
+    }
+
+    return position.index - sourceFile->startOffset;
+}
+
+unsigned int gulc::SourceManager::getLine(gulc::TextPosition position) const {
+    SourceFile const* sourceFile = findFile(position);
+
+    if (sourceFile == nullptr) {
+        return 0;
+    }
+
+    return findLine(*sourceFile, position.index - sourceFile->startOffset) + 1;
+}
+
+unsigned int gulc::SourceManager::getColumn(gulc::TextPosition position) const {
+    SourceFile const* sourceFile = findFile(position);
+
+    if (sourceFile == nullptr) {
+        return 0;
+    }
+
+    unsigned int fileOffset = position.index - sourceFile->startOffset;
+    return fileOffset - sourceFile->lineStarts[findLine(*sourceFile, fileOffset)] + 1;
+}
+
+gulc::SourceManager::SourceFile const* gulc::SourceManager::findFile(gulc::TextPosition position) const {
+    // Find the last file that starts at or before `position`
+    auto foundFile = std::upper_bound(_files.begin(), _files.end(), position.index,
+                                      [](unsigned int index, SourceFile const& sourceFile) {
+                                          return index < sourceFile.startOffset;
+                                      });
+
+    if (foundFile == _files.begin()) {
+        return nullptr;
+    }
+
+    --foundFile;
+
+    if (position.index > foundFile->endOffset) {
+        return nullptr;
+    }
+
+    return &*foundFile;
+}
+
+std::size_t gulc::SourceManager::findLine(SourceFile const& sourceFile, unsigned int fileOffset) {
+    auto nextLine = std::upper_bound(sourceFile.lineStarts.begin(), sourceFile.lineStarts.end(), fileOffset);
+    return static_cast<std::size_t>(nextLine - sourceFile.lineStarts.begin()) - 1;
+}
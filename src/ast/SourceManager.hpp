@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_SOURCEMANAGER_HPP
+#define GULC_SOURCEMANAGER_HPP
+
+#include <string>
+#include <vector>
+#include "Node.hpp"
+
+namespace gulc {
+    /**
+     * Owner of the single offset space every `TextPosition` points into
+     *
+     * Each source file is given a contiguous range of offsets when it is registered (the first file starts at `1` so
+     * an offset of `0` is always an unknown position). A `TextPosition` is then only the offset, the file, line and
+     * column it refers to are looked up here when a diagnostic needs them.
+     *
+     * NOTE: Files have to be registered before any of their positions are looked up (`Parser` does this for both
+     *       lexed and cached sources)
+     */
+    class SourceManager {
+    public:
+        static SourceManager& get();
+
+        /// Registers `sourceCode` under `filePath`, returns the offset of its first character. The position of any
+        /// character within the file is that offset plus the index of the character within `sourceCode`.
+        unsigned int addFile(std::string filePath, std::string const& sourceCode);
+
+        /// Returns the source code `filePath` was registered with (the text every position within it points into),
+        /// `nullptr` if the file was never registered
+        std::string const* getSourceCode(std::string const& filePath) const;
+        /// Returns the path of the file `position` is within, empty for unknown positions
+        std::string const& getFilePath(TextPosition position) const;
+        /// Returns the index of `position` within the source code of its own file
+        unsigned int getFileOffset(TextPosition position) const;
+        /// Returns the 1-based line of `position`, `0` for unknown positions
+        unsigned int getLine(TextPosition position) const;
+        /// Returns the 1-based column of `position`, `0` for unknown positions
+        unsigned int getColumn(TextPosition position) const;
+
+    private:
+        struct SourceFile {
+            std::string filePath;
+            std::string sourceCode;
+            unsigned int startOffset;
+            // One past the last character of the file, the EOF token is positioned here
+            unsigned int endOffset;
+            // The offset of the first character of every line (relative to `startOffset`)
+            std::vector<unsigned int> lineStarts;
+        };
+
+        // Sorted by `startOffset` since offsets are handed out in the order files are added
+        std::vector<SourceFile> _files;
+        unsigned int _nextOffset = 1;
+
+        SourceFile const* findFile(TextPosition position) const;
+        // Returns the 0-based index of the line `fileOffset` is on
+        static std::size_t findLine(SourceFile const& sourceFile, unsigned int fileOffset);
+
+    };
+}
+
+#endif //GULC_SOURCEMANAGER_HPP
@@ -49,6 +49,7 @@ namespace gulc {
             RepeatWhile,
             Return,
             Switch,
+            Throw,
             While,
         };
 
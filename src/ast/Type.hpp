@@ -40,6 +40,7 @@ namespace gulc {
             Pointer,
             Reference,
             Self,
+            Simd,
             Struct,
             Templated,
             TemplateStruct,
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_BRANCHHINTATTR_HPP
+#define GULC_BRANCHHINTATTR_HPP
+
+#include <ast/Attr.hpp>
+
+namespace gulc {
+    /**
+     * `@likely` and `@unlikely` on an `if` statement. The hint is for the `if` condition being `true`, it is lowered
+     * to branch weights on the conditional branch the same as `__builtin_expect` would be.
+     *
+     *     @unlikely
+     *     if errorCode != 0 {
+     *         ...
+     *     }
+     */
+    class BranchHintAttr : public Attr {
+    public:
+        static bool classof(const Attr* attr) { return attr->getAttrKind() == Attr::Kind::BranchHint; }
+
+        BranchHintAttr(bool isLikely, TextPosition startPosition, TextPosition endPosition)
+                : Attr(Attr::Kind::BranchHint, startPosition, endPosition), _isLikely(isLikely) {}
+
+        bool isLikely() const { return _isLikely; }
+
+        Attr* deepCopy() const override {
+            return new BranchHintAttr(_isLikely, _startPosition, _endPosition);
+        }
+
+    protected:
+        bool _isLikely;
+
+    };
+}
+
+#endif //GULC_BRANCHHINTATTR_HPP
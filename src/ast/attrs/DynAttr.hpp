@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_DYNATTR_HPP
+#define GULC_DYNATTR_HPP
+
+#include <ast/Attr.hpp>
+
+namespace gulc {
+    /**
+     * The `@dyn` attribute tells the compiler to compile a trait constrained template function once using trait
+     * objects instead of creating a copy of the function for every type it is called with. Every typename parameter
+     * of a `@dyn` function is replaced with the single trait it is constrained to and calls within the function are
+     * dispatched through that trait's witness table. This trades a small indirect call cost for less generated code.
+     */
+    class DynAttr : public Attr {
+    public:
+        static bool classof(const Attr* attr) { return attr->getAttrKind() == Attr::Kind::Dyn; }
+
+        DynAttr(TextPosition startPosition, TextPosition endPosition)
+                : Attr(Attr::Kind::Dyn, startPosition, endPosition) {}
+
+        Attr* deepCopy() const override {
+            return new DynAttr(_startPosition, _endPosition);
+        }
+
+    };
+}
+
+#endif //GULC_DYNATTR_HPP
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_FUNCTIONHINTATTR_HPP
+#define GULC_FUNCTIONHINTATTR_HPP
+
+#include <ast/Attr.hpp>
+#include <string>
+
+namespace gulc {
+    /**
+     * Optimizer hints for functions, operators, properties, and subscripts. Each hint maps directly onto the LLVM
+     * function attribute of the same purpose:
+     *
+     *     `@inline`   -> `alwaysinline`
+     *     `@noinline` -> `noinline`
+     *     `@cold`     -> `cold`
+     *     `@hot`      -> `hot` + `.text.hot` section
+     *     `@flatten`  -> every direct call within the function body is marked `alwaysinline`
+     *     `@minsize`  -> `minsize` + `optsize`
+     *
+     * When applied to a property or subscript the hint applies to every `get` and `set` within it.
+     */
+    class FunctionHintAttr : public Attr {
+    public:
+        static bool classof(const Attr* attr) { return attr->getAttrKind() == Attr::Kind::FunctionHint; }
+
+        enum class Hint {
+            Inline,
+            NoInline,
+            Cold,
+            Hot,
+            Flatten,
+            MinSize
+        };
+
+        FunctionHintAttr(Hint hint, TextPosition startPosition, TextPosition endPosition)
+                : Attr(Attr::Kind::FunctionHint, startPosition, endPosition), _hint(hint) {}
+
+        Hint hint() const { return _hint; }
+        std::string hintName() const {
+            switch (_hint) {
+                case Hint::Inline:
+                    return "inline";
+                case Hint::NoInline:
+                    return "noinline";
+                case Hint::Cold:
+                    return "cold";
+                case Hint::Hot:
+                    return "hot";
+                case Hint::Flatten:
+                    return "flatten";
+                case Hint::MinSize:
+                    return "minsize";
+            }
+
+            return "[UNKNOWN]";
+        }
+
+        Attr* deepCopy() const override {
+            return new FunctionHintAttr(_hint, _startPosition, _endPosition);
+        }
+
+    protected:
+        Hint _hint;
+
+    };
+}
+
+#endif //GULC_FUNCTIONHINTATTR_HPP
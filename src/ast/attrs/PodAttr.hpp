@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_PODATTR_HPP
+#define GULC_PODATTR_HPP
+
+#include <ast/Attr.hpp>
+
+namespace gulc {
+    /**
+     * The `@pod` attribute marks a struct as "plain old data". `@pod` structs keep the exact memory layout they are
+     * declared with (the same as C) so the compiler will NOT reorder their members to reduce padding.
+     */
+    class PodAttr : public Attr {
+    public:
+        static bool classof(const Attr* attr) { return attr->getAttrKind() == Attr::Kind::Pod; }
+
+        PodAttr(TextPosition startPosition, TextPosition endPosition)
+                : Attr(Attr::Kind::Pod, startPosition, endPosition) {}
+
+        Attr* deepCopy() const override {
+            return new PodAttr(_startPosition, _endPosition);
+        }
+
+    };
+}
+
+#endif //GULC_PODATTR_HPP
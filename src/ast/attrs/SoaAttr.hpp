@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_SOAATTR_HPP
+#define GULC_SOAATTR_HPP
+
+#include <ast/Attr.hpp>
+
+namespace gulc {
+    /**
+     * The `@soa` attribute makes flat arrays of a struct be stored as a "structure of arrays". Instead of storing each
+     * element one after the other every data member is stored in its own column (`[Particle; 64]` is stored as
+     * `{ [f32; 64], [f32; 64], ... }`). Accessing `particles[i].x` is rewritten to index into the `x` column so loops
+     * that only touch a few members of each element don't pull the unused members into the cache.
+     */
+    class SoaAttr : public Attr {
+    public:
+        static bool classof(const Attr* attr) { return attr->getAttrKind() == Attr::Kind::Soa; }
+
+        SoaAttr(TextPosition startPosition, TextPosition endPosition)
+                : Attr(Attr::Kind::Soa, startPosition, endPosition) {}
+
+        Attr* deepCopy() const override {
+            return new SoaAttr(_startPosition, _endPosition);
+        }
+
+    };
+}
+
+#endif //GULC_SOAATTR_HPP
@@ -19,33 +19,37 @@
 #define GULC_THROWSCONT_HPP
 
 #include <ast/Cont.hpp>
-#include <optional>
-#include <ast/Identifier.hpp>
+#include <ast/Type.hpp>
 
 namespace gulc {
     class ThrowsCont : public Cont {
     public:
         static bool classof(const Cont* cont) { return cont->getContKind() == Cont::Kind::Throws; }
 
+        // The type of the value carried by the error, `nullptr` for an untyped `throws`
+        // NOTE: Error values are passed back to the caller through a hidden error slot, they are never unwound
+        Type* exceptionType;
+
         ThrowsCont(TextPosition startPosition, TextPosition endPosition)
-                : Cont(Cont::Kind::Throws, startPosition, endPosition) {}
-        ThrowsCont(TextPosition startPosition, TextPosition endPosition, Identifier exceptionType)
                 : Cont(Cont::Kind::Throws, startPosition, endPosition),
-                  _exceptionType(exceptionType) {}
+                  exceptionType(nullptr) {}
+        ThrowsCont(TextPosition startPosition, TextPosition endPosition, Type* exceptionType)
+                : Cont(Cont::Kind::Throws, startPosition, endPosition),
+                  exceptionType(exceptionType) {}
 
-        bool hasExceptionType() const { return _exceptionType.has_value(); }
-        Identifier const& exceptionTypeIdentifier() const { return _exceptionType.value(); }
+        bool hasExceptionType() const { return exceptionType != nullptr; }
 
         Cont* deepCopy() const override {
-            if (_exceptionType.has_value()) {
-                return new ThrowsCont(_startPosition, _endPosition, _exceptionType.value());
+            if (exceptionType != nullptr) {
+                return new ThrowsCont(_startPosition, _endPosition, exceptionType->deepCopy());
             } else {
                 return new ThrowsCont(_startPosition, _endPosition);
             }
         }
 
-    protected:
-        std::optional<Identifier> _exceptionType;
+        ~ThrowsCont() override {
+            delete exceptionType;
+        }
 
     };
 }
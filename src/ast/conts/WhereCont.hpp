@@ -20,6 +20,8 @@
 
 #include <ast/Cont.hpp>
 #include <ast/Expr.hpp>
+#include <string>
+#include <unordered_map>
 
 namespace gulc {
     /**
@@ -31,6 +33,10 @@ namespace gulc {
         static bool classof(const Cont* cont) { return cont->getContKind() == Cont::Kind::Where; }
 
         Expr* condition;
+        // Results of `ContractUtil::checkWhereCont` keyed by the canonical key of the template arguments checked. Every
+        // use of a template checks its `where` contracts again so this keeps each distinct check to one evaluation.
+        // NOTE: This isn't copied by `deepCopy` as a copy belongs to different template parameters.
+        std::unordered_map<std::string, bool> solvedResults;
 
         WhereCont(Expr* condition, TextPosition startPosition, TextPosition endPosition)
                 : Cont(Cont::Kind::Where, startPosition, endPosition), condition(condition) {}
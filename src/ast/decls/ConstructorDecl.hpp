@@ -93,7 +93,7 @@ namespace gulc {
             auto result = new ConstructorDecl(_sourceFileID, copiedAttributes, _declVisibility, _isConstExpr,
                                               _identifier, _declModifiers, copiedParameters,
                                               copiedBaseConstructorCall, copiedContracts,
-                                              llvm::dyn_cast<CompoundStmt>(_body->deepCopy()),
+                                              copyBody(),
                                               _startPosition, _endPosition, _constructorType);
             result->container = container;
             result->containedInTemplate = containedInTemplate;
@@ -49,7 +49,7 @@ namespace gulc {
 
             auto result = new DestructorDecl(_sourceFileID, copiedAttributes, _declVisibility, _isConstExpr,
                                              _identifier, _declModifiers, copiedContracts,
-                                             llvm::dyn_cast<CompoundStmt>(_body->deepCopy()),
+                                             copyBody(),
                                              _startPosition, _endPosition);
             result->container = container;
             result->containedInTemplate = containedInTemplate;
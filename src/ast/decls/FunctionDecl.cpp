@@ -20,6 +20,9 @@
 #include "TraitDecl.hpp"
 #include "PropertyDecl.hpp"
 #include "SubscriptOperatorDecl.hpp"
+#include "TemplateFunctionDecl.hpp"
+#include "TemplateStructDecl.hpp"
+#include "TemplateTraitDecl.hpp"
 
 bool gulc::FunctionDecl::isMemberFunction() const {
     if (container == nullptr) {
@@ -44,3 +47,31 @@ bool gulc::FunctionDecl::isMemberFunction() const {
 
     return false;
 }
+
+gulc::CompoundStmt* gulc::FunctionDecl::copyBody() const {
+    if (_body == nullptr) {
+        return _sharedBody == nullptr ? nullptr : llvm::dyn_cast<CompoundStmt>(_sharedBody->deepCopy());
+    }
+
+    // Template functions are templates of their own, their body always belongs to them
+    if (!llvm::isa<TemplateFunctionDecl>(this)) {
+        for (Decl const* checkContainer = container; checkContainer != nullptr;
+                checkContainer = checkContainer->container) {
+            if (llvm::isa<TemplateStructDecl>(checkContainer)) {
+                if (llvm::dyn_cast<TemplateStructDecl>(checkContainer)->isCopyingForInstantiation) {
+                    return nullptr;
+                }
+
+                break;
+            } else if (llvm::isa<TemplateTraitDecl>(checkContainer)) {
+                if (llvm::dyn_cast<TemplateTraitDecl>(checkContainer)->isCopyingForInstantiation) {
+                    return nullptr;
+                }
+
+                break;
+            }
+        }
+    }
+
+    return llvm::dyn_cast<CompoundStmt>(_body->deepCopy());
+}
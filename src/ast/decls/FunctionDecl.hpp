@@ -27,6 +27,8 @@
 #include <ast/conts/ThrowsCont.hpp>
 #include <llvm/Support/Casting.h>
 #include <ast/stmts/LabeledStmt.hpp>
+#include <ast/stmts/ReturnStmt.hpp>
+#include <ast/exprs/VariableDeclExpr.hpp>
 #include <map>
 #include "ParameterDecl.hpp"
 
@@ -38,7 +40,7 @@ namespace gulc {
 
             return kind == Decl::Kind::CallOperator || kind == Decl::Kind::Constructor ||
                    kind == Decl::Kind::Destructor || kind == Decl::Kind::Function || kind == Decl::Kind::Operator ||
-                   kind == Decl::Kind::TypeSuffix;
+                   kind == Decl::Kind::TemplateFunctionInst || kind == Decl::Kind::TypeSuffix;
         }
 
         Type* returnType;
@@ -52,14 +54,39 @@ namespace gulc {
                                isConstExpr, std::move(identifier), declModifiers, std::move(parameters),
                                returnType, std::move(contracts), body, startPosition, endPosition) {}
 
-        DeclModifiers declModifiers() const { return _declModifiers; }
         std::vector<ParameterDecl*>& parameters() { return _parameters; }
         std::vector<ParameterDecl*> const& parameters() const { return _parameters; }
         std::vector<Cont*>& contracts() { return _contracts; }
         std::vector<Cont*> const& contracts() const { return _contracts; }
         CompoundStmt* body() const { return _body; }
+        // Members of template instantiations share the body of the template they were copied from until the body is
+        // needed, `body()` is null until `materializeBody` is called.
+        // NOTE: The shared body is owned by the template and MUST NOT be modified
+        CompoundStmt const* sharedBody() const { return _sharedBody; }
+        void shareBody(CompoundStmt const* sharedBody) {
+            delete _body;
+            _body = nullptr;
+            _sharedBody = sharedBody;
+        }
+        void materializeBody() {
+            if (_body == nullptr && _sharedBody != nullptr) {
+                _body = copyBody();
+                _sharedBody = nullptr;
+            }
+        }
 
         bool throws() const { return _throws; }
+        // The type carried by `throws T`, `nullptr` for an untyped `throws` (or a function that doesn't throw)
+        Type* throwsType() const {
+            for (Cont* contract : _contracts) {
+                if (llvm::isa<ThrowsCont>(contract)) {
+                    return llvm::dyn_cast<ThrowsCont>(contract)->exceptionType;
+                }
+            }
+
+            return nullptr;
+        }
+
         bool hasContract() const { return !_contracts.empty(); }
 
         bool isMemberFunction() const;
@@ -96,7 +123,7 @@ namespace gulc {
             auto result = new FunctionDecl(_sourceFileID, copiedAttributes, _declVisibility, _isConstExpr,
                                            _identifier, _declModifiers, copiedParameters,
                                            copiedReturnType, copiedContracts,
-                                           llvm::dyn_cast<CompoundStmt>(_body->deepCopy()),
+                                           copyBody(),
                                            _startPosition, _endPosition);
             result->container = container;
             result->containedInTemplate = containedInTemplate;
@@ -129,13 +156,26 @@ namespace gulc {
                 delete contract;
             }
 
+            for (ReturnCleanup& returnCleanup : returnCleanups) {
+                delete returnCleanup.destructExpr;
+            }
+
             delete returnType;
             delete _body;
         }
 
-        bool isInstantiated = false;
+        bool isInstantiated : 1;
+        // Member functions of template instantiations only have their signature instantiated up front, the body is
+        // instantiated and processed by `CodeProcessor` the first time the function is referenced. This is `false`
+        // until that happens (it is always `true` for functions that aren't contained within a template instantiation)
+        bool bodyIsInstantiated : 1;
         // These are already stored in `body()` so we don't have to free them again
         std::map<std::string, LabeledStmt*> labeledStmts;
+        // The cleanup chain shared by all `return` statements, this is filled by `CodeTransformer`
+        std::vector<ReturnCleanup> returnCleanups;
+        // If every `return` returns the same local variable then that variable is constructed directly in the return
+        // slot (NRVO). This is stored in `body()` so we don't free it.
+        VariableDeclExpr* namedReturnValue = nullptr;
 
     protected:
         FunctionDecl(Decl::Kind declKind, unsigned int sourceFileID, std::vector<Attr*> attributes,
@@ -145,8 +185,9 @@ namespace gulc {
                      TextPosition startPosition, TextPosition endPosition)
                 : Decl(declKind, sourceFileID, std::move(attributes), visibility, isConstExpr, std::move(identifier),
                        declModifiers),
-                  _parameters(std::move(parameters)), returnType(returnType),
-                  _contracts(std::move(contracts)), _body(body),
+                  isInstantiated(false), bodyIsInstantiated(true), _parameters(std::move(parameters)),
+                  returnType(returnType),
+                  _contracts(std::move(contracts)), _body(body), _sharedBody(nullptr),
                   _startPosition(startPosition), _endPosition(endPosition), _throws(false), _isMainEntry(false) {
             for (Cont* contract : _contracts) {
                 if (llvm::isa<ThrowsCont>(contract)) {
@@ -163,11 +204,16 @@ namespace gulc {
         std::vector<ParameterDecl*> _parameters;
         std::vector<Cont*> _contracts;
         CompoundStmt* _body;
+        CompoundStmt const* _sharedBody;
         TextPosition _startPosition;
         TextPosition _endPosition;
-        bool _throws;
+        bool _throws : 1;
         // TODO: We need to make this detection a little more advanced
-        bool _isMainEntry;
+        bool _isMainEntry : 1;
+
+        // Copies of a function sharing its body with a template get a body of their own. Copies made while the closest
+        // containing template is being instantiated get no body at all, they share the template's body instead.
+        CompoundStmt* copyBody() const;
 
     };
 }
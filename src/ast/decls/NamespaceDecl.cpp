@@ -15,13 +15,18 @@
  * with this program; if not, write to the Free Software Foundation, Inc.,
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
-#include <utilities/TypeCompareUtil.hpp>
 #include "NamespaceDecl.hpp"
 #include "ExtensionDecl.hpp"
 #include <parsing/ASTFile.hpp>
 
+void gulc::NamespaceDecl::indexTypeExtensions() {
+    _typeExtensionIndex.build(scopeExtensions);
+    _cachedTypeExtensions.clear();
+}
+
 std::vector<gulc::ExtensionDecl*>* gulc::NamespaceDecl::getTypeExtensions(ASTFile& scopeFile, const gulc::Type* forType) {
-    auto foundExtensions = _cachedTypeExtensions.find(forType);
+    std::string typeKey = TypeExtensionIndex::getTypeKey(forType);
+    auto foundExtensions = _cachedTypeExtensions.find(typeKey);
 
     if (foundExtensions == _cachedTypeExtensions.end()) {
         // The key doesn't already exist, we will have to generate the list...
@@ -52,21 +57,14 @@ std::vector<gulc::ExtensionDecl*>* gulc::NamespaceDecl::getTypeExtensions(ASTFil
             }
         }
 
-        TypeCompareUtil typeCompareUtil;
-
-        for (ExtensionDecl* checkExtension : scopeExtensions) {
-            if (typeCompareUtil.compareAreSameOrInherits(forType, checkExtension->typeToExtend)) {
-                typeExtensions.push_back(checkExtension);
-            }
-        }
+        _typeExtensionIndex.findExtensions(forType, typeExtensions);
 
-        if (typeExtensions.empty()) {
-            return nullptr;
-        } else {
-            _cachedTypeExtensions.insert({forType, typeExtensions});
+        // NOTE: We cache empty results as well, most types have no extensions at all
+        foundExtensions = _cachedTypeExtensions.insert({typeKey, std::move(typeExtensions)}).first;
+    }
 
-            return &_cachedTypeExtensions[forType];
-        }
+    if (foundExtensions->second.empty()) {
+        return nullptr;
     } else {
         return &foundExtensions->second;
     }
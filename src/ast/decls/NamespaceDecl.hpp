@@ -21,6 +21,7 @@
 #include <ast/Decl.hpp>
 #include <llvm/Support/Casting.h>
 #include <map>
+#include <utilities/TypeExtensionIndex.hpp>
 
 namespace gulc {
     class ExtensionDecl;
@@ -99,11 +100,6 @@ namespace gulc {
 
                 delete decl;
             }
-
-            // We own the types that are used as keys for the cached type extensions, we delete those here
-            for (auto const& cachedTypeIterator : _cachedTypeExtensions) {
-                delete cachedTypeIterator.first;
-            }
         }
 
         // We use this to give us a link to the actual namespace with ALL `nestedDecls` from all sources
@@ -111,6 +107,9 @@ namespace gulc {
         // All extensions within the current scope
         std::vector<ExtensionDecl*> scopeExtensions;
 
+        // Builds the `scopeExtensions` index, this has to be called after `DeclInstantiator` has resolved the
+        // extended types and before any calls to `getTypeExtensions`
+        void indexTypeExtensions();
         std::vector<ExtensionDecl*>* getTypeExtensions(ASTFile& scopeFile, Type const* forType);
 
     protected:
@@ -119,7 +118,9 @@ namespace gulc {
         std::vector<Decl*> _nestedDecls;
         // If this is true it means we only own a nested `Decl` if it is a namespace, all other cannot be deleted by us.
         bool _isPrototype;
-        std::map<Type const*, std::vector<ExtensionDecl*>> _cachedTypeExtensions;
+        TypeExtensionIndex _typeExtensionIndex;
+        // Keyed by `TypeExtensionIndex::getTypeKey` so separate `Type` allocations of the same type share results.
+        std::unordered_map<std::string, std::vector<ExtensionDecl*>> _cachedTypeExtensions;
 
     };
 }
@@ -81,7 +81,7 @@ namespace gulc {
             auto result = new OperatorDecl(_sourceFileID, copiedAttributes, _declVisibility, _isConstExpr,
                                            _operatorType, _operatorIdentifier, _declModifiers,
                                            copiedParameters, copiedReturnType, copiedContracts,
-                                           llvm::dyn_cast<CompoundStmt>(_body->deepCopy()),
+                                           copyBody(),
                                            _startPosition, _endPosition);
             result->container = container;
             result->containedInTemplate = containedInTemplate;
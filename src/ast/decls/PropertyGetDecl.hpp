@@ -60,7 +60,7 @@ namespace gulc {
             auto result = new PropertyGetDecl(_sourceFileID, copiedAttributes, _declVisibility, _isConstExpr,
                                               _identifier, _declModifiers,
                                               returnType->deepCopy(), copiedContracts,
-                                              llvm::dyn_cast<CompoundStmt>(_body->deepCopy()),
+                                              copyBody(),
                                               _startPosition, _endPosition, _getResult);
             result->container = container;
             result->containedInTemplate = containedInTemplate;
@@ -56,7 +56,7 @@ namespace gulc {
             auto result = new PropertySetDecl(_sourceFileID, copiedAttributes, _declVisibility, _isConstExpr,
                                               _identifier, _declModifiers,
                                               returnType->deepCopy(), copiedContracts,
-                                              llvm::dyn_cast<CompoundStmt>(_body->deepCopy()),
+                                              copyBody(),
                                               _startPosition, _endPosition);
             result->container = container;
             result->containedInTemplate = containedInTemplate;
@@ -21,11 +21,14 @@
 #include <ast/Decl.hpp>
 #include <ast/Type.hpp>
 #include <set>
+#include <map>
 #include "ConstructorDecl.hpp"
 #include "DestructorDecl.hpp"
 #include "VariableDecl.hpp"
 
 namespace gulc {
+    class TraitDecl;
+
     class StructDecl : public Decl {
     public:
         static bool classof(const Decl* decl) {
@@ -197,6 +200,9 @@ namespace gulc {
         std::vector<VariableDecl*> ownedPaddingMembers;
         std::size_t dataSizeWithoutPadding;
         std::size_t dataSizeWithPadding;
+        // The alignment of the struct, this is the target's struct alignment or the alignment of the most aligned
+        // member (e.g. a `simd` member), whichever is larger
+        std::size_t dataAlignment;
 
         // The virtual function table for this struct
         // NOTE: None of these need to be deleted as they are all stored in other lists that are deleted.
@@ -211,6 +217,10 @@ namespace gulc {
         //       the same way any other struct is added to the vtable. Constructing the `vtable` for a `trait` will be
         //       handled differently
         StructDecl* vtableOwner;
+        // The witness tables for every trait this struct has been converted to a trait object of, each list holds our
+        // implementations in the same order as `TraitDecl::witnessTable`
+        // NOTE: These are filled in as needed by `WitnessTableUtil`, none of the functions need to be deleted
+        std::map<TraitDecl const*, std::vector<FunctionDecl*>> witnessTables;
 
     protected:
         StructDecl(Decl::Kind declKind, unsigned int sourceFileID, std::vector<Attr*> attributes,
@@ -220,8 +230,9 @@ namespace gulc {
                    std::vector<ConstructorDecl*> constructors, DestructorDecl* destructor)
                 : Decl(declKind, sourceFileID, std::move(attributes), visibility, isConstExpr, std::move(identifier),
                        declModifiers),
+                  cachedDefaultConstructor(nullptr), cachedMoveConstructor(nullptr), cachedCopyConstructor(nullptr),
                   containerTemplateType(), baseStruct(nullptr), memoryLayout(), dataSizeWithoutPadding(0),
-                  dataSizeWithPadding(0), vtableOwner(nullptr),
+                  dataSizeWithPadding(0), dataAlignment(0), vtableOwner(nullptr),
                   _startPosition(startPosition), _endPosition(endPosition),
                   _structKind(structKind), _inheritedTypes(std::move(inheritedTypes)),
                   _contracts(std::move(contracts)), _ownedMembers(std::move(ownedMembers)),
@@ -55,7 +55,7 @@ namespace gulc {
             auto result = new SubscriptOperatorSetDecl(_sourceFileID, copiedAttributes, _declVisibility, _isConstExpr,
                                                        _identifier, _declModifiers,
                                                        returnType->deepCopy(), copiedContracts,
-                                                       llvm::dyn_cast<CompoundStmt>(_body->deepCopy()),
+                                                       copyBody(),
                                                        _startPosition, _endPosition);
             result->container = container;
             result->containedInTemplate = containedInTemplate;
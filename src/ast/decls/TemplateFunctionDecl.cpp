@@ -47,7 +47,7 @@ gulc::Decl* gulc::TemplateFunctionDecl::deepCopy() const  {
     auto result = new TemplateFunctionDecl(_sourceFileID, copiedAttributes, _declVisibility, _isConstExpr,
                                            _identifier, _declModifiers, copiedParameters,
                                            returnType->deepCopy(), copiedContracts,
-                                           llvm::dyn_cast<CompoundStmt>(_body->deepCopy()),
+                                           copyBody(),
                                            _startPosition, _endPosition, copiedTemplateParameters);
     result->container = container;
     result->containedInTemplate = containedInTemplate;
@@ -137,7 +137,7 @@ bool gulc::TemplateFunctionDecl::getInstantiation(std::vector<Expr*> const& temp
     *result = new TemplateFunctionInstDecl(_sourceFileID, copiedAttributes, _declVisibility, _isConstExpr,
                                            _identifier, _declModifiers, copiedParameters,
                                            returnType->deepCopy(), copiedContracts,
-                                           llvm::dyn_cast<CompoundStmt>(_body->deepCopy()),
+                                           copyBody(),
                                            _startPosition, _endPosition,
                                            this, copiedTemplateArguments);
     (*result)->container = container;
@@ -67,7 +67,7 @@ namespace gulc {
             auto result = new TemplateFunctionInstDecl(_sourceFileID, copiedAttributes, _declVisibility, _isConstExpr,
                                                        _identifier, _declModifiers, copiedParameters,
                                                        copiedReturnType, copiedContracts,
-                                                       llvm::dyn_cast<CompoundStmt>(_body->deepCopy()),
+                                                       copyBody(),
                                                        _startPosition, _endPosition,
                                                        _parentTemplateStruct, copiedTemplateArguments);
             result->container = container;
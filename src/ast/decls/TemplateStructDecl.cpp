@@ -164,6 +164,9 @@ bool gulc::TemplateStructDecl::getInstantiation(const std::vector<Expr*>& templa
         copiedContracts.push_back(contract->deepCopy());
     }
 
+    // The function bodies are shared with the instantiation, copying them would only have them deleted again
+    isCopyingForInstantiation = true;
+
     for (Decl* ownedMember : _ownedMembers) {
         copiedOwnedMembers.push_back(ownedMember->deepCopy());
     }
@@ -176,6 +179,8 @@ bool gulc::TemplateStructDecl::getInstantiation(const std::vector<Expr*>& templa
         copiedDestructorDecl = llvm::dyn_cast<DestructorDecl>(destructor->deepCopy());
     }
 
+    isCopyingForInstantiation = false;
+
     *result = new TemplateStructInstDecl(_sourceFileID, copiedAttributes, _declVisibility, _isConstExpr,
                                          _identifier, _declModifiers,
                                          _startPosition, _endPosition, _structKind,
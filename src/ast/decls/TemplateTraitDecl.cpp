@@ -148,10 +148,15 @@ bool gulc::TemplateTraitDecl::getInstantiation(const std::vector<Expr*>& templat
         copiedContracts.push_back(contract->deepCopy());
     }
 
+    // The function bodies are shared with the instantiation, copying them would only have them deleted again
+    isCopyingForInstantiation = true;
+
     for (Decl* ownedMember : _ownedMembers) {
         copiedOwnedMembers.push_back(ownedMember->deepCopy());
     }
 
+    isCopyingForInstantiation = false;
+
     // Here we "steal" the `templateArguments` (since we don't have a way to deep copy)
     *result = new TemplateTraitInstDecl(_sourceFileID, copiedAttributes, _declVisibility, _isConstExpr,
                                         _identifier, _declModifiers,
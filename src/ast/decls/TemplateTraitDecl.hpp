@@ -82,6 +82,9 @@ namespace gulc {
         bool contractsAreInstantiated = false;
         // This is a specialized template instantiation used to validate the template logic.
         TemplateTraitInstDecl* validationInst = nullptr;
+        // Set while `getInstantiation` copies the members. The copied functions are left without a body, the
+        // instantiation shares the template's bodies instead (see `TemplateInstHelper::shareFunctionBodies`)
+        bool isCopyingForInstantiation = false;
 
     protected:
         std::vector<TemplateParameterDecl*> _templateParameters;
@@ -24,6 +24,8 @@
 #include <set>
 
 namespace gulc {
+    class FunctionDecl;
+
     // TODO: For traits we'll have to decide how we want to handle their actual implementation. With a trait you're
     //       allowed to provide default implementations like so:
     //           trait ToString {
@@ -141,6 +143,10 @@ namespace gulc {
         // NOTE: None of these pointers are owned by us so we don't free them
         // TODO: How will we handle shadows? Should we just consider them to be the same function?
         std::vector<Decl*> allMembers;
+        // The member functions that can be called through a trait object, in the order their implementations are laid
+        // out within the witness table of every `struct` that implements this trait.
+        // NOTE: These are all contained within `allMembers` so we don't free them
+        std::vector<FunctionDecl*> witnessTable;
 
         // This is used to know if this trait has passed through `DeclInstantiator`
         bool isInstantiated = false;
@@ -61,7 +61,7 @@ namespace gulc {
 
             auto result = new TypeSuffixDecl(_sourceFileID, copiedAttributes, _declVisibility, _isConstExpr,
                                              _identifier, _declModifiers, copiedParameters, copiedReturnType,
-                                             copiedContracts, llvm::dyn_cast<CompoundStmt>(_body->deepCopy()),
+                                             copiedContracts, copyBody(),
                                              _startPosition, _endPosition);
             result->container = container;
             result->containedInTemplate = containedInTemplate;
@@ -30,9 +30,11 @@ namespace gulc {
 
         Type* type;
         Expr* initialValue;
+        // Set by `ModuleInterfaceWriter` when a body it exports uses this `private` variable, the importing modules
+        // reference it so it can't be `internal`
+        bool isReferencedByExport = false;
 
         bool hasInitialValue() const { return initialValue != nullptr; }
-        DeclModifiers declModifiers() const { return _declModifiers; }
 
         VariableDecl(unsigned int sourceFileID, std::vector<Attr*> attributes, Decl::Visibility visibility,
                      bool isConstExpr, Identifier identifier, DeclModifiers declModifiers,
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_DELETEEXPR_HPP
+#define GULC_DELETEEXPR_HPP
+
+#include <ast/Expr.hpp>
+
+namespace gulc {
+    /**
+     * `@delete pointer` destructs the object `pointer` points to and frees the memory `@new` allocated for it.
+     */
+    class DeleteExpr : public Expr {
+    public:
+        static bool classof(const Expr* expr) { return expr->getExprKind() == Expr::Kind::Delete; }
+
+        Expr* pointer;
+        // Cleared by `EscapeAnalyzer` when the object was moved to the stack, it is only destructed then
+        bool freesMemory;
+
+        DeleteExpr(Expr* pointer, TextPosition deleteStartPosition, TextPosition deleteEndPosition)
+                : Expr(Expr::Kind::Delete),
+                  pointer(pointer), freesMemory(true),
+                  _deleteStartPosition(deleteStartPosition), _deleteEndPosition(deleteEndPosition) {}
+
+        TextPosition startPosition() const override { return _deleteStartPosition; }
+        TextPosition endPosition() const override { return pointer->endPosition(); }
+        TextPosition deleteStartPosition() const { return _deleteStartPosition; }
+        TextPosition deleteEndPosition() const { return _deleteEndPosition; }
+
+        Expr* deepCopy() const override {
+            auto result = new DeleteExpr(pointer->deepCopy(),
+                                         _deleteStartPosition, _deleteEndPosition);
+            result->valueType = valueType == nullptr ? nullptr : valueType->deepCopy();
+            result->freesMemory = freesMemory;
+            return result;
+        }
+
+        std::string toString() const override {
+            return "@delete " + pointer->toString();
+        }
+
+        ~DeleteExpr() override {
+            delete pointer;
+        }
+
+    protected:
+        TextPosition _deleteStartPosition;
+        TextPosition _deleteEndPosition;
+
+    };
+}
+
+#endif //GULC_DELETEEXPR_HPP
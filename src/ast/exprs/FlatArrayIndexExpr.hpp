@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_FLATARRAYINDEXEXPR_HPP
+#define GULC_FLATARRAYINDEXEXPR_HPP
+
+#include <ast/Expr.hpp>
+
+namespace gulc {
+    /// `FlatArrayIndexExpr` is the built in `[index]` for flat arrays (`[T; N]`). It results in an lvalue to the element
+    class FlatArrayIndexExpr : public Expr {
+    public:
+        static bool classof(const Expr* expr) { return expr->getExprKind() == Expr::Kind::FlatArrayIndex; }
+
+        // An lvalue to the flat array being indexed
+        Expr* array;
+        Expr* index;
+
+        FlatArrayIndexExpr(TextPosition startPosition, TextPosition endPosition, Expr* array, Expr* index)
+                : Expr(Expr::Kind::FlatArrayIndex),
+                  array(array), index(index), _startPosition(startPosition), _endPosition(endPosition) {}
+
+        TextPosition startPosition() const override { return _startPosition; }
+        TextPosition endPosition() const override { return _endPosition; }
+
+        Expr* deepCopy() const override {
+            auto result = new FlatArrayIndexExpr(_startPosition, _endPosition,
+                                                 array->deepCopy(), index->deepCopy());
+            result->valueType = valueType == nullptr ? nullptr : valueType->deepCopy();
+            return result;
+        }
+
+        std::string toString() const override {
+            return array->toString() + "[" + index->toString() + "]";
+        }
+
+        ~FlatArrayIndexExpr() override {
+            delete array;
+            delete index;
+        }
+
+    protected:
+        TextPosition _startPosition;
+        TextPosition _endPosition;
+
+    };
+}
+
+#endif //GULC_FLATARRAYINDEXEXPR_HPP
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_NEWEXPR_HPP
+#define GULC_NEWEXPR_HPP
+
+#include <ast/Expr.hpp>
+
+namespace gulc {
+    /**
+     * `@new Type(...)` constructs a `Type` in newly allocated memory and returns a `*Type` to it. The memory is
+     * allocated with `malloc` unless `EscapeAnalyzer` proves the pointer never outlives the function, then the object
+     * is constructed in a stack slot of the function instead.
+     */
+    class NewExpr : public Expr {
+    public:
+        static bool classof(const Expr* expr) { return expr->getExprKind() == Expr::Kind::New; }
+
+        // Starts out as the call `Type(...)`, `CodeProcessor` resolves it to a `ConstructorCallExpr` without an
+        // `objectRef`, the allocated memory is passed as `self` instead
+        Expr* initializer;
+        // Set by `EscapeAnalyzer` when the object can be allocated on the stack
+        bool isStackAllocated;
+
+        NewExpr(Expr* initializer, TextPosition newStartPosition, TextPosition newEndPosition)
+                : Expr(Expr::Kind::New),
+                  initializer(initializer), isStackAllocated(false),
+                  _newStartPosition(newStartPosition), _newEndPosition(newEndPosition) {}
+
+        TextPosition startPosition() const override { return _newStartPosition; }
+        TextPosition endPosition() const override { return initializer->endPosition(); }
+        TextPosition newStartPosition() const { return _newStartPosition; }
+        TextPosition newEndPosition() const { return _newEndPosition; }
+
+        Expr* deepCopy() const override {
+            auto result = new NewExpr(initializer->deepCopy(),
+                                      _newStartPosition, _newEndPosition);
+            result->valueType = valueType == nullptr ? nullptr : valueType->deepCopy();
+            result->isStackAllocated = isStackAllocated;
+            return result;
+        }
+
+        std::string toString() const override {
+            return "@new " + initializer->toString();
+        }
+
+        ~NewExpr() override {
+            delete initializer;
+        }
+
+    protected:
+        TextPosition _newStartPosition;
+        TextPosition _newEndPosition;
+
+    };
+}
+
+#endif //GULC_NEWEXPR_HPP
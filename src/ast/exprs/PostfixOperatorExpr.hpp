@@ -55,6 +55,8 @@ namespace gulc {
 
         TextPosition startPosition() const override { return nestedExpr->startPosition(); }
         TextPosition endPosition() const override { return _operatorEndPosition; }
+        TextPosition operatorStartPosition() const { return _operatorStartPosition; }
+        TextPosition operatorEndPosition() const { return _operatorEndPosition; }
 
         Expr* deepCopy() const override {
             auto result = new PostfixOperatorExpr(_postfixOperator, nestedExpr->deepCopy(),
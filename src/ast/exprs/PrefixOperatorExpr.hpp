@@ -100,6 +100,8 @@ namespace gulc {
 
         TextPosition startPosition() const override { return _operatorStartPosition; }
         TextPosition endPosition() const override { return nestedExpr->endPosition(); }
+        TextPosition operatorStartPosition() const { return _operatorStartPosition; }
+        TextPosition operatorEndPosition() const { return _operatorEndPosition; }
 
         Expr* deepCopy() const override {
             auto result = new PrefixOperatorExpr(_prefixOperator, nestedExpr->deepCopy(),
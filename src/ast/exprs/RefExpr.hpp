@@ -35,6 +35,8 @@ namespace gulc {
 
         TextPosition startPosition() const override { return _refStartPosition; }
         TextPosition endPosition() const override { return nestedExpr->endPosition(); }
+        TextPosition refStartPosition() const { return _refStartPosition; }
+        TextPosition refEndPosition() const { return _refEndPosition; }
 
         Expr* deepCopy() const override {
             auto result = new RefExpr(isMutable, nestedExpr->deepCopy(),
@@ -0,0 +1,185 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_SIMDBUILTINCALLEXPR_HPP
+#define GULC_SIMDBUILTINCALLEXPR_HPP
+
+#include <ast/Expr.hpp>
+#include <vector>
+
+namespace gulc {
+    /**
+     * `SimdBuiltInCallExpr` is a call to one of the built in `simd_*` functions for `simd<T, N>`. These have no
+     * declaration anywhere, they are recognized by name in `CodeProcessor` and lowered directly to LLVM vector
+     * instructions and intrinsics in `CodeGen`.
+     */
+    class SimdBuiltInCallExpr : public Expr {
+    public:
+        static bool classof(const Expr* expr) { return expr->getExprKind() == Expr::Kind::SimdBuiltInCall; }
+
+        enum class BuiltIn {
+            // `simd_shuffle(a, [b,] indices...)`, indices must be integer literals
+            Shuffle,
+            // `simd_select(mask, a, b)`
+            Select,
+            // `simd_extract(v, index)`
+            Extract,
+            // `simd_insert(v, index, value)`
+            Insert,
+            // `simd_reduce_*(v)`
+            ReduceAdd,
+            ReduceMul,
+            ReduceMin,
+            ReduceMax,
+            ReduceAnd,
+            ReduceOr,
+            ReduceXor,
+            // `simd_masked_load(ptr, mask, passthru)`
+            MaskedLoad,
+            // `simd_masked_store(value, ptr, mask)`
+            MaskedStore
+        };
+
+        // Returns true if `name` is one of the `simd_*` built in functions, `result` is set to the matching built in
+        static bool getBuiltIn(std::string const& name, BuiltIn& result) {
+            if (name == "simd_shuffle") {
+                result = BuiltIn::Shuffle;
+            } else if (name == "simd_select") {
+                result = BuiltIn::Select;
+            } else if (name == "simd_extract") {
+                result = BuiltIn::Extract;
+            } else if (name == "simd_insert") {
+                result = BuiltIn::Insert;
+            } else if (name == "simd_reduce_add") {
+                result = BuiltIn::ReduceAdd;
+            } else if (name == "simd_reduce_mul") {
+                result = BuiltIn::ReduceMul;
+            } else if (name == "simd_reduce_min") {
+                result = BuiltIn::ReduceMin;
+            } else if (name == "simd_reduce_max") {
+                result = BuiltIn::ReduceMax;
+            } else if (name == "simd_reduce_and") {
+                result = BuiltIn::ReduceAnd;
+            } else if (name == "simd_reduce_or") {
+                result = BuiltIn::ReduceOr;
+            } else if (name == "simd_reduce_xor") {
+                result = BuiltIn::ReduceXor;
+            } else if (name == "simd_masked_load") {
+                result = BuiltIn::MaskedLoad;
+            } else if (name == "simd_masked_store") {
+                result = BuiltIn::MaskedStore;
+            } else {
+                return false;
+            }
+
+            return true;
+        }
+
+        static std::string getBuiltInName(BuiltIn builtIn) {
+            switch (builtIn) {
+                case BuiltIn::Shuffle:
+                    return "simd_shuffle";
+                case BuiltIn::Select:
+                    return "simd_select";
+                case BuiltIn::Extract:
+                    return "simd_extract";
+                case BuiltIn::Insert:
+                    return "simd_insert";
+                case BuiltIn::ReduceAdd:
+                    return "simd_reduce_add";
+                case BuiltIn::ReduceMul:
+                    return "simd_reduce_mul";
+                case BuiltIn::ReduceMin:
+                    return "simd_reduce_min";
+                case BuiltIn::ReduceMax:
+                    return "simd_reduce_max";
+                case BuiltIn::ReduceAnd:
+                    return "simd_reduce_and";
+                case BuiltIn::ReduceOr:
+                    return "simd_reduce_or";
+                case BuiltIn::ReduceXor:
+                    return "simd_reduce_xor";
+                case BuiltIn::MaskedLoad:
+                    return "simd_masked_load";
+                case BuiltIn::MaskedStore:
+                    return "simd_masked_store";
+            }
+
+            return "[UNKNOWN]";
+        }
+
+        // These are all rvalues by the time `CodeProcessor` is done with them
+        std::vector<Expr*> arguments;
+        // Only used by `Shuffle`, these are the already solved element indices
+        std::vector<std::size_t> shuffleMask;
+
+        SimdBuiltInCallExpr(BuiltIn builtIn, std::vector<Expr*> arguments,
+                            TextPosition startPosition, TextPosition endPosition)
+                : Expr(Expr::Kind::SimdBuiltInCall),
+                  arguments(std::move(arguments)), shuffleMask(), _builtIn(builtIn),
+                  _startPosition(startPosition), _endPosition(endPosition) {}
+
+        BuiltIn builtIn() const { return _builtIn; }
+
+        TextPosition startPosition() const override { return _startPosition; }
+        TextPosition endPosition() const override { return _endPosition; }
+
+        Expr* deepCopy() const override {
+            std::vector<Expr*> copiedArguments;
+            copiedArguments.reserve(arguments.size());
+
+            for (Expr* argument : arguments) {
+                copiedArguments.push_back(argument->deepCopy());
+            }
+
+            auto result = new SimdBuiltInCallExpr(_builtIn, copiedArguments, _startPosition, _endPosition);
+            result->shuffleMask = shuffleMask;
+            result->valueType = valueType == nullptr ? nullptr : valueType->deepCopy();
+            return result;
+        }
+
+        std::string toString() const override {
+            std::string argumentsString;
+
+            for (std::size_t i = 0; i < arguments.size(); ++i) {
+                if (i != 0) argumentsString += ", ";
+
+                argumentsString += arguments[i]->toString();
+            }
+
+            for (std::size_t shuffleIndex : shuffleMask) {
+                argumentsString += ", " + std::to_string(shuffleIndex);
+            }
+
+            return getBuiltInName(_builtIn) + "(" + argumentsString + ")";
+        }
+
+        ~SimdBuiltInCallExpr() override {
+            for (Expr* argument : arguments) {
+                delete argument;
+            }
+        }
+
+    protected:
+        BuiltIn _builtIn;
+        TextPosition _startPosition;
+        TextPosition _endPosition;
+
+    };
+}
+
+#endif //GULC_SIMDBUILTINCALLEXPR_HPP
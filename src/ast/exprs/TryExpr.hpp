@@ -19,6 +19,8 @@
 #define GULC_TRYEXPR_HPP
 
 #include <ast/Expr.hpp>
+#include <ast/stmts/CatchStmt.hpp>
+#include <vector>
 
 namespace gulc {
     class TryExpr : public Expr {
@@ -33,6 +35,8 @@ namespace gulc {
 
         TextPosition startPosition() const override { return _tryStartPosition; }
         TextPosition endPosition() const override { return nestedExpr->endPosition(); }
+        TextPosition tryStartPosition() const { return _tryStartPosition; }
+        TextPosition tryEndPosition() const { return _tryEndPosition; }
 
         Expr* deepCopy() const override {
             auto result = new TryExpr(nestedExpr->deepCopy(),
@@ -45,6 +49,11 @@ namespace gulc {
             return "try " + nestedExpr->toString();
         }
 
+        // Where the error goes for every call to a throwing function within `nestedExpr`, in the order the calls are
+        // made. Each call has its own destination since calls can throw different types and each call has a different
+        // set of temporary values to destruct. Set by `CodeTransformer`
+        std::vector<ErrorDestination> callErrorDestinations;
+
         ~TryExpr() override {
             delete nestedExpr;
         }
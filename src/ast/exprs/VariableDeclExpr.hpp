@@ -24,11 +24,13 @@
 
 namespace gulc {
     // For structs we have to handle assignments differently. We do so by storing how the initial value should be
-    // handled specially. `Normal` is used for all non-structs.
+    // handled specially. `Normal` is used for all non-structs. `Elided` is used when the initial value is a fresh
+    // struct (a constructor call or a call returning a struct) that can be constructed directly into the variable.
     enum class InitialValueAssignmentType {
         Normal,
         Move,
         Copy,
+        Elided,
     };
 
     class VariableDeclExpr : public Expr {
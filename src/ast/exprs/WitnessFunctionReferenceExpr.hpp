@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_WITNESSFUNCTIONREFERENCEEXPR_HPP
+#define GULC_WITNESSFUNCTIONREFERENCEEXPR_HPP
+
+#include <ast/Expr.hpp>
+#include <ast/decls/TraitDecl.hpp>
+#include <ast/decls/FunctionDecl.hpp>
+
+namespace gulc {
+    /**
+     * `WitnessFunctionReferenceExpr` is used for calls made through a trait object, the called function is loaded
+     * from the witness table the trait object carries.
+     *
+     * Examples:
+     *     shape.area() // Where `shape: Shape` and `Shape` is a `trait`
+     */
+    class WitnessFunctionReferenceExpr : public Expr {
+    public:
+        static bool classof(const Expr *expr) { return expr->getExprKind() == Kind::WitnessFunctionReference; }
+
+        WitnessFunctionReferenceExpr(TextPosition startPosition, TextPosition endPosition,
+                                     TraitDecl* traitDecl, std::size_t witnessIndex, FunctionDecl* functionDecl)
+                : Expr(Expr::Kind::WitnessFunctionReference),
+                  _startPosition(startPosition), _endPosition(endPosition),
+                  _traitDecl(traitDecl), _witnessIndex(witnessIndex), _functionDecl(functionDecl) {}
+
+        TextPosition startPosition() const override { return _startPosition; }
+        TextPosition endPosition() const override { return _endPosition; }
+
+        TraitDecl* traitDecl() const { return _traitDecl; }
+        std::size_t witnessIndex() const { return _witnessIndex; }
+        /// The trait's prototype for the function, the implementation is only known at runtime
+        FunctionDecl* functionDecl() const { return _functionDecl; }
+
+        Expr* deepCopy() const override {
+            auto result = new WitnessFunctionReferenceExpr(_startPosition, _endPosition,
+                                                           _traitDecl, _witnessIndex, _functionDecl);
+            result->valueType = valueType == nullptr ? nullptr : valueType->deepCopy();
+            return result;
+        }
+
+        std::string toString() const override {
+            return _functionDecl->identifier().name();
+        }
+
+    private:
+        TextPosition _startPosition;
+        TextPosition _endPosition;
+        TraitDecl* _traitDecl;
+        /// The index within `TraitDecl::witnessTable` the function was found at
+        std::size_t _witnessIndex;
+        FunctionDecl* _functionDecl;
+
+    };
+}
+
+#endif //GULC_WITNESSFUNCTIONREFERENCEEXPR_HPP
@@ -24,8 +24,29 @@
 #include <ast/Type.hpp>
 #include <llvm/Support/Casting.h>
 #include "CompoundStmt.hpp"
+#include "ReturnStmt.hpp"
+#include <ast/exprs/VariableDeclExpr.hpp>
+#include <cstdint>
 
 namespace gulc {
+    class CatchStmt;
+
+    /**
+     * Where an error goes once it has been thrown. Every `throw` and every call to a throwing function within a `try`
+     * has one of these, they are filled in by `CodeTransformer`. The `catch` is picked at compile time since every
+     * error has a known type, the first `catch` of the innermost `do` that can handle the type wins.
+     */
+    struct ErrorDestination {
+        // The `catch` that handles the error, `nullptr` means the error is passed on to our caller
+        // NOTE: We don't own this
+        CatchStmt* errorCatch = nullptr;
+        // Index into `errorCatch->caughtErrorTypes` of the error type, each type gets its own error slot
+        std::size_t errorTypeIndex = 0;
+        // Index into `errorCatch->errorCleanups` (or `FunctionDecl::returnCleanups` when there is no `errorCatch`) of
+        // the first cleanup to run before the error reaches its destination, `-1` means there is nothing to clean up.
+        std::int64_t cleanupIndex = -1;
+    };
+
     // Syntax:
     // catch e: exception {} // A typed exception where you want to access the value from the exception
     // catch exception {} // A typed exception where you don't care what the exception says
@@ -53,6 +74,15 @@ namespace gulc {
 
         CompoundStmt* body() const { return _body; }
 
+        // The local variable for `catch e: exception`, this is created by `CodeProcessor` so the body can reference `e`
+        VariableDeclExpr* exceptionVariable = nullptr;
+        // The types of every error that reaches this `catch` (`nullptr` is an untyped error), a typed `catch` only
+        // ever has one. If this is empty the `catch` can never run. Filled in by `CodeTransformer`
+        std::vector<Type*> caughtErrorTypes;
+        // The cleanup chain for errors that end at this `catch`, this works the same as `FunctionDecl::returnCleanups`
+        // except the chain ends at the `catch` instead of the function exit
+        std::vector<ReturnCleanup> errorCleanups;
+
         TextPosition catchStartPosition() const { return _startPosition; }
         TextPosition catchEndPosition() const { return _endPosition; }
 
@@ -82,6 +112,15 @@ namespace gulc {
 
         ~CatchStmt() override {
             delete exceptionType;
+            delete exceptionVariable;
+
+            for (Type* caughtErrorType : caughtErrorTypes) {
+                delete caughtErrorType;
+            }
+
+            for (ReturnCleanup& errorCleanup : errorCleanups) {
+                delete errorCleanup.destructExpr;
+            }
         }
 
     protected:
@@ -34,7 +34,7 @@ namespace gulc {
                   _startPosition(startPosition), _endPosition(endPosition) {}
 
         CompoundStmt* body() const { return _body; }
-        std::vector<CatchStmt*> const& catchStatements() { return _catchStatements; }
+        std::vector<CatchStmt*> const& catchStatements() const { return _catchStatements; }
         bool hasFinallyStatement() const { return _finallyStatement != nullptr; }
         CompoundStmt* finallyStatement() const { return _finallyStatement; }
 
@@ -20,6 +20,8 @@
 
 #include <ast/Stmt.hpp>
 #include <ast/Expr.hpp>
+#include <ast/Attr.hpp>
+#include <vector>
 #include <llvm/Support/Casting.h>
 #include "CompoundStmt.hpp"
 
@@ -29,6 +31,8 @@ namespace gulc {
         static bool classof(const Stmt* stmt) { return stmt->getStmtKind() == Stmt::Kind::If; }
 
         Expr* condition;
+        // Statement attributes placed before the `if` (`@likely`, `@unlikely`)
+        std::vector<Attr*> attributes;
         CompoundStmt* trueBody() const { return _trueBody; }
         bool hasFalseBody() const { return _falseBody != nullptr; }
         Stmt* falseBody() const { return _falseBody; }
@@ -49,12 +53,22 @@ namespace gulc {
                 copiedFalseBody = _falseBody->deepCopy();
             }
 
-            return new IfStmt(_startPosition, _endPosition, condition->deepCopy(),
-                              llvm::dyn_cast<CompoundStmt>(_trueBody->deepCopy()),
-                              copiedFalseBody);
+            auto result = new IfStmt(_startPosition, _endPosition, condition->deepCopy(),
+                                     llvm::dyn_cast<CompoundStmt>(_trueBody->deepCopy()),
+                                     copiedFalseBody);
+
+            for (Attr* attribute : attributes) {
+                result->attributes.push_back(attribute->deepCopy());
+            }
+
+            return result;
         }
 
         ~IfStmt() override {
+            for (Attr* attribute : attributes) {
+                delete attribute;
+            }
+
             delete condition;
             delete _trueBody;
             delete _falseBody;
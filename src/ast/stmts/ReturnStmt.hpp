@@ -21,8 +21,24 @@
 #include <ast/Stmt.hpp>
 #include <ast/Expr.hpp>
 #include <vector>
+#include <cstdint>
 
 namespace gulc {
+    /**
+     * A single link in the chain of cleanups shared by every `return` within a function. Each cleanup destructs one
+     * value and then continues on to `nextCleanupIndex`, so a value that is live at many `return` statements is still
+     * only destructed in one place. This is the same idea as Clang's cleanup stack.
+     */
+    struct ReturnCleanup {
+        Expr* destructExpr;
+        // Index into `FunctionDecl::returnCleanups` of the cleanup to run after this one, `-1` is the function exit
+        std::int64_t nextCleanupIndex;
+
+        ReturnCleanup(Expr* destructExpr, std::int64_t nextCleanupIndex)
+                : destructExpr(destructExpr), nextCleanupIndex(nextCleanupIndex) {}
+
+    };
+
     class ReturnStmt : public Stmt {
     public:
         static bool classof(const Stmt* stmt) { return stmt->getStmtKind() == Stmt::Kind::Return; }
@@ -55,14 +71,11 @@ namespace gulc {
             }
         }
 
-        // The most common case for this will be destructor calls.
-        std::vector<Expr*> preReturnDeferred;
+        // Index into `FunctionDecl::returnCleanups` of the first cleanup to branch into after the return value has been
+        // stored, `-1` means there is nothing to clean up and we branch straight to the function exit.
+        std::int64_t cleanupIndex = -1;
 
         ~ReturnStmt() override {
-            for (Expr* preReturnDeferredExpr : preReturnDeferred) {
-                delete preReturnDeferredExpr;
-            }
-
             delete returnValue;
         }
 
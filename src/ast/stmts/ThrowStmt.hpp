@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_THROWSTMT_HPP
+#define GULC_THROWSTMT_HPP
+
+#include <ast/Stmt.hpp>
+#include <ast/Expr.hpp>
+#include "CatchStmt.hpp"
+
+namespace gulc {
+    // Syntax:
+    // throw // Only allowed for an untyped `throws`
+    // throw value // The value has to be the type named by `throws T` (or the type caught by the enclosing `do`)
+    class ThrowStmt : public Stmt {
+    public:
+        static bool classof(const Stmt* stmt) { return stmt->getStmtKind() == Stmt::Kind::Throw; }
+
+        Expr* thrownValue;
+
+        ThrowStmt(TextPosition startPosition, TextPosition endPosition)
+                : ThrowStmt(startPosition, endPosition, nullptr) {}
+        ThrowStmt(TextPosition startPosition, TextPosition endPosition, Expr* thrownValue)
+                : Stmt(Stmt::Kind::Throw),
+                  thrownValue(thrownValue), _startPosition(startPosition), _endPosition(endPosition) {}
+
+        bool hasThrownValue() const { return thrownValue != nullptr; }
+
+        TextPosition throwStartPosition() const { return _startPosition; }
+        TextPosition throwEndPosition() const { return _endPosition; }
+
+        TextPosition startPosition() const override { return _startPosition; }
+        TextPosition endPosition() const override {
+            if (thrownValue != nullptr) {
+                return thrownValue->endPosition();
+            } else {
+                return _endPosition;
+            }
+        }
+
+        Stmt* deepCopy() const override {
+            if (thrownValue == nullptr) {
+                return new ThrowStmt(_startPosition, _endPosition);
+            } else {
+                return new ThrowStmt(_startPosition, _endPosition, thrownValue->deepCopy());
+            }
+        }
+
+        // Where the error goes, set by `CodeTransformer`
+        ErrorDestination errorDestination;
+
+        ~ThrowStmt() override {
+            delete thrownValue;
+        }
+
+    protected:
+        TextPosition _startPosition;
+        TextPosition _endPosition;
+
+    };
+}
+
+#endif //GULC_THROWSTMT_HPP
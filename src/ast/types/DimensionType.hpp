@@ -54,12 +54,12 @@ namespace gulc {
      */
     class DimensionType : public Type {
     public:
-        static bool classof(const Type* type) { return type->getTypeKind() == Type::Kind::Pointer; }
+        static bool classof(const Type* type) { return type->getTypeKind() == Type::Kind::Dimension; }
 
         Type* nestedType;
 
         DimensionType(Qualifier qualifier, Type* nestedType, std::size_t dimensions)
-                : Type(Type::Kind::Pointer, qualifier, false),
+                : Type(Type::Kind::Dimension, qualifier, false),
                   nestedType(nestedType), _dimensions(dimensions) {}
 
         TextPosition startPosition() const override { return nestedType->startPosition(); }
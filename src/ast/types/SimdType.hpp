@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_SIMDTYPE_HPP
+#define GULC_SIMDTYPE_HPP
+
+#include <ast/Type.hpp>
+#include <cstddef>
+
+namespace gulc {
+    /**
+     * `simd<T, N>` is a built in fixed width vector of `N` elements of `T` (where `T` is a built in number type or
+     * `bool`). Built in operators on a `simd` are applied element-wise and are lowered directly to LLVM vector types.
+     * Comparing two vectors results in a `simd<bool, N>` mask.
+     */
+    class SimdType : public Type {
+    public:
+        static bool classof(const Type* type) { return type->getTypeKind() == Type::Kind::Simd; }
+
+        // NOTE: This is always either a `BuiltInType` or a `BoolType`
+        Type* elementType;
+
+        SimdType(Qualifier qualifier, Type* elementType, std::size_t length,
+                 TextPosition startPosition, TextPosition endPosition)
+                : Type(Type::Kind::Simd, qualifier, false),
+                  elementType(elementType), _length(length),
+                  _startPosition(startPosition), _endPosition(endPosition) {}
+
+        std::size_t length() const { return _length; }
+
+        TextPosition startPosition() const override { return _startPosition; }
+        TextPosition endPosition() const override { return _endPosition; }
+
+        std::string toString() const override {
+            return "simd<" + elementType->toString() + ", " + std::to_string(_length) + ">";
+        }
+
+        Type* deepCopy() const override {
+            auto result = new SimdType(_qualifier, elementType->deepCopy(), _length,
+                                       _startPosition, _endPosition);
+            result->setIsLValue(_isLValue);
+            return result;
+        }
+
+        ~SimdType() override {
+            delete elementType;
+        }
+
+    protected:
+        std::size_t _length;
+        TextPosition _startPosition;
+        TextPosition _endPosition;
+
+    };
+}
+
+#endif //GULC_SIMDTYPE_HPP
@@ -20,6 +20,7 @@
 
 #include <llvm/IR/Module.h>
 #include <llvm/IR/Verifier.h>
+#include <llvm/Pass.h>
 #include <llvm/Transforms/InstCombine/InstCombine.h>
 #include <llvm/Transforms/Scalar.h>
 #include <llvm/Transforms/Scalar/GVN.h>
@@ -35,9 +36,22 @@
 #include <ast/types/FunctionPointerType.hpp>
 #include <utilities/TypeCompareUtil.hpp>
 #include <ast/types/BoolType.hpp>
+#include <ast/types/SimdType.hpp>
 #include <llvm/Transforms/IPO/PassManagerBuilder.h>
 #include <ast/exprs/MemberPropertyRefExpr.hpp>
 #include <ast/exprs/MemberSubscriptOperatorRefExpr.hpp>
+#include <ast/exprs/ParenExpr.hpp>
+#include <ast/conts/RequiresCont.hpp>
+#include <ast/conts/EnsuresCont.hpp>
+#include <llvm/IR/Intrinsics.h>
+#include <llvm/IR/MDBuilder.h>
+#include <llvm/ProfileData/InstrProf.h>
+#include <llvm/Transforms/Instrumentation.h>
+#include <utilities/SizeofUtil.hpp>
+#include <ast/attrs/BranchHintAttr.hpp>
+#include <ast/types/TraitType.hpp>
+#include <utilities/WitnessTableUtil.hpp>
+#include <algorithm>
 
 gulc::Module gulc::CodeGen::generate(gulc::ASTFile* file) {
     auto llvmContext = new llvm::LLVMContext();
@@ -56,6 +70,8 @@ gulc::Module gulc::CodeGen::generate(gulc::ASTFile* file) {
     this->_irBuilder = &irBuilder;
     this->_llvmModule = genModule;
     this->_funcPassManager = funcPassManager;
+    _linkOnceDecls.clear();
+    _linkOnceDeclQueue.clear();
 
     // TODO: We will need to account for the imported `extern` decls. These are implicitly `extern`ed declarations that
     //       come from the `import` statements. Much easier and quicker than needing to `extern` every declaration from
@@ -67,6 +83,22 @@ gulc::Module gulc::CodeGen::generate(gulc::ASTFile* file) {
         //globalObject.print()
     }
 
+    // Template instantiations, `@inline` functions, and the imported `private` functions they call are generated last
+    generateLinkOnceDecls();
+
+    // NOTE: Functions are only optimized once the entire module has been generated. Profile instrumentation and
+    //       profile use both have to see the exact same unoptimized IR for the CFG checksums to match, and the
+    //       profile metadata has to be attached before the optimizations that use it.
+    if (_options.profileMode != CompilerOptions::ProfileMode::None) {
+        runProfilePasses();
+    }
+
+    for (llvm::Function& function : *genModule) {
+        if (!function.isDeclaration()) {
+            funcPassManager->run(function);
+        }
+    }
+
     genModule->print(llvm::errs(), nullptr);
 
     funcPassManager->doFinalization();
@@ -75,11 +107,31 @@ gulc::Module gulc::CodeGen::generate(gulc::ASTFile* file) {
     return Module(_filePaths[_currentFile->sourceFileID], llvmContext, genModule);
 }
 
+void gulc::CodeGen::runProfilePasses() {
+    llvm::legacy::PassManager profilePassManager;
+
+    if (_options.profileMode == CompilerOptions::ProfileMode::Generate) {
+        // Insert the edge counters then lower them to the `__llvm_profile_*` runtime data. The entry stub calls
+        // `__llvm_profile_write_file` after `main` returns since we exit with a raw syscall and never run `atexit`.
+        profilePassManager.add(llvm::createPGOInstrumentationGenLegacyPass());
+        profilePassManager.add(llvm::createInstrProfilingLegacyPass(llvm::InstrProfOptions()));
+
+        if (!_options.profilePath.empty()) {
+            llvm::createProfileFileNameVar(*_llvmModule, _options.profilePath);
+        }
+    } else {
+        // Attaches `!prof` branch weights and function entry counts from the merged profile
+        profilePassManager.add(llvm::createPGOInstrumentationUseLegacyPass(_options.profilePath));
+    }
+
+    profilePassManager.run(*_llvmModule);
+}
+
 void gulc::CodeGen::printError(std::string const& message, gulc::TextPosition startPosition,
                                gulc::TextPosition endPosition) {
     std::cout << "gulc codegen error[" << _filePaths[_currentFile->sourceFileID] << ", "
-                                   "{" << startPosition.line << ", " << startPosition.column << "} "
-                                   "to {" << endPosition.line << ", " << endPosition.column << "}]: "
+                                   "{" << startPosition.line() << ", " << startPosition.column() << "} "
+                                   "to {" << endPosition.line() << ", " << endPosition.column() << "}]: "
               << message
               << std::endl;
     std::exit(1);
@@ -141,9 +193,19 @@ llvm::Type* gulc::CodeGen::generateLlvmType(gulc::Type const* type) {
         }
         case Type::Kind::FlatArray: {
             auto flatArrayType = llvm::dyn_cast<FlatArrayType>(type);
-            auto indexType = generateLlvmType(flatArrayType->indexType);
             std::uint64_t length = generateConstSize(flatArrayType->length);
 
+            // Arrays of `@soa` structs are stored as a struct of arrays, one array per member
+            if (llvm::isa<StructType>(flatArrayType->indexType)) {
+                auto elementStructDecl = llvm::dyn_cast<StructType>(flatArrayType->indexType)->decl();
+
+                if (elementStructDecl->hasAttr(Attr::Kind::Soa)) {
+                    return generateLlvmSoaArrayType(elementStructDecl, length);
+                }
+            }
+
+            auto indexType = generateLlvmType(flatArrayType->indexType);
+
             return llvm::ArrayType::get(indexType, length);
         }
         case Type::Kind::FunctionPointer: {
@@ -159,14 +221,30 @@ llvm::Type* gulc::CodeGen::generateLlvmType(gulc::Type const* type) {
             auto referenceType = llvm::dyn_cast<gulc::ReferenceType>(type);
             return llvm::PointerType::getUnqual(generateLlvmType(referenceType->nestedType));
         }
+        case Type::Kind::Simd: {
+            auto simdType = llvm::dyn_cast<SimdType>(type);
+            llvm::Type* elementType;
+
+            // Unlike scalar `bool` (which is stored as `i8`) `simd<bool, N>` is a vector of `i1` so it can be used
+            // directly as the mask operand for `select` and the masked load/store intrinsics
+            if (llvm::isa<BoolType>(simdType->elementType)) {
+                elementType = llvm::Type::getInt1Ty(*_llvmContext);
+            } else {
+                elementType = generateLlvmType(simdType->elementType);
+            }
+
+            return llvm::FixedVectorType::get(elementType, simdType->length());
+        }
         case Type::Kind::Struct: {
             auto structType = llvm::dyn_cast<StructType>(type);
             return generateLlvmStructType(structType->decl());
         }
         case Type::Kind::Trait: {
-            printError("[INTERNAL] trait types not yet supported!",
-                       type->startPosition(), type->endPosition());
-            return nullptr;
+            // Trait objects are `{ self*, witness table* }`, the witness table is typed the same as a vtable
+            llvm::Type* varArgFuncType = llvm::FunctionType::get(llvm::Type::getVoidTy(*_llvmContext), true);
+            llvm::Type* witnessTableType = llvm::PointerType::get(llvm::PointerType::get(varArgFuncType, 0), 0);
+            return llvm::StructType::get(*_llvmContext, { llvm::Type::getInt8PtrTy(*_llvmContext), witnessTableType },
+                                         false);
         }
         case Type::Kind::VTable: {
             // We just make the vtable a `void**` and will bitcast later to what it needs to be later.
@@ -183,6 +261,18 @@ llvm::Type* gulc::CodeGen::generateLlvmType(gulc::Type const* type) {
 std::vector<llvm::Type*> gulc::CodeGen::generateLlvmParamTypes(std::vector<ParameterDecl*> const& parameters,
                                                                gulc::StructDecl const* parentStruct,
                                                                gulc::Type* returnType) {
+    llvm::Type* selfType = nullptr;
+
+    if (parentStruct) {
+        selfType = llvm::PointerType::getUnqual(generateLlvmStructType(parentStruct));
+    }
+
+    return generateLlvmParamTypesWithSelf(parameters, selfType, returnType);
+}
+
+std::vector<llvm::Type*> gulc::CodeGen::generateLlvmParamTypesWithSelf(std::vector<ParameterDecl*> const& parameters,
+                                                                       llvm::Type* selfType,
+                                                                       gulc::Type* returnType) {
     std::vector<llvm::Type*> paramTypes{};
     paramTypes.reserve(parameters.size());
 
@@ -205,25 +295,51 @@ std::vector<llvm::Type*> gulc::CodeGen::generateLlvmParamTypes(std::vector<Param
     // And on and on. I can't be bothered to find out what is causing this. LLVM has awful documentation and from what
     // I read online this isn't even supposed to happen. LLVM is supposed to be doing the `sret` for us but oh well.
     // I don't care enough to find out what this is right now. Maybe later.
-    if (returnType != nullptr && llvm::isa<StructType>(returnType)) {
+    // NOTE: Since we now follow the System V ABI this only applies to structs that are classified as `MEMORY`,
+    //       structs that fit in two eightbytes are returned in registers instead
+    FunctionAbiInfo abiInfo = _abiClassifier.classifyFunction(returnType, selfType != nullptr, parameters);
+
+    if (abiInfo.returnInfo.kind == AbiArgInfo::Kind::Indirect) {
         auto sretType = generateLlvmType(returnType);
 
         paramTypes.push_back(llvm::PointerType::get(sretType, 0));
     }
 
-    if (parentStruct) {
-        paramTypes.push_back(llvm::PointerType::getUnqual(generateLlvmStructType(parentStruct)));
+    if (selfType) {
+        paramTypes.push_back(selfType);
     }
 
-    for (ParameterDecl const* parameterDecl : parameters) {
-        auto paramLlvmType = generateLlvmType(parameterDecl->type);
+    for (std::size_t i = 0; i < parameters.size(); ++i) {
+        ParameterDecl const* parameterDecl = parameters[i];
+        AbiArgInfo const& parameterInfo = abiInfo.parameterInfos[i];
 
-        // `in` and `out` are reference types.
-        if (parameterDecl->parameterKind() != ParameterDecl::ParameterKind::Val) {
-            paramLlvmType = llvm::PointerType::get(paramLlvmType, 0);
-        }
+        switch (parameterInfo.kind) {
+            case AbiArgInfo::Kind::Direct: {
+                auto paramLlvmType = generateLlvmType(parameterDecl->type);
+
+                // `in` and `out` are reference types.
+                if (parameterDecl->parameterKind() != ParameterDecl::ParameterKind::Val) {
+                    paramLlvmType = llvm::PointerType::get(paramLlvmType, 0);
+                }
+
+                paramTypes.push_back(paramLlvmType);
+                break;
+            }
+            case AbiArgInfo::Kind::Coerce:
+                paramTypes.push_back(generateLlvmAbiEightbyteType(parameterInfo.lo));
+
+                if (parameterInfo.hasHi()) {
+                    paramTypes.push_back(generateLlvmAbiEightbyteType(parameterInfo.hi));
+                }
 
-        paramTypes.push_back(paramLlvmType);
+                break;
+            case AbiArgInfo::Kind::Indirect:
+                // Passed as a `byval` pointer, the caller makes the copy
+                paramTypes.push_back(llvm::PointerType::get(generateLlvmType(parameterDecl->type), 0));
+                break;
+            case AbiArgInfo::Kind::Ignore:
+                break;
+        }
     }
 
     return paramTypes;
@@ -254,7 +370,7 @@ llvm::StructType* gulc::CodeGen::generateLlvmStructType(gulc::StructDecl const*
             elementsPadded.push_back(memberType);
         }
 
-        std::size_t structAlign = _target.alignofStruct();
+        std::size_t structAlign = structDecl->dataAlignment;
         std::size_t alignPadding = 0;
 
         // `align` can't be zero, `n % 0` is illegal since `n / 0` is illegal
@@ -291,6 +407,411 @@ llvm::StructType* gulc::CodeGen::generateLlvmStructType(gulc::StructDecl const*
     return nullptr;
 }
 
+llvm::StructType* gulc::CodeGen::generateLlvmSoaArrayType(gulc::StructDecl const* soaStruct, std::uint64_t length,
+                                                          std::vector<VariableDecl const*>* outLayout) {
+    std::vector<llvm::Type*> elements;
+    std::size_t currentOffset = 0;
+
+    // Like `generateLlvmStructType` the result is packed with explicit padding so the layout matches `SizeofUtil`
+    for (SoaColumn const& soaColumn : SizeofUtil::getSoaColumns(_target, soaStruct, length)) {
+        if (soaColumn.offset > currentOffset) {
+            elements.push_back(llvm::ArrayType::get(llvm::Type::getInt8Ty(*_llvmContext),
+                                                    soaColumn.offset - currentOffset));
+
+            if (outLayout != nullptr) outLayout->push_back(nullptr);
+        }
+
+        elements.push_back(llvm::ArrayType::get(generateLlvmType(soaColumn.member->type), length));
+
+        if (outLayout != nullptr) outLayout->push_back(soaColumn.member);
+
+        currentOffset = soaColumn.offset + soaColumn.sizeAndAlignment.size;
+    }
+
+    return llvm::StructType::get(*_llvmContext, elements, true);
+}
+
+llvm::Type* gulc::CodeGen::generateLlvmReturnType(gulc::Type const* returnType) {
+    if (returnType == nullptr) {
+        return llvm::Type::getVoidTy(*_llvmContext);
+    }
+
+    if (SysVAbiClassifier::isAggregate(returnType)) {
+        AbiArgInfo returnInfo = _abiClassifier.classifyAggregate(returnType);
+
+        if (returnInfo.kind == AbiArgInfo::Kind::Coerce) {
+            return generateLlvmAbiCoercedType(returnInfo);
+        } else {
+            // `Indirect` is returned through `sret`, `Ignore` has nothing to return
+            return llvm::Type::getVoidTy(*_llvmContext);
+        }
+    }
+
+    return generateLlvmType(returnType);
+}
+
+llvm::StructType* gulc::CodeGen::generateLlvmErrorSlotType(gulc::Type const* errorType) {
+    std::vector<llvm::Type*> elementTypes { llvm::Type::getInt1Ty(*_llvmContext) };
+
+    if (errorType != nullptr) {
+        elementTypes.push_back(generateLlvmType(errorType));
+    }
+
+    return llvm::StructType::get(*_llvmContext, elementTypes, false);
+}
+
+gulc::FunctionAbiInfo gulc::CodeGen::classifyFunctionAbi(std::vector<ParameterDecl*> const& parameters,
+                                                         gulc::StructDecl const* parentStruct,
+                                                         gulc::Type const* returnType) {
+    return _abiClassifier.classifyFunction(returnType, parentStruct != nullptr, parameters);
+}
+
+bool gulc::CodeGen::returnsViaSRet(gulc::Type const* returnType) const {
+    return returnType != nullptr && SysVAbiClassifier::isAggregate(returnType) &&
+           _abiClassifier.classifyAggregate(returnType).kind == AbiArgInfo::Kind::Indirect;
+}
+
+llvm::Type* gulc::CodeGen::generateLlvmAbiEightbyteType(gulc::AbiEightbyte const& eightbyte) {
+    if (eightbyte.abiClass == AbiClass::SSE) {
+        llvm::Type* elementType;
+
+        switch (eightbyte.floatSize) {
+            case 2:
+                elementType = llvm::Type::getHalfTy(*_llvmContext);
+                break;
+            case 4:
+                elementType = llvm::Type::getFloatTy(*_llvmContext);
+                break;
+            default:
+                return llvm::Type::getDoubleTy(*_llvmContext);
+        }
+
+        // Multiple floats packed into a single `xmm` register are passed as a vector (e.g. `{ f32, f32 }` becomes
+        // `<2 x float>`), this matches what Clang generates.
+        std::size_t elementCount = eightbyte.size / eightbyte.floatSize;
+
+        if (elementCount <= 1) {
+            return elementType;
+        } else {
+            return llvm::FixedVectorType::get(elementType, elementCount);
+        }
+    }
+
+    return llvm::IntegerType::get(*_llvmContext, eightbyte.size * 8);
+}
+
+llvm::Type* gulc::CodeGen::generateLlvmAbiCoercedType(gulc::AbiArgInfo const& abiArgInfo) {
+    llvm::Type* loType = generateLlvmAbiEightbyteType(abiArgInfo.lo);
+
+    if (!abiArgInfo.hasHi()) {
+        return loType;
+    }
+
+    llvm::Type* hiType = generateLlvmAbiEightbyteType(abiArgInfo.hi);
+
+    return llvm::StructType::get(*_llvmContext, { loType, hiType }, false);
+}
+
+void gulc::CodeGen::applyAbiAttributes(llvm::Function* function, std::vector<ParameterDecl*> const& parameters,
+                                       gulc::StructDecl const* parentStruct, gulc::Type const* returnType) {
+    FunctionAbiInfo abiInfo = classifyFunctionAbi(parameters, parentStruct, returnType);
+    unsigned llvmArgIndex = 0;
+
+    if (abiInfo.returnInfo.kind == AbiArgInfo::Kind::Indirect) {
+        function->addParamAttr(llvmArgIndex, llvm::Attribute::getWithStructRetType(
+                *_llvmContext, function->getFunctionType()->getParamType(llvmArgIndex)->getPointerElementType()));
+        function->addParamAttr(llvmArgIndex, llvm::Attribute::NoAlias);
+        ++llvmArgIndex;
+    }
+
+    // `self`, `in` and `out` are references, they can never be null and always point to a complete object
+    auto addReferenceAttributes = [&](unsigned argIndex, llvm::Type* referencedType) {
+        function->addParamAttr(argIndex, llvm::Attribute::NonNull);
+
+        if (referencedType->isSized()) {
+            function->addDereferenceableParamAttr(
+                    argIndex, _llvmModule->getDataLayout().getTypeAllocSize(referencedType));
+        }
+    };
+
+    if (parentStruct != nullptr) {
+        addReferenceAttributes(llvmArgIndex, generateLlvmStructType(parentStruct));
+        ++llvmArgIndex;
+    }
+
+    for (std::size_t i = 0; i < abiInfo.parameterInfos.size(); ++i) {
+        AbiArgInfo const& parameterInfo = abiInfo.parameterInfos[i];
+
+        switch (parameterInfo.kind) {
+            case AbiArgInfo::Kind::Direct:
+                if (parameters[i]->parameterKind() != ParameterDecl::ParameterKind::Val) {
+                    addReferenceAttributes(llvmArgIndex, generateLlvmType(parameters[i]->type));
+                } else if (llvm::isa<ReferenceType>(parameters[i]->type)) {
+                    auto referenceType = llvm::dyn_cast<ReferenceType>(parameters[i]->type);
+                    addReferenceAttributes(llvmArgIndex, generateLlvmType(referenceType->nestedType));
+                }
+
+                ++llvmArgIndex;
+                break;
+            case AbiArgInfo::Kind::Coerce:
+                llvmArgIndex += parameterInfo.hasHi() ? 2 : 1;
+                break;
+            case AbiArgInfo::Kind::Indirect: {
+                llvm::Type* byvalType = generateLlvmType(parameters[i]->type);
+
+                function->addParamAttr(llvmArgIndex, llvm::Attribute::getWithByValType(*_llvmContext, byvalType));
+                function->addParamAttr(llvmArgIndex, llvm::Attribute::getWithAlignment(
+                        *_llvmContext, llvm::Align(getLlvmTypeAlignment(byvalType))));
+                ++llvmArgIndex;
+                break;
+            }
+            case AbiArgInfo::Kind::Ignore:
+                break;
+        }
+    }
+}
+
+void gulc::CodeGen::appendAbiArgument(std::vector<llvm::Value*>& llvmArgs, gulc::AbiArgInfo const& abiArgInfo,
+                                      llvm::Value* value) {
+    switch (abiArgInfo.kind) {
+        case AbiArgInfo::Kind::Direct:
+            llvmArgs.push_back(value);
+            break;
+        case AbiArgInfo::Kind::Coerce: {
+            // We spill the aggregate to the stack and reload it as the coerced type, LLVM's `mem2reg` and `sroa`
+            // passes clean this up into plain register moves.
+            llvm::Type* coercedType = generateLlvmAbiCoercedType(abiArgInfo);
+            llvm::AllocaInst* spill = createEntryBlockAlloca(value->getType());
+            _irBuilder->CreateStore(value, spill);
+            llvm::Value* coercedRef = _irBuilder->CreateBitCast(spill, llvm::PointerType::getUnqual(coercedType));
+
+            if (abiArgInfo.hasHi()) {
+                llvmArgs.push_back(_irBuilder->CreateLoad(coercedType->getStructElementType(0),
+                                                          _irBuilder->CreateStructGEP(coercedType, coercedRef, 0)));
+                llvmArgs.push_back(_irBuilder->CreateLoad(coercedType->getStructElementType(1),
+                                                          _irBuilder->CreateStructGEP(coercedType, coercedRef, 1)));
+            } else {
+                llvmArgs.push_back(_irBuilder->CreateLoad(coercedType, coercedRef));
+            }
+
+            break;
+        }
+        case AbiArgInfo::Kind::Indirect: {
+            // The callee owns the `byval` copy, we just need the value to be in memory
+            llvm::AllocaInst* copy = createEntryBlockAlloca(value->getType());
+            _irBuilder->CreateStore(value, copy);
+            llvmArgs.push_back(copy);
+            break;
+        }
+        case AbiArgInfo::Kind::Ignore:
+            break;
+    }
+}
+
+llvm::CallInst* gulc::CodeGen::createAbiCall(llvm::Value* function, gulc::FunctionDecl const* functionDecl,
+                                             llvm::Value* sret, llvm::Value* selfArgument,
+                                             std::vector<llvm::Value*> const& arguments) {
+    FunctionAbiInfo abiInfo = _abiClassifier.classifyFunction(functionDecl->returnType, selfArgument != nullptr,
+                                                             functionDecl->parameters());
+    std::vector<llvm::Value*> llvmArgs;
+    llvmArgs.reserve(arguments.size() + 2);
+
+    if (abiInfo.returnInfo.kind == AbiArgInfo::Kind::Indirect) {
+        // If the caller doesn't care about the result we still have to give the callee somewhere to put it
+        if (sret == nullptr) {
+            sret = createEntryBlockAlloca(generateLlvmType(functionDecl->returnType));
+        }
+
+        llvmArgs.push_back(sret);
+    }
+
+    if (selfArgument != nullptr) {
+        llvmArgs.push_back(selfArgument);
+    }
+
+    std::vector<unsigned> byvalIndexes;
+
+    for (std::size_t i = 0; i < arguments.size(); ++i) {
+        // Variadic arguments past the declared parameters are always passed as-is
+        if (i >= abiInfo.parameterInfos.size()) {
+            llvmArgs.push_back(arguments[i]);
+            continue;
+        }
+
+        if (abiInfo.parameterInfos[i].kind == AbiArgInfo::Kind::Indirect) {
+            byvalIndexes.push_back(llvmArgs.size());
+        }
+
+        appendAbiArgument(llvmArgs, abiInfo.parameterInfos[i], arguments[i]);
+    }
+
+    llvm::Value* errorSlot = nullptr;
+    ErrorDestination const* errorDestination = nullptr;
+
+    // Throwing functions take a pointer to the error slot of whoever handles the error as their last argument. When
+    // the error is passed on to our own caller that is our own slot so nothing has to be copied on the way out.
+    if (functionDecl->throws()) {
+        if (_currentTryExpr == nullptr) {
+            printError("[INTERNAL] call to throwing function `" + functionDecl->identifier().name() + "` "
+                       "found outside of `try`!",
+                       functionDecl->startPosition(), functionDecl->endPosition());
+        }
+
+        if (_currentTryCallIndex >= _currentTryExpr->callErrorDestinations.size()) {
+            printError("[INTERNAL] call to throwing function `" + functionDecl->identifier().name() + "` is "
+                       "missing its error destination!",
+                       _currentTryExpr->startPosition(), _currentTryExpr->endPosition());
+        }
+
+        errorDestination = &_currentTryExpr->callErrorDestinations[_currentTryCallIndex];
+        ++_currentTryCallIndex;
+
+        errorSlot = getErrorSlot(*errorDestination, _currentTryExpr->startPosition(), _currentTryExpr->endPosition());
+        _irBuilder->CreateStore(llvm::ConstantInt::getFalse(*_llvmContext),
+                                _irBuilder->CreateStructGEP(errorSlot->getType()->getPointerElementType(),
+                                                            errorSlot, 0));
+        llvmArgs.push_back(errorSlot);
+    }
+
+    auto functionType = llvm::cast<llvm::FunctionType>(function->getType()->getPointerElementType());
+    llvm::CallInst* result = _irBuilder->CreateCall(functionType, function, llvmArgs);
+
+    if (abiInfo.returnInfo.kind == AbiArgInfo::Kind::Indirect) {
+        result->addParamAttr(0, llvm::Attribute::getWithStructRetType(
+                *_llvmContext, llvmArgs[0]->getType()->getPointerElementType()));
+    }
+
+    for (unsigned byvalIndex : byvalIndexes) {
+        llvm::Type* byvalType = llvmArgs[byvalIndex]->getType()->getPointerElementType();
+
+        result->addParamAttr(byvalIndex, llvm::Attribute::getWithByValType(*_llvmContext, byvalType));
+        result->addParamAttr(byvalIndex, llvm::Attribute::getWithAlignment(
+                *_llvmContext, llvm::Align(getLlvmTypeAlignment(byvalType))));
+    }
+
+    // For coerced returns the caller still expects the struct to be in `sret`, the coerced type is always the same
+    // size as the padded struct so we can store it straight through a cast pointer.
+    if (abiInfo.returnInfo.kind == AbiArgInfo::Kind::Coerce && sret != nullptr) {
+        llvm::Type* coercedType = generateLlvmAbiCoercedType(abiInfo.returnInfo);
+        _irBuilder->CreateStore(result, _irBuilder->CreateBitCast(sret, llvm::PointerType::getUnqual(coercedType)));
+    }
+
+    if (errorSlot != nullptr) {
+        generateErrorCheck(errorSlot, *errorDestination);
+    }
+
+    return result;
+}
+
+std::vector<gulc::FunctionHintAttr const*> gulc::CodeGen::getFunctionHints(
+        gulc::FunctionDecl const* functionDecl) const {
+    std::vector<FunctionHintAttr const*> result;
+
+    for (Attr const* attribute : functionDecl->attributes()) {
+        if (auto functionHintAttr = llvm::dyn_cast<FunctionHintAttr>(attribute)) {
+            result.push_back(functionHintAttr);
+        }
+    }
+
+    // Hints on a property or subscript apply to all of their `get` and `set` functions
+    if (functionDecl->container != nullptr &&
+        (llvm::isa<PropertyDecl>(functionDecl->container) ||
+         llvm::isa<SubscriptOperatorDecl>(functionDecl->container))) {
+        for (Attr const* attribute : functionDecl->container->attributes()) {
+            if (auto functionHintAttr = llvm::dyn_cast<FunctionHintAttr>(attribute)) {
+                result.push_back(functionHintAttr);
+            }
+        }
+    }
+
+    return result;
+}
+
+void gulc::CodeGen::applyFunctionHintAttributes(llvm::Function* function, gulc::FunctionDecl const* functionDecl) {
+    for (FunctionHintAttr const* functionHint : getFunctionHints(functionDecl)) {
+        switch (functionHint->hint()) {
+            case FunctionHintAttr::Hint::Inline:
+                function->addFnAttr(llvm::Attribute::AlwaysInline);
+                break;
+            case FunctionHintAttr::Hint::NoInline:
+                function->addFnAttr(llvm::Attribute::NoInline);
+                break;
+            case FunctionHintAttr::Hint::Cold:
+                function->addFnAttr(llvm::Attribute::Cold);
+                break;
+            case FunctionHintAttr::Hint::Hot:
+                // `hot` only changes how LLVM optimizes the function, we also group it with the other hot functions
+                // the same way GCC does.
+                function->addFnAttr(llvm::Attribute::Hot);
+                function->setSection(".text.hot." + functionDecl->mangledName());
+                break;
+            case FunctionHintAttr::Hint::Flatten:
+                // Handled after the body is generated by `flattenCallSites`
+                break;
+            case FunctionHintAttr::Hint::MinSize:
+                function->addFnAttr(llvm::Attribute::MinSize);
+                function->addFnAttr(llvm::Attribute::OptimizeForSize);
+                break;
+        }
+    }
+}
+
+void gulc::CodeGen::flattenCallSites(llvm::Function* function) {
+    // `flatten` isn't an LLVM attribute, it is implemented the same as Clang does by forcing every direct call within
+    // the function to be inlined. This is NOT recursive, calls within the inlined functions are left alone.
+    for (llvm::BasicBlock& basicBlock : *function) {
+        for (llvm::Instruction& instruction : basicBlock) {
+            auto callInst = llvm::dyn_cast<llvm::CallInst>(&instruction);
+
+            if (callInst == nullptr) {
+                continue;
+            }
+
+            llvm::Function* calledFunction = callInst->getCalledFunction();
+
+            if (calledFunction != nullptr && !calledFunction->isIntrinsic() && calledFunction != function) {
+                callInst->addFnAttr(llvm::Attribute::AlwaysInline);
+            }
+        }
+    }
+}
+
+llvm::AllocaInst* gulc::CodeGen::createEntryBlockAlloca(llvm::Type* llvmType, llvm::Twine const& name) {
+    // NOTE: We don't use `_entryBlockBuilder` here as it appends to the end of the entry block, if the entry block has
+    //       already been terminated that would put the `alloca` after the terminator.
+    // NOTE: Every stack slot MUST be created here. An `alloca` outside of the entry block is a dynamic allocation
+    //       (inside a loop it grows the stack every iteration) and `SROA`/`mem2reg` will not touch it. Slots in the
+    //       entry block that never escape get promoted to registers or split into scalars by the function pass
+    //       manager, so short lived locals, temporaries, and `in` reference spills cost nothing after optimization.
+    llvm::BasicBlock& entryBlock = _currentLlvmFunction->getEntryBlock();
+    llvm::IRBuilder<> entryBuilder(&entryBlock, entryBlock.begin());
+
+    llvm::AllocaInst* result = entryBuilder.CreateAlloca(llvmType, nullptr, name);
+    result->setAlignment(llvm::Align(getLlvmTypeAlignment(llvmType)));
+    return result;
+}
+
+std::uint64_t gulc::CodeGen::getLlvmTypeAlignment(llvm::Type* llvmType) {
+    // Our struct types are packed (we add the padding ourselves) so LLVM thinks they only need an alignment of `1`.
+    // The members are laid out at offsets aligned to their own alignment, so the struct has to be at least as aligned
+    // as its most aligned member or members such as `simd` vectors would be misaligned in memory.
+    if (auto structType = llvm::dyn_cast<llvm::StructType>(llvmType)) {
+        if (structType->isPacked()) {
+            std::uint64_t result = 1;
+
+            for (llvm::Type* elementType : structType->elements()) {
+                result = std::max(result, getLlvmTypeAlignment(elementType));
+            }
+
+            return result;
+        }
+    } else if (auto arrayType = llvm::dyn_cast<llvm::ArrayType>(llvmType)) {
+        return getLlvmTypeAlignment(arrayType->getElementType());
+    }
+
+    return _llvmModule->getDataLayout().getABITypeAlignment(llvmType);
+}
+
 std::uint64_t gulc::CodeGen::generateConstSize(gulc::Expr* constSize) {
     if (!llvm::isa<ValueLiteralExpr>(constSize)) {
         printError("[INTERNAL] `CodeGen::generateConstSize` received non-value literal!",
@@ -330,17 +851,7 @@ llvm::Function* gulc::CodeGen::getFunctionFromDecl(gulc::FunctionDecl* functionD
         }
     }
 
-    std::vector<llvm::Type*> paramTypes = generateLlvmParamTypes(functionDecl->parameters(), parentStruct,
-                                                                 functionDecl->returnType);
-    llvm::Type* returnType = nullptr;
-
-    if (functionDecl->returnType == nullptr) {
-        returnType = llvm::Type::getVoidTy(*_llvmContext);
-    } else {
-        returnType = generateLlvmType(functionDecl->returnType);
-    }
-
-    llvm::FunctionType* functionType = llvm::FunctionType::get(returnType, paramTypes, false);
+    llvm::FunctionType* functionType = getFunctionType(functionDecl, parentStruct);
     llvm::Function* function = _llvmModule->getFunction(functionDecl->mangledName());
 
     if (!function) {
@@ -352,8 +863,13 @@ llvm::Function* gulc::CodeGen::getFunctionFromDecl(gulc::FunctionDecl* functionD
 //        }
 
         function = llvm::Function::Create(functionType, linkageType, functionDecl->mangledName(), _llvmModule);
+        applyAbiAttributes(function, functionDecl->parameters(), parentStruct, functionDecl->returnType);
+        // NOTE: The hints are applied to declarations as well, a call to a `cold` declaration is still a cold path
+        applyFunctionHintAttributes(function, functionDecl);
     }
 
+    requireLinkOnceDecl(functionDecl);
+
     return function;
 }
 
@@ -412,9 +928,19 @@ void gulc::CodeGen::generateDecl(gulc::Decl const* decl, bool isInternal) {
 }
 
 void gulc::CodeGen::generateConstructorDecl(gulc::ConstructorDecl const* constructorDecl, bool isInternal) {
+    if (isLinkOnceDecl(constructorDecl) && !_isGeneratingLinkOnceDecls) {
+        // Generated by the modules that reference it, see `generateLinkOnceDecls`
+        return;
+    }
+
     auto parentStruct = llvm::dyn_cast<StructDecl>(constructorDecl->container);
 
     std::vector<llvm::Type*> paramTypes = generateLlvmParamTypes(constructorDecl->parameters(), parentStruct, nullptr);
+
+    if (constructorDecl->throws()) {
+        paramTypes.push_back(llvm::PointerType::getUnqual(generateLlvmErrorSlotType(constructorDecl->throwsType())));
+    }
+
     // All constructors return void. We construct the `this` parameter. Memory allocation for the struct is
     // NOT handled by the constructor
     llvm::Type* returnType = llvm::Type::getVoidTy(*_llvmContext);
@@ -429,6 +955,7 @@ void gulc::CodeGen::generateConstructorDecl(gulc::ConstructorDecl const* constru
         }
 
         function = llvm::Function::Create(functionType, linkageType, constructorDecl->mangledName(), _llvmModule);
+        applyAbiAttributes(function, constructorDecl->parameters(), parentStruct, nullptr);
     }
 
     // Generate the constructor that DOESN'T assign the vtable
@@ -437,7 +964,7 @@ void gulc::CodeGen::generateConstructorDecl(gulc::ConstructorDecl const* constru
         _irBuilder->SetInsertPoint(funcBody);
         _currentFunctionExitBlock = llvm::BasicBlock::Create(*_llvmContext, "exit");
 
-        setCurrentFunction(function, constructorDecl);
+        setCurrentFunction(function, constructorDecl, parentStruct);
 
         // If there is a base constructor we HAVE to call it as the first line of the constructor
         if (constructorDecl->baseConstructorCall != nullptr) {
@@ -452,8 +979,9 @@ void gulc::CodeGen::generateConstructorDecl(gulc::ConstructorDecl const* constru
         // NOTE: For constructors we always `ret void`...
         _irBuilder->CreateRetVoid();
 
+        generateErrorExitBlock();
+
         verifyFunction(*function);
-        _funcPassManager->run(*function);
 
         // Reset the insertion point (this probably isn't needed but oh well)
         _irBuilder->ClearInsertionPoint();
@@ -475,6 +1003,7 @@ void gulc::CodeGen::generateConstructorDecl(gulc::ConstructorDecl const* constru
 
             functionVTable = llvm::Function::Create(functionType, linkageType, constructorDecl->mangledNameVTable(),
                                                     _llvmModule);
+            applyAbiAttributes(functionVTable, constructorDecl->parameters(), parentStruct, nullptr);
         }
 
         // Generate the constructor that DOES assign the vtable
@@ -486,12 +1015,13 @@ void gulc::CodeGen::generateConstructorDecl(gulc::ConstructorDecl const* constru
             _irBuilder->SetInsertPoint(funcBody);
             _currentFunctionExitBlock = llvm::BasicBlock::Create(*_llvmContext, "exit");
 
-            setCurrentFunction(functionVTable, constructorDecl);
+            setCurrentFunction(functionVTable, constructorDecl, parentStruct);
 
             // TODO: Assign vtable here
             {
                 llvm::Value *refThis = _currentLlvmFunctionParameters[0];
-                llvm::Value *derefThis = _irBuilder->CreateLoad(refThis);
+                llvm::Value *derefThis = _irBuilder->CreateLoad(refThis->getType()->getPointerElementType(),
+                                                                refThis);
                 llvm::Value *vtableOwner = derefThis;
 
                 // Cast to the vtable owner if we have to
@@ -504,7 +1034,7 @@ void gulc::CodeGen::generateConstructorDecl(gulc::ConstructorDecl const* constru
 
                 // Get a pointer to array
                 llvm::Value *index0 = llvm::ConstantInt::get(*_llvmContext, llvm::APInt(32, 0, false));
-                vtableRef = _irBuilder->CreateGEP(vtableRef, index0);
+                vtableRef = _irBuilder->CreateGEP(vtableRef->getType()->getPointerElementType(), vtableRef, index0);
 
                 // Cast the pointer to the correct type (void (...)**)
                 llvm::Type *elementType = llvm::FunctionType::get(llvm::Type::getVoidTy(*_llvmContext), true);
@@ -514,7 +1044,8 @@ void gulc::CodeGen::generateConstructorDecl(gulc::ConstructorDecl const* constru
                 vtableRef = _irBuilder->CreateBitCast(vtableRef, elementType);
 
                 // Grab the vtable member and set it
-                llvm::Value *vtableMemberRef = _irBuilder->CreateStructGEP(vtableOwner, 0);
+                llvm::Value *vtableMemberRef = _irBuilder->CreateStructGEP(
+                        vtableOwner->getType()->getPointerElementType(), vtableOwner, 0);
                 _irBuilder->CreateStore(vtableRef, vtableMemberRef, false);
             }
 
@@ -531,8 +1062,9 @@ void gulc::CodeGen::generateConstructorDecl(gulc::ConstructorDecl const* constru
             // NOTE: For constructors we always `ret void`...
             _irBuilder->CreateRetVoid();
 
+            generateErrorExitBlock();
+
             verifyFunction(*functionVTable);
-            _funcPassManager->run(*functionVTable);
 
             // Reset the insertion point (this probably isn't needed but oh well)
             _irBuilder->ClearInsertionPoint();
@@ -544,6 +1076,11 @@ void gulc::CodeGen::generateConstructorDecl(gulc::ConstructorDecl const* constru
 }
 
 void gulc::CodeGen::generateDestructorDecl(gulc::DestructorDecl const* destructorDecl, bool isInternal) {
+    if (isLinkOnceDecl(destructorDecl) && !_isGeneratingLinkOnceDecls) {
+        // Generated by the modules that reference it, see `generateLinkOnceDecls`
+        return;
+    }
+
     auto parentStruct = llvm::dyn_cast<StructDecl>(destructorDecl->container);
 
     // Destructors DO NOT support parameters except for the single `this` parameter
@@ -568,7 +1105,7 @@ void gulc::CodeGen::generateDestructorDecl(gulc::DestructorDecl const* destructo
     _irBuilder->SetInsertPoint(funcBody);
     _currentFunctionExitBlock = llvm::BasicBlock::Create(*_llvmContext, "exit");
 
-    setCurrentFunction(function, destructorDecl);
+    setCurrentFunction(function, destructorDecl, parentStruct);
 
     // Generate the function body
     generateStmt(destructorDecl->body());
@@ -579,7 +1116,6 @@ void gulc::CodeGen::generateDestructorDecl(gulc::DestructorDecl const* destructo
     _irBuilder->CreateRetVoid();
 
     verifyFunction(*function);
-    _funcPassManager->run(*function);
 
     // Reset the insertion point (this probably isn't needed but oh well)
     _irBuilder->ClearInsertionPoint();
@@ -602,6 +1138,16 @@ void gulc::CodeGen::generateEnumDecl(gulc::EnumDecl const* enumDecl, bool isInte
 void gulc::CodeGen::generateFunctionDecl(gulc::FunctionDecl const* functionDecl, bool isInternal) {
     assert(!functionDecl->mangledName().empty());
 
+    if (!functionDecl->isReachable) {
+        // Nothing can call the function, see `DeadDeclEliminator`
+        return;
+    }
+
+    if (isLinkOnceDecl(functionDecl) && !_isGeneratingLinkOnceDecls) {
+        // Generated by the modules that reference it, see `generateLinkOnceDecls`
+        return;
+    }
+
     gulc::StructDecl* parentStruct = nullptr;
 
     if (functionDecl->container != nullptr) {
@@ -633,13 +1179,20 @@ void gulc::CodeGen::generateFunctionDecl(gulc::FunctionDecl const* functionDecl,
         }
 
         function = llvm::Function::Create(functionType, linkageType, functionDecl->mangledName(), _llvmModule);
+        applyAbiAttributes(function, functionDecl->parameters(), parentStruct, functionDecl->returnType);
+    } else if (isFilePrivateDecl(functionDecl)) {
+        // The prototype made by an earlier call is `external`, a `private` definition must not be visible to the
+        // linker
+        function->setLinkage(llvm::Function::LinkageTypes::InternalLinkage);
     }
 
+    applyFunctionHintAttributes(function, functionDecl);
+
     llvm::BasicBlock* funcBody = llvm::BasicBlock::Create(*_llvmContext, "entry", function);
     _irBuilder->SetInsertPoint(funcBody);
     _currentFunctionExitBlock = llvm::BasicBlock::Create(*_llvmContext, "exit");
 
-    setCurrentFunction(function, functionDecl);
+    setCurrentFunction(function, functionDecl, parentStruct);
 
     // If the return type isn't `void` we create an alloca for the return value. I don't want to deal with phi nodes
     // right now. I'll deal with them when we port the compiler to Ghoul and start handling the IR ourselves.
@@ -647,33 +1200,62 @@ void gulc::CodeGen::generateFunctionDecl(gulc::FunctionDecl const* functionDecl,
         !(llvm::isa<BuiltInType>(functionDecl->returnType) &&
           llvm::dyn_cast<BuiltInType>(functionDecl->returnType)->sizeInBytes() == 0)) {
         // If the return type is `struct` we make the return value `*structType param 0`...
-        if (llvm::isa<StructType>(functionDecl->returnType)) {
-            _currentFunctionReturnValue = _irBuilder->CreateLoad(_currentLlvmFunctionParameters[0]);
+        if (returnsViaSRet(functionDecl->returnType)) {
+            llvm::Value* sretParameter = _currentLlvmFunctionParameters[0];
+            _currentFunctionReturnValue = _irBuilder->CreateLoad(sretParameter->getType()->getPointerElementType(),
+                                                                 sretParameter);
         } else {
-            _currentFunctionReturnValue = _irBuilder->CreateAlloca(generateLlvmType(functionDecl->returnType));
+            // Structs returned in registers are still constructed in place, we just do it in a local slot and load
+            // the coerced value out of it in the exit block
+            _currentFunctionReturnValue = createEntryBlockAlloca(generateLlvmType(functionDecl->returnType));
         }
     }
 
+    collectContractRanges(functionDecl);
+    generateContracts(functionDecl, Cont::Kind::Requires);
+    _currentFunctionChecksEnsures = true;
+
     // Generate the function body
     generateStmt(functionDecl->body());
 
+    _currentFunctionChecksEnsures = false;
     _currentLlvmFunction->getBasicBlockList().push_back(_currentFunctionExitBlock);
     _irBuilder->SetInsertPoint(_currentFunctionExitBlock);
 
     if (_currentFunctionReturnValue != nullptr) {
         // If the function returns a struct we need to store the value in `sret` param 0 then return void
-        if (llvm::isa<StructType>(functionDecl->returnType)) {
+        if (returnsViaSRet(functionDecl->returnType)) {
             //_irBuilder->CreateStore(_currentFunctionReturnValue, _currentLlvmFunctionParameters[0]);
             _irBuilder->CreateRetVoid();
+        } else if (SysVAbiClassifier::isAggregate(functionDecl->returnType)) {
+            llvm::Type* llvmReturnType = _currentLlvmFunction->getReturnType();
+
+            if (llvmReturnType->isVoidTy()) {
+                // Zero sized structs don't return anything
+                _irBuilder->CreateRetVoid();
+            } else {
+                llvm::Value* coercedRef = _irBuilder->CreateBitCast(_currentFunctionReturnValue,
+                                                                    llvm::PointerType::getUnqual(llvmReturnType));
+                _irBuilder->CreateRet(_irBuilder->CreateLoad(llvmReturnType, coercedRef));
+            }
         } else {
-            _irBuilder->CreateRet(_irBuilder->CreateLoad(_currentFunctionReturnValue));
+            _irBuilder->CreateRet(_irBuilder->CreateLoad(_currentLlvmFunction->getReturnType(),
+                                                         _currentFunctionReturnValue));
         }
     } else {
         _irBuilder->CreateRetVoid();
     }
 
+    generateErrorExitBlock();
+
+    for (FunctionHintAttr const* functionHint : getFunctionHints(functionDecl)) {
+        if (functionHint->hint() == FunctionHintAttr::Hint::Flatten) {
+            flattenCallSites(function);
+            break;
+        }
+    }
+
     verifyFunction(*function);
-    _funcPassManager->run(*function);
 
     // Reset the insertion point (this probably isn't needed but oh well)
     _irBuilder->ClearInsertionPoint();
@@ -700,53 +1282,9 @@ void gulc::CodeGen::generatePropertyDecl(gulc::PropertyDecl const* propertyDecl,
 }
 
 void gulc::CodeGen::generateStructDecl(gulc::StructDecl const* structDecl, bool isInternal) {
-    if (!structDecl->vtable.empty()) {
-        // If the struct has a vtable we have to generate a global variable for it...
-        llvm::Type* vtableEntryType =
-                llvm::PointerType::get(
-                        llvm::FunctionType::get(llvm::Type::getVoidTy(*_llvmContext), true), 0);
-
-        std::vector<llvm::Constant*> vtableEntries;
-
-        for (FunctionDecl* functionDecl : structDecl->vtable) {
-            llvm::Function* vtableFunction;
-
-            // TODO: Is `functionDecl == structDecl->destructor` correct? I believe we're actually putting the
-            //       destructor in the vtable list like this.
-            if (structDecl->destructor != nullptr && structDecl->destructor->isAnyVirtual() &&
-                    functionDecl == structDecl->destructor) {
-                // Destructors DO NOT support parameters except for the single `this` parameter
-                std::vector<llvm::Type*> paramTypes = generateLlvmParamTypes({}, structDecl, nullptr);
-                // All constructors return void. We construct the `this` parameter. Memory allocation for the struct is
-                // NOT handled by the constructor
-                llvm::Type* returnType = llvm::Type::getVoidTy(*_llvmContext);
-                llvm::FunctionType* functionType = llvm::FunctionType::get(returnType, paramTypes, false);
-                vtableFunction = _llvmModule->getFunction(structDecl->destructor->mangledName());
-
-                if (!vtableFunction) {
-                    auto linkageType = llvm::Function::LinkageTypes::ExternalLinkage;
-
-                    if (isInternal) {
-                        linkageType = llvm::Function::LinkageTypes::InternalLinkage;
-                    }
-
-                    vtableFunction = llvm::Function::Create(functionType, linkageType,
-                                                            structDecl->destructor->mangledName(), _llvmModule);
-                }
-            } else {
-                vtableFunction = getFunction(functionDecl);
-            }
-
-            vtableEntries.push_back(llvm::ConstantExpr::getBitCast(vtableFunction, vtableEntryType));
-        }
-
-        llvm::ArrayType* vtableType = llvm::ArrayType::get(vtableEntryType, vtableEntries.size());
-
-        llvm::Constant* llvmVTableEntries = llvm::ConstantArray::get(vtableType, vtableEntries);
-
-        new llvm::GlobalVariable(*_llvmModule, vtableType, false,
-                                 llvm::GlobalVariable::LinkageTypes::ExternalLinkage,
-                                 llvmVTableEntries, structDecl->vtableName);
+    // NOTE: The vtable of a template instantiation is generated alongside its constructors by the modules that use them
+    if (!structDecl->vtable.empty() && !isLinkOnceDecl(structDecl)) {
+        generateVTable(structDecl, isInternal);
     }
 
     for (ConstructorDecl const* constructor : structDecl->constructors()) {
@@ -782,14 +1320,13 @@ void gulc::CodeGen::generateSubscriptOperatorDecl(gulc::SubscriptOperatorDecl co
 
 void gulc::CodeGen::generateTemplateFunctionDecl(gulc::TemplateFunctionDecl const* templateFunctionDecl,
                                                  bool isInternal) {
-    // TODO: Is there anything else to do besides pass the instantiations to the normal generators?
-    for (auto templateFunctionInst : templateFunctionDecl->templateInstantiations()) {
-        generateFunctionDecl(templateFunctionInst, isInternal);
-    }
+    // NOTE: Template function instantiations are `linkonce_odr`, they are only generated by the modules that reference
+    //       them (see `generateLinkOnceDecls`) so there is nothing to generate for the template itself.
 }
 
 void gulc::CodeGen::generateTemplateStructDecl(gulc::TemplateStructDecl const* templateStructDecl, bool isInternal) {
-    // TODO: Is there anything else to do besides pass the instantiations to the normal generators?
+    // NOTE: This only generates the static variables of each instantiation, the functions and vtable are
+    //       `linkonce_odr` and are generated by the modules that reference them (see `generateLinkOnceDecls`)
     for (auto templateStructInst : templateStructDecl->templateInstantiations()) {
         generateStructDecl(templateStructInst, isInternal);
     }
@@ -803,10 +1340,17 @@ void gulc::CodeGen::generateTemplateTraitDecl(gulc::TemplateTraitDecl const* tem
 }
 
 void gulc::CodeGen::generateTraitDecl(gulc::TraitDecl const* traitDecl, bool isInternal) {
-    // TODO:
+    // TODO: Default implementations within traits aren't generated yet
+    // NOTE: There is nothing to generate for the trait itself. The witness tables for each `struct` that implements
+    //       the trait are generated by `getWitnessTable` in every module that creates a trait object from the struct.
 }
 
 void gulc::CodeGen::generateVariableDecl(gulc::VariableDecl const* variableDecl, bool isInternal) {
+    if (!variableDecl->isReachable) {
+        // Nothing references the variable, see `DeadDeclEliminator`
+        return;
+    }
+
     llvm::GlobalVariable* checkExtern = _llvmModule->getGlobalVariable(variableDecl->identifier().name(), true);
 
     llvm::Constant* initialValue = nullptr;
@@ -828,17 +1372,270 @@ void gulc::CodeGen::generateVariableDecl(gulc::VariableDecl const* variableDecl,
 
         auto linkageType = llvm::Function::LinkageTypes::ExternalLinkage;
 
-        if (isInternal) {
+        // Other modules declare our non-`private` variables `extern` through the module interface, those have to be
+        // visible to the linker
+        if (isInternal && isFilePrivateDecl(variableDecl) && !variableDecl->isReferencedByExport) {
             linkageType = llvm::Function::LinkageTypes::InternalLinkage;
         }
 
-        new llvm::GlobalVariable(*_llvmModule, llvmType, isConstant, linkageType, initialValue,
-                                 variableDecl->mangledName());
+        auto globalVariable = new llvm::GlobalVariable(*_llvmModule, llvmType, isConstant, linkageType,
+                                                       initialValue, variableDecl->mangledName());
+        globalVariable->setAlignment(llvm::Align(getLlvmTypeAlignment(llvmType)));
+    }
+}
+
+llvm::GlobalVariable* gulc::CodeGen::generateVTable(gulc::StructDecl const* structDecl, bool isInternal) {
+    llvm::Type* vtableEntryType =
+            llvm::PointerType::get(
+                    llvm::FunctionType::get(llvm::Type::getVoidTy(*_llvmContext), true), 0);
+
+    std::vector<llvm::Constant*> vtableEntries;
+
+    for (FunctionDecl* functionDecl : structDecl->vtable) {
+        llvm::Function* vtableFunction;
+
+        // TODO: Is `functionDecl == structDecl->destructor` correct? I believe we're actually putting the
+        //       destructor in the vtable list like this.
+        if (structDecl->destructor != nullptr && structDecl->destructor->isAnyVirtual() &&
+                functionDecl == structDecl->destructor) {
+            // Destructors DO NOT support parameters except for the single `this` parameter
+            std::vector<llvm::Type*> paramTypes = generateLlvmParamTypes({}, structDecl, nullptr);
+            // All constructors return void. We construct the `this` parameter. Memory allocation for the struct is
+            // NOT handled by the constructor
+            llvm::Type* returnType = llvm::Type::getVoidTy(*_llvmContext);
+            llvm::FunctionType* functionType = llvm::FunctionType::get(returnType, paramTypes, false);
+            vtableFunction = _llvmModule->getFunction(structDecl->destructor->mangledName());
+
+            if (!vtableFunction) {
+                auto linkageType = llvm::Function::LinkageTypes::ExternalLinkage;
+
+                if (isInternal) {
+                    linkageType = llvm::Function::LinkageTypes::InternalLinkage;
+                }
+
+                vtableFunction = llvm::Function::Create(functionType, linkageType,
+                                                        structDecl->destructor->mangledName(), _llvmModule);
+            }
+
+            requireLinkOnceDecl(structDecl->destructor);
+        } else {
+            vtableFunction = getFunction(functionDecl);
+        }
+
+        vtableEntries.push_back(llvm::ConstantExpr::getBitCast(vtableFunction, vtableEntryType));
+    }
+
+    llvm::ArrayType* vtableType = llvm::ArrayType::get(vtableEntryType, vtableEntries.size());
+
+    llvm::Constant* llvmVTableEntries = llvm::ConstantArray::get(vtableType, vtableEntries);
+
+    return new llvm::GlobalVariable(*_llvmModule, vtableType, false,
+                                    llvm::GlobalVariable::LinkageTypes::ExternalLinkage,
+                                    llvmVTableEntries, structDecl->vtableName);
+}
+
+llvm::GlobalVariable* gulc::CodeGen::getWitnessTable(gulc::StructDecl* structDecl, gulc::TraitDecl* traitDecl) {
+    std::string witnessTableName = WitnessTableUtil::getWitnessTableName(structDecl, traitDecl);
+    llvm::GlobalVariable* witnessTable = _llvmModule->getGlobalVariable(witnessTableName, true);
+
+    if (witnessTable != nullptr) {
+        return witnessTable;
+    }
+
+    std::vector<FunctionDecl*> const* witnessFunctions = WitnessTableUtil::getWitnessTable(structDecl, traitDecl);
+
+    if (witnessFunctions == nullptr) {
+        printError("[INTERNAL] `" + structDecl->identifier().name() + "` is missing an implementation for trait `" +
+                   traitDecl->identifier().name() + "`!",
+                   structDecl->startPosition(), structDecl->endPosition());
+    }
+
+    llvm::Type* witnessEntryType =
+            llvm::PointerType::get(
+                    llvm::FunctionType::get(llvm::Type::getVoidTy(*_llvmContext), true), 0);
+
+    std::vector<llvm::Constant*> witnessEntries;
+    witnessEntries.reserve(witnessFunctions->size());
+
+    for (std::size_t i = 0; i < witnessFunctions->size(); ++i) {
+        FunctionDecl* witnessFunction = (*witnessFunctions)[i];
+        llvm::Function* witnessEntry = getFunction(witnessFunction);
+        auto vtableEntry = std::find(structDecl->vtable.begin(), structDecl->vtable.end(), witnessFunction);
+
+        // The object behind the trait object might be a subclass that overrides a `virtual` implementation, those
+        // have to go through the vtable the same as a call on the struct itself would
+        if (vtableEntry != structDecl->vtable.end()) {
+            witnessEntry = getWitnessVTableThunk(structDecl, witnessEntry, vtableEntry - structDecl->vtable.begin(),
+                                                 witnessTableName + "_vcall" + std::to_string(i));
+        }
+
+        witnessEntries.push_back(llvm::ConstantExpr::getBitCast(witnessEntry, witnessEntryType));
+    }
+
+    llvm::ArrayType* witnessTableType = llvm::ArrayType::get(witnessEntryType, witnessEntries.size());
+
+    // Every module that creates a trait object gets its own copy of the witness table, the linker keeps one of them
+    witnessTable = new llvm::GlobalVariable(*_llvmModule, witnessTableType, true,
+                                            llvm::GlobalVariable::LinkageTypes::LinkOnceODRLinkage,
+                                            llvm::ConstantArray::get(witnessTableType, witnessEntries),
+                                            witnessTableName);
+    setLinkOnceODR(witnessTable);
+
+    return witnessTable;
+}
+
+llvm::Function* gulc::CodeGen::getWitnessVTableThunk(gulc::StructDecl* structDecl, llvm::Function* implementation,
+                                                     std::size_t vtableIndex, std::string const& thunkName) {
+    llvm::Function* thunk = _llvmModule->getFunction(thunkName);
+
+    if (thunk != nullptr) {
+        return thunk;
+    }
+
+    // The thunk has the exact signature of the implementation so the arguments are forwarded untouched
+    llvm::FunctionType* functionType = implementation->getFunctionType();
+    thunk = llvm::Function::Create(functionType, llvm::Function::LinkageTypes::LinkOnceODRLinkage, thunkName,
+                                   _llvmModule);
+    thunk->setAttributes(implementation->getAttributes());
+    setLinkOnceODR(thunk);
+
+    // NOTE: Witness tables are created while generating the function that makes the trait object
+    llvm::IRBuilderBase::InsertPointGuard insertPointGuard(*_irBuilder);
+    _irBuilder->SetInsertPoint(llvm::BasicBlock::Create(*_llvmContext, "entry", thunk));
+
+    std::vector<llvm::Value*> llvmArgs;
+    llvmArgs.reserve(thunk->arg_size());
+
+    for (llvm::Argument& argument : thunk->args()) {
+        llvmArgs.push_back(&argument);
+    }
+
+    // `self` comes after the `sret` pointer
+    std::size_t selfIndex = thunk->hasParamAttribute(0, llvm::Attribute::StructRet) ? 1 : 0;
+    llvm::Value* functionPointer = getVTableFunctionPointer(structDecl, llvmArgs[selfIndex], vtableIndex,
+                                                            functionType);
+    llvm::CallInst* callInst = _irBuilder->CreateCall(functionType, functionPointer, llvmArgs);
+    callInst->setAttributes(implementation->getAttributes());
+    callInst->setTailCall();
+
+    if (functionType->getReturnType()->isVoidTy()) {
+        _irBuilder->CreateRetVoid();
+    } else {
+        _irBuilder->CreateRet(callInst);
+    }
+
+    return thunk;
+}
+
+bool gulc::CodeGen::isLinkOnceDecl(gulc::Decl const* decl) const {
+    // Every module that uses a template instantiation gets its own copy, the linker keeps one of them
+    for (Decl const* checkDecl = decl; checkDecl != nullptr; checkDecl = checkDecl->container) {
+        if (llvm::isa<TemplateStructInstDecl>(checkDecl) || llvm::isa<TemplateFunctionInstDecl>(checkDecl)) {
+            return true;
+        }
+    }
+
+    // A `private` function is only visible to its own file, two files can have one with the same mangled name and
+    // merging them would keep the wrong body. They stay `internal` instead.
+    if (isFilePrivateDecl(decl)) {
+        return false;
+    }
+
+    // `@inline` functions need their body in every module that calls them for the always inliner to do anything
+    if (auto functionDecl = llvm::dyn_cast<FunctionDecl>(decl)) {
+        for (FunctionHintAttr const* functionHint : getFunctionHints(functionDecl)) {
+            if (functionHint->hint() == FunctionHintAttr::Hint::Inline) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool gulc::CodeGen::isFilePrivateDecl(gulc::Decl const* decl) const {
+    for (Decl const* checkDecl = decl; checkDecl != nullptr; checkDecl = checkDecl->container) {
+        if (checkDecl->visibility() == Decl::Visibility::Private) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool gulc::CodeGen::isImportedPrivateDecl(gulc::FunctionDecl const* functionDecl) const {
+    // A module interface keeps the body of any `private` function its exported bodies call, the function isn't
+    // visible to the linker so every module that calls it generates an `internal` copy
+    return functionDecl->sourceFileID() != _currentFile->sourceFileID && !functionDecl->isPrototype() &&
+           isFilePrivateDecl(functionDecl);
+}
+
+void gulc::CodeGen::requireLinkOnceDecl(gulc::FunctionDecl const* functionDecl) {
+    if (_linkOnceDecls.find(functionDecl) != _linkOnceDecls.end() ||
+            (!isLinkOnceDecl(functionDecl) && !isImportedPrivateDecl(functionDecl))) {
+        return;
+    }
+
+    _linkOnceDecls.insert(functionDecl);
+    _linkOnceDeclQueue.push_back(functionDecl);
+}
+
+void gulc::CodeGen::generateLinkOnceDecls() {
+    _isGeneratingLinkOnceDecls = true;
+
+    // NOTE: Generating a body can reference more `linkonce_odr` functions, those are added to the queue as we go
+    while (!_linkOnceDeclQueue.empty()) {
+        FunctionDecl const* functionDecl = _linkOnceDeclQueue.back();
+        _linkOnceDeclQueue.pop_back();
+
+        if (llvm::isa<ConstructorDecl>(functionDecl)) {
+            auto constructorDecl = llvm::dyn_cast<ConstructorDecl>(functionDecl);
+            auto parentStruct = llvm::dyn_cast<StructDecl>(constructorDecl->container);
+
+            // The vtable constructor references the vtable, we need our own copy of it the same as the constructor
+            if (!parentStruct->vtable.empty() &&
+                    _llvmModule->getGlobalVariable(parentStruct->vtableName, true) == nullptr) {
+                setLinkOnceODR(generateVTable(parentStruct, false));
+            }
+
+            generateConstructorDecl(constructorDecl, false);
+
+            if (!parentStruct->vtable.empty()) {
+                setOnDemandLinkage(functionDecl, _llvmModule->getFunction(constructorDecl->mangledNameVTable()));
+            }
+        } else if (llvm::isa<DestructorDecl>(functionDecl)) {
+            generateDestructorDecl(llvm::dyn_cast<DestructorDecl>(functionDecl), false);
+        } else {
+            generateFunctionDecl(functionDecl, false);
+        }
+
+        setOnDemandLinkage(functionDecl, _llvmModule->getFunction(functionDecl->mangledName()));
+    }
+
+    _isGeneratingLinkOnceDecls = false;
+}
+
+void gulc::CodeGen::setOnDemandLinkage(gulc::FunctionDecl const* functionDecl, llvm::GlobalObject* globalObject) {
+    if (isLinkOnceDecl(functionDecl)) {
+        setLinkOnceODR(globalObject);
+    } else {
+        globalObject->setLinkage(llvm::GlobalValue::LinkageTypes::InternalLinkage);
     }
 }
 
+void gulc::CodeGen::setLinkOnceODR(llvm::GlobalObject* globalObject) {
+    // Each definition gets a COMDAT of its own so the linker folds the copies from every object into one and
+    // `--gc-sections` can drop the ones that end up unused
+    llvm::Comdat* comdat = _llvmModule->getOrInsertComdat(globalObject->getName());
+    comdat->setSelectionKind(llvm::Comdat::Any);
+
+    globalObject->setLinkage(llvm::GlobalValue::LinkageTypes::LinkOnceODRLinkage);
+    globalObject->setComdat(comdat);
+}
+
 void gulc::CodeGen::setCurrentFunction(llvm::Function* currentFunction,
-                                       gulc::FunctionDecl const* currentGhoulFunction) {
+                                       gulc::FunctionDecl const* currentGhoulFunction,
+                                       gulc::StructDecl const* parentStruct) {
     if (_entryBlockBuilder) {
         delete _entryBlockBuilder;
         _entryBlockBuilder = nullptr;
@@ -847,18 +1644,91 @@ void gulc::CodeGen::setCurrentFunction(llvm::Function* currentFunction,
     _currentLlvmFunctionParameters.clear();
     _currentLlvmFunctionLocalVariables.clear();
     _currentLlvmFunctionLabels.clear();
+    _currentParameterRanges.clear();
+    _currentFunctionReturnValue = nullptr;
+    _currentReturnCleanupBlocks.assign(currentGhoulFunction->returnCleanups.size(), nullptr);
+    _currentErrorCleanupBlocks.assign(currentGhoulFunction->returnCleanups.size(), nullptr);
+    _currentFunctionChecksEnsures = false;
+    _currentFunctionErrorSlot = nullptr;
+    _currentFunctionErrorExitBlock = nullptr;
+    _currentCatchStates.clear();
+    _currentTryExpr = nullptr;
 
     _currentLlvmFunction = currentFunction;
     _currentGhoulFunction = currentGhoulFunction;
     _entryBlockBuilder = new llvm::IRBuilder<>(&currentFunction->getEntryBlock(),
                                                currentFunction->getEntryBlock().begin());
 
-    for (llvm::Argument& arg : currentFunction->args()) {
-        llvm::AllocaInst* allocaInst = _entryBlockBuilder->CreateAlloca(arg.getType(), nullptr);
+    FunctionAbiInfo abiInfo = classifyFunctionAbi(currentGhoulFunction->parameters(), parentStruct,
+                                                  currentGhoulFunction->returnType);
+    auto argIterator = currentFunction->arg_begin();
+
+    // `sret` and `self` are always passed directly
+    std::size_t directArgCount = (abiInfo.returnInfo.kind == AbiArgInfo::Kind::Indirect ? 1 : 0) +
+                                 (parentStruct != nullptr ? 1 : 0);
+
+    for (std::size_t i = 0; i < directArgCount; ++i, ++argIterator) {
+        llvm::AllocaInst* allocaInst = createEntryBlockAlloca(argIterator->getType());
 
         _currentLlvmFunctionParameters.push_back(allocaInst);
 
-        _entryBlockBuilder->CreateStore(&arg, allocaInst);
+        _entryBlockBuilder->CreateStore(&*argIterator, allocaInst);
+    }
+
+    for (std::size_t i = 0; i < abiInfo.parameterInfos.size(); ++i) {
+        AbiArgInfo const& parameterInfo = abiInfo.parameterInfos[i];
+
+        switch (parameterInfo.kind) {
+            case AbiArgInfo::Kind::Direct: {
+                llvm::AllocaInst* allocaInst = createEntryBlockAlloca(argIterator->getType());
+
+                _currentLlvmFunctionParameters.push_back(allocaInst);
+
+                _entryBlockBuilder->CreateStore(&*argIterator, allocaInst);
+                ++argIterator;
+                break;
+            }
+            case AbiArgInfo::Kind::Coerce: {
+                // Reassemble the struct from its eightbytes so the rest of `CodeGen` can treat it as a normal
+                // parameter
+                llvm::Type* structType = generateLlvmType(currentGhoulFunction->parameters()[i]->type);
+                llvm::Type* coercedType = generateLlvmAbiCoercedType(parameterInfo);
+                llvm::AllocaInst* allocaInst = createEntryBlockAlloca(structType);
+                llvm::Value* coercedRef = _entryBlockBuilder->CreateBitCast(
+                        allocaInst, llvm::PointerType::getUnqual(coercedType));
+
+                if (parameterInfo.hasHi()) {
+                    _entryBlockBuilder->CreateStore(&*argIterator,
+                                                    _entryBlockBuilder->CreateStructGEP(coercedType, coercedRef, 0));
+                    ++argIterator;
+                    _entryBlockBuilder->CreateStore(&*argIterator,
+                                                    _entryBlockBuilder->CreateStructGEP(coercedType, coercedRef, 1));
+                    ++argIterator;
+                } else {
+                    _entryBlockBuilder->CreateStore(&*argIterator, coercedRef);
+                    ++argIterator;
+                }
+
+                _currentLlvmFunctionParameters.push_back(allocaInst);
+                break;
+            }
+            case AbiArgInfo::Kind::Indirect:
+                // `byval` arguments are already a private copy in memory, we can use the pointer as the storage
+                _currentLlvmFunctionParameters.push_back(&*argIterator);
+                ++argIterator;
+                break;
+            case AbiArgInfo::Kind::Ignore: {
+                llvm::Type* structType = generateLlvmType(currentGhoulFunction->parameters()[i]->type);
+
+                _currentLlvmFunctionParameters.push_back(createEntryBlockAlloca(structType));
+                break;
+            }
+        }
+    }
+
+    // The error slot is always the last argument, it is only ever used as a pointer so we don't spill it
+    if (currentGhoulFunction->throws()) {
+        _currentFunctionErrorSlot = &*argIterator;
     }
 }
 
@@ -866,12 +1736,10 @@ llvm::FunctionType* gulc::CodeGen::getFunctionType(gulc::FunctionDecl const* fun
                                                    StructDecl const* parentStruct) {
     std::vector<llvm::Type*> paramTypes = generateLlvmParamTypes(functionDecl->parameters(), parentStruct,
                                                                  functionDecl->returnType);
-    llvm::Type* returnType;
+    llvm::Type* returnType = generateLlvmReturnType(functionDecl->returnType);
 
-    if (llvm::isa<StructType>(functionDecl->returnType)) {
-        returnType = llvm::Type::getVoidTy(*_llvmContext);
-    } else {
-        returnType = generateLlvmType(functionDecl->returnType);
+    if (functionDecl->throws()) {
+        paramTypes.push_back(llvm::PointerType::getUnqual(generateLlvmErrorSlotType(functionDecl->throwsType())));
     }
 
     return llvm::FunctionType::get(returnType, paramTypes, false);
@@ -884,13 +1752,229 @@ llvm::Function* gulc::CodeGen::getFunction(gulc::FunctionDecl* functionDecl) {
         parentStruct = llvm::dyn_cast<StructDecl>(functionDecl->container);
     }
 
-    std::vector<llvm::Type*> paramTypes = generateLlvmParamTypes(functionDecl->parameters(), parentStruct,
-                                                                 functionDecl->returnType);
-    llvm::Type* returnType = generateLlvmType(functionDecl->returnType);
-    llvm::FunctionType* functionType = llvm::FunctionType::get(returnType, paramTypes, false);
+    llvm::FunctionType* functionType = getFunctionType(functionDecl, parentStruct);
+
+    requireLinkOnceDecl(functionDecl);
 
-    // TODO: Why does this return `llvm::Constant*` instead of `llvm::Function*`?
-    return llvm::dyn_cast<llvm::Function>(_llvmModule->getOrInsertFunction(functionDecl->mangledName(), functionType));
+    // NOTE: The callee is only a bitcast instead of an `llvm::Function*` when the name was already declared with a
+    //       different type.
+    return llvm::dyn_cast<llvm::Function>(
+            _llvmModule->getOrInsertFunction(functionDecl->mangledName(), functionType).getCallee());
+}
+
+void gulc::CodeGen::generateContracts(gulc::FunctionDecl const* functionDecl, gulc::Cont::Kind contractKind) {
+    if (_options.contractMode == CompilerOptions::ContractMode::Ignore) {
+        return;
+    }
+
+    for (Cont const* contract : functionDecl->contracts()) {
+        if (contract->getContKind() != contractKind) {
+            continue;
+        }
+
+        Expr const* condition;
+
+        if (llvm::isa<RequiresCont>(contract)) {
+            condition = llvm::dyn_cast<RequiresCont>(contract)->condition;
+        } else if (llvm::isa<EnsuresCont>(contract)) {
+            condition = llvm::dyn_cast<EnsuresCont>(contract)->condition;
+        } else {
+            continue;
+        }
+
+        llvm::Value* conditionValue = generateExpr(condition);
+
+        // `bool` values loaded from memory are `i8`, `llvm.assume` and `br` both need an `i1`
+        if (!conditionValue->getType()->isIntegerTy(1)) {
+            conditionValue = _irBuilder->CreateICmpNE(conditionValue,
+                                                      llvm::ConstantInt::get(conditionValue->getType(), 0));
+        }
+
+        if (_options.contractMode == CompilerOptions::ContractMode::Assume) {
+            llvm::Function* assumeFunction = llvm::Intrinsic::getDeclaration(_llvmModule, llvm::Intrinsic::assume);
+            _irBuilder->CreateCall(assumeFunction, { conditionValue });
+        } else {
+            generateContractCheck(conditionValue, contract);
+        }
+    }
+}
+
+void gulc::CodeGen::generateContractCheck(llvm::Value* condition, gulc::Cont const* contract) {
+    std::string contractName = contract->getContKind() == Cont::Kind::Requires ? "requires" : "ensures";
+    llvm::BasicBlock* passedBlock = llvm::BasicBlock::Create(*_llvmContext, contractName + "Passed",
+                                                             _currentLlvmFunction);
+    llvm::BasicBlock* failedBlock = llvm::BasicBlock::Create(*_llvmContext, contractName + "Failed",
+                                                             _currentLlvmFunction);
+    llvm::MDBuilder mdBuilder(*_llvmContext);
+
+    // A failed contract is a bug in the caller (or callee for `ensures`), weighting the branch lets LLVM move the
+    // failure path out of the hot code the same way it would for `__builtin_expect`
+    _irBuilder->CreateCondBr(condition, passedBlock, failedBlock, mdBuilder.createBranchWeights(1u << 20u, 1));
+
+    // TODO: Once we have `abandon` support this should output which contract failed before abandoning
+    _irBuilder->SetInsertPoint(failedBlock);
+    llvm::Function* trapFunction = llvm::Intrinsic::getDeclaration(_llvmModule, llvm::Intrinsic::trap);
+    _irBuilder->CreateCall(trapFunction, {});
+    _irBuilder->CreateUnreachable();
+
+    _irBuilder->SetInsertPoint(passedBlock);
+}
+
+void gulc::CodeGen::collectContractRanges(gulc::FunctionDecl const* functionDecl) {
+    _currentParameterRanges.clear();
+
+    // We only trust the contracts enough to use them as metadata when we've been told to assume they hold
+    if (_options.contractMode != CompilerOptions::ContractMode::Assume) {
+        return;
+    }
+
+    std::map<std::size_t, llvm::ConstantRange> ranges;
+
+    for (Cont const* contract : functionDecl->contracts()) {
+        if (llvm::isa<RequiresCont>(contract)) {
+            narrowContractRange(llvm::dyn_cast<RequiresCont>(contract)->condition, functionDecl->parameters(),
+                                ranges);
+        }
+    }
+
+    llvm::MDBuilder mdBuilder(*_llvmContext);
+
+    for (auto const& range : ranges) {
+        // `!range` can't describe an empty or full set
+        if (range.second.isFullSet() || range.second.isEmptySet()) {
+            continue;
+        }
+
+        _currentParameterRanges.insert({
+            range.first, mdBuilder.createRange(range.second.getLower(), range.second.getUpper())
+        });
+    }
+}
+
+void gulc::CodeGen::narrowContractRange(gulc::Expr const* condition, std::vector<ParameterDecl*> const& parameters,
+                                        std::map<std::size_t, llvm::ConstantRange>& ranges) {
+    if (!llvm::isa<InfixOperatorExpr>(condition)) {
+        return;
+    }
+
+    auto infixOperatorExpr = llvm::dyn_cast<InfixOperatorExpr>(condition);
+
+    // `requires x >= 0 && x < 12` is the same as two separate `requires`
+    if (infixOperatorExpr->infixOperator() == InfixOperators::LogicalAnd) {
+        narrowContractRange(infixOperatorExpr->leftValue, parameters, ranges);
+        narrowContractRange(infixOperatorExpr->rightValue, parameters, ranges);
+        return;
+    }
+
+    auto stripExpr = [](Expr const* expr) -> Expr const* {
+        while (true) {
+            if (llvm::isa<ParenExpr>(expr)) {
+                expr = llvm::dyn_cast<ParenExpr>(expr)->nestedExpr;
+            } else if (llvm::isa<ImplicitCastExpr>(expr)) {
+                expr = llvm::dyn_cast<ImplicitCastExpr>(expr)->expr;
+            } else if (llvm::isa<LValueToRValueExpr>(expr)) {
+                expr = llvm::dyn_cast<LValueToRValueExpr>(expr)->lvalue;
+            } else {
+                return expr;
+            }
+        }
+    };
+
+    Expr const* parameterSide = stripExpr(infixOperatorExpr->leftValue);
+    Expr const* literalSide = stripExpr(infixOperatorExpr->rightValue);
+    bool isSwapped = false;
+
+    if (!llvm::isa<ParameterRefExpr>(parameterSide)) {
+        std::swap(parameterSide, literalSide);
+        isSwapped = true;
+    }
+
+    if (!llvm::isa<ParameterRefExpr>(parameterSide) || !llvm::isa<ValueLiteralExpr>(literalSide)) {
+        return;
+    }
+
+    std::size_t parameterIndex = llvm::dyn_cast<ParameterRefExpr>(parameterSide)->parameterIndex();
+    auto valueLiteralExpr = llvm::dyn_cast<ValueLiteralExpr>(literalSide);
+
+    if (parameterIndex >= parameters.size() ||
+            valueLiteralExpr->literalType() != ValueLiteralExpr::LiteralType::Integer ||
+            valueLiteralExpr->hasSuffix()) {
+        return;
+    }
+
+    ParameterDecl const* parameterDecl = parameters[parameterIndex];
+
+    // The metadata is attached to loads of the parameter, if the parameter can be modified the range wouldn't hold
+    // for the entire function
+    if (parameterDecl->parameterKind() != ParameterDecl::ParameterKind::Val ||
+            parameterDecl->type->qualifier() == Type::Qualifier::Mut ||
+            !llvm::isa<BuiltInType>(parameterDecl->type)) {
+        return;
+    }
+
+    auto builtInType = llvm::dyn_cast<BuiltInType>(parameterDecl->type);
+
+    if (builtInType->isFloating() || builtInType->sizeInBytes() == 0) {
+        return;
+    }
+
+    bool isSigned = builtInType->isSigned();
+    llvm::CmpInst::Predicate predicate;
+
+    switch (infixOperatorExpr->infixOperator()) {
+        case InfixOperators::EqualTo:
+            predicate = llvm::CmpInst::Predicate::ICMP_EQ;
+            break;
+        case InfixOperators::NotEqualTo:
+            predicate = llvm::CmpInst::Predicate::ICMP_NE;
+            break;
+        case InfixOperators::GreaterThan:
+            predicate = isSigned ? llvm::CmpInst::Predicate::ICMP_SGT : llvm::CmpInst::Predicate::ICMP_UGT;
+            break;
+        case InfixOperators::GreaterThanEqualTo:
+            predicate = isSigned ? llvm::CmpInst::Predicate::ICMP_SGE : llvm::CmpInst::Predicate::ICMP_UGE;
+            break;
+        case InfixOperators::LessThan:
+            predicate = isSigned ? llvm::CmpInst::Predicate::ICMP_SLT : llvm::CmpInst::Predicate::ICMP_ULT;
+            break;
+        case InfixOperators::LessThanEqualTo:
+            predicate = isSigned ? llvm::CmpInst::Predicate::ICMP_SLE : llvm::CmpInst::Predicate::ICMP_ULE;
+            break;
+        default:
+            return;
+    }
+
+    // `12 < x` is `x > 12`
+    if (isSwapped) {
+        predicate = llvm::CmpInst::getSwappedPredicate(predicate);
+    }
+
+    unsigned parameterWidth = builtInType->sizeInBytes() * 8;
+    std::uint64_t rawLiteralValue;
+
+    // `getAsInteger` fails instead of wrapping when the literal doesn't fit in 64 bits
+    if (llvm::StringRef(valueLiteralExpr->value()).getAsInteger(10, rawLiteralValue)) {
+        return;
+    }
+
+    // A literal outside of the parameter's range would wrap when truncated, `u8 x < 300` would become `x < 44`. Those
+    // comparisons are always true or always false, there is nothing to narrow.
+    llvm::APInt wideLiteralValue(64, rawLiteralValue);
+
+    if (isSigned ? !wideLiteralValue.isSignedIntN(parameterWidth) : !wideLiteralValue.isIntN(parameterWidth)) {
+        return;
+    }
+
+    llvm::APInt literalValue(parameterWidth, rawLiteralValue, isSigned);
+    llvm::ConstantRange allowedRange = llvm::ConstantRange::makeAllowedICmpRegion(
+            predicate, llvm::ConstantRange(literalValue));
+    auto foundRange = ranges.find(parameterIndex);
+
+    if (foundRange == ranges.end()) {
+        ranges.insert({ parameterIndex, allowedRange });
+    } else {
+        foundRange->second = foundRange->second.intersectWith(allowedRange);
+    }
 }
 
 // Statement Generation
@@ -940,6 +2024,12 @@ void gulc::CodeGen::generateStmt(gulc::Stmt const* stmt, std::string const& stmt
         case Stmt::Kind::Switch:
             generateSwitchStmt(llvm::dyn_cast<SwitchStmt>(stmt));
             break;
+        case Stmt::Kind::Throw:
+            generateThrowStmt(llvm::dyn_cast<ThrowStmt>(stmt));
+            // NOTE: Same as `return`, the temporary values are destructed by the cleanup chain that
+            //       `generateThrowStmt` branches to
+            _currentStmtTemporaryValues.resize(oldTemporaryValueCount);
+            return;
         case Stmt::Kind::While:
             generateWhileStmt(llvm::dyn_cast<WhileStmt>(stmt), stmtName);
             break;
@@ -1019,8 +2109,72 @@ void gulc::CodeGen::generateContinueStmt(gulc::ContinueStmt const* continueStmt)
 }
 
 void gulc::CodeGen::generateDoCatchStmt(gulc::DoCatchStmt const* doCatchStmt) {
-    printError("`do {} catch {}` statement not yet supported!",
-               doCatchStmt->startPosition(), doCatchStmt->endPosition());
+    // A `catch` that no error reaches can never run so we don't generate it. Every error that does reach it has its
+    // own error slot, a typed `catch` only ever has one.
+    std::vector<CatchStmt const*> reachableCatchStatements;
+
+    for (CatchStmt const* catchStmt : doCatchStmt->catchStatements()) {
+        if (catchStmt->caughtErrorTypes.empty()) {
+            continue;
+        }
+
+        CatchState& catchState = _currentCatchStates[catchStmt];
+
+        for (Type const* caughtErrorType : catchStmt->caughtErrorTypes) {
+            catchState.errorSlots.push_back(createEntryBlockAlloca(generateLlvmErrorSlotType(caughtErrorType)));
+        }
+
+        catchState.catchBlock = llvm::BasicBlock::Create(*_llvmContext, "catch");
+        catchState.cleanupBlocks.assign(catchStmt->errorCleanups.size(), nullptr);
+
+        reachableCatchStatements.push_back(catchStmt);
+    }
+
+    if (reachableCatchStatements.empty()) {
+        generateCompoundStmt(doCatchStmt->body());
+        return;
+    }
+
+    llvm::BasicBlock* mergeBlock = llvm::BasicBlock::Create(*_llvmContext, "doMerge");
+
+    generateCompoundStmt(doCatchStmt->body());
+
+    if (_irBuilder->GetInsertBlock()->getTerminator() == nullptr) {
+        _irBuilder->CreateBr(mergeBlock);
+    }
+
+    // `CodeTransformer` picked the `catch` for every error within the body so there is nothing to dispatch on at
+    // runtime, each error branches straight to its own `catch` once the values created within the body are destructed
+    for (CatchStmt const* catchStmt : reachableCatchStatements) {
+        CatchState& catchState = _currentCatchStates[catchStmt];
+
+        addBlockAndSetInsertionPoint(catchState.catchBlock);
+
+        auto oldLocalVariableCount = _currentLlvmFunctionLocalVariables.size();
+
+        if (catchStmt->exceptionVariable != nullptr) {
+            llvm::AllocaInst* exceptionVariable = addLocalVariable(
+                    catchStmt->exceptionVariable->identifier().name(),
+                    generateLlvmType(catchStmt->exceptionVariable->type)
+                );
+            llvm::Value* errorSlot = catchState.errorSlots.front();
+            llvm::Value* caughtValue = _irBuilder->CreateLoad(
+                    exceptionVariable->getAllocatedType(),
+                    _irBuilder->CreateStructGEP(errorSlot->getType()->getPointerElementType(), errorSlot, 1));
+
+            _irBuilder->CreateStore(caughtValue, exceptionVariable);
+        }
+
+        generateCompoundStmt(catchStmt->body());
+
+        _currentLlvmFunctionLocalVariables.resize(oldLocalVariableCount);
+
+        if (_irBuilder->GetInsertBlock()->getTerminator() == nullptr) {
+            _irBuilder->CreateBr(mergeBlock);
+        }
+    }
+
+    addBlockAndSetInsertionPoint(mergeBlock);
 }
 
 void gulc::CodeGen::generateForStmt(gulc::ForStmt const* forStmt, std::string const& loopName) {
@@ -1150,13 +2304,28 @@ void gulc::CodeGen::generateIfStmt(gulc::IfStmt const* ifStmt) {
     llvm::BasicBlock* mergeBlock = llvm::BasicBlock::Create(*_llvmContext, "ifMerge");
     llvm::BasicBlock* falseBlock = nullptr;
 
+    // `@likely`/`@unlikely` are lowered to branch weights, we use the same weights Clang uses for `__builtin_expect`
+    llvm::MDNode* branchWeights = nullptr;
+
+    for (Attr const* attribute : ifStmt->attributes) {
+        if (auto branchHintAttr = llvm::dyn_cast<BranchHintAttr>(attribute)) {
+            llvm::MDBuilder mdBuilder(*_llvmContext);
+
+            if (branchHintAttr->isLikely()) {
+                branchWeights = mdBuilder.createBranchWeights(2000, 1);
+            } else {
+                branchWeights = mdBuilder.createBranchWeights(1, 2000);
+            }
+        }
+    }
+
     // If there isn't a false block we make the IR jump to the merge block on false, else we make an actual false block
     if (ifStmt->hasFalseBody()) {
         falseBlock = llvm::BasicBlock::Create(*_llvmContext, "ifFalseBlock");
 
-        _irBuilder->CreateCondBr(cond, trueBlock, falseBlock);
+        _irBuilder->CreateCondBr(cond, trueBlock, falseBlock, branchWeights);
     } else {
-        _irBuilder->CreateCondBr(cond, trueBlock, mergeBlock);
+        _irBuilder->CreateCondBr(cond, trueBlock, mergeBlock, branchWeights);
     }
 
     // Set the insert point to our true block then generate the statement for it...
@@ -1265,10 +2434,10 @@ void gulc::CodeGen::generateReturnStmt(gulc::ReturnStmt const* returnStmt) {
         // If the function returns a struct we have to do a few "hacks" to account for the first parameter being the
         // return value instead of having LLVM handle it as `ret`...
         if (llvm::isa<StructType>(_currentGhoulFunction->returnType)) {
-            // Returning a struct should always be a `LValueToRValue(ConstructorCall(self: temporaryValue))`.
-            // The constructor call could be a normal constructor or a copy/move constructor.
-            // It doesn't matter which, all that matters is we need to replace the `temporaryValue` with
-            // `_currentFunctionReturnValue` and prevent `temporaryValue` from being passed to `deinit`.
+            // Returning a struct should always be a `LValueToRValue` of either a constructor call, a call that returns
+            // a struct through a temporary value, or an existing lvalue.
+            // For the calls we construct the result directly in `_currentFunctionReturnValue` and prevent the
+            // temporary value from being passed to `deinit`. Existing lvalues have to be moved or copied.
             if (!llvm::isa<LValueToRValueExpr>(returnStmt->returnValue)) {
                 printError("[INTERNAL] attempted to move return value to `sret`, failed due to missing `LValueToRValue`!",
                            returnStmt->startPosition(), returnStmt->endPosition());
@@ -1276,51 +2445,205 @@ void gulc::CodeGen::generateReturnStmt(gulc::ReturnStmt const* returnStmt) {
 
             auto checkLValueToRValue = llvm::dyn_cast<LValueToRValueExpr>(returnStmt->returnValue);
 
-            if (!llvm::isa<ConstructorCallExpr>(checkLValueToRValue->lvalue)) {
-                printError("[INTERNAL] attempted to move return value to `sret`, failed due to missing constructor call!",
-                           returnStmt->startPosition(), returnStmt->endPosition());
-            }
+            switch (checkLValueToRValue->lvalue->getExprKind()) {
+                case Expr::Kind::ConstructorCall: {
+                    auto modifyConstructorCall = llvm::dyn_cast<ConstructorCallExpr>(checkLValueToRValue->lvalue);
+                    // What we're doing here is telling the `generateConstructorCallExpr` to use
+                    // `_currentFunctionReturnValue` as the `self` reference instead of what is stored inside
+                    // `modifyConstructorCall`
+                    generateConstructorCallExpr(modifyConstructorCall, _currentFunctionReturnValue);
+
+                    // We need to cancel the destructor call for the temporary value `modifyConstructorCall->objectRef`
+                    // since it is not constructed. It could cause an error if we allow that to slip by.
+                    if (!llvm::isa<TemporaryValueRefExpr>(modifyConstructorCall->objectRef)) {
+                        printError("[INTERNAL] attempted to cancel `sret` deinit, failed due to missing temporary value reference!",
+                                   returnStmt->startPosition(), returnStmt->endPosition());
+                    }
 
-            auto modifyConstructorCall = llvm::dyn_cast<ConstructorCallExpr>(checkLValueToRValue->lvalue);
-            // What we're doing here is telling the `generateConstructorCallExpr` to use `_currentFunctionReturnValue`
-            // as the `self` reference instead of what is stored inside `modifyConstructorCall`
-            generateConstructorCallExpr(modifyConstructorCall, _currentFunctionReturnValue);
+                    auto tempValueRef = llvm::dyn_cast<TemporaryValueRefExpr>(modifyConstructorCall->objectRef);
 
-            // We need to cancel the destructor call for the temporary value `modifyConstructorCall->objectRef`
-            // since it is not constructed. It could cause an error if we allow that to slip by.
-            if (!llvm::isa<TemporaryValueRefExpr>(modifyConstructorCall->objectRef)) {
-                printError("[INTERNAL] attempted to cancel `sret` deinit, failed due to missing temporary value reference!",
-                           returnStmt->startPosition(), returnStmt->endPosition());
-            }
+                    cleanupTemporaryValues(returnStmt->temporaryValues, tempValueRef->temporaryName());
+                    break;
+                }
+                case Expr::Kind::StoreTemporaryValue: {
+                    // `return makeType()`, the callee constructs its result straight into our own `sret`
+                    auto storeTemporaryValue = llvm::dyn_cast<StoreTemporaryValueExpr>(checkLValueToRValue->lvalue);
 
-            auto tempValueRef = llvm::dyn_cast<TemporaryValueRefExpr>(modifyConstructorCall->objectRef);
+                    generateCallWithSRet(storeTemporaryValue->storeValue, _currentFunctionReturnValue);
+
+                    cleanupTemporaryValues(returnStmt->temporaryValues,
+                                           storeTemporaryValue->temporaryValue->temporaryName());
+                    break;
+                }
+                case Expr::Kind::LocalVariableRef: {
+                    auto localVariableRef = llvm::dyn_cast<LocalVariableRefExpr>(checkLValueToRValue->lvalue);
+
+                    // The named return value was constructed in `_currentFunctionReturnValue` to begin with
+                    if (_currentGhoulFunction->namedReturnValue == nullptr ||
+                            _currentGhoulFunction->namedReturnValue->identifier().name() !=
+                            localVariableRef->variableName()) {
+                        // The local is destructed by the cleanup chain right after this so we can move from it
+                        std::vector<llvm::Value*> llvmArgs {
+                                _currentFunctionReturnValue,
+                                generateLocalVariableRefExpr(localVariableRef)
+                        };
+
+                        _irBuilder->CreateCall(getMoveConstructorForType(_currentGhoulFunction->returnType),
+                                               llvmArgs);
+                    }
+
+                    cleanupTemporaryValues(returnStmt->temporaryValues);
+                    break;
+                }
+                default: {
+                    // Anything else is still owned by someone else so we have to copy it
+                    std::vector<llvm::Value*> llvmArgs {
+                            _currentFunctionReturnValue,
+                            generateExpr(checkLValueToRValue->lvalue)
+                    };
 
-            cleanupTemporaryValues(returnStmt->temporaryValues, tempValueRef->temporaryName());
+                    _irBuilder->CreateCall(getCopyConstructorForType(_currentGhoulFunction->returnType), llvmArgs);
 
-            for (Expr* deferredExpr : returnStmt->preReturnDeferred) {
-                generateExpr(deferredExpr);
+                    cleanupTemporaryValues(returnStmt->temporaryValues);
+                    break;
+                }
             }
         } else {
             // The normal way of handling a return value...
             llvm::Value* returnValue = generateExpr(returnStmt->returnValue);
 
-            cleanupTemporaryValues(returnStmt->temporaryValues);
+            cleanupTemporaryValues(returnStmt->temporaryValues);
+
+            _irBuilder->CreateStore(returnValue, _currentFunctionReturnValue);
+        }
+    } else {
+        cleanupTemporaryValues(returnStmt->temporaryValues);
+    }
+
+    // `ensures` has to hold while the parameters and locals are still alive, the cleanup chain destructs them
+    if (_currentFunctionChecksEnsures) {
+        generateContracts(_currentGhoulFunction, Cont::Kind::Ensures);
+    }
+
+    // The return value is already stored so all that is left is to branch into the cleanup chain (which ends in the
+    // exit block)
+    _irBuilder->CreateBr(getReturnCleanupBlock(returnStmt->cleanupIndex));
+}
+
+llvm::BasicBlock* gulc::CodeGen::getReturnCleanupBlock(std::int64_t cleanupIndex) {
+    return getCleanupBlock(_currentGhoulFunction->returnCleanups, _currentReturnCleanupBlocks, cleanupIndex,
+                           _currentFunctionExitBlock, "cleanup");
+}
+
+llvm::BasicBlock* gulc::CodeGen::getErrorCleanupBlock(gulc::ErrorDestination const& errorDestination) {
+    if (errorDestination.errorCatch == nullptr) {
+        if (_currentFunctionErrorExitBlock == nullptr) {
+            _currentFunctionErrorExitBlock = llvm::BasicBlock::Create(*_llvmContext, "errorExit");
+        }
+
+        // NOTE: These are the same cleanups as `return` uses, they need their own blocks since they end somewhere else
+        return getCleanupBlock(_currentGhoulFunction->returnCleanups, _currentErrorCleanupBlocks,
+                               errorDestination.cleanupIndex, _currentFunctionErrorExitBlock, "errorCleanup");
+    }
+
+    auto foundCatchState = _currentCatchStates.find(errorDestination.errorCatch);
+
+    if (foundCatchState == _currentCatchStates.end()) {
+        printError("[INTERNAL] error handler was not found!",
+                   errorDestination.errorCatch->startPosition(), errorDestination.errorCatch->endPosition());
+    }
+
+    return getCleanupBlock(errorDestination.errorCatch->errorCleanups, foundCatchState->second.cleanupBlocks,
+                           errorDestination.cleanupIndex, foundCatchState->second.catchBlock, "catchCleanup");
+}
+
+llvm::BasicBlock* gulc::CodeGen::getCleanupBlock(std::vector<ReturnCleanup> const& cleanups,
+                                                 std::vector<llvm::BasicBlock*>& cleanupBlocks,
+                                                 std::int64_t cleanupIndex, llvm::BasicBlock* endBlock,
+                                                 std::string const& blockName) {
+    if (cleanupIndex < 0) {
+        return endBlock;
+    }
+
+    // The cleanup for a named return value is removed, the caller owns the value so we go straight to the next one
+    if (cleanups[cleanupIndex].destructExpr == nullptr) {
+        return getCleanupBlock(cleanups, cleanupBlocks, cleanups[cleanupIndex].nextCleanupIndex, endBlock,
+                               blockName);
+    }
+
+    llvm::BasicBlock*& cleanupBlock = cleanupBlocks[cleanupIndex];
+
+    // Cleanup blocks are only created the first time a `return` branches into them. At that point every value in the
+    // chain is live and in scope, every later `return` that uses the block is within the same scopes.
+    if (cleanupBlock == nullptr) {
+        ReturnCleanup const& returnCleanup = cleanups[cleanupIndex];
+        llvm::BasicBlock* returnBlock = _irBuilder->GetInsertBlock();
+
+        cleanupBlock = llvm::BasicBlock::Create(*_llvmContext, blockName + std::to_string(cleanupIndex),
+                                                _currentLlvmFunction);
+        _irBuilder->SetInsertPoint(cleanupBlock);
+        generateExpr(returnCleanup.destructExpr);
+        _irBuilder->CreateBr(getCleanupBlock(cleanups, cleanupBlocks, returnCleanup.nextCleanupIndex, endBlock,
+                                             blockName));
+
+        _irBuilder->SetInsertPoint(returnBlock);
+    }
+
+    return cleanupBlock;
+}
+
+llvm::Value* gulc::CodeGen::getErrorSlot(gulc::ErrorDestination const& errorDestination,
+                                         gulc::TextPosition startPosition, gulc::TextPosition endPosition) {
+    if (errorDestination.errorCatch == nullptr) {
+        if (_currentFunctionErrorSlot == nullptr) {
+            printError("[INTERNAL] error is passed on from a function that doesn't throw!",
+                       startPosition, endPosition);
+        }
+
+        return _currentFunctionErrorSlot;
+    }
+
+    auto foundCatchState = _currentCatchStates.find(errorDestination.errorCatch);
+
+    if (foundCatchState == _currentCatchStates.end()) {
+        printError("[INTERNAL] error handler was not found!", startPosition, endPosition);
+    }
+
+    return foundCatchState->second.errorSlots[errorDestination.errorTypeIndex];
+}
+
+void gulc::CodeGen::generateErrorCheck(llvm::Value* errorSlot, gulc::ErrorDestination const& errorDestination) {
+    llvm::Type* errorSlotType = errorSlot->getType()->getPointerElementType();
+    llvm::Value* didThrow = _irBuilder->CreateLoad(llvm::Type::getInt1Ty(*_llvmContext),
+                                                   _irBuilder->CreateStructGEP(errorSlotType, errorSlot, 0));
+    llvm::BasicBlock* errorBlock = getErrorCleanupBlock(errorDestination);
+    llvm::BasicBlock* continueBlock = llvm::BasicBlock::Create(*_llvmContext, "tryContinue");
+
+    // Errors are the exceptional path, we weight the branch so the error handling is moved out of the hot path
+    llvm::MDBuilder mdBuilder(*_llvmContext);
+    _irBuilder->CreateCondBr(didThrow, errorBlock, continueBlock, mdBuilder.createBranchWeights(1, 1u << 20u));
+
+    addBlockAndSetInsertionPoint(continueBlock);
+}
+
+void gulc::CodeGen::generateErrorExitBlock() {
+    if (_currentFunctionErrorExitBlock == nullptr) {
+        return;
+    }
 
-            for (Expr* deferredExpr : returnStmt->preReturnDeferred) {
-                generateExpr(deferredExpr);
-            }
+    // The caller only looks at the error slot when we throw, whatever we return is ignored
+    _currentLlvmFunction->getBasicBlockList().push_back(_currentFunctionErrorExitBlock);
+    _irBuilder->SetInsertPoint(_currentFunctionErrorExitBlock);
 
-            _irBuilder->CreateStore(returnValue, _currentFunctionReturnValue);
-        }
-    } else {
-        cleanupTemporaryValues(returnStmt->temporaryValues);
+    llvm::Type* llvmReturnType = _currentLlvmFunction->getReturnType();
 
-        for (Expr* deferredExpr : returnStmt->preReturnDeferred) {
-            generateExpr(deferredExpr);
-        }
+    if (llvmReturnType->isVoidTy()) {
+        _irBuilder->CreateRetVoid();
+    } else {
+        _irBuilder->CreateRet(llvm::UndefValue::get(llvmReturnType));
     }
 
-    _irBuilder->CreateBr(_currentFunctionExitBlock);
+    _currentFunctionErrorExitBlock = nullptr;
 }
 
 void gulc::CodeGen::generateSwitchStmt(gulc::SwitchStmt const* switchStmt) {
@@ -1328,6 +2651,25 @@ void gulc::CodeGen::generateSwitchStmt(gulc::SwitchStmt const* switchStmt) {
                switchStmt->startPosition(), switchStmt->endPosition());
 }
 
+void gulc::CodeGen::generateThrowStmt(gulc::ThrowStmt const* throwStmt) {
+    llvm::Value* errorSlot = getErrorSlot(throwStmt->errorDestination,
+                                          throwStmt->startPosition(), throwStmt->endPosition());
+
+    llvm::Type* errorSlotType = errorSlot->getType()->getPointerElementType();
+
+    if (throwStmt->hasThrownValue()) {
+        llvm::Value* thrownValue = generateExpr(throwStmt->thrownValue);
+
+        _irBuilder->CreateStore(thrownValue, _irBuilder->CreateStructGEP(errorSlotType, errorSlot, 1));
+    }
+
+    _irBuilder->CreateStore(llvm::ConstantInt::getTrue(*_llvmContext),
+                            _irBuilder->CreateStructGEP(errorSlotType, errorSlot, 0));
+
+    // NOTE: The temporary values of the `throw` (and the statements it is within) are part of the cleanup chain
+    _irBuilder->CreateBr(getErrorCleanupBlock(throwStmt->errorDestination));
+}
+
 void gulc::CodeGen::generateWhileStmt(gulc::WhileStmt const* whileStmt, std::string const& loopName) {
     std::string whileName;
 
@@ -1501,6 +2843,23 @@ llvm::Constant* gulc::CodeGen::generateConstant(gulc::Expr const* expr) {
                 break;
             }
         }
+    } else if (llvm::isa<BoolLiteralExpr>(expr)) {
+        // `bool` is stored as an `i8`, the same as `generateBoolLiteralExpr`
+        return llvm::ConstantInt::get(llvm::IntegerType::getInt8Ty(*_llvmContext),
+                                      llvm::dyn_cast<BoolLiteralExpr>(expr)->value(), false);
+    } else if (llvm::isa<ArrayLiteralExpr>(expr)) {
+        auto arrayLiteralExpr = llvm::dyn_cast<ArrayLiteralExpr>(expr);
+        auto arrayType = llvm::dyn_cast<llvm::ArrayType>(generateLlvmType(arrayLiteralExpr->valueType));
+        std::vector<llvm::Constant*> elements;
+        elements.reserve(arrayLiteralExpr->indexes.size());
+
+        for (Expr const* index : arrayLiteralExpr->indexes) {
+            elements.push_back(generateConstant(index));
+        }
+
+        return llvm::ConstantArray::get(arrayType, elements);
+    } else if (llvm::isa<SolvedConstExpr>(expr)) {
+        return generateConstant(llvm::dyn_cast<SolvedConstExpr>(expr)->solution);
     }
 
     printError("unsupported constant in codegen!", expr->startPosition(), expr->endPosition());
@@ -1521,10 +2880,14 @@ llvm::Value* gulc::CodeGen::generateExpr(gulc::Expr const* expr) {
             return generateConstructorCallExpr(llvm::dyn_cast<ConstructorCallExpr>(expr));
         case Expr::Kind::CurrentSelf:
             return generateCurrentSelfExpr(llvm::dyn_cast<CurrentSelfExpr>(expr));
+        case Expr::Kind::Delete:
+            return generateDeleteExpr(llvm::dyn_cast<DeleteExpr>(expr));
         case Expr::Kind::DestructorCall:
             return generateDestructorCallExpr(llvm::dyn_cast<DestructorCallExpr>(expr));
         case Expr::Kind::EnumConstRef:
             return generateEnumConstRefExpr(llvm::dyn_cast<EnumConstRefExpr>(expr));
+        case Expr::Kind::FlatArrayIndex:
+            return generateFlatArrayIndexExpr(llvm::dyn_cast<FlatArrayIndexExpr>(expr));
         case Expr::Kind::FunctionCall:
             return generateFunctionCallExpr(llvm::dyn_cast<FunctionCallExpr>(expr));
         case Expr::Kind::ImplicitCast:
@@ -1547,6 +2910,8 @@ llvm::Value* gulc::CodeGen::generateExpr(gulc::Expr const* expr) {
             return generateMemberPrefixOperatorCallExpr(llvm::dyn_cast<MemberPrefixOperatorCallExpr>(expr));
         case Expr::Kind::MemberVariableRef:
             return generateMemberVariableRefExpr(llvm::dyn_cast<MemberVariableRefExpr>(expr));
+        case Expr::Kind::New:
+            return generateNewExpr(llvm::dyn_cast<NewExpr>(expr));
         case Expr::Kind::ParameterRef:
             return generateParameterRefExpr(llvm::dyn_cast<ParameterRefExpr>(expr));
         case Expr::Kind::Paren:
@@ -1563,6 +2928,8 @@ llvm::Value* gulc::CodeGen::generateExpr(gulc::Expr const* expr) {
             return generateRefExpr(llvm::dyn_cast<RefExpr>(expr));
         case Expr::Kind::RValueToInRef:
             return generateRValueToInRefExpr(llvm::dyn_cast<RValueToInRefExpr>(expr));
+        case Expr::Kind::SimdBuiltInCall:
+            return generateSimdBuiltInCallExpr(llvm::dyn_cast<SimdBuiltInCallExpr>(expr));
         case Expr::Kind::SolvedConst:
             return generateSolvedConstExpr(llvm::dyn_cast<SolvedConstExpr>(expr));
         case Expr::Kind::StoreTemporaryValue:
@@ -1666,27 +3033,46 @@ llvm::Value* gulc::CodeGen::generateConstructorCallExpr(gulc::ConstructorCallExp
     std::vector<llvm::Value*> llvmArgs{};
     llvmArgs.reserve(constructorCallExpr->arguments.size() + 1);
 
-    llvmArgs.push_back(objectRef);
-
     for (LabeledArgumentExpr* argument : constructorCallExpr->arguments) {
         llvmArgs.push_back(generateExpr(argument->argument));
     }
 
-    _irBuilder->CreateCall(constructorFunc, llvmArgs);
+    createAbiCall(constructorFunc, constructorReferenceExpr->constructor, nullptr, objectRef, llvmArgs);
 
     return objectRef;
 }
 
 llvm::Value* gulc::CodeGen::generateCurrentSelfExpr(gulc::CurrentSelfExpr const* currentSelfExpr) {
     // If the function returns a struct we make it the first parameter.
-    std::size_t sretMod =
-            _currentGhoulFunction->returnType != nullptr && llvm::isa<StructType>(_currentGhoulFunction->returnType) ?
-            1 : 0;
+    std::size_t sretMod = returnsViaSRet(_currentGhoulFunction->returnType) ? 1 : 0;
     // NOTE: `self` is always parameter `0`. Error checking to make sure a `self` parameter exists should be performed
     //       in a prior check.
     return _currentLlvmFunctionParameters[sretMod];
 }
 
+llvm::Value* gulc::CodeGen::generateDeleteExpr(gulc::DeleteExpr const* deleteExpr) {
+    llvm::Value* pointer = generateExpr(deleteExpr->pointer);
+    auto pointerType = llvm::dyn_cast<PointerType>(deleteExpr->pointer->valueType);
+    StructDecl const* structDecl = llvm::dyn_cast<StructType>(pointerType->nestedType)->decl();
+
+    if (structDecl->destructor != nullptr) {
+        llvm::Function* destructorFunc = getFunctionFromDecl(structDecl->destructor);
+        _irBuilder->CreateCall(destructorFunc, { pointer });
+    }
+
+    // Objects `EscapeAnalyzer` moved to the stack are only destructed, their stack slot goes away with the function
+    if (deleteExpr->freesMemory) {
+        llvm::Type* int8PtrType = llvm::Type::getInt8PtrTy(*_llvmContext);
+        llvm::FunctionType* freeType = llvm::FunctionType::get(llvm::Type::getVoidTy(*_llvmContext),
+                                                               { int8PtrType }, false);
+
+        _irBuilder->CreateCall(_llvmModule->getOrInsertFunction("free", freeType),
+                               { _irBuilder->CreateBitCast(pointer, int8PtrType) });
+    }
+
+    return nullptr;
+}
+
 llvm::Value* gulc::CodeGen::generateDestructorCallExpr(gulc::DestructorCallExpr const* destructorCallExpr) {
     auto destructorReferenceExpr = llvm::dyn_cast<DestructorReferenceExpr>(destructorCallExpr->functionReference);
     llvm::Function* destructorFunc = getFunctionFromDecl(destructorReferenceExpr->destructor);
@@ -1702,16 +3088,76 @@ llvm::Value* gulc::CodeGen::generateEnumConstRefExpr(gulc::EnumConstRefExpr cons
     return generateExpr(enumConstRefExpr->enumConst()->constValue);
 }
 
+llvm::Value* gulc::CodeGen::generateFlatArrayIndexExpr(gulc::FlatArrayIndexExpr const* flatArrayIndexExpr) {
+    if (llvm::isa<StructType>(flatArrayIndexExpr->valueType) &&
+            llvm::dyn_cast<StructType>(flatArrayIndexExpr->valueType)->decl()->hasAttr(Attr::Kind::Soa)) {
+        // `CodeProcessor` only allows `@soa` elements as the object of a member access, see `generateSoaMemberRef`
+        printError("[INTERNAL] `@soa` array element used outside of a member access!",
+                   flatArrayIndexExpr->startPosition(), flatArrayIndexExpr->endPosition());
+        return nullptr;
+    }
+
+    llvm::Value* arrayRef = generateExpr(flatArrayIndexExpr->array);
+    llvm::Value* index = generateArrayIndex(flatArrayIndexExpr->index);
+
+    return _irBuilder->CreateGEP(arrayRef->getType()->getPointerElementType(), arrayRef,
+                                 { _irBuilder->getInt64(0), index });
+}
+
+llvm::Value* gulc::CodeGen::generateArrayIndex(gulc::Expr const* index) {
+    llvm::Value* result = generateExpr(index);
+
+    // `getelementptr` treats every index as signed, a narrow unsigned index has to be zero extended or anything at or
+    // above `2^(n-1)` would index backwards
+    if (result->getType()->getIntegerBitWidth() < 64) {
+        auto indexType = llvm::dyn_cast<BuiltInType>(index->valueType);
+
+        if (indexType != nullptr && indexType->isSigned()) {
+            result = _irBuilder->CreateSExt(result, _irBuilder->getInt64Ty());
+        } else {
+            result = _irBuilder->CreateZExt(result, _irBuilder->getInt64Ty());
+        }
+    }
+
+    return result;
+}
+
+llvm::Value* gulc::CodeGen::generateSoaMemberRef(gulc::FlatArrayIndexExpr const* flatArrayIndexExpr,
+                                                 gulc::VariableDecl const* member) {
+    gulc::Type const* arrayType = flatArrayIndexExpr->array->valueType;
+
+    if (llvm::isa<ReferenceType>(arrayType)) {
+        arrayType = llvm::dyn_cast<ReferenceType>(arrayType)->nestedType;
+    }
+
+    auto flatArrayType = llvm::dyn_cast<FlatArrayType>(arrayType);
+    auto soaStruct = llvm::dyn_cast<StructType>(flatArrayType->indexType)->decl();
+    std::vector<VariableDecl const*> soaLayout;
+
+    generateLlvmSoaArrayType(soaStruct, generateConstSize(flatArrayType->length), &soaLayout);
+
+    auto foundColumn = std::find(soaLayout.begin(), soaLayout.end(), member);
+
+    if (foundColumn == soaLayout.end()) {
+        printError("struct element '" + member->identifier().name() + "' was not found!",
+                   flatArrayIndexExpr->startPosition(), flatArrayIndexExpr->endPosition());
+    }
+
+    llvm::Value* arrayRef = generateExpr(flatArrayIndexExpr->array);
+    llvm::Value* index = generateArrayIndex(flatArrayIndexExpr->index);
+    auto columnIndex = static_cast<unsigned int>(std::distance(soaLayout.begin(), foundColumn));
+
+    // `array[i].member` becomes `array.memberColumn[i]`
+    return _irBuilder->CreateGEP(arrayRef->getType()->getPointerElementType(), arrayRef,
+                                 { _irBuilder->getInt64(0), _irBuilder->getInt32(columnIndex), index });
+}
+
 llvm::Value* gulc::CodeGen::generateFunctionCallExpr(gulc::FunctionCallExpr const* functionCallExpr,
                                                      llvm::Value* sret) {
     llvm::Value* functionPointer = generateFunctionReferenceFromExpr(functionCallExpr->functionReference);
 
     std::vector<llvm::Value*> llvmArgs{};
 
-    if (sret != nullptr) {
-        llvmArgs.push_back(sret);
-    }
-
     if (functionCallExpr->hasArguments()) {
         llvmArgs.reserve(functionCallExpr->arguments.size());
 
@@ -1720,7 +3166,19 @@ llvm::Value* gulc::CodeGen::generateFunctionCallExpr(gulc::FunctionCallExpr cons
         }
     }
 
-    return _irBuilder->CreateCall(functionPointer, llvmArgs);
+    // TODO: Once function pointers are supported they will need to carry enough information to be lowered here
+    if (llvm::isa<FunctionReferenceExpr>(functionCallExpr->functionReference)) {
+        auto functionDecl = llvm::dyn_cast<FunctionReferenceExpr>(functionCallExpr->functionReference)->functionDecl();
+
+        return createAbiCall(functionPointer, functionDecl, sret, nullptr, llvmArgs);
+    }
+
+    if (sret != nullptr) {
+        llvmArgs.insert(llvmArgs.begin(), sret);
+    }
+
+    auto functionType = llvm::cast<llvm::FunctionType>(functionPointer->getType()->getPointerElementType());
+    return _irBuilder->CreateCall(functionType, functionPointer, llvmArgs);
 }
 
 llvm::Value* gulc::CodeGen::generateFunctionReferenceFromExpr(gulc::Expr const* expr) {
@@ -1750,7 +3208,7 @@ llvm::Value* gulc::CodeGen::generateImplicitCastExpr(gulc::ImplicitCastExpr cons
 
 llvm::Value* gulc::CodeGen::generateImplicitDerefExpr(gulc::ImplicitDerefExpr const* implicitDerefExpr) {
     auto refResult = generateExpr(implicitDerefExpr->nestedExpr);
-    return _irBuilder->CreateLoad(refResult);
+    return _irBuilder->CreateLoad(refResult->getType()->getPointerElementType(), refResult);
 }
 
 llvm::Value* gulc::CodeGen::generateInfixOperatorExpr(gulc::InfixOperatorExpr const* infixOperatorExpr) {
@@ -1764,6 +3222,11 @@ llvm::Value* gulc::CodeGen::generateInfixOperatorExpr(gulc::InfixOperatorExpr co
     // TODO: Support pointer arithmetic
     Type* resultType = infixOperatorExpr->valueType;
 
+    // Element-wise comparisons result in a `simd<bool, N>` mask but the operation is still done on the operand type
+    if (llvm::isa<SimdType>(leftType)) {
+        resultType = leftType;
+    }
+
     return generateBuiltInInfixOperator(
             infixOperatorExpr->infixOperator(), resultType,
             leftType, leftValue, rightType, rightValue,
@@ -1783,6 +3246,17 @@ llvm::Value* gulc::CodeGen::generateBuiltInInfixOperator(InfixOperators infixOpe
 
         isFloat = builtInType->isFloating();
         isSigned = builtInType->isSigned();
+    } else if (llvm::isa<SimdType>(operationType)) {
+        // Vector operations are the same instructions as scalar operations, the only difference being they are done
+        // element-wise. So we only need to grab the signedness and "floatness" from the element type.
+        auto simdType = llvm::dyn_cast<SimdType>(operationType);
+
+        if (llvm::isa<BuiltInType>(simdType->elementType)) {
+            auto elementBuiltInType = llvm::dyn_cast<BuiltInType>(simdType->elementType);
+
+            isFloat = elementBuiltInType->isFloating();
+            isSigned = elementBuiltInType->isSigned();
+        }
     } else if (!llvm::isa<PointerType>(operationType) && !llvm::isa<BoolType>(operationType)) {
         printError("unknown infix operator expression!",
                    startPosition, endPosition);
@@ -1913,6 +3387,13 @@ llvm::Value* gulc::CodeGen::generateBuiltInInfixOperator(InfixOperators infixOpe
 }
 
 llvm::Value* gulc::CodeGen::generateLocalVariableRefExpr(gulc::LocalVariableRefExpr const* localVariableRefExpr) {
+    // The named return value doesn't have its own `alloca`, it lives in the return slot. `CodeTransformer` only sets
+    // it when the name is unique within the function.
+    if (_currentGhoulFunction->namedReturnValue != nullptr &&
+            _currentGhoulFunction->namedReturnValue->identifier().name() == localVariableRefExpr->variableName()) {
+        return _currentFunctionReturnValue;
+    }
+
     llvm::AllocaInst* localVariableAlloca = getLocalVariableOrNull(localVariableRefExpr->variableName());
 
     if (localVariableAlloca != nullptr) {
@@ -1927,17 +3408,60 @@ llvm::Value* gulc::CodeGen::generateLocalVariableRefExpr(gulc::LocalVariableRefE
 
 llvm::Value* gulc::CodeGen::generateLValueToRValueExpr(gulc::LValueToRValueExpr const* lValueToRValueExpr) {
     llvm::Value* lvalue = generateExpr(lValueToRValueExpr->lvalue);
-    return _irBuilder->CreateLoad(lvalue);
+    llvm::LoadInst* result = _irBuilder->CreateLoad(lvalue->getType()->getPointerElementType(), lvalue);
+
+    // If a `requires` contract narrowed the parameter's range we pass that along to the optimizer
+    if (llvm::isa<ParameterRefExpr>(lValueToRValueExpr->lvalue)) {
+        auto parameterRef = llvm::dyn_cast<ParameterRefExpr>(lValueToRValueExpr->lvalue);
+        auto foundRange = _currentParameterRanges.find(parameterRef->parameterIndex());
+
+        if (foundRange != _currentParameterRanges.end()) {
+            result->setMetadata(llvm::LLVMContext::MD_range, foundRange->second);
+        }
+    }
+
+    return result;
 }
 
 llvm::Value* gulc::CodeGen::generateMemberFunctionCallExpr(gulc::MemberFunctionCallExpr const* memberFunctionCallExpr,
                                                            llvm::Value* sret) {
     llvm::Value* functionPointer;
+    FunctionDecl const* functionDecl = nullptr;
     llvm::Value* selfArgument = generateExpr(memberFunctionCallExpr->selfArgument);
 
-    if (llvm::isa<VTableFunctionReferenceExpr>(memberFunctionCallExpr->functionReference)) {
+    if (llvm::isa<WitnessFunctionReferenceExpr>(memberFunctionCallExpr->functionReference)) {
+        auto witnessFunctionReference =
+                llvm::dyn_cast<WitnessFunctionReferenceExpr>(memberFunctionCallExpr->functionReference);
+        functionDecl = witnessFunctionReference->functionDecl();
+
+        // The implementations all take their own struct as `self`, through the witness table `self` is opaque
+        llvm::Type* selfType = llvm::Type::getInt8PtrTy(*_llvmContext);
+        std::vector<llvm::Type*> paramTypes = generateLlvmParamTypesWithSelf(functionDecl->parameters(), selfType,
+                                                                             functionDecl->returnType);
+
+        if (functionDecl->throws()) {
+            paramTypes.push_back(llvm::PointerType::getUnqual(generateLlvmErrorSlotType(functionDecl->throwsType())));
+        }
+
+        llvm::FunctionType* functionType =
+                llvm::FunctionType::get(generateLlvmReturnType(functionDecl->returnType), paramTypes, false);
+
+        llvm::Value* witnessTable = _irBuilder->CreateExtractValue(selfArgument, 1);
+        selfArgument = _irBuilder->CreateExtractValue(selfArgument, 0);
+
+        llvm::Value* witnessFunctions =
+                _irBuilder->CreateBitCast(witnessTable,
+                                          llvm::PointerType::getUnqual(llvm::PointerType::getUnqual(functionType)));
+        llvm::Value* witnessIndex = llvm::ConstantInt::get(llvm::Type::getInt32Ty(*_llvmContext),
+                                                           witnessFunctionReference->witnessIndex());
+
+        llvm::Type* witnessFunctionType = llvm::PointerType::getUnqual(functionType);
+        functionPointer = _irBuilder->CreateLoad(
+                witnessFunctionType, _irBuilder->CreateGEP(witnessFunctionType, witnessFunctions, witnessIndex));
+    } else if (llvm::isa<VTableFunctionReferenceExpr>(memberFunctionCallExpr->functionReference)) {
         auto vtableFunctionReference =
                 llvm::dyn_cast<VTableFunctionReferenceExpr>(memberFunctionCallExpr->functionReference);
+        functionDecl = vtableFunctionReference->functionDecl();
 
         llvm::FunctionType* functionType = getFunctionType(vtableFunctionReference->functionDecl(),
                                                            vtableFunctionReference->structDecl());
@@ -1947,15 +3471,14 @@ llvm::Value* gulc::CodeGen::generateMemberFunctionCallExpr(gulc::MemberFunctionC
                         vtableFunctionReference->vtableIndex(), functionType);
     } else {
         functionPointer = generateFunctionReferenceFromExpr(memberFunctionCallExpr->functionReference);
-    }
-
-    std::vector<llvm::Value*> llvmArgs;
 
-    if (sret != nullptr) {
-        llvmArgs.push_back(sret);
+        if (llvm::isa<FunctionReferenceExpr>(memberFunctionCallExpr->functionReference)) {
+            functionDecl = llvm::dyn_cast<FunctionReferenceExpr>(memberFunctionCallExpr->functionReference)
+                    ->functionDecl();
+        }
     }
 
-    llvmArgs.push_back(selfArgument);
+    std::vector<llvm::Value*> llvmArgs;
 
     if (memberFunctionCallExpr->hasArguments()) {
         llvmArgs.reserve(memberFunctionCallExpr->arguments.size());
@@ -1965,53 +3488,56 @@ llvm::Value* gulc::CodeGen::generateMemberFunctionCallExpr(gulc::MemberFunctionC
         }
     }
 
-    return _irBuilder->CreateCall(functionPointer, llvmArgs);
-}
+    if (functionDecl != nullptr) {
+        return createAbiCall(functionPointer, functionDecl, sret, selfArgument, llvmArgs);
+    }
 
-llvm::Value* gulc::CodeGen::generateMemberInfixOperatorCallExpr(
-        gulc::MemberInfixOperatorCallExpr const* memberInfixOperatorCallExpr, llvm::Value* sret) {
-    llvm::Function* functionPointer = getFunctionFromDecl(memberInfixOperatorCallExpr->infixOperatorDecl);
-    std::vector<llvm::Value*> llvmArgs;
+    llvmArgs.insert(llvmArgs.begin(), selfArgument);
 
     if (sret != nullptr) {
-        llvmArgs.push_back(sret);
+        llvmArgs.insert(llvmArgs.begin(), sret);
     }
 
-    llvmArgs.push_back(generateExpr(memberInfixOperatorCallExpr->leftValue));
-    llvmArgs.push_back(generateExpr(memberInfixOperatorCallExpr->rightValue));
+    auto functionType = llvm::cast<llvm::FunctionType>(functionPointer->getType()->getPointerElementType());
+    return _irBuilder->CreateCall(functionType, functionPointer, llvmArgs);
+}
+
+llvm::Value* gulc::CodeGen::generateMemberInfixOperatorCallExpr(
+        gulc::MemberInfixOperatorCallExpr const* memberInfixOperatorCallExpr, llvm::Value* sret) {
+    llvm::Function* functionPointer = getFunctionFromDecl(memberInfixOperatorCallExpr->infixOperatorDecl);
+    llvm::Value* selfArgument = generateExpr(memberInfixOperatorCallExpr->leftValue);
+    std::vector<llvm::Value*> llvmArgs {
+        generateExpr(memberInfixOperatorCallExpr->rightValue)
+    };
 
-    return _irBuilder->CreateCall(functionPointer, llvmArgs);
+    return createAbiCall(functionPointer, memberInfixOperatorCallExpr->infixOperatorDecl, sret, selfArgument,
+                         llvmArgs);
 }
 
 llvm::Value* gulc::CodeGen::generateMemberPostfixOperatorCallExpr(
         gulc::MemberPostfixOperatorCallExpr const* memberPostfixOperatorCallExpr, llvm::Value* sret) {
     llvm::Function* functionPointer = getFunctionFromDecl(memberPostfixOperatorCallExpr->postfixOperatorDecl);
-    std::vector<llvm::Value*> llvmArgs;
+    llvm::Value* selfArgument = generateExpr(memberPostfixOperatorCallExpr->nestedExpr);
 
-    if (sret != nullptr) {
-        llvmArgs.push_back(sret);
-    }
-
-    llvmArgs.push_back(generateExpr(memberPostfixOperatorCallExpr->nestedExpr));
-
-    return _irBuilder->CreateCall(functionPointer, llvmArgs);
+    return createAbiCall(functionPointer, memberPostfixOperatorCallExpr->postfixOperatorDecl, sret, selfArgument, {});
 }
 
 llvm::Value* gulc::CodeGen::generateMemberPrefixOperatorCallExpr(
         gulc::MemberPrefixOperatorCallExpr const* memberPrefixOperatorCallExpr, llvm::Value* sret) {
     llvm::Function* functionPointer = getFunctionFromDecl(memberPrefixOperatorCallExpr->prefixOperatorDecl);
-    std::vector<llvm::Value*> llvmArgs;
-
-    if (sret != nullptr) {
-        llvmArgs.push_back(sret);
-    }
+    llvm::Value* selfArgument = generateExpr(memberPrefixOperatorCallExpr->nestedExpr);
 
-    llvmArgs.push_back(generateExpr(memberPrefixOperatorCallExpr->nestedExpr));
-
-    return _irBuilder->CreateCall(functionPointer, llvmArgs);
+    return createAbiCall(functionPointer, memberPrefixOperatorCallExpr->prefixOperatorDecl, sret, selfArgument, {});
 }
 
 llvm::Value* gulc::CodeGen::generateMemberVariableRefExpr(gulc::MemberVariableRefExpr const* memberVariableRefExpr) {
+    // Members of `@soa` array elements are stored in their own column instead of within the element
+    if (llvm::isa<FlatArrayIndexExpr>(memberVariableRefExpr->object) &&
+            memberVariableRefExpr->structType->decl()->hasAttr(Attr::Kind::Soa)) {
+        return generateSoaMemberRef(llvm::dyn_cast<FlatArrayIndexExpr>(memberVariableRefExpr->object),
+                                    memberVariableRefExpr->variableDecl());
+    }
+
     llvm::Value* objectRef = generateExpr(memberVariableRefExpr->object);
 
     TypeCompareUtil typeCompareUtil;
@@ -2053,14 +3579,54 @@ llvm::Value* gulc::CodeGen::generateMemberVariableRefExpr(gulc::MemberVariableRe
     // NOTE: Not exactly sure whats wrong here but we'll just let LLVM handle getting the type...
 //    llvm::StructType* structType = getLlvmStructType(refStructMemberVariableExpr->structType->decl());
 //    llvm::PointerType* structPointerType = llvm::PointerType::getUnqual(structType);
-    return _irBuilder->CreateStructGEP(nullptr, objectRef, index);
+    return _irBuilder->CreateStructGEP(objectRef->getType()->getPointerElementType(), objectRef, index);
+}
+
+llvm::Value* gulc::CodeGen::generateNewExpr(gulc::NewExpr const* newExpr) {
+    auto constructorCallExpr = llvm::dyn_cast<ConstructorCallExpr>(newExpr->initializer);
+    llvm::Type* llvmStructType = generateLlvmType(constructorCallExpr->valueType);
+    llvm::Value* memory;
+
+    if (newExpr->isStackAllocated) {
+        // `EscapeAnalyzer` proved the pointer never outlives the function, a stack slot is enough
+        memory = createEntryBlockAlloca(llvmStructType, "new");
+    } else {
+        llvm::DataLayout const& dataLayout = _llvmModule->getDataLayout();
+        std::uint64_t size = dataLayout.getTypeAllocSize(llvmStructType);
+        std::uint64_t alignment = getLlvmTypeAlignment(llvmStructType);
+        llvm::Type* int8PtrType = llvm::Type::getInt8PtrTy(*_llvmContext);
+        llvm::Type* sizeType = dataLayout.getIntPtrType(*_llvmContext);
+        llvm::Value* rawMemory;
+
+        // `malloc` only guarantees the alignment of the largest built in type, over aligned structs (e.g. ones with
+        // `simd` members) need `aligned_alloc` which also requires the size to be a multiple of the alignment
+        if (alignment > 16) {
+            llvm::FunctionType* alignedAllocType = llvm::FunctionType::get(int8PtrType, { sizeType, sizeType },
+                                                                           false);
+            std::uint64_t alignedSize = (size + alignment - 1) / alignment * alignment;
+
+            rawMemory = _irBuilder->CreateCall(_llvmModule->getOrInsertFunction("aligned_alloc", alignedAllocType),
+                                               { llvm::ConstantInt::get(sizeType, alignment),
+                                                 llvm::ConstantInt::get(sizeType, alignedSize) });
+        } else {
+            llvm::FunctionType* mallocType = llvm::FunctionType::get(int8PtrType, { sizeType }, false);
+
+            rawMemory = _irBuilder->CreateCall(_llvmModule->getOrInsertFunction("malloc", mallocType),
+                                               { llvm::ConstantInt::get(sizeType, size) });
+        }
+
+        memory = _irBuilder->CreateBitCast(rawMemory, llvm::PointerType::getUnqual(llvmStructType));
+    }
+
+    // The constructor is called with the new memory as `self`, there is no temporary value to construct
+    generateConstructorCallExpr(constructorCallExpr, memory);
+
+    return memory;
 }
 
 llvm::Value* gulc::CodeGen::generateParameterRefExpr(gulc::ParameterRefExpr const* parameterRefExpr) {
     // If the function returns a struct we make it the first parameter.
-    std::size_t sretMod =
-            _currentGhoulFunction->returnType != nullptr && llvm::isa<StructType>(_currentGhoulFunction->returnType) ?
-                    1 : 0;
+    std::size_t sretMod = returnsViaSRet(_currentGhoulFunction->returnType) ? 1 : 0;
     // If the function is a member function (i.e. has `self` argument) we need to add one to the param
     // index.
     std::size_t paramMod = _currentGhoulFunction->isMemberFunction() ? 1 : 0;
@@ -2081,7 +3647,7 @@ llvm::Value* gulc::CodeGen::generateParenExpr(gulc::ParenExpr const* parenExpr)
 
 llvm::Value* gulc::CodeGen::generatePostfixOperatorExpr(gulc::PostfixOperatorExpr const* postfixOperatorExpr) {
     llvm::Value* refValue = generateExpr(postfixOperatorExpr->nestedExpr);
-    llvm::Value* value = _irBuilder->CreateLoad(refValue);
+    llvm::Value* value = _irBuilder->CreateLoad(refValue->getType()->getPointerElementType(), refValue);
 
     Type* valueType = postfixOperatorExpr->nestedExpr->valueType;
 
@@ -2160,7 +3726,8 @@ llvm::Value* gulc::CodeGen::generatePrefixOperatorExpr(gulc::PrefixOperatorExpr
     PrefixOperators checkOperator = prefixOperatorExpr->prefixOperator();
 
     if (checkOperator == PrefixOperators::Increment || checkOperator == PrefixOperators::Decrement) {
-        llvm::Value* derefValue = _irBuilder->CreateLoad(nestedValue);
+        llvm::Value* derefValue = _irBuilder->CreateLoad(nestedValue->getType()->getPointerElementType(),
+                                                         nestedValue);
 
         bool isSigned = false;
         bool isFloat = false;
@@ -2224,7 +3791,7 @@ llvm::Value* gulc::CodeGen::generatePrefixOperatorExpr(gulc::PrefixOperatorExpr
                        prefixOperatorExpr->startPosition(), prefixOperatorExpr->endPosition());
         }
 
-        return _irBuilder->CreateLoad(nestedValue);
+        return _irBuilder->CreateLoad(nestedValue->getType()->getPointerElementType(), nestedValue);
     } else if (checkOperator == PrefixOperators::Reference) {
         // NOTE: For `reference` is is just a logical conversion for us to no longer implicitly dereference the
         //       reference. The only difference between a pointer and a reference is that pointers are managed manually
@@ -2296,18 +3863,14 @@ llvm::Value* gulc::CodeGen::generatePrefixOperatorExpr(gulc::PrefixOperatorExpr
 llvm::Value* gulc::CodeGen::generatePropertyGetCallExpr(gulc::PropertyGetCallExpr const* propertyGetCallExpr,
                                                         llvm::Value* sret) {
     llvm::Function* callFunction = nullptr;
-    std::vector<llvm::Value*> arguments;
-
-    if (sret != nullptr) {
-        arguments.push_back(sret);
-    }
+    llvm::Value* selfArgument = nullptr;
 
     switch (propertyGetCallExpr->propertyReference->getExprKind()) {
         case Expr::Kind::MemberPropertyRef: {
             auto memberPropertyRef = llvm::dyn_cast<MemberPropertyRefExpr>(propertyGetCallExpr->propertyReference);
 
             callFunction = getFunctionFromDecl(propertyGetCallExpr->propertyGetter);
-            arguments.push_back(generateExpr(memberPropertyRef->object));
+            selfArgument = generateExpr(memberPropertyRef->object);
             break;
         }
         case Expr::Kind::PropertyRef: {
@@ -2322,19 +3885,19 @@ llvm::Value* gulc::CodeGen::generatePropertyGetCallExpr(gulc::PropertyGetCallExp
             return nullptr;
     }
 
-    return _irBuilder->CreateCall(callFunction, arguments);
+    return createAbiCall(callFunction, propertyGetCallExpr->propertyGetter, sret, selfArgument, {});
 }
 
 llvm::Value* gulc::CodeGen::generatePropertySetCallExpr(gulc::PropertySetCallExpr const* propertySetCallExpr) {
     llvm::Function* callFunction = nullptr;
-    std::vector<llvm::Value*> arguments;
+    llvm::Value* selfArgument = nullptr;
 
     switch (propertySetCallExpr->propertyReference->getExprKind()) {
         case Expr::Kind::MemberPropertyRef: {
             auto memberPropertyRef = llvm::dyn_cast<MemberPropertyRefExpr>(propertySetCallExpr->propertyReference);
 
             callFunction = getFunctionFromDecl(propertySetCallExpr->propertySetter);
-            arguments.push_back(generateExpr(memberPropertyRef->object));
+            selfArgument = generateExpr(memberPropertyRef->object);
             break;
         }
         case Expr::Kind::PropertyRef: {
@@ -2349,9 +3912,11 @@ llvm::Value* gulc::CodeGen::generatePropertySetCallExpr(gulc::PropertySetCallExp
             return nullptr;
     }
 
-    arguments.push_back(generateExpr(propertySetCallExpr->value));
+    std::vector<llvm::Value*> arguments {
+        generateExpr(propertySetCallExpr->value)
+    };
 
-    return _irBuilder->CreateCall(callFunction, arguments);
+    return createAbiCall(callFunction, propertySetCallExpr->propertySetter, nullptr, selfArgument, arguments);
 }
 
 llvm::Value* gulc::CodeGen::generateRefExpr(gulc::RefExpr const* refExpr) {
@@ -2362,11 +3927,139 @@ llvm::Value* gulc::CodeGen::generateRefExpr(gulc::RefExpr const* refExpr) {
 
 llvm::Value* gulc::CodeGen::generateRValueToInRefExpr(gulc::RValueToInRefExpr const* rvalueToInRefExpr) {
     auto generatedValue = generateExpr(rvalueToInRefExpr->rvalue);
-    auto result = _irBuilder->CreateAlloca(generateLlvmType(rvalueToInRefExpr->valueType));
+    auto result = createEntryBlockAlloca(generateLlvmType(rvalueToInRefExpr->valueType));
     _irBuilder->CreateStore(generatedValue, result);
     return result;
 }
 
+llvm::Value* gulc::CodeGen::generateSimdBuiltInCallExpr(gulc::SimdBuiltInCallExpr const* simdBuiltInCallExpr) {
+    std::vector<llvm::Value*> arguments;
+    arguments.reserve(simdBuiltInCallExpr->arguments.size());
+
+    for (Expr const* argument : simdBuiltInCallExpr->arguments) {
+        arguments.push_back(generateExpr(argument));
+    }
+
+    // The vector operand is the first argument for everything except `simd_masked_load`
+    auto vectorType = llvm::dyn_cast<SimdType>(
+            simdBuiltInCallExpr->builtIn() == SimdBuiltInCallExpr::BuiltIn::MaskedLoad
+                ? simdBuiltInCallExpr->arguments[2]->valueType
+                : simdBuiltInCallExpr->arguments[0]->valueType
+        );
+    bool isBoolElement = llvm::isa<BoolType>(vectorType->elementType);
+    bool isFloat = false;
+    bool isSigned = false;
+
+    if (!isBoolElement) {
+        auto elementBuiltIn = llvm::dyn_cast<BuiltInType>(vectorType->elementType);
+
+        isFloat = elementBuiltIn->isFloating();
+        isSigned = elementBuiltIn->isSigned();
+    }
+
+    llvm::Value* result = nullptr;
+
+    switch (simdBuiltInCallExpr->builtIn()) {
+        case SimdBuiltInCallExpr::BuiltIn::Shuffle: {
+            std::vector<int> shuffleMask(simdBuiltInCallExpr->shuffleMask.begin(),
+                                                   simdBuiltInCallExpr->shuffleMask.end());
+            // With a single vector the second operand is never selected from
+            llvm::Value* secondVector = arguments.size() == 2
+                    ? arguments[1]
+                    : llvm::UndefValue::get(arguments[0]->getType());
+
+            return _irBuilder->CreateShuffleVector(arguments[0], secondVector, shuffleMask);
+        }
+        case SimdBuiltInCallExpr::BuiltIn::Select:
+            return _irBuilder->CreateSelect(arguments[0], arguments[1], arguments[2]);
+        case SimdBuiltInCallExpr::BuiltIn::Extract:
+            result = _irBuilder->CreateExtractElement(arguments[0], arguments[1]);
+            break;
+        case SimdBuiltInCallExpr::BuiltIn::Insert: {
+            llvm::Value* insertValue = arguments[2];
+
+            if (isBoolElement) {
+                insertValue = _irBuilder->CreateTrunc(insertValue, llvm::Type::getInt1Ty(*_llvmContext));
+            }
+
+            return _irBuilder->CreateInsertElement(arguments[0], insertValue, arguments[1]);
+        }
+        case SimdBuiltInCallExpr::BuiltIn::ReduceAdd:
+            if (isFloat) {
+                // `reassoc` lets LLVM use a tree reduction instead of a strict in order reduction, without it the
+                // reduction is lowered to a serial chain of `fadd` which defeats the purpose
+                llvm::FastMathFlags fastMathFlags;
+                fastMathFlags.setAllowReassoc();
+                _irBuilder->setFastMathFlags(fastMathFlags);
+                result = _irBuilder->CreateFAddReduce(
+                        llvm::ConstantFP::get(generateLlvmType(vectorType->elementType), 0.0), arguments[0]);
+                _irBuilder->clearFastMathFlags();
+            } else {
+                result = _irBuilder->CreateAddReduce(arguments[0]);
+            }
+            break;
+        case SimdBuiltInCallExpr::BuiltIn::ReduceMul:
+            if (isFloat) {
+                llvm::FastMathFlags fastMathFlags;
+                fastMathFlags.setAllowReassoc();
+                _irBuilder->setFastMathFlags(fastMathFlags);
+                result = _irBuilder->CreateFMulReduce(
+                        llvm::ConstantFP::get(generateLlvmType(vectorType->elementType), 1.0), arguments[0]);
+                _irBuilder->clearFastMathFlags();
+            } else {
+                result = _irBuilder->CreateMulReduce(arguments[0]);
+            }
+            break;
+        case SimdBuiltInCallExpr::BuiltIn::ReduceMin:
+            if (isFloat) {
+                result = _irBuilder->CreateFPMinReduce(arguments[0]);
+            } else {
+                result = _irBuilder->CreateIntMinReduce(arguments[0], isSigned);
+            }
+            break;
+        case SimdBuiltInCallExpr::BuiltIn::ReduceMax:
+            if (isFloat) {
+                result = _irBuilder->CreateFPMaxReduce(arguments[0]);
+            } else {
+                result = _irBuilder->CreateIntMaxReduce(arguments[0], isSigned);
+            }
+            break;
+        case SimdBuiltInCallExpr::BuiltIn::ReduceAnd:
+            result = _irBuilder->CreateAndReduce(arguments[0]);
+            break;
+        case SimdBuiltInCallExpr::BuiltIn::ReduceOr:
+            result = _irBuilder->CreateOrReduce(arguments[0]);
+            break;
+        case SimdBuiltInCallExpr::BuiltIn::ReduceXor:
+            result = _irBuilder->CreateXorReduce(arguments[0]);
+            break;
+        case SimdBuiltInCallExpr::BuiltIn::MaskedLoad:
+        case SimdBuiltInCallExpr::BuiltIn::MaskedStore: {
+            bool isLoad = simdBuiltInCallExpr->builtIn() == SimdBuiltInCallExpr::BuiltIn::MaskedLoad;
+            llvm::Value* elementPointer = isLoad ? arguments[0] : arguments[1];
+            llvm::Value* mask = isLoad ? arguments[1] : arguments[2];
+            // The pointer is to a single element, we only know the elements are aligned to the element size
+            llvm::Align alignment(SizeofUtil::getSizeAndAlignmentOf(_target, vectorType->elementType).align);
+            llvm::Type* llvmVectorType = generateLlvmType(vectorType);
+            llvm::Value* vectorPointer = _irBuilder->CreateBitCast(elementPointer,
+                                                                   llvm::PointerType::getUnqual(llvmVectorType));
+
+            if (isLoad) {
+                return _irBuilder->CreateMaskedLoad(llvmVectorType, vectorPointer, alignment, mask, arguments[2]);
+            } else {
+                return _irBuilder->CreateMaskedStore(arguments[0], vectorPointer, alignment, mask);
+            }
+        }
+    }
+
+    // Scalar `bool` is stored as `i8` while the elements of `simd<bool, N>` are `i1`
+    if (isBoolElement && result != nullptr) {
+        result = _irBuilder->CreateZExt(result, llvm::Type::getInt8Ty(*_llvmContext));
+    }
+
+    return result;
+}
+
 llvm::Value* gulc::CodeGen::generateSolvedConstExpr(gulc::SolvedConstExpr const* solvedConstExpr) {
     return generateExpr(solvedConstExpr->solution);
 }
@@ -2374,74 +4067,51 @@ llvm::Value* gulc::CodeGen::generateSolvedConstExpr(gulc::SolvedConstExpr const*
 llvm::Value* gulc::CodeGen::generateStoreTemporaryValueExpr(
         gulc::StoreTemporaryValueExpr const* storeTemporaryValueExpr) {
     auto tempValueRef = generateTemporaryValueRefExpr(storeTemporaryValueExpr->temporaryValue);
-    llvm::Value* storeValue = nullptr;
 
     // If the temporary value is a struct then we will have to manually inject the temporary value as the first
     // argument to various function calls.
     if (llvm::isa<StructType>(storeTemporaryValueExpr->temporaryValue->valueType)) {
-        switch (storeTemporaryValueExpr->storeValue->getExprKind()) {
-            case Expr::Kind::FunctionCall:
-                storeValue = generateFunctionCallExpr(
-                        llvm::dyn_cast<FunctionCallExpr>(storeTemporaryValueExpr->storeValue),
-                        tempValueRef
-                );
-                break;
-            case Expr::Kind::MemberFunctionCall:
-                storeValue = generateMemberFunctionCallExpr(
-                        llvm::dyn_cast<MemberFunctionCallExpr>(storeTemporaryValueExpr->storeValue),
-                        tempValueRef
-                );
-                break;
-            case Expr::Kind::MemberInfixOperatorCall:
-                storeValue = generateMemberInfixOperatorCallExpr(
-                        llvm::dyn_cast<MemberInfixOperatorCallExpr>(storeTemporaryValueExpr->storeValue),
-                        tempValueRef
-                );
-                break;
-            case Expr::Kind::MemberPostfixOperatorCall:
-                storeValue = generateMemberPostfixOperatorCallExpr(
-                        llvm::dyn_cast<MemberPostfixOperatorCallExpr>(storeTemporaryValueExpr->storeValue),
-                        tempValueRef
-                );
-                break;
-            case Expr::Kind::MemberPrefixOperatorCall:
-                storeValue = generateMemberPrefixOperatorCallExpr(
-                        llvm::dyn_cast<MemberPrefixOperatorCallExpr>(storeTemporaryValueExpr->storeValue),
-                        tempValueRef
-                );
-                break;
-            case Expr::Kind::PropertyGetCall:
-                storeValue = generatePropertyGetCallExpr(
-                        llvm::dyn_cast<PropertyGetCallExpr>(storeTemporaryValueExpr->storeValue),
-                        tempValueRef
-                );
-                break;
-            case Expr::Kind::SubscriptOperatorGetCall:
-                storeValue = generateSubscriptOperatorGetCallExpr(
-                        llvm::dyn_cast<SubscriptOperatorGetCallExpr>(storeTemporaryValueExpr->storeValue),
-                        tempValueRef
-                );
-                break;
-            default:
-                printError("[INTERNAL] unsupported expression found in `CodeGen::generateStoreTemporaryValueExpr`!",
-                           storeTemporaryValueExpr->startPosition(), storeTemporaryValueExpr->endPosition());
-        }
+        generateCallWithSRet(storeTemporaryValueExpr->storeValue, tempValueRef);
     } else {
-        storeValue = generateExpr(storeTemporaryValueExpr->storeValue);
+        generateExpr(storeTemporaryValueExpr->storeValue);
     }
 
     return tempValueRef;
 }
 
+llvm::Value* gulc::CodeGen::generateCallWithSRet(gulc::Expr const* callExpr, llvm::Value* sret) {
+    switch (callExpr->getExprKind()) {
+        case Expr::Kind::FunctionCall:
+            return generateFunctionCallExpr(llvm::dyn_cast<FunctionCallExpr>(callExpr), sret);
+        case Expr::Kind::MemberFunctionCall:
+            return generateMemberFunctionCallExpr(llvm::dyn_cast<MemberFunctionCallExpr>(callExpr), sret);
+        case Expr::Kind::MemberInfixOperatorCall:
+            return generateMemberInfixOperatorCallExpr(llvm::dyn_cast<MemberInfixOperatorCallExpr>(callExpr), sret);
+        case Expr::Kind::MemberPostfixOperatorCall:
+            return generateMemberPostfixOperatorCallExpr(llvm::dyn_cast<MemberPostfixOperatorCallExpr>(callExpr),
+                                                         sret);
+        case Expr::Kind::MemberPrefixOperatorCall:
+            return generateMemberPrefixOperatorCallExpr(llvm::dyn_cast<MemberPrefixOperatorCallExpr>(callExpr),
+                                                        sret);
+        case Expr::Kind::PropertyGetCall:
+            return generatePropertyGetCallExpr(llvm::dyn_cast<PropertyGetCallExpr>(callExpr), sret);
+        case Expr::Kind::SubscriptOperatorGetCall:
+            return generateSubscriptOperatorGetCallExpr(llvm::dyn_cast<SubscriptOperatorGetCallExpr>(callExpr),
+                                                        sret);
+        default:
+            printError("[INTERNAL] unsupported expression found in `CodeGen::generateCallWithSRet`!",
+                       callExpr->startPosition(), callExpr->endPosition());
+    }
+
+    return nullptr;
+}
+
 llvm::Value* gulc::CodeGen::generateSubscriptOperatorGetCallExpr(
         gulc::SubscriptOperatorGetCallExpr const* subscriptOperatorGetCallExpr, llvm::Value* sret) {
     llvm::Function* callFunction = nullptr;
+    llvm::Value* selfArgument = nullptr;
     std::vector<llvm::Value*> arguments;
 
-    if (sret != nullptr) {
-        arguments.push_back(sret);
-    }
-
     switch (subscriptOperatorGetCallExpr->subscriptOperatorReference->getExprKind()) {
         case Expr::Kind::MemberSubscriptOperatorRef: {
             auto memberSubscriptOperatorRef =
@@ -2450,7 +4120,7 @@ llvm::Value* gulc::CodeGen::generateSubscriptOperatorGetCallExpr(
                     );
 
             callFunction = getFunctionFromDecl(subscriptOperatorGetCallExpr->subscriptOperatorGetter);
-            arguments.push_back(generateExpr(memberSubscriptOperatorRef->object));
+            selfArgument = generateExpr(memberSubscriptOperatorRef->object);
             break;
         }
         case Expr::Kind::SubscriptOperatorRef: {
@@ -2471,13 +4141,14 @@ llvm::Value* gulc::CodeGen::generateSubscriptOperatorGetCallExpr(
         arguments.push_back(generateExpr(argument->argument));
     }
 
-    return _irBuilder->CreateCall(callFunction, arguments);
+    return createAbiCall(callFunction, subscriptOperatorGetCallExpr->subscriptOperatorGetter, sret, selfArgument,
+                         arguments);
 }
 
 llvm::Value* gulc::CodeGen::generateSubscriptOperatorSetCallExpr(
         gulc::SubscriptOperatorSetCallExpr const* subscriptOperatorSetCallExpr) {
     llvm::Function* callFunction = nullptr;
-    std::vector<llvm::Value*> arguments;
+    llvm::Value* selfArgument = nullptr;
 
     switch (subscriptOperatorSetCallExpr->subscriptOperatorReference->getExprKind()) {
         case Expr::Kind::MemberSubscriptOperatorRef: {
@@ -2487,7 +4158,7 @@ llvm::Value* gulc::CodeGen::generateSubscriptOperatorSetCallExpr(
                     );
 
             callFunction = getFunctionFromDecl(subscriptOperatorSetCallExpr->subscriptOperatorSetter);
-            arguments.push_back(generateExpr(memberSubscriptOperatorRef->object));
+            selfArgument = generateExpr(memberSubscriptOperatorRef->object);
             break;
         }
         case Expr::Kind::SubscriptOperatorRef: {
@@ -2504,13 +4175,18 @@ llvm::Value* gulc::CodeGen::generateSubscriptOperatorSetCallExpr(
             return nullptr;
     }
 
+    // The only declared parameter of a setter is `value`, it is classified against the setter the same as any other
+    // parameter. The subscript arguments come after it and are passed as-is the same as they are for the getter.
+    std::vector<llvm::Value*> arguments {
+        generateExpr(subscriptOperatorSetCallExpr->value)
+    };
+
     for (LabeledArgumentExpr* argument : subscriptOperatorSetCallExpr->subscriptOperatorReference->arguments) {
         arguments.push_back(generateExpr(argument->argument));
     }
 
-    arguments.push_back(generateExpr(subscriptOperatorSetCallExpr->value));
-
-    return _irBuilder->CreateCall(callFunction, arguments);
+    return createAbiCall(callFunction, subscriptOperatorSetCallExpr->subscriptOperatorSetter, nullptr, selfArgument,
+                         arguments);
 }
 
 llvm::Value* gulc::CodeGen::generateTemporaryValueRefExpr(gulc::TemporaryValueRefExpr const* temporaryValueRefExpr) {
@@ -2543,7 +4219,17 @@ llvm::Value* gulc::CodeGen::generateTernaryExpr(gulc::TernaryExpr const* ternary
 }
 
 llvm::Value* gulc::CodeGen::generateTryExpr(gulc::TryExpr const* tryExpr) {
-    return generateExpr(tryExpr->nestedExpr);
+    TryExpr const* oldTryExpr = _currentTryExpr;
+    std::size_t oldTryCallIndex = _currentTryCallIndex;
+    _currentTryExpr = tryExpr;
+    _currentTryCallIndex = 0;
+
+    llvm::Value* result = generateExpr(tryExpr->nestedExpr);
+
+    _currentTryExpr = oldTryExpr;
+    _currentTryCallIndex = oldTryCallIndex;
+
+    return result;
 }
 
 llvm::Value* gulc::CodeGen::generateValueLiteralExpr(gulc::ValueLiteralExpr const* valueLiteralExpr) {
@@ -2592,14 +4278,36 @@ llvm::Value* gulc::CodeGen::generateValueLiteralExpr(gulc::ValueLiteralExpr cons
 }
 
 llvm::Value* gulc::CodeGen::generateVariableDeclExpr(gulc::VariableDeclExpr const* variableDeclExpr) {
-    llvm::AllocaInst* newLocalVariable = addLocalVariable(variableDeclExpr->identifier().name(),
-                                                          generateLlvmType(variableDeclExpr->type));
+    llvm::Value* newLocalVariable;
+
+    // The named return value is constructed directly in the return slot instead of being moved there on `return`
+    if (variableDeclExpr == _currentGhoulFunction->namedReturnValue) {
+        newLocalVariable = _currentFunctionReturnValue;
+    } else {
+        newLocalVariable = addLocalVariable(variableDeclExpr->identifier().name(),
+                                            generateLlvmType(variableDeclExpr->type));
+    }
 
     // TODO: Are we going to do RAII? Or is `let x: i32` going to error saying it is unassigned?
     //       I think we should say it is unassigned. We do nothing unless you access `x`. If `x` hasn't been assigned
     //       at the first use then we error.
     //       To do something similar to RAII you would replace `let x: i32` with `let x = i32()`
     if (variableDeclExpr->initialValue != nullptr) {
+        // Elided initial values are constructed in place, there is no temporary to copy from
+        if (variableDeclExpr->initialValueAssignmentType == InitialValueAssignmentType::Elided) {
+            if (llvm::isa<ConstructorCallExpr>(variableDeclExpr->initialValue)) {
+                return generateConstructorCallExpr(
+                        llvm::dyn_cast<ConstructorCallExpr>(variableDeclExpr->initialValue),
+                        newLocalVariable
+                    );
+            } else {
+                return generateCallWithSRet(
+                        llvm::dyn_cast<StoreTemporaryValueExpr>(variableDeclExpr->initialValue)->storeValue,
+                        newLocalVariable
+                    );
+            }
+        }
+
         llvm::Value* initialValue = generateExpr(variableDeclExpr->initialValue);
 
         switch (variableDeclExpr->initialValueAssignmentType) {
@@ -2624,6 +4332,9 @@ llvm::Value* gulc::CodeGen::generateVariableDeclExpr(gulc::VariableDeclExpr cons
 
                 return _irBuilder->CreateCall(moveConstructorFunc, llvmArgs);
             }
+            case InitialValueAssignmentType::Elided:
+                // Handled above
+                break;
         }
     }
 
@@ -2644,11 +4355,51 @@ llvm::Value* gulc::CodeGen::generateVTableFunctionReferenceExpr(
 }
 
 llvm::Value* gulc::CodeGen::dereferenceReference(llvm::Value* value) {
-    return _irBuilder->CreateLoad(value);
+    return _irBuilder->CreateLoad(value->getType()->getPointerElementType(), value);
 }
 
 void gulc::CodeGen::castValue(gulc::Type* to, gulc::Type* from, llvm::Value*& value,
                               gulc::TextPosition const& startPosition, gulc::TextPosition const& endPosition) {
+    if (llvm::isa<TraitType>(to) && !llvm::isa<TraitType>(from)) {
+        // Struct to trait object, `value` is a pointer to the struct (either an lvalue or a reference)
+        auto toTrait = llvm::dyn_cast<TraitType>(to);
+        Type* fromStruct = from;
+
+        if (llvm::isa<ReferenceType>(fromStruct)) {
+            fromStruct = llvm::dyn_cast<ReferenceType>(fromStruct)->nestedType;
+        }
+
+        if (!llvm::isa<StructType>(fromStruct)) {
+            printError("[INTERNAL] type `" + from->toString() + "` cannot be converted to trait object `" +
+                       to->toString() + "`!",
+                       startPosition, endPosition);
+        }
+
+        llvm::Type* traitObjectType = generateLlvmType(to);
+        llvm::GlobalVariable* witnessTable = getWitnessTable(llvm::dyn_cast<StructType>(fromStruct)->decl(),
+                                                             toTrait->decl());
+        llvm::Value* selfPointer = _irBuilder->CreateBitCast(value, llvm::Type::getInt8PtrTy(*_llvmContext));
+        llvm::Value* witnessTablePointer =
+                _irBuilder->CreateBitCast(witnessTable, traitObjectType->getStructElementType(1));
+
+        value = llvm::UndefValue::get(traitObjectType);
+        value = _irBuilder->CreateInsertValue(value, selfPointer, 0);
+        value = _irBuilder->CreateInsertValue(value, witnessTablePointer, 1);
+        return;
+    }
+
+    if (llvm::isa<SimdType>(to) && !llvm::isa<SimdType>(from)) {
+        // Scalar to `simd` is a splat of the scalar into every element
+        auto toSimd = llvm::dyn_cast<SimdType>(to);
+
+        if (llvm::isa<BoolType>(from)) {
+            value = _irBuilder->CreateTrunc(value, llvm::Type::getInt1Ty(*_llvmContext));
+        }
+
+        value = _irBuilder->CreateVectorSplat(toSimd->length(), value);
+        return;
+    }
+
     if (llvm::isa<BuiltInType>(from)) {
         auto fromBuiltIn = llvm::dyn_cast<BuiltInType>(from);
 
@@ -2730,7 +4481,7 @@ void gulc::CodeGen::castValue(gulc::Type* to, gulc::Type* from, llvm::Value*& va
 }
 
 llvm::AllocaInst* gulc::CodeGen::addLocalVariable(std::string const& varName, llvm::Type* llvmType) {
-    llvm::AllocaInst* allocaInst = _irBuilder->CreateAlloca(llvmType, nullptr, varName);
+    llvm::AllocaInst* allocaInst = createEntryBlockAlloca(llvmType, varName);
 
     _currentLlvmFunctionLocalVariables.push_back(allocaInst);
 
@@ -2753,7 +4504,7 @@ llvm::AllocaInst* gulc::CodeGen::getLocalVariableOrNull(std::string const& varNa
 }
 
 llvm::AllocaInst* gulc::CodeGen::addTemporaryValue(std::string const& tmpName, llvm::Type* llvmType) {
-    llvm::AllocaInst* allocaInst = _irBuilder->CreateAlloca(llvmType, nullptr, tmpName);
+    llvm::AllocaInst* allocaInst = createEntryBlockAlloca(llvmType, tmpName);
 
     _currentStmtTemporaryValues.push_back(allocaInst);
 
@@ -2818,13 +4569,15 @@ llvm::Value* gulc::CodeGen::getVTableFunctionPointer(gulc::StructDecl* structDec
         objectRef = _irBuilder->CreateBitCast(objectRef, llvm::PointerType::getUnqual(vtableOwnerType));
     }
 
-    llvm::Value* vtablePointer = _irBuilder->CreateStructGEP(nullptr, objectRef, 0);
+    llvm::Value* vtablePointer = _irBuilder->CreateStructGEP(objectRef->getType()->getPointerElementType(),
+                                                             objectRef, 0);
     llvm::Value* indexVTableEntry = llvm::ConstantInt::get(indexType, vtableIndex);
 
     // Load the vtable entry pointer
-    llvm::Value* vtableFunctionPointer = _irBuilder->CreateGEP(nullptr, vtablePointer, index0);
+    llvm::Type* vtablePointerType = vtablePointer->getType()->getPointerElementType();
+    llvm::Value* vtableFunctionPointer = _irBuilder->CreateGEP(vtablePointerType, vtablePointer, index0);
 
-    vtableFunctionPointer = _irBuilder->CreateLoad(vtableFunctionPointer);
+    vtableFunctionPointer = _irBuilder->CreateLoad(vtablePointerType, vtableFunctionPointer);
 
     // Cast the vtable entry pointer to the appropriate function pointer type
     llvm::Type* vtableFunctionType = llvm::PointerType::getUnqual(functionType);
@@ -2834,7 +4587,8 @@ llvm::Value* gulc::CodeGen::getVTableFunctionPointer(gulc::StructDecl* structDec
     llvm::Value* vtableFunctions = _irBuilder->CreateBitCast(vtableFunctionPointer, vtableFunctionType);
 
     // This is finally a pointer to the function
-    llvm::Value* finalFunctionPointer = _irBuilder->CreateGEP(nullptr, vtableFunctions, indexVTableEntry);
+    llvm::Type* functionPointerType = llvm::PointerType::getUnqual(functionType);
+    llvm::Value* finalFunctionPointer = _irBuilder->CreateGEP(functionPointerType, vtableFunctions, indexVTableEntry);
 
-    return _irBuilder->CreateLoad(finalFunctionPointer);
+    return _irBuilder->CreateLoad(functionPointerType, finalFunctionPointer);
 }
@@ -19,12 +19,16 @@
 #define GULC_CODEGEN_HPP
 
 #include <Target.hpp>
+#include <CompilerOptions.hpp>
 #include <parsing/ASTFile.hpp>
 #include "Module.hpp"
+#include "SysVAbiClassifier.hpp"
 
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/ConstantRange.h>
 #include <llvm/IR/LegacyPassManager.h>
+#include <ast/Cont.hpp>
 #include <ast/decls/FunctionDecl.hpp>
 #include <ast/decls/VariableDecl.hpp>
 #include <ast/decls/TemplateFunctionDecl.hpp>
@@ -47,6 +51,7 @@
 #include <ast/stmts/ReturnStmt.hpp>
 #include <ast/stmts/SwitchStmt.hpp>
 #include <ast/stmts/DoCatchStmt.hpp>
+#include <ast/stmts/ThrowStmt.hpp>
 #include <ast/stmts/WhileStmt.hpp>
 #include <ast/exprs/ArrayLiteralExpr.hpp>
 #include <ast/exprs/AsExpr.hpp>
@@ -67,6 +72,7 @@
 #include <ast/exprs/VariableDeclExpr.hpp>
 #include <ast/exprs/VariableRefExpr.hpp>
 #include <ast/exprs/VTableFunctionReferenceExpr.hpp>
+#include <ast/exprs/WitnessFunctionReferenceExpr.hpp>
 #include <ast/exprs/LValueToRValueExpr.hpp>
 #include <ast/exprs/TryExpr.hpp>
 #include <ast/exprs/BoolLiteralExpr.hpp>
@@ -82,22 +88,30 @@
 #include <ast/exprs/StoreTemporaryValueExpr.hpp>
 #include <ast/exprs/MemberInfixOperatorCallExpr.hpp>
 #include <ast/exprs/SolvedConstExpr.hpp>
+#include <ast/exprs/FlatArrayIndexExpr.hpp>
+#include <ast/exprs/SimdBuiltInCallExpr.hpp>
+#include <ast/exprs/NewExpr.hpp>
+#include <ast/exprs/DeleteExpr.hpp>
+#include <ast/attrs/FunctionHintAttr.hpp>
 
 namespace gulc {
     class CodeGen {
     public:
-        CodeGen(Target const& genTarget, std::vector<std::string> const& filePaths)
-                : _target(genTarget), _filePaths(filePaths), _currentFile(nullptr),
+        CodeGen(Target const& genTarget, CompilerOptions const& options, std::vector<std::string> const& filePaths)
+                : _target(genTarget), _options(options), _filePaths(filePaths), _abiClassifier(genTarget),
+                  _currentFile(nullptr),
                   _llvmContext(nullptr), _irBuilder(nullptr), _llvmModule(nullptr), _funcPassManager(nullptr),
                   _currentLlvmFunction(nullptr), _currentGhoulFunction(nullptr), _entryBlockBuilder(nullptr),
-                  _currentFunctionExitBlock(nullptr), _currentLoopBlockContinue(nullptr),
-                  _currentLoopBlockBreak(nullptr), _anonLoopNameNumber(0) {}
+                  _currentFunctionExitBlock(nullptr), _currentFunctionReturnValue(nullptr),
+                  _currentLoopBlockContinue(nullptr), _currentLoopBlockBreak(nullptr), _anonLoopNameNumber(0) {}
 
         gulc::Module generate(ASTFile* file);
 
     protected:
         gulc::Target const& _target;
+        CompilerOptions const& _options;
         std::vector<std::string> const& _filePaths;
+        SysVAbiClassifier _abiClassifier;
         ASTFile* _currentFile;
         llvm::LLVMContext* _llvmContext;
         llvm::IRBuilder<>* _irBuilder;
@@ -108,13 +122,42 @@ namespace gulc {
 
         llvm::Function* _currentLlvmFunction;
         gulc::FunctionDecl const* _currentGhoulFunction;
-        std::vector<llvm::AllocaInst*> _currentLlvmFunctionParameters;
+        // NOTE: These are the storage locations for `sret`, `self` and the Ghoul parameters (in that order), they are
+        //       NOT one-to-one with the LLVM arguments since aggregates can be split into multiple registers
+        std::vector<llvm::Value*> _currentLlvmFunctionParameters;
         llvm::IRBuilder<>* _entryBlockBuilder;
         llvm::BasicBlock* _currentFunctionExitBlock;
         llvm::Value* _currentFunctionReturnValue;
         std::map<std::string, llvm::BasicBlock*> _currentLlvmFunctionLabels;
         std::vector<llvm::AllocaInst*> _currentLlvmFunctionLocalVariables;
         std::vector<llvm::AllocaInst*> _currentStmtTemporaryValues;
+        // `!range` metadata for parameters that were narrowed by a `requires` contract, keyed by the parameter index
+        std::map<std::size_t, llvm::MDNode*> _currentParameterRanges;
+        // The blocks for `_currentGhoulFunction->returnCleanups`, these are created the first time a `return` needs them
+        std::vector<llvm::BasicBlock*> _currentReturnCleanupBlocks;
+        // `ensures` is checked by every `return` before it branches into the cleanup chain, the cleanups destruct the
+        // parameters the contracts refer to
+        bool _currentFunctionChecksEnsures = false;
+        // The hidden error slot argument for `throws` functions, errors that aren't caught are stored straight into it
+        llvm::Value* _currentFunctionErrorSlot = nullptr;
+        // Errors passed on to our caller run the same cleanups as `return` but end at this block instead of
+        // `_currentFunctionExitBlock` so `ensures` is skipped and the caller's return value is left untouched
+        llvm::BasicBlock* _currentFunctionErrorExitBlock = nullptr;
+        std::vector<llvm::BasicBlock*> _currentErrorCleanupBlocks;
+        // The innermost `try` being generated, calls to throwing functions check the error slot and branch to its handler
+        TryExpr const* _currentTryExpr = nullptr;
+        // The index into `_currentTryExpr->callErrorDestinations` of the next throwing call
+        std::size_t _currentTryCallIndex = 0;
+
+        struct CatchState {
+            // One slot for each of `CatchStmt::caughtErrorTypes`
+            std::vector<llvm::Value*> errorSlots;
+            llvm::BasicBlock* catchBlock = nullptr;
+            // The blocks for `CatchStmt::errorCleanups`
+            std::vector<llvm::BasicBlock*> cleanupBlocks;
+        };
+
+        std::map<CatchStmt const*, CatchState> _currentCatchStates;
 
         llvm::BasicBlock* _currentLoopBlockContinue;
         llvm::BasicBlock* _currentLoopBlockBreak;
@@ -123,12 +166,50 @@ namespace gulc {
         // For unnamed (anonymous) loop names we keep a tally of their numbers for proper naming
         unsigned int _anonLoopNameNumber;
 
+        // Template instantiations and `@inline` functions are generated as `linkonce_odr` in their own COMDAT by every
+        // module that references them instead of by the module that declares them. These are the ones referenced by
+        // the current module, the queue holds the ones that still need their body generated.
+        std::set<FunctionDecl const*> _linkOnceDecls;
+        std::vector<FunctionDecl const*> _linkOnceDeclQueue;
+        bool _isGeneratingLinkOnceDecls = false;
+
         void printError(std::string const& message, TextPosition startPosition, TextPosition endPosition);
 
         llvm::Type* generateLlvmType(gulc::Type const* type);
         std::vector<llvm::Type*> generateLlvmParamTypes(std::vector<ParameterDecl*> const& parameters,
                                                         StructDecl const* parentStruct, gulc::Type* returnType);
+        // `selfType` is the LLVM type of the `self` pointer, `nullptr` when there is no `self`
+        std::vector<llvm::Type*> generateLlvmParamTypesWithSelf(std::vector<ParameterDecl*> const& parameters,
+                                                                llvm::Type* selfType, gulc::Type* returnType);
         llvm::StructType* generateLlvmStructType(StructDecl const* structDecl, bool unpadded = false);
+        // `outLayout` is filled with the member stored in each LLVM element, padding elements are `nullptr`
+        llvm::StructType* generateLlvmSoaArrayType(StructDecl const* soaStruct, std::uint64_t length,
+                                                   std::vector<VariableDecl const*>* outLayout = nullptr);
+        llvm::Type* generateLlvmReturnType(gulc::Type const* returnType);
+        // `{ i1 didThrow, errorType value }`, the value is left out for an untyped `throws`
+        llvm::StructType* generateLlvmErrorSlotType(gulc::Type const* errorType);
+
+        // System V ABI lowering
+        FunctionAbiInfo classifyFunctionAbi(std::vector<ParameterDecl*> const& parameters,
+                                            StructDecl const* parentStruct, gulc::Type const* returnType);
+        bool returnsViaSRet(gulc::Type const* returnType) const;
+        llvm::Type* generateLlvmAbiEightbyteType(AbiEightbyte const& eightbyte);
+        llvm::Type* generateLlvmAbiCoercedType(AbiArgInfo const& abiArgInfo);
+        void applyAbiAttributes(llvm::Function* function, std::vector<ParameterDecl*> const& parameters,
+                                StructDecl const* parentStruct, gulc::Type const* returnType);
+        // Profile guided optimization, instruments or annotates `_llvmModule` depending on `_options.profileMode`
+        void runProfilePasses();
+
+        // Optimizer hints (`@inline`, `@cold`, etc.)
+        std::vector<FunctionHintAttr const*> getFunctionHints(FunctionDecl const* functionDecl) const;
+        void applyFunctionHintAttributes(llvm::Function* function, FunctionDecl const* functionDecl);
+        void flattenCallSites(llvm::Function* function);
+        void appendAbiArgument(std::vector<llvm::Value*>& llvmArgs, AbiArgInfo const& abiArgInfo,
+                               llvm::Value* value);
+        llvm::CallInst* createAbiCall(llvm::Value* function, FunctionDecl const* functionDecl, llvm::Value* sret,
+                                      llvm::Value* selfArgument, std::vector<llvm::Value*> const& arguments);
+        llvm::AllocaInst* createEntryBlockAlloca(llvm::Type* llvmType, llvm::Twine const& name = "");
+        std::uint64_t getLlvmTypeAlignment(llvm::Type* llvmType);
         // This is meant to grab the size from `constSize`, `constSize` will be required to be a value literal type
         std::uint64_t generateConstSize(Expr* constSize);
 
@@ -151,11 +232,36 @@ namespace gulc {
         void generateTraitDecl(TraitDecl const* traitDecl, bool isInternal);
         // Generate a global (non-member) variable declaration.
         void generateVariableDecl(VariableDecl const* variableDecl, bool isInternal);
+        llvm::GlobalVariable* generateVTable(StructDecl const* structDecl, bool isInternal);
+        // Get (or generate) the `linkonce_odr` witness table `structDecl` uses for trait objects of `traitDecl`
+        llvm::GlobalVariable* getWitnessTable(StructDecl* structDecl, TraitDecl* traitDecl);
+        // Get (or generate) the witness table entry for a `virtual` implementation, it calls `vtableIndex` of `self`
+        llvm::Function* getWitnessVTableThunk(StructDecl* structDecl, llvm::Function* implementation,
+                                              std::size_t vtableIndex, std::string const& thunkName);
+
+        // `linkonce_odr` emission
+        bool isLinkOnceDecl(Decl const* decl) const;
+        // True if `decl` or any of its containers is `private`
+        bool isFilePrivateDecl(Decl const* decl) const;
+        bool isImportedPrivateDecl(FunctionDecl const* functionDecl) const;
+        void requireLinkOnceDecl(FunctionDecl const* functionDecl);
+        void generateLinkOnceDecls();
+        // `linkonce_odr` for `isLinkOnceDecl`, `internal` for the copies of imported `private` functions
+        void setOnDemandLinkage(FunctionDecl const* functionDecl, llvm::GlobalObject* globalObject);
+        void setLinkOnceODR(llvm::GlobalObject* globalObject);
 
-        void setCurrentFunction(llvm::Function* currentFunction, gulc::FunctionDecl const* currentGhoulFunction);
+        void setCurrentFunction(llvm::Function* currentFunction, gulc::FunctionDecl const* currentGhoulFunction,
+                                StructDecl const* parentStruct);
         llvm::FunctionType* getFunctionType(FunctionDecl const* functionDecl, StructDecl const* parentStruct);
         llvm::Function* getFunction(FunctionDecl* functionDecl);
         bool currentFunctionLabelsContains(std::string const& labelName);
+
+        // Contracts
+        void generateContracts(FunctionDecl const* functionDecl, Cont::Kind contractKind);
+        void generateContractCheck(llvm::Value* condition, Cont const* contract);
+        void collectContractRanges(FunctionDecl const* functionDecl);
+        void narrowContractRange(Expr const* condition, std::vector<ParameterDecl*> const& parameters,
+                                 std::map<std::size_t, llvm::ConstantRange>& ranges);
         void addCurrentFunctionLabel(std::string const& labelName, llvm::BasicBlock* basicBlock);
         void addBlockAndSetInsertionPoint(llvm::BasicBlock* basicBlock);
         llvm::BasicBlock* getBreakBlock(std::string const& blockName);
@@ -173,7 +279,17 @@ namespace gulc {
         void generateLabeledStmt(LabeledStmt const* labeledStmt);
         void generateRepeatWhileStmt(RepeatWhileStmt const* repeatWhileStmt, std::string const& stmtName);
         void generateReturnStmt(ReturnStmt const* returnStmt);
+        llvm::BasicBlock* getReturnCleanupBlock(std::int64_t cleanupIndex);
+        llvm::BasicBlock* getErrorCleanupBlock(ErrorDestination const& errorDestination);
+        llvm::BasicBlock* getCleanupBlock(std::vector<ReturnCleanup> const& cleanups,
+                                          std::vector<llvm::BasicBlock*>& cleanupBlocks, std::int64_t cleanupIndex,
+                                          llvm::BasicBlock* endBlock, std::string const& blockName);
+        llvm::Value* getErrorSlot(ErrorDestination const& errorDestination, TextPosition startPosition,
+                                  TextPosition endPosition);
+        void generateErrorCheck(llvm::Value* errorSlot, ErrorDestination const& errorDestination);
+        void generateErrorExitBlock();
         void generateSwitchStmt(SwitchStmt const* switchStmt);
+        void generateThrowStmt(ThrowStmt const* throwStmt);
         void generateWhileStmt(WhileStmt const* whileStmt, std::string const& stmtName);
 
         void enterNestedLoop(llvm::BasicBlock* continueLoop, llvm::BasicBlock* breakLoop,
@@ -194,8 +310,14 @@ namespace gulc {
         llvm::Value* generateConstructorCallExpr(ConstructorCallExpr const* constructorCallExpr,
                                                  llvm::Value* replaceObjectRef = nullptr);
         llvm::Value* generateCurrentSelfExpr(CurrentSelfExpr const* currentSelfExpr);
+        llvm::Value* generateDeleteExpr(DeleteExpr const* deleteExpr);
         llvm::Value* generateDestructorCallExpr(DestructorCallExpr const* destructorCallExpr);
         llvm::Value* generateEnumConstRefExpr(EnumConstRefExpr const* enumConstRefExpr);
+        llvm::Value* generateFlatArrayIndexExpr(FlatArrayIndexExpr const* flatArrayIndexExpr);
+        // Generates a flat array index widened to `i64` based on the signedness of its type
+        llvm::Value* generateArrayIndex(Expr const* index);
+        llvm::Value* generateSoaMemberRef(FlatArrayIndexExpr const* flatArrayIndexExpr,
+                                          VariableDecl const* member);
         llvm::Value* generateFunctionCallExpr(FunctionCallExpr const* functionCallExpr, llvm::Value* sret = nullptr);
         llvm::Value* generateFunctionReferenceFromExpr(Expr const* expr);
         llvm::Value* generateImplicitCastExpr(ImplicitCastExpr const* implicitCastExpr);
@@ -216,6 +338,7 @@ namespace gulc {
         llvm::Value* generateMemberPrefixOperatorCallExpr(
                 MemberPrefixOperatorCallExpr const* memberPrefixOperatorCallExpr, llvm::Value* sret = nullptr);
         llvm::Value* generateMemberVariableRefExpr(MemberVariableRefExpr const* memberVariableRefExpr);
+        llvm::Value* generateNewExpr(NewExpr const* newExpr);
         llvm::Value* generateParameterRefExpr(ParameterRefExpr const* parameterRefExpr);
         llvm::Value* generateParenExpr(ParenExpr const* parenExpr);
         llvm::Value* generatePostfixOperatorExpr(PostfixOperatorExpr const* postfixOperatorExpr);
@@ -225,8 +348,11 @@ namespace gulc {
         llvm::Value* generatePropertySetCallExpr(PropertySetCallExpr const* propertySetCallExpr);
         llvm::Value* generateRefExpr(RefExpr const* refExpr);
         llvm::Value* generateRValueToInRefExpr(RValueToInRefExpr const* rvalueToInRefExpr);
+        llvm::Value* generateSimdBuiltInCallExpr(SimdBuiltInCallExpr const* simdBuiltInCallExpr);
         llvm::Value* generateSolvedConstExpr(SolvedConstExpr const* solvedConstExpr);
         llvm::Value* generateStoreTemporaryValueExpr(StoreTemporaryValueExpr const* storeTemporaryValueExpr);
+        // Generates a call that returns a struct, constructing the result in `sret`
+        llvm::Value* generateCallWithSRet(Expr const* callExpr, llvm::Value* sret);
         llvm::Value* generateSubscriptOperatorGetCallExpr(
                 SubscriptOperatorGetCallExpr const* subscriptOperatorGetCallExpr, llvm::Value* sret = nullptr);
         llvm::Value* generateSubscriptOperatorSetCallExpr(
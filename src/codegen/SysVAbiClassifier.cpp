@@ -0,0 +1,306 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <algorithm>
+#include <llvm/Support/Casting.h>
+#include <ast/types/BoolType.hpp>
+#include <ast/types/BuiltInType.hpp>
+#include <ast/types/FlatArrayType.hpp>
+#include <ast/types/FunctionPointerType.hpp>
+#include <ast/types/PointerType.hpp>
+#include <ast/types/ReferenceType.hpp>
+#include <ast/types/StructType.hpp>
+#include <ast/types/TraitType.hpp>
+#include <ast/types/VTableType.hpp>
+#include <ast/exprs/ValueLiteralExpr.hpp>
+#include "SysVAbiClassifier.hpp"
+
+gulc::FunctionAbiInfo gulc::SysVAbiClassifier::classifyFunction(gulc::Type const* returnType, bool hasSelfParameter,
+                                                               std::vector<ParameterDecl*> const& parameters) const {
+    FunctionAbiInfo result;
+    // `rdi`, `rsi`, `rdx`, `rcx`, `r8`, `r9`
+    std::size_t freeIntegerRegisters = 6;
+    // `xmm0` - `xmm7`
+    std::size_t freeSSERegisters = 8;
+
+    if (returnType != nullptr && isAggregate(returnType)) {
+        result.returnInfo = classifyAggregate(returnType);
+
+        // The hidden `sret` pointer is passed in `rdi`
+        if (result.returnInfo.kind == AbiArgInfo::Kind::Indirect) {
+            freeIntegerRegisters -= 1;
+        }
+    }
+
+    if (hasSelfParameter) {
+        freeIntegerRegisters -= 1;
+    }
+
+    result.parameterInfos.reserve(parameters.size());
+
+    for (ParameterDecl const* parameter : parameters) {
+        // `in` and `out` parameters are always passed as pointers
+        if (parameter->parameterKind() != ParameterDecl::ParameterKind::Val || !isAggregate(parameter->type)) {
+            bool usesSSE = false;
+
+            if (parameter->parameterKind() == ParameterDecl::ParameterKind::Val &&
+                    llvm::isa<BuiltInType>(parameter->type)) {
+                usesSSE = llvm::dyn_cast<BuiltInType>(parameter->type)->isFloating();
+            }
+
+            if (usesSSE) {
+                if (freeSSERegisters > 0) freeSSERegisters -= 1;
+            } else if (parameter->parameterKind() == ParameterDecl::ParameterKind::Val &&
+                    llvm::isa<TraitType>(parameter->type)) {
+                // Trait objects are passed as their two pointers, `self` and the witness table
+                freeIntegerRegisters -= std::min<std::size_t>(freeIntegerRegisters, 2);
+            } else {
+                if (freeIntegerRegisters > 0) freeIntegerRegisters -= 1;
+            }
+
+            result.parameterInfos.emplace_back(AbiArgInfo::Kind::Direct);
+            continue;
+        }
+
+        AbiArgInfo parameterInfo = classifyAggregate(parameter->type);
+
+        if (parameterInfo.kind == AbiArgInfo::Kind::Coerce) {
+            std::size_t neededIntegerRegisters = 0;
+            std::size_t neededSSERegisters = 0;
+
+            for (AbiEightbyte const* eightbyte : { &parameterInfo.lo, &parameterInfo.hi }) {
+                if (eightbyte->abiClass == AbiClass::Integer) {
+                    ++neededIntegerRegisters;
+                } else if (eightbyte->abiClass == AbiClass::SSE) {
+                    ++neededSSERegisters;
+                }
+            }
+
+            // If the whole aggregate doesn't fit in the remaining registers it is passed on the stack instead. We
+            // NEVER split an aggregate between registers and the stack.
+            if (neededIntegerRegisters > freeIntegerRegisters || neededSSERegisters > freeSSERegisters) {
+                parameterInfo = AbiArgInfo(AbiArgInfo::Kind::Indirect);
+            } else {
+                freeIntegerRegisters -= neededIntegerRegisters;
+                freeSSERegisters -= neededSSERegisters;
+            }
+        }
+
+        result.parameterInfos.push_back(parameterInfo);
+    }
+
+    return result;
+}
+
+gulc::AbiArgInfo gulc::SysVAbiClassifier::classifyAggregate(gulc::Type const* type) const {
+    std::vector<ScalarField> fields;
+    std::size_t size = 0;
+
+    // If we can't flatten the type (unaligned members, unsupported types, etc.) it has to be passed in memory
+    if (!flattenType(type, 0, fields, &size)) {
+        return AbiArgInfo(AbiArgInfo::Kind::Indirect);
+    }
+
+    if (size == 0) {
+        return AbiArgInfo(AbiArgInfo::Kind::Ignore);
+    }
+
+    // Anything larger than two eightbytes is always passed in memory
+    if (size > 16) {
+        return AbiArgInfo(AbiArgInfo::Kind::Indirect);
+    }
+
+    AbiArgInfo result(AbiArgInfo::Kind::Coerce);
+    result.lo = classifyEightbyte(fields, 0, size);
+
+    if (size > 8) {
+        result.hi = classifyEightbyte(fields, 8, size);
+    }
+
+    // An eightbyte that is entirely padding still has to be passed for the value to be reconstructed, we pass it as
+    // an integer (this matches how the padding would be copied as part of the struct)
+    if (result.lo.abiClass == AbiClass::NoClass) {
+        result.lo.abiClass = AbiClass::Integer;
+    }
+
+    if (size > 8 && result.hi.abiClass == AbiClass::NoClass) {
+        result.hi.abiClass = AbiClass::Integer;
+    }
+
+    return result;
+}
+
+bool gulc::SysVAbiClassifier::isAggregate(gulc::Type const* type) {
+    return llvm::isa<StructType>(type);
+}
+
+bool gulc::SysVAbiClassifier::flattenType(gulc::Type const* type, std::size_t baseOffset,
+                                          std::vector<ScalarField>& outFields, std::size_t* outSize) const {
+    if (llvm::isa<BuiltInType>(type)) {
+        auto builtInType = llvm::dyn_cast<BuiltInType>(type);
+        std::size_t size = builtInType->sizeInBytes();
+
+        if (size == 0) {
+            *outSize = 0;
+            return true;
+        }
+
+        // Unaligned scalars force the entire aggregate into memory
+        if (baseOffset % size != 0) {
+            return false;
+        }
+
+        outFields.emplace_back(baseOffset, size, builtInType->isFloating());
+        *outSize = size;
+        return true;
+    } else if (llvm::isa<BoolType>(type)) {
+        outFields.emplace_back(baseOffset, 1, false);
+        *outSize = 1;
+        return true;
+    } else if (llvm::isa<PointerType>(type) || llvm::isa<ReferenceType>(type) || llvm::isa<VTableType>(type) ||
+               llvm::isa<FunctionPointerType>(type)) {
+        if (baseOffset % _target.sizeofPtr() != 0) {
+            return false;
+        }
+
+        outFields.emplace_back(baseOffset, _target.sizeofPtr(), false);
+        *outSize = _target.sizeofPtr();
+        return true;
+    } else if (llvm::isa<TraitType>(type)) {
+        // Trait objects are a `self` pointer followed by a witness table pointer
+        if (baseOffset % _target.sizeofPtr() != 0) {
+            return false;
+        }
+
+        outFields.emplace_back(baseOffset, _target.sizeofPtr(), false);
+        outFields.emplace_back(baseOffset + _target.sizeofPtr(), _target.sizeofPtr(), false);
+        *outSize = _target.sizeofPtr() * 2;
+        return true;
+    } else if (llvm::isa<FlatArrayType>(type)) {
+        auto flatArrayType = llvm::dyn_cast<FlatArrayType>(type);
+
+        if (!llvm::isa<ValueLiteralExpr>(flatArrayType->length)) {
+            return false;
+        }
+
+        std::size_t length = std::stoull(llvm::dyn_cast<ValueLiteralExpr>(flatArrayType->length)->value());
+        std::size_t offset = baseOffset;
+
+        for (std::size_t i = 0; i < length; ++i) {
+            std::size_t elementSize = 0;
+
+            if (!flattenType(flatArrayType->indexType, offset, outFields, &elementSize)) {
+                return false;
+            }
+
+            offset += elementSize;
+        }
+
+        *outSize = offset - baseOffset;
+        return true;
+    } else if (llvm::isa<StructType>(type)) {
+        auto structDecl = llvm::dyn_cast<StructType>(type)->decl();
+
+        if (!structDecl->isInstantiated) {
+            return false;
+        }
+
+        std::size_t offset = baseOffset;
+
+        // The base struct is laid out unpadded as the first member of the struct
+        if (structDecl->baseStruct != nullptr) {
+            StructType baseStructType(Type::Qualifier::Unassigned, structDecl->baseStruct, {}, {});
+            std::size_t baseStructSize = 0;
+
+            if (!flattenType(&baseStructType, offset, outFields, &baseStructSize)) {
+                return false;
+            }
+
+            offset = baseOffset + structDecl->baseStruct->dataSizeWithoutPadding;
+        }
+
+        for (VariableDecl const* dataMember : structDecl->memoryLayout) {
+            std::size_t memberSize = 0;
+
+            // Padding members don't hold any data, they only move the offset
+            if (std::find(structDecl->ownedPaddingMembers.begin(), structDecl->ownedPaddingMembers.end(),
+                          dataMember) != structDecl->ownedPaddingMembers.end()) {
+                std::vector<ScalarField> ignoredFields;
+
+                if (!flattenType(dataMember->type, offset, ignoredFields, &memberSize)) {
+                    return false;
+                }
+            } else if (!flattenType(dataMember->type, offset, outFields, &memberSize)) {
+                return false;
+            }
+
+            offset += memberSize;
+        }
+
+        std::size_t size = offset - baseOffset;
+        std::size_t structAlign = structDecl->dataAlignment;
+
+        // NOTE: This matches the padding added to the end of the struct in `CodeGen::generateLlvmStructType`
+        if (structAlign != 0 && size % structAlign != 0) {
+            size += structAlign - (size % structAlign);
+        }
+
+        *outSize = size;
+        return true;
+    }
+
+    // Enums, etc. are not supported yet
+    return false;
+}
+
+gulc::AbiEightbyte gulc::SysVAbiClassifier::classifyEightbyte(std::vector<ScalarField> const& fields,
+                                                             std::size_t eightbyteOffset,
+                                                             std::size_t totalSize) const {
+    AbiEightbyte result;
+    result.size = std::min<std::size_t>(8, totalSize - eightbyteOffset);
+
+    bool hasInteger = false;
+    bool hasFloat = false;
+
+    for (ScalarField const& field : fields) {
+        if (field.offset < eightbyteOffset || field.offset >= eightbyteOffset + 8) {
+            continue;
+        }
+
+        if (field.isFloating) {
+            // Mixed sizes (only possible with `f16` and `f32`) are passed as a vector of the smallest element, the
+            // register holds the same bits either way
+            if (!hasFloat || field.size < result.floatSize) {
+                result.floatSize = field.size;
+            }
+
+            hasFloat = true;
+            result.floatCount += 1;
+        } else {
+            hasInteger = true;
+        }
+    }
+
+    if (hasInteger) {
+        result.abiClass = AbiClass::Integer;
+    } else if (hasFloat) {
+        // An eightbyte made up of only floats is `SSE` regardless of the float sizes within it
+        result.abiClass = AbiClass::SSE;
+    }
+
+    return result;
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_SYSVABICLASSIFIER_HPP
+#define GULC_SYSVABICLASSIFIER_HPP
+
+#include <cstddef>
+#include <vector>
+#include <Target.hpp>
+#include <ast/Type.hpp>
+#include <ast/decls/ParameterDecl.hpp>
+
+namespace gulc {
+    /**
+     * The System V x86-64 register classes for a single eightbyte. We only need the subset that Ghoul types can
+     * produce (no `X87`, `SSEUP`, etc. until we support `f80` and vector types)
+     */
+    enum class AbiClass {
+        NoClass,
+        Integer,
+        SSE,
+        Memory
+    };
+
+    struct AbiEightbyte {
+        AbiClass abiClass;
+        // The number of bytes within the eightbyte actually covered by fields (1-8)
+        std::size_t size;
+        // For `SSE` eightbytes this is the size of the float elements (2, 4 or 8, the smallest when they are mixed)
+        // and how many there are
+        std::size_t floatSize;
+        std::size_t floatCount;
+
+        AbiEightbyte()
+                : abiClass(AbiClass::NoClass), size(0), floatSize(0), floatCount(0) {}
+
+    };
+
+    /**
+     * Describes how a single value (parameter or return value) is lowered when crossing a function boundary
+     */
+    struct AbiArgInfo {
+        enum class Kind {
+            // Passed as-is; scalars, pointers, references, `in` and `out` parameters
+            Direct,
+            // An aggregate passed in one or two registers, one LLVM argument per eightbyte
+            Coerce,
+            // An aggregate passed in memory; `byval` for parameters and `sret` for return values
+            Indirect,
+            // Zero sized, nothing is passed at all
+            Ignore
+        };
+
+        Kind kind;
+        AbiEightbyte lo;
+        AbiEightbyte hi;
+
+        explicit AbiArgInfo(Kind kind)
+                : kind(kind), lo(), hi() {}
+
+        bool hasHi() const { return hi.abiClass != AbiClass::NoClass; }
+
+    };
+
+    struct FunctionAbiInfo {
+        AbiArgInfo returnInfo;
+        // One entry per Ghoul parameter (NOT including `sret` or `self`)
+        std::vector<AbiArgInfo> parameterInfos;
+
+        FunctionAbiInfo()
+                : returnInfo(AbiArgInfo::Kind::Direct) {}
+
+    };
+
+    /**
+     * Implements the System V x86-64 classification algorithm for Ghoul types. This only decides how each value is
+     * passed, generating the matching LLVM types is left to `CodeGen`.
+     *
+     * NOTE: This is used for both Ghoul functions and `extern` functions so that small structs such as `vec3` or a
+     *       `(ptr, len)` pair are passed in registers the same way C passes them.
+     */
+    class SysVAbiClassifier {
+    public:
+        explicit SysVAbiClassifier(Target const& target)
+                : _target(target) {}
+
+        /// Classify a full function signature, keeping track of the available registers the same way Clang does so
+        /// that an aggregate is never split between registers and the stack
+        FunctionAbiInfo classifyFunction(Type const* returnType, bool hasSelfParameter,
+                                         std::vector<ParameterDecl*> const& parameters) const;
+        /// Classify a single aggregate without accounting for register pressure
+        AbiArgInfo classifyAggregate(Type const* type) const;
+
+        /// Returns true if values of `type` are passed using the aggregate rules (i.e. structs passed by value)
+        static bool isAggregate(Type const* type);
+
+    protected:
+        Target const& _target;
+
+        struct ScalarField {
+            std::size_t offset;
+            std::size_t size;
+            bool isFloating;
+
+            ScalarField(std::size_t offset, std::size_t size, bool isFloating)
+                    : offset(offset), size(size), isFloating(isFloating) {}
+
+        };
+
+        bool flattenType(Type const* type, std::size_t baseOffset, std::vector<ScalarField>& outFields,
+                         std::size_t* outSize) const;
+        AbiEightbyte classifyEightbyte(std::vector<ScalarField> const& fields, std::size_t eightbyteOffset,
+                                       std::size_t totalSize) const;
+
+    };
+}
+
+#endif //GULC_SYSVABICLASSIFIER_HPP
@@ -16,19 +16,201 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 #include "Linker.hpp"
+#include <iostream>
+#include <llvm/ADT/Optional.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Program.h>
 
-void gulc::Linker::link(std::vector<ObjFile>& objFiles) {
-    // Create the entry object...
-    std::string asmArgs = "as examples/entry.x64.s -o build/objs/examples/entry.o";
-    std::system(asmArgs.c_str());
+#ifdef __GNUC__
+#include <experimental/filesystem>
+namespace std_fs = std::experimental::filesystem;
+#else
+#include <filesystem>
+namespace std_fs = std::filesystem;
+#endif
 
-    std::string objFilesPath;
+void gulc::Linker::link(std::vector<ObjFile>& objFiles, CompilerOptions const& options) {
+    bool profileGenerate = options.profileMode == CompilerOptions::ProfileMode::Generate;
+
+    // NOTE: Instrumented builds use a different entry stub that writes the profile after `main` returns
+    std::string entryObjPath = profileGenerate ?
+            getEntryObject("examples/entry.profile.x64.s", "build/objs/examples/entry.profile.o") :
+            getEntryObject("examples/entry.x64.s", "build/objs/examples/entry.o");
+
+    // `ld.lld` is preferred as it is faster and supports `--icf`, `ld.gold` also supports `--icf`, `ld` is last
+    std::string linkerPath = findProgram({ "ld.lld", "ld.gold", "ld" });
+
+    if (linkerPath.empty()) {
+        std::cerr << "gulc linker error: no linker found! (looked for `ld.lld`, `ld.gold`, and `ld`)" << std::endl;
+        std::exit(1);
+    }
+
+    std::vector<std::string> linkerArgs = {
+        linkerPath,
+        "-o", options.outputPath,
+    };
+
+    if (options.gcSections) {
+        linkerArgs.emplace_back("--gc-sections");
+    }
+
+    if (options.icf) {
+        std::string linkerName = std_fs::path(linkerPath).filename().string();
+
+        if (linkerName == "ld.lld" || linkerName == "ld.gold") {
+            linkerArgs.emplace_back("--icf=all");
+        } else {
+            std::cerr << "gulc linker warning: `--icf` requires `ld.lld` or `ld.gold`, identical code folding skipped"
+                      << std::endl;
+        }
+    }
+
+    for (std::string const& librarySearchPath : options.librarySearchPaths) {
+        linkerArgs.push_back("-L" + librarySearchPath);
+    }
+
+    linkerArgs.push_back(entryObjPath);
 
     for (ObjFile& objFile : objFiles) {
-        objFilesPath += " " + objFile.filePath;
+        linkerArgs.push_back(objFile.filePath);
+    }
+
+    // NOTE: Archives and libraries have to come after the objects that reference them
+    bool needsDynamicLinker = !options.libraries.empty();
+
+    for (std::string const& linkerInput : options.linkerInputs) {
+        linkerArgs.push_back(linkerInput);
+
+        if (std_fs::path(linkerInput).extension() == ".so") {
+            needsDynamicLinker = true;
+        }
+    }
+
+    if (profileGenerate) {
+        // The profile runtime writes the file through `libc` so we have to link against it as well
+        linkerArgs.push_back(findProfileRuntime());
+        linkerArgs.emplace_back("-lc");
+        needsDynamicLinker = true;
+    }
+
+    for (std::string const& library : options.libraries) {
+        linkerArgs.push_back("-l" + library);
+    }
+
+    if (needsDynamicLinker) {
+        linkerArgs.emplace_back("-dynamic-linker");
+        linkerArgs.emplace_back("/lib64/ld-linux-x86-64.so.2");
+    }
+
+    if (execute(linkerPath, linkerArgs) != 0) {
+        std::cerr << "gulc linker error: linking `" << options.outputPath << "` failed!" << std::endl;
+        std::exit(1);
+    }
+}
+
+int gulc::Linker::execute(std::string const& program, std::vector<std::string> const& args,
+                          std::string const* stdoutPath) {
+    std::vector<llvm::StringRef> argRefs;
+    argRefs.reserve(args.size());
+
+    for (std::string const& arg : args) {
+        argRefs.emplace_back(arg);
+    }
+
+    std::vector<llvm::Optional<llvm::StringRef>> redirects;
+
+    if (stdoutPath != nullptr) {
+        // stdin, stdout, stderr
+        redirects = { llvm::None, llvm::StringRef(*stdoutPath), llvm::None };
+    }
+
+    std::string errorMessage;
+    bool executionFailed = false;
+    int result = llvm::sys::ExecuteAndWait(program, argRefs, llvm::None, redirects, 0, 0,
+                                           &errorMessage, &executionFailed);
+
+    if (executionFailed) {
+        std::cerr << "gulc linker error: failed to run `" << program << "`: " << errorMessage << std::endl;
+        std::exit(1);
+    }
+
+    return result;
+}
+
+std::string gulc::Linker::findProgram(std::vector<std::string> const& programNames) {
+    for (std::string const& programName : programNames) {
+        llvm::ErrorOr<std::string> programPath = llvm::sys::findProgramByName(programName);
+
+        if (programPath) {
+            return *programPath;
+        }
+    }
+
+    return "";
+}
+
+std::string gulc::Linker::getEntryObject(std::string const& entryAsmPath, std::string const& entryObjPath) {
+    // The entry stub almost never changes, there is no reason to spawn `as` for it on every build
+    if (std_fs::exists(entryObjPath) &&
+        std_fs::last_write_time(entryObjPath) >= std_fs::last_write_time(entryAsmPath)) {
+        return entryObjPath;
+    }
+
+    std_fs::create_directories(std_fs::path(entryObjPath).parent_path());
+
+    std::string assemblerPath = findProgram({ "as" });
+
+    if (assemblerPath.empty()) {
+        std::cerr << "gulc linker error: `as` is required to assemble `" << entryAsmPath << "`!" << std::endl;
+        std::exit(1);
+    }
+
+    if (execute(assemblerPath, { assemblerPath, entryAsmPath, "-o", entryObjPath }) != 0) {
+        std::cerr << "gulc linker error: failed to assemble `" << entryAsmPath << "`!" << std::endl;
+        std::exit(1);
+    }
+
+    return entryObjPath;
+}
+
+std::string gulc::Linker::findProfileRuntime() {
+    std::string clangPath = findProgram({ "clang" });
+
+    if (clangPath.empty()) {
+        std::cerr << "gulc linker error: `--profile-generate` requires `clang` to locate the profile runtime!"
+                  << std::endl;
+        std::exit(1);
+    }
+
+    llvm::SmallString<128> outputPath;
+
+    if (llvm::sys::fs::createTemporaryFile("gulc-profile-runtime", "txt", outputPath)) {
+        std::cerr << "gulc linker error: failed to create a temporary file!" << std::endl;
+        std::exit(1);
+    }
+
+    std::string outputPathString = outputPath.str().str();
+    execute(clangPath, { clangPath, "--print-file-name=libclang_rt.profile-x86_64.a" }, &outputPathString);
+
+    std::string result;
+
+    {
+        auto outputBuffer = llvm::MemoryBuffer::getFile(outputPathString);
+
+        if (outputBuffer) {
+            result = (*outputBuffer)->getBuffer().trim().str();
+        }
+    }
+
+    llvm::sys::fs::remove(outputPathString);
+
+    // `clang` echoes the name back when it can't find the file
+    if (result.empty() || result == "libclang_rt.profile-x86_64.a") {
+        std::cerr << "gulc linker error: could not find `libclang_rt.profile-x86_64.a`, `--profile-generate` requires "
+                     "the compiler-rt profile runtime!" << std::endl;
+        std::exit(1);
     }
 
-    // Link everything together...
-    std::string linkerArgs = "ld build/objs/examples/entry.o " + objFilesPath + " -o a.out";
-    std::system(linkerArgs.c_str());
+    return result;
 }
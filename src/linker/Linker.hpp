@@ -20,11 +20,24 @@
 
 #include <vector>
 #include <objgen/ObjFile.hpp>
+#include <CompilerOptions.hpp>
+#include <string>
 
 namespace gulc {
     class Linker {
     public:
-        static void link(std::vector<ObjFile>& objFiles);
+        static void link(std::vector<ObjFile>& objFiles, CompilerOptions const& options);
+
+    protected:
+        // Runs `program` with `args` directly (no shell), returns the exit code
+        static int execute(std::string const& program, std::vector<std::string> const& args,
+                           std::string const* stdoutPath = nullptr);
+        // Finds the first of `programNames` within `PATH`, returns an empty string if none exist
+        static std::string findProgram(std::vector<std::string> const& programNames);
+        // Assembles the entry stub only if the object is missing or older than the stub
+        static std::string getEntryObject(std::string const& entryAsmPath, std::string const& entryObjPath);
+        // Asks `clang` where its `compiler-rt` profile runtime is, the runtime is required by `--profile-generate`
+        static std::string findProfileRuntime();
 
     };
 }
@@ -16,6 +16,7 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 #include <parsing/Parser.hpp>
+#include <ast/ASTVisitor.hpp>
 #include <passes/BasicTypeResolver.hpp>
 #include <passes/DeclInstantiator.hpp>
 #include <passes/NamespacePrototyper.hpp>
@@ -25,9 +26,16 @@
 #include <namemangling/ItaniumMangler.hpp>
 #include <codegen/CodeGen.hpp>
 #include <passes/CodeTransformer.hpp>
+#include <passes/DeadDeclEliminator.hpp>
+#include <passes/EscapeAnalyzer.hpp>
 #include <objgen/ObjGen.hpp>
 #include <linker/Linker.hpp>
+#include <utilities/StructLayoutUtil.hpp>
+#include <modules/ModuleInterfaceLoader.hpp>
+#include <modules/ModuleInterfaceWriter.hpp>
 #include "Target.hpp"
+#include "CompilerOptions.hpp"
+#include <iostream>
 
 using namespace gulc;
 
@@ -241,20 +249,120 @@ using namespace gulc;
 //       making will be a `FlatArray`, `StaticArray` makes much more sense imo..
 
 
-int main() {
+bool hasExtension(std::string const& filePath, std::string const& extension) {
+    return filePath.size() > extension.size() &&
+           filePath.compare(filePath.size() - extension.size(), extension.size(), extension) == 0;
+}
+
+CompilerOptions parseCommandLine(int argc, char** argv) {
+    CompilerOptions result;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+
+        if (argument == "--contracts=ignore") {
+            result.contractMode = CompilerOptions::ContractMode::Ignore;
+        } else if (argument == "--contracts=assume") {
+            result.contractMode = CompilerOptions::ContractMode::Assume;
+        } else if (argument == "--contracts=check") {
+            result.contractMode = CompilerOptions::ContractMode::Check;
+        } else if (argument == "--print-struct-layouts") {
+            result.printStructLayouts = true;
+        } else if (argument == "--profile-generate" || argument.compare(0, 19, "--profile-generate=") == 0) {
+            if (result.profileMode == CompilerOptions::ProfileMode::Use) {
+                std::cout << "gulc error: `--profile-generate` cannot be used with `--profile-use`!" << std::endl;
+                std::exit(1);
+            }
+
+            result.profileMode = CompilerOptions::ProfileMode::Generate;
+
+            if (argument.size() > 19) {
+                result.profilePath = argument.substr(19);
+            }
+        } else if (argument.compare(0, 14, "--profile-use=") == 0) {
+            if (result.profileMode == CompilerOptions::ProfileMode::Generate) {
+                std::cout << "gulc error: `--profile-use` cannot be used with `--profile-generate`!" << std::endl;
+                std::exit(1);
+            }
+
+            result.profileMode = CompilerOptions::ProfileMode::Use;
+            result.profilePath = argument.substr(14);
+
+            if (result.profilePath.empty()) {
+                std::cout << "gulc error: `--profile-use` requires a `.profdata` file!" << std::endl;
+                std::exit(1);
+            }
+        } else if (argument.compare(0, 24, "--emit-module-interface=") == 0) {
+            result.moduleInterfacePath = argument.substr(24);
+
+            if (result.moduleInterfacePath.empty()) {
+                std::cout << "gulc error: `--emit-module-interface` requires a `.gmi` file!" << std::endl;
+                std::exit(1);
+            }
+        } else if (argument.compare(0, 12, "--ast-cache=") == 0) {
+            result.astCacheDirectory = argument.substr(12);
+
+            if (result.astCacheDirectory.empty()) {
+                std::cout << "gulc error: `--ast-cache` requires a directory!" << std::endl;
+                std::exit(1);
+            }
+        } else if (argument == "--gc-sections") {
+            result.gcSections = true;
+        } else if (argument == "--icf") {
+            result.icf = true;
+        } else if (argument == "-o") {
+            if (i + 1 >= argc) {
+                std::cout << "gulc error: `-o` requires an output path!" << std::endl;
+                std::exit(1);
+            }
+
+            result.outputPath = argv[++i];
+        } else if (argument.size() > 2 && argument.compare(0, 2, "-L") == 0) {
+            result.librarySearchPaths.push_back(argument.substr(2));
+        } else if (argument.size() > 2 && argument.compare(0, 2, "-l") == 0) {
+            result.libraries.push_back(argument.substr(2));
+        } else if (argument.size() > 2 && argument[0] == '-' && argument[1] == '-') {
+            std::cout << "gulc error: unknown option `" << argument << "`!" << std::endl;
+            std::exit(1);
+        } else if (hasExtension(argument, ".gmi")) {
+            result.moduleInterfaces.push_back(argument);
+        } else if (hasExtension(argument, ".o") || hasExtension(argument, ".a") || hasExtension(argument, ".so")) {
+            result.linkerInputs.push_back(argument);
+        } else {
+            result.filePaths.push_back(argument);
+        }
+    }
+
+    // TODO: Remove this once we're no longer testing everything against the single test file
+    if (result.filePaths.empty()) {
+        result.filePaths.emplace_back("examples/TestFile.ghoul");
+//        result.filePaths.emplace_back("examples/TemplateWhereContractTest.ghoul");
+    }
+
+    return result;
+}
+
+int main(int argc, char** argv) {
     Target target = Target::getHostTarget();
+    CompilerOptions options = parseCommandLine(argc, argv);
 
-    std::vector<std::string> filePaths {
-            "examples/TestFile.ghoul"
-//            "examples/TemplateWhereContractTest.ghoul"
-    };
+    std::vector<std::string> filePaths = options.filePaths;
     std::vector<ASTFile> parsedFiles;
 
     for (std::size_t i = 0; i < filePaths.size(); ++i) {
-        Parser parser;
+        Parser parser(options.astCacheDirectory);
         parsedFiles.push_back(parser.parseFile(i, filePaths[i]));
     }
 
+    // Declarations loaded from module interfaces are appended after our own files. They are only prototypes (or
+    // templates) used to resolve references, code is only generated for the first `sourceFileCount` files
+    std::size_t sourceFileCount = parsedFiles.size();
+
+    for (std::string const& moduleInterface : options.moduleInterfaces) {
+        ModuleInterfaceLoader moduleInterfaceLoader(moduleInterface);
+        moduleInterfaceLoader.loadImportedDecls(parsedFiles, filePaths);
+    }
+
     // Generate namespace map
     NamespacePrototyper namespacePrototyper;
     std::vector<NamespaceDecl*> prototypes = namespacePrototyper.generatePrototypes(parsedFiles);
@@ -264,16 +372,23 @@ int main() {
     //       I would go ahead and do it but I'm not sure if the overhead is worth it, I think it would be better
     //       to wait until we're doing more processing of the `Stmt`s...
     BasicDeclValidator basicDeclValidator(filePaths, prototypes);
-    basicDeclValidator.processFiles(parsedFiles);
 
     // Resolve all types as much as possible, leaving `TemplatedType`s for any templates
     BasicTypeResolver basicTypeResolver(filePaths, prototypes);
-    basicTypeResolver.processFiles(parsedFiles);
+
+    // Both run in a single walk of the AST, every `Decl` is validated right before its types are resolved
+    FusedASTVisitor<BasicDeclValidator, BasicTypeResolver>(basicDeclValidator, basicTypeResolver)
+            .traverseFiles(parsedFiles);
 
     // Instantiate Decl instances as much as possible (set `StructDecl` data layouts, instantiate `TemplatedType`, etc.)
     DeclInstantiator declInstantiator(target, filePaths);
     declInstantiator.processFiles(parsedFiles);
 
+    if (!options.moduleInterfacePath.empty()) {
+        ModuleInterfaceWriter moduleInterfaceWriter(options.filePaths);
+        moduleInterfaceWriter.writeFiles(parsedFiles, options.moduleInterfacePath);
+    }
+
     // TODO: We need to actually implement `DeclInstValidator`
     //        * Check to make sure all `Self` type references are removed and are valid
     //        *
@@ -282,6 +397,11 @@ int main() {
     CodeProcessor codeProcessor(target, filePaths, prototypes);
     codeProcessor.processFiles(parsedFiles);
 
+    // All template structs have been instantiated by this point so every struct has its final layout
+    if (options.printStructLayouts) {
+        StructLayoutUtil::printStructLayouts(target, parsedFiles, filePaths, std::cout);
+    }
+
     // Mangle decl names for code generation
     auto manglerBackend = ItaniumMangler();
     NameMangler nameMangler(&manglerBackend);
@@ -291,22 +411,30 @@ int main() {
     CodeTransformer codeTransformer(target, filePaths, prototypes);
     codeTransformer.processFiles(parsedFiles);
 
+    // Move `@new` allocations that never leave their function to the stack
+    EscapeAnalyzer escapeAnalyzer;
+    escapeAnalyzer.processFiles(parsedFiles);
+
+    // Remove anything that can't be reached from `main`, `extern` or the exported API before it reaches LLVM
+    DeadDeclEliminator deadDeclEliminator(filePaths, !options.moduleInterfacePath.empty());
+    deadDeclEliminator.processFiles(parsedFiles);
+
     std::vector<ObjFile> objFiles;
-    objFiles.reserve(parsedFiles.size());
+    objFiles.reserve(sourceFileCount);
 
     ObjGen::init();
-    ObjGen objGen = ObjGen();
+    ObjGen objGen = ObjGen(options);
 
-    for (auto parsedFile : parsedFiles) {
+    for (std::size_t i = 0; i < sourceFileCount; ++i) {
         // Generate LLVM IR
-        CodeGen codeGen(target, filePaths);
-        gulc::Module module = codeGen.generate(&parsedFile);
+        CodeGen codeGen(target, options, filePaths);
+        gulc::Module module = codeGen.generate(&parsedFiles[i]);
 
         // Generate the object files
         objFiles.push_back(objGen.generate(module));
     }
 
-    gulc::Linker::link(objFiles);
+    gulc::Linker::link(objFiles, options);
 
 
     return 0;
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_MODULEINTERFACE_HPP
+#define GULC_MODULEINTERFACE_HPP
+
+#include <cstdint>
+
+namespace gulc {
+    /**
+     * The on-disk layout of a module interface (`.gmi`) written by `ModuleInterfaceWriter` and read by
+     * `ModuleInterfaceLoader`. Everything is stored in the host's byte order, the file is memory mapped and read in place.
+     *
+     *     Header
+     *     NamespaceEntry[namespaceCount]   - sorted by `path` so the namespaces an `import` needs are found by search
+     *     FileEntry[fileCount]             - one per source file of the module
+     *     DeclEntry[declCount]             - grouped by namespace
+     *     string data                      - `uint32_t` length followed by the bytes of the string
+     *
+     * All string "pointers" are offsets from the start of the file. The global namespace uses an empty `path`.
+     */
+    namespace ModuleInterface {
+        constexpr char magic[4] = { 'G', 'M', 'I', '\0' };
+        // Increment whenever the layout below or the way declarations are stored changes
+        constexpr std::uint32_t version = 2;
+
+        struct Header {
+            char magic[4];
+            std::uint32_t version;
+            std::uint32_t namespaceCount;
+            std::uint32_t fileCount;
+            std::uint32_t declCount;
+        };
+
+        struct NamespaceEntry {
+            // Full path of the namespace (e.g. `std.io`)
+            std::uint32_t path;
+            std::uint32_t firstDecl;
+            std::uint32_t declCount;
+        };
+
+        struct FileEntry {
+            std::uint32_t sourcePath;
+            // The `import` declarations of the source file, the declarations from the file are written relative to
+            // them so they have to be imported again when the declarations are loaded
+            std::uint32_t imports;
+            // The same imports as `imports` as a `\n` separated list of namespace paths
+            std::uint32_t importPaths;
+        };
+
+        struct DeclEntry {
+            // Index into the `FileEntry` table of the file the declaration came from
+            std::uint32_t file;
+            // The source of the declaration with all function bodies removed (templates, `@inline` functions, and
+            // the `private` functions they call keep their bodies so the modules that import them can generate them).
+            // Global variables are stored as `extern` declarations.
+            std::uint32_t source;
+        };
+    }
+}
+
+#endif //GULC_MODULEINTERFACE_HPP
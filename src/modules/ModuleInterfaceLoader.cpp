@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <parsing/Parser.hpp>
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include "ModuleInterfaceLoader.hpp"
+
+gulc::ModuleInterfaceLoader::ModuleInterfaceLoader(std::string modulePath)
+        : _modulePath(std::move(modulePath)), _buffer(), _data(nullptr), _size(0), _header(nullptr),
+          _namespaceEntries(nullptr), _fileEntries(nullptr), _declEntries(nullptr) {
+    // NOTE: `RequiresNullTerminator` has to be false for `MemoryBuffer` to map the file instead of reading it
+    auto bufferOrError = llvm::MemoryBuffer::getFile(_modulePath, -1, false);
+
+    if (!bufferOrError) {
+        printError("module interface `" + _modulePath + "` could not be opened: " +
+                   bufferOrError.getError().message());
+    }
+
+    _buffer = std::move(bufferOrError.get());
+    _data = _buffer->getBufferStart();
+    _size = _buffer->getBufferSize();
+
+    if (_size < sizeof(ModuleInterface::Header)) {
+        printError("`" + _modulePath + "` is not a module interface!");
+    }
+
+    _header = reinterpret_cast<ModuleInterface::Header const*>(_data);
+
+    if (!std::equal(std::begin(ModuleInterface::magic), std::end(ModuleInterface::magic), _header->magic)) {
+        printError("`" + _modulePath + "` is not a module interface!");
+    }
+
+    if (_header->version != ModuleInterface::version) {
+        printError("module interface `" + _modulePath + "` was written by a different version of gulc, it has to be "
+                   "regenerated!");
+    }
+
+    std::size_t namespaceTableOffset = sizeof(ModuleInterface::Header);
+    std::size_t fileTableOffset = namespaceTableOffset +
+                                  _header->namespaceCount * sizeof(ModuleInterface::NamespaceEntry);
+    std::size_t declTableOffset = fileTableOffset + _header->fileCount * sizeof(ModuleInterface::FileEntry);
+
+    if (declTableOffset + _header->declCount * sizeof(ModuleInterface::DeclEntry) > _size) {
+        printError("module interface `" + _modulePath + "` is corrupt!");
+    }
+
+    _namespaceEntries = reinterpret_cast<ModuleInterface::NamespaceEntry const*>(_data + namespaceTableOffset);
+    _fileEntries = reinterpret_cast<ModuleInterface::FileEntry const*>(_data + fileTableOffset);
+    _declEntries = reinterpret_cast<ModuleInterface::DeclEntry const*>(_data + declTableOffset);
+
+    _loadedNamespaces.resize(_header->namespaceCount, false);
+    _importedFiles.resize(_header->fileCount, false);
+}
+
+void gulc::ModuleInterfaceLoader::loadImportedDecls(std::vector<ASTFile>& files, std::vector<std::string>& filePaths) {
+    // The global namespace doesn't need to be imported
+    requireNamespace("");
+
+    for (ASTFile const& file : files) {
+        for (Decl const* decl : file.declarations) {
+            requireImportedNamespaces(decl);
+        }
+    }
+
+    // The declarations are put back into the file they came from so they are resolved with that file's imports
+    std::vector<std::string> fileSources(_header->fileCount);
+
+    while (!_namespaceQueue.empty()) {
+        ModuleInterface::NamespaceEntry const& namespaceEntry = _namespaceEntries[_namespaceQueue.back()];
+        _namespaceQueue.pop_back();
+
+        if (namespaceEntry.firstDecl + namespaceEntry.declCount > _header->declCount) {
+            printError("module interface `" + _modulePath + "` is corrupt!");
+        }
+
+        std::string namespacePath = getString(namespaceEntry.path);
+        // NOTE: The declarations of a namespace from the same file are put in a single `namespace` block, a body can
+        //       only find the functions it calls unqualified within the block it is in
+        std::vector<std::string> namespaceSources(_header->fileCount);
+
+        for (std::uint32_t i = namespaceEntry.firstDecl; i < namespaceEntry.firstDecl + namespaceEntry.declCount; ++i) {
+            ModuleInterface::DeclEntry const& declEntry = _declEntries[i];
+
+            if (declEntry.file >= _header->fileCount) {
+                printError("module interface `" + _modulePath + "` is corrupt!");
+            }
+
+            // Loading a declaration requires the namespaces its file imports (they might be in this module)
+            requireFileImports(declEntry.file);
+
+            namespaceSources[declEntry.file] += getString(declEntry.source) + "\n";
+        }
+
+        for (std::uint32_t fileIndex = 0; fileIndex < _header->fileCount; ++fileIndex) {
+            if (namespaceSources[fileIndex].empty()) {
+                continue;
+            }
+
+            if (namespacePath.empty()) {
+                fileSources[fileIndex] += namespaceSources[fileIndex];
+            } else {
+                fileSources[fileIndex] += "namespace " + namespacePath + " {\n" + namespaceSources[fileIndex] + "}\n";
+            }
+        }
+    }
+
+    for (std::uint32_t i = 0; i < _header->fileCount; ++i) {
+        if (!_importedFiles[i]) {
+            continue;
+        }
+
+        ModuleInterface::FileEntry const& fileEntry = _fileEntries[i];
+        // Errors within the loaded declarations are reported as `module.gmi(source.ghoul)`
+        std::string sourcePath = _modulePath + "(" + getString(fileEntry.sourcePath) + ")";
+
+        Parser parser;
+        files.push_back(parser.parseSource(filePaths.size(), sourcePath,
+                                           getString(fileEntry.imports) + fileSources[i]));
+        filePaths.push_back(sourcePath);
+    }
+}
+
+void gulc::ModuleInterfaceLoader::printError(std::string const& message) const {
+    std::cout << "gulc error: " << message << std::endl;
+    std::exit(1);
+}
+
+std::string gulc::ModuleInterfaceLoader::getString(std::uint32_t offset) const {
+    std::uint32_t length;
+
+    if (static_cast<std::size_t>(offset) + sizeof(length) > _size) {
+        printError("module interface `" + _modulePath + "` is corrupt!");
+    }
+
+    std::memcpy(&length, _data + offset, sizeof(length));
+
+    if (static_cast<std::size_t>(offset) + sizeof(length) + length > _size) {
+        printError("module interface `" + _modulePath + "` is corrupt!");
+    }
+
+    return std::string(_data + offset + sizeof(length), length);
+}
+
+/**
+ * Queue the namespace `namespacePath` and all of the namespaces nested within it to be loaded
+ *
+ * The namespace table is sorted by path so every namespace starting with `namespacePath.` directly follows
+ * `namespacePath`.
+ */
+void gulc::ModuleInterfaceLoader::requireNamespace(std::string const& namespacePath) {
+    std::uint32_t namespaceCount = _header->namespaceCount;
+
+    // Find the first namespace that isn't less than `namespacePath`
+    std::uint32_t low = 0;
+    std::uint32_t high = namespaceCount;
+
+    while (low < high) {
+        std::uint32_t middle = low + (high - low) / 2;
+
+        if (getString(_namespaceEntries[middle].path) < namespacePath) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    std::string nestedPrefix = namespacePath + ".";
+
+    for (std::uint32_t i = low; i < namespaceCount; ++i) {
+        std::string checkPath = getString(_namespaceEntries[i].path);
+
+        if (checkPath != namespacePath &&
+                (namespacePath.empty() || checkPath.compare(0, nestedPrefix.size(), nestedPrefix) != 0)) {
+            break;
+        }
+
+        if (!_loadedNamespaces[i]) {
+            _loadedNamespaces[i] = true;
+            _namespaceQueue.push_back(i);
+        }
+    }
+}
+
+void gulc::ModuleInterfaceLoader::requireImportedNamespaces(gulc::Decl const* decl) {
+    if (auto importDecl = llvm::dyn_cast<ImportDecl>(decl)) {
+        std::string importPath;
+
+        for (Identifier const& pathIdentifier : importDecl->importPath()) {
+            if (!importPath.empty()) importPath += ".";
+
+            importPath += pathIdentifier.name();
+        }
+
+        requireNamespace(importPath);
+    } else if (auto namespaceDecl = llvm::dyn_cast<NamespaceDecl>(decl)) {
+        for (Decl const* nestedDecl : namespaceDecl->nestedDecls()) {
+            requireImportedNamespaces(nestedDecl);
+        }
+    }
+}
+
+void gulc::ModuleInterfaceLoader::requireFileImports(std::uint32_t fileIndex) {
+    if (_importedFiles[fileIndex]) {
+        return;
+    }
+
+    _importedFiles[fileIndex] = true;
+
+    std::string importPaths = getString(_fileEntries[fileIndex].importPaths);
+    std::size_t pathStart = 0;
+
+    for (std::size_t pathEnd = importPaths.find('\n'); pathEnd != std::string::npos;
+            pathEnd = importPaths.find('\n', pathStart)) {
+        requireNamespace(importPaths.substr(pathStart, pathEnd - pathStart));
+        pathStart = pathEnd + 1;
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_MODULEINTERFACELOADER_HPP
+#define GULC_MODULEINTERFACELOADER_HPP
+
+#include <parsing/ASTFile.hpp>
+#include <llvm/Support/MemoryBuffer.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "ModuleInterface.hpp"
+
+namespace gulc {
+    /**
+     * Loads the declarations of a module interface written by `ModuleInterfaceWriter`
+     *
+     * The file is memory mapped (through `llvm::MemoryBuffer`) and only the namespaces that are actually imported are parsed, the declarations of
+     * every other namespace are never read.
+     */
+    class ModuleInterfaceLoader {
+    public:
+        explicit ModuleInterfaceLoader(std::string modulePath);
+
+        /// Parses the declarations of every namespace imported by `files` (including the global namespace and the
+        /// namespaces the loaded declarations import themselves), appending them to `files` and `filePaths`
+        /// NOTE: The appended files only contain prototypes, code is never generated for them.
+        void loadImportedDecls(std::vector<ASTFile>& files, std::vector<std::string>& filePaths);
+
+    private:
+        std::string _modulePath;
+        std::unique_ptr<llvm::MemoryBuffer> _buffer;
+        char const* _data;
+        std::size_t _size;
+        ModuleInterface::Header const* _header;
+        ModuleInterface::NamespaceEntry const* _namespaceEntries;
+        ModuleInterface::FileEntry const* _fileEntries;
+        ModuleInterface::DeclEntry const* _declEntries;
+
+        std::vector<bool> _loadedNamespaces;
+        std::vector<bool> _importedFiles;
+        // Indexes into `_namespaceEntries` of the namespaces that still have to be loaded
+        std::vector<std::uint32_t> _namespaceQueue;
+
+        void printError(std::string const& message) const;
+
+        std::string getString(std::uint32_t offset) const;
+        void requireNamespace(std::string const& namespacePath);
+        void requireImportedNamespaces(Decl const* decl);
+        void requireFileImports(std::uint32_t fileIndex);
+
+    };
+}
+
+#endif //GULC_MODULEINTERFACELOADER_HPP
@@ -0,0 +1,669 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <ast/ASTVisitor.hpp>
+#include <ast/SourceManager.hpp>
+#include <ast/attrs/FunctionHintAttr.hpp>
+#include <ast/decls/ExtensionDecl.hpp>
+#include <ast/decls/PropertyDecl.hpp>
+#include <ast/decls/StructDecl.hpp>
+#include <ast/decls/SubscriptOperatorDecl.hpp>
+#include <ast/decls/TemplateFunctionDecl.hpp>
+#include <ast/decls/TemplateStructDecl.hpp>
+#include <ast/decls/TemplateTraitDecl.hpp>
+#include <ast/decls/TraitDecl.hpp>
+#include <ast/types/AliasType.hpp>
+#include <ast/types/EnumType.hpp>
+#include <ast/types/StructType.hpp>
+#include <ast/types/TraitType.hpp>
+#include <ast/types/UnresolvedType.hpp>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include "ModuleInterface.hpp"
+#include "ModuleInterfaceWriter.hpp"
+
+/**
+ * Collects every name an exported body could reference. The bodies haven't been processed yet so this is by name only,
+ * it can export a `private` declaration that isn't needed but never misses one that is.
+ */
+class gulc::ModuleInterfaceWriter::BodyReferenceCollector : public ASTVisitor<BodyReferenceCollector> {
+public:
+    explicit BodyReferenceCollector(std::set<std::string>& referencedNames)
+            : _referencedNames(referencedNames) {}
+
+    template<typename T>
+    void collectFunction(T* functionDecl) { traverseFunctionDecl(functionDecl); }
+
+private:
+    std::set<std::string>& _referencedNames;
+
+    friend class ASTVisitor<BodyReferenceCollector>;
+    using ASTVisitor<BodyReferenceCollector>::visit;
+
+    bool visit(IdentifierExpr* identifierExpr) {
+        _referencedNames.insert(identifierExpr->identifier().name());
+        return true;
+    }
+
+    bool visit(TypeExpr* typeExpr) {
+        if (auto aliasType = llvm::dyn_cast<AliasType>(typeExpr->type)) {
+            _referencedNames.insert(aliasType->decl()->identifier().name());
+        } else if (auto enumType = llvm::dyn_cast<EnumType>(typeExpr->type)) {
+            _referencedNames.insert(enumType->decl()->identifier().name());
+        } else if (auto structType = llvm::dyn_cast<StructType>(typeExpr->type)) {
+            _referencedNames.insert(structType->decl()->identifier().name());
+        } else if (auto traitType = llvm::dyn_cast<TraitType>(typeExpr->type)) {
+            _referencedNames.insert(traitType->decl()->identifier().name());
+        } else if (auto unresolvedType = llvm::dyn_cast<UnresolvedType>(typeExpr->type)) {
+            _referencedNames.insert(unresolvedType->identifier().name());
+        }
+
+        return true;
+    }
+
+};
+
+void gulc::ModuleInterfaceWriter::writeFiles(std::vector<ASTFile> const& files, std::string const& outputPath) {
+    collectReferencedNames(files);
+
+    for (ASTFile const& file : files) {
+        if (file.sourceFileID >= _filePaths.size()) {
+            continue;
+        }
+
+        std::string const& sourcePath = _filePaths[file.sourceFileID];
+        // The declarations are sliced out of the exact text they were parsed from, the file on disk could have changed
+        // since then
+        _currentSource = SourceManager::get().getSourceCode(sourcePath);
+
+        if (_currentSource == nullptr) {
+            printError("source file `" + sourcePath + "` was never parsed!");
+        }
+
+        _currentFileIndex = _fileImports.size();
+        _fileImports.push_back(FileImports { sourcePath, "", "" });
+
+        for (Decl const* decl : file.declarations) {
+            collectDecl(decl, "");
+        }
+    }
+
+    std::uint32_t declCount = 0;
+
+    for (auto const& namespaceDecls : _namespaceDecls) {
+        declCount += namespaceDecls.second.size();
+    }
+
+    ModuleInterface::Header header {};
+    std::copy(std::begin(ModuleInterface::magic), std::end(ModuleInterface::magic), header.magic);
+    header.version = ModuleInterface::version;
+    header.namespaceCount = _namespaceDecls.size();
+    header.fileCount = _fileImports.size();
+    header.declCount = declCount;
+
+    // The string data comes after all of the tables, we know their sizes up front so the offsets can be assigned
+    // as the strings are added
+    std::size_t stringDataOffset = sizeof(ModuleInterface::Header) +
+                                   header.namespaceCount * sizeof(ModuleInterface::NamespaceEntry) +
+                                   header.fileCount * sizeof(ModuleInterface::FileEntry) +
+                                   header.declCount * sizeof(ModuleInterface::DeclEntry);
+    std::string stringData;
+
+    auto addString = [&](std::string const& value) -> std::uint32_t {
+        std::size_t offset = stringDataOffset + stringData.size();
+
+        if (offset + sizeof(std::uint32_t) + value.size() > UINT32_MAX) {
+            printError("module interface `" + outputPath + "` is too large!");
+        }
+
+        auto length = static_cast<std::uint32_t>(value.size());
+        stringData.append(reinterpret_cast<char const*>(&length), sizeof(length));
+        stringData.append(value);
+
+        return static_cast<std::uint32_t>(offset);
+    };
+
+    std::vector<ModuleInterface::NamespaceEntry> namespaceEntries;
+    namespaceEntries.reserve(header.namespaceCount);
+    std::vector<ModuleInterface::FileEntry> fileEntries;
+    fileEntries.reserve(header.fileCount);
+    std::vector<ModuleInterface::DeclEntry> declEntries;
+    declEntries.reserve(header.declCount);
+
+    for (auto const& namespaceDecls : _namespaceDecls) {
+        namespaceEntries.push_back(ModuleInterface::NamespaceEntry {
+            addString(namespaceDecls.first),
+            static_cast<std::uint32_t>(declEntries.size()),
+            static_cast<std::uint32_t>(namespaceDecls.second.size())
+        });
+
+        for (DeclSource const& declSource : namespaceDecls.second) {
+            declEntries.push_back(ModuleInterface::DeclEntry { declSource.fileIndex, addString(declSource.source) });
+        }
+    }
+
+    for (FileImports const& fileImports : _fileImports) {
+        fileEntries.push_back(ModuleInterface::FileEntry {
+            addString(fileImports.sourcePath),
+            addString(fileImports.imports),
+            addString(fileImports.importPaths)
+        });
+    }
+
+    std::ofstream outputStream(outputPath, std::ios::binary | std::ios::trunc);
+
+    if (!outputStream.good()) {
+        printError("module interface `" + outputPath + "` could not be opened for writing!");
+    }
+
+    outputStream.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    outputStream.write(reinterpret_cast<char const*>(namespaceEntries.data()),
+                       namespaceEntries.size() * sizeof(ModuleInterface::NamespaceEntry));
+    outputStream.write(reinterpret_cast<char const*>(fileEntries.data()),
+                       fileEntries.size() * sizeof(ModuleInterface::FileEntry));
+    outputStream.write(reinterpret_cast<char const*>(declEntries.data()),
+                       declEntries.size() * sizeof(ModuleInterface::DeclEntry));
+    outputStream.write(stringData.data(), stringData.size());
+
+    if (!outputStream.good()) {
+        printError("failed to write module interface `" + outputPath + "`!");
+    }
+}
+
+void gulc::ModuleInterfaceWriter::printError(std::string const& message) const {
+    std::cout << "gulc error: " << message << std::endl;
+    std::exit(1);
+}
+
+void gulc::ModuleInterfaceWriter::collectReferencedNames(std::vector<ASTFile> const& files) {
+    BodyReferenceCollector collector(_referencedNames);
+    std::size_t lastNameCount;
+
+    // Exporting a `private` declaration can keep more bodies, we keep going until no new names are found
+    do {
+        lastNameCount = _referencedNames.size();
+
+        for (ASTFile const& file : files) {
+            if (file.sourceFileID >= _filePaths.size()) {
+                continue;
+            }
+
+            for (Decl* decl : file.declarations) {
+                collectKeptBodyReferences(decl, false, collector);
+            }
+        }
+    } while (_referencedNames.size() != lastNameCount);
+}
+
+void gulc::ModuleInterfaceWriter::collectKeptBodyReferences(gulc::Decl* decl, bool keepsAllBodies,
+                                                            BodyReferenceCollector& collector) {
+    if (decl->getDeclKind() == Decl::Kind::Namespace) {
+        for (Decl* nestedDecl : llvm::dyn_cast<NamespaceDecl>(decl)->nestedDecls()) {
+            collectKeptBodyReferences(nestedDecl, keepsAllBodies, collector);
+        }
+
+        return;
+    }
+
+    if (!isExportedDecl(decl)) {
+        return;
+    }
+
+    switch (decl->getDeclKind()) {
+        case Decl::Kind::CallOperator:
+        case Decl::Kind::Function:
+        case Decl::Kind::Operator:
+        case Decl::Kind::TypeSuffix: {
+            auto functionDecl = llvm::dyn_cast<FunctionDecl>(decl);
+
+            if (keepsAllBodies || keepsFunctionBody(functionDecl)) {
+                collector.collectFunction(functionDecl);
+            }
+
+            break;
+        }
+        case Decl::Kind::Extension: {
+            auto extensionDecl = llvm::dyn_cast<ExtensionDecl>(decl);
+
+            for (ConstructorDecl* constructor : extensionDecl->constructors()) {
+                if (keepsAllBodies || keepsFunctionBody(constructor)) collector.collectFunction(constructor);
+            }
+
+            for (Decl* member : extensionDecl->ownedMembers()) {
+                collectKeptBodyReferences(member, keepsAllBodies, collector);
+            }
+
+            break;
+        }
+        case Decl::Kind::Property: {
+            auto propertyDecl = llvm::dyn_cast<PropertyDecl>(decl);
+
+            for (PropertyGetDecl* getter : propertyDecl->getters()) {
+                if (keepsAllBodies || keepsFunctionBody(getter)) collector.collectFunction(getter);
+            }
+
+            if (propertyDecl->hasSetter() && (keepsAllBodies || keepsFunctionBody(propertyDecl->setter()))) {
+                collector.collectFunction(propertyDecl->setter());
+            }
+
+            break;
+        }
+        case Decl::Kind::Struct:
+        case Decl::Kind::TemplateStruct: {
+            // NOTE: `TemplateStructDecl` isn't included in `StructDecl::classof`
+            auto structDecl = static_cast<StructDecl*>(decl);
+            // Templates are instantiated by the importing module, every body they have is kept
+            keepsAllBodies = keepsAllBodies || decl->getDeclKind() == Decl::Kind::TemplateStruct;
+
+            for (ConstructorDecl* constructor : structDecl->constructors()) {
+                if (keepsAllBodies || keepsFunctionBody(constructor)) collector.collectFunction(constructor);
+            }
+
+            for (Decl* member : structDecl->ownedMembers()) {
+                collectKeptBodyReferences(member, keepsAllBodies, collector);
+            }
+
+            if (structDecl->destructor != nullptr &&
+                    (keepsAllBodies || keepsFunctionBody(structDecl->destructor))) {
+                collector.collectFunction(structDecl->destructor);
+            }
+
+            break;
+        }
+        case Decl::Kind::SubscriptOperator: {
+            auto subscriptOperatorDecl = llvm::dyn_cast<SubscriptOperatorDecl>(decl);
+
+            for (SubscriptOperatorGetDecl* getter : subscriptOperatorDecl->getters()) {
+                if (keepsAllBodies || keepsFunctionBody(getter)) collector.collectFunction(getter);
+            }
+
+            if (subscriptOperatorDecl->hasSetter() &&
+                    (keepsAllBodies || keepsFunctionBody(subscriptOperatorDecl->setter()))) {
+                collector.collectFunction(subscriptOperatorDecl->setter());
+            }
+
+            break;
+        }
+        case Decl::Kind::TemplateFunction:
+            collector.collectFunction(static_cast<TemplateFunctionDecl*>(decl));
+            break;
+        case Decl::Kind::TemplateTrait:
+        case Decl::Kind::Trait:
+            for (Decl* member : static_cast<TraitDecl*>(decl)->ownedMembers()) {
+                collectKeptBodyReferences(member, true, collector);
+            }
+
+            break;
+        case Decl::Kind::Variable: {
+            auto variableDecl = llvm::dyn_cast<VariableDecl>(decl);
+
+            // Other modules link against the variable, it has to be visible to the linker
+            if (variableDecl->visibility() == Decl::Visibility::Private) {
+                variableDecl->isReferencedByExport = true;
+            }
+
+            // `const` variables are exported with their value
+            if (variableDecl->isConstExpr() && variableDecl->hasInitialValue()) {
+                collector.traverseExpr(variableDecl->initialValue);
+            }
+
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void gulc::ModuleInterfaceWriter::collectDecl(gulc::Decl const* decl, std::string const& namespacePath) {
+    switch (decl->getDeclKind()) {
+        case Decl::Kind::Namespace: {
+            auto namespaceDecl = llvm::dyn_cast<NamespaceDecl>(decl);
+            std::string nestedPath = namespacePath.empty() ?
+                                     namespaceDecl->identifier().name() :
+                                     namespacePath + "." + namespaceDecl->identifier().name();
+
+            for (Decl const* nestedDecl : namespaceDecl->nestedDecls()) {
+                collectDecl(nestedDecl, nestedPath);
+            }
+
+            return;
+        }
+        case Decl::Kind::Import:
+            collectImport(llvm::dyn_cast<ImportDecl>(decl));
+            return;
+        case Decl::Kind::Enum:
+        case Decl::Kind::Extension:
+        case Decl::Kind::Function:
+        case Decl::Kind::Operator:
+        case Decl::Kind::Property:
+        case Decl::Kind::Struct:
+        case Decl::Kind::TemplateFunction:
+        case Decl::Kind::TemplateStruct:
+        case Decl::Kind::TemplateTrait:
+        case Decl::Kind::Trait:
+        case Decl::Kind::TypeAlias:
+        case Decl::Kind::Variable:
+            break;
+        default:
+            return;
+    }
+
+    if (!isExportedDecl(decl)) {
+        return;
+    }
+
+    // `main` is the entry point of this module, exporting it would give the importing module a second one
+    if (namespacePath.empty() && decl->getDeclKind() == Decl::Kind::Function && decl->identifier().name() == "main") {
+        return;
+    }
+
+    if (auto variableDecl = llvm::dyn_cast<VariableDecl>(decl)) {
+        // The type is needed for the `extern` declaration, variables with an inferred type can't be exported
+        if (variableDecl->type == nullptr) {
+            return;
+        }
+
+        _namespaceDecls[namespacePath].push_back(DeclSource { _currentFileIndex, getVariableDeclSource(variableDecl) });
+        return;
+    }
+
+    _namespaceDecls[namespacePath].push_back(DeclSource { _currentFileIndex, getDeclSource(decl) });
+}
+
+void gulc::ModuleInterfaceWriter::collectImport(gulc::ImportDecl const* importDecl) {
+    std::string importPath;
+
+    for (Identifier const& pathIdentifier : importDecl->importPath()) {
+        if (!importPath.empty()) importPath += ".";
+
+        importPath += pathIdentifier.name();
+    }
+
+    FileImports& fileImports = _fileImports[_currentFileIndex];
+
+    fileImports.imports += "import " + importPath;
+
+    if (importDecl->hasAlias()) {
+        fileImports.imports += " as " + importDecl->importAlias().name();
+    }
+
+    fileImports.imports += "\n";
+    fileImports.importPaths += importPath + "\n";
+}
+
+bool gulc::ModuleInterfaceWriter::isExportedDecl(gulc::Decl const* decl) const {
+    // `private` declarations are only exported when a body we keep needs them
+    return decl->visibility() != Decl::Visibility::Private ||
+           _referencedNames.find(decl->identifier().name()) != _referencedNames.end();
+}
+
+bool gulc::ModuleInterfaceWriter::keepsFunctionBody(gulc::FunctionDecl const* functionDecl) const {
+    // `@inline` functions are generated by every module that calls them so they keep their body
+    for (Attr const* attribute : functionDecl->attributes()) {
+        if (auto functionHint = llvm::dyn_cast<FunctionHintAttr>(attribute)) {
+            if (functionHint->hint() == FunctionHintAttr::Hint::Inline) {
+                return true;
+            }
+        }
+    }
+
+    // A `private` function isn't visible to the linker, the modules that need it generate their own copy
+    return functionDecl->visibility() == Decl::Visibility::Private && isExportedDecl(functionDecl);
+}
+
+std::string gulc::ModuleInterfaceWriter::getDeclSource(gulc::Decl const* decl) const {
+    std::size_t startIndex = getSourceIndex(decl->startPosition());
+    std::size_t endIndex;
+    std::vector<std::pair<std::size_t, std::size_t>> bodyRanges;
+
+    // Attributes come before the start of the declaration, they are part of its interface (e.g. `@inline`)
+    for (Attr const* attribute : decl->attributes()) {
+        std::size_t attributeIndex = getSourceIndex(attribute->startPosition());
+
+        // NOTE: The position of an attribute is its name, the `@` before it has to be included as well
+        if (attributeIndex > 0 && (*_currentSource)[attributeIndex - 1] == '@') {
+            --attributeIndex;
+        }
+
+        startIndex = std::min<std::size_t>(startIndex, attributeIndex);
+    }
+
+    switch (decl->getDeclKind()) {
+        case Decl::Kind::Function:
+        case Decl::Kind::Operator: {
+            auto functionDecl = llvm::dyn_cast<FunctionDecl>(decl);
+
+            if (functionDecl->isPrototype()) {
+                endIndex = getSourceIndex(decl->endPosition());
+            } else {
+                endIndex = getSourceIndex(functionDecl->body()->endPosition());
+                collectFunctionBodyRange(functionDecl, bodyRanges);
+            }
+
+            break;
+        }
+        case Decl::Kind::TemplateFunction:
+            // NOTE: `TemplateFunctionDecl` isn't included in `FunctionDecl::classof`
+            endIndex = getSourceIndex(static_cast<TemplateFunctionDecl const*>(decl)->body()->endPosition());
+            break;
+        case Decl::Kind::TypeAlias:
+            // NOTE: The end position of a `typealias` includes the token after it, it ends at the end of the line
+            endIndex = _currentSource->find_first_of(";\n", getSourceIndex(decl->startPosition()));
+
+            if (endIndex == std::string::npos) {
+                endIndex = _currentSource->size();
+            }
+
+            break;
+        case Decl::Kind::Extension:
+        case Decl::Kind::Property:
+        case Decl::Kind::Struct:
+            endIndex = findDeclEnd(getSourceIndex(decl->startPosition()));
+            collectBodyRanges(decl, bodyRanges);
+            break;
+        default:
+            // Templates and traits keep their bodies, the modules that import them instantiate them
+            endIndex = findDeclEnd(getSourceIndex(decl->startPosition()));
+            break;
+    }
+
+    std::sort(bodyRanges.begin(), bodyRanges.end());
+
+    std::string result;
+    std::size_t currentIndex = startIndex;
+
+    for (auto const& bodyRange : bodyRanges) {
+        // NOTE: Implicitly generated members (e.g. the default constructor) don't have a body in the source, we only
+        //       skip the ranges that actually are a `{ ... }` within the declaration
+        if (bodyRange.first < currentIndex || bodyRange.second > endIndex ||
+                bodyRange.second <= bodyRange.first || (*_currentSource)[bodyRange.first] != '{' ||
+                (*_currentSource)[bodyRange.second - 1] != '}') {
+            continue;
+        }
+
+        result += _currentSource->substr(currentIndex, bodyRange.first - currentIndex);
+        currentIndex = bodyRange.second;
+    }
+
+    result += _currentSource->substr(currentIndex, endIndex - currentIndex);
+
+    return result;
+}
+
+void gulc::ModuleInterfaceWriter::collectBodyRanges(gulc::Decl const* decl,
+                                                    std::vector<std::pair<std::size_t, std::size_t>>& bodyRanges) const {
+    switch (decl->getDeclKind()) {
+        case Decl::Kind::CallOperator:
+        case Decl::Kind::Function:
+        case Decl::Kind::Operator:
+        case Decl::Kind::TypeSuffix:
+            collectFunctionBodyRange(llvm::dyn_cast<FunctionDecl>(decl), bodyRanges);
+            break;
+        case Decl::Kind::Extension: {
+            auto extensionDecl = llvm::dyn_cast<ExtensionDecl>(decl);
+
+            for (ConstructorDecl const* constructor : extensionDecl->constructors()) {
+                collectFunctionBodyRange(constructor, bodyRanges);
+            }
+
+            for (Decl const* member : extensionDecl->ownedMembers()) {
+                collectBodyRanges(member, bodyRanges);
+            }
+
+            break;
+        }
+        case Decl::Kind::Property: {
+            auto propertyDecl = llvm::dyn_cast<PropertyDecl>(decl);
+
+            for (PropertyGetDecl const* getter : propertyDecl->getters()) {
+                collectFunctionBodyRange(getter, bodyRanges);
+            }
+
+            if (propertyDecl->hasSetter()) {
+                collectFunctionBodyRange(propertyDecl->setter(), bodyRanges);
+            }
+
+            break;
+        }
+        case Decl::Kind::Struct: {
+            auto structDecl = llvm::dyn_cast<StructDecl>(decl);
+
+            for (ConstructorDecl const* constructor : structDecl->constructors()) {
+                collectFunctionBodyRange(constructor, bodyRanges);
+            }
+
+            for (Decl const* member : structDecl->ownedMembers()) {
+                collectBodyRanges(member, bodyRanges);
+            }
+
+            if (structDecl->destructor != nullptr) {
+                collectFunctionBodyRange(structDecl->destructor, bodyRanges);
+            }
+
+            break;
+        }
+        case Decl::Kind::SubscriptOperator: {
+            auto subscriptOperatorDecl = llvm::dyn_cast<SubscriptOperatorDecl>(decl);
+
+            for (SubscriptOperatorGetDecl const* getter : subscriptOperatorDecl->getters()) {
+                collectFunctionBodyRange(getter, bodyRanges);
+            }
+
+            if (subscriptOperatorDecl->hasSetter()) {
+                collectFunctionBodyRange(subscriptOperatorDecl->setter(), bodyRanges);
+            }
+
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+void gulc::ModuleInterfaceWriter::collectFunctionBodyRange(
+        gulc::FunctionDecl const* functionDecl, std::vector<std::pair<std::size_t, std::size_t>>& bodyRanges) const {
+    if (functionDecl->isPrototype() || functionDecl->body() == nullptr) {
+        return;
+    }
+
+    if (keepsFunctionBody(functionDecl)) {
+        return;
+    }
+
+    bodyRanges.emplace_back(getSourceIndex(functionDecl->body()->startPosition()),
+                            getSourceIndex(functionDecl->body()->endPosition()));
+}
+
+std::string gulc::ModuleInterfaceWriter::getVariableDeclSource(gulc::VariableDecl const* variableDecl) const {
+    std::size_t startIndex = getSourceIndex(variableDecl->startPosition());
+
+    // `const` variables are evaluated at compile time, the importing module needs the value
+    if (variableDecl->isConstExpr() && variableDecl->hasInitialValue()) {
+        std::size_t endIndex = getSourceIndex(variableDecl->initialValue->endPosition());
+        return _currentSource->substr(startIndex, endIndex - startIndex);
+    }
+
+    // Everything else is declared `extern` so the importing module references our definition instead of making its
+    // own. The declaration ends at its type, that drops the initial value.
+    std::string result = _currentSource->substr(startIndex,
+                                               getSourceIndex(variableDecl->endPosition()) - startIndex);
+
+    if (!variableDecl->isExtern()) {
+        std::size_t identifierIndex = getSourceIndex(variableDecl->identifier().startPosition()) - startIndex;
+        std::size_t varIndex = result.rfind("var", identifierIndex);
+
+        if (varIndex == std::string::npos) {
+            printError("could not find `var` in the declaration of `" + variableDecl->identifier().name() + "`!");
+        }
+
+        result.insert(varIndex, "extern ");
+    }
+
+    return result;
+}
+
+std::size_t gulc::ModuleInterfaceWriter::getSourceIndex(gulc::TextPosition position) {
+    return SourceManager::get().getFileOffset(position);
+}
+
+/**
+ * Find the end of a declaration with a body (`struct`, `trait`, `enum`, etc.)
+ *
+ * The parser only stores the position of the declaration's header so we find the end by matching the first `{` after
+ * the start of the declaration with its closing `}`.
+ *
+ * @return The index directly after the closing `}`
+ */
+std::size_t gulc::ModuleInterfaceWriter::findDeclEnd(std::size_t declStart) const {
+    std::size_t depth = 0;
+
+    for (std::size_t i = declStart; i < _currentSource->size(); ++i) {
+        char currentChar = (*_currentSource)[i];
+
+        if (currentChar == '/' && i + 1 < _currentSource->size() && (*_currentSource)[i + 1] == '/') {
+            i = _currentSource->find('\n', i);
+
+            if (i == std::string::npos) break;
+        } else if (currentChar == '/' && i + 1 < _currentSource->size() && (*_currentSource)[i + 1] == '*') {
+            i = _currentSource->find("*/", i + 2);
+
+            if (i == std::string::npos) break;
+
+            ++i;
+        } else if (currentChar == '"' || currentChar == '\'') {
+            // Skip string and character literals, a `{` or `}` within them doesn't count
+            for (++i; i < _currentSource->size() && (*_currentSource)[i] != currentChar; ++i) {
+                if ((*_currentSource)[i] == '\\') ++i;
+            }
+        } else if (currentChar == '{') {
+            ++depth;
+        } else if (currentChar == '}') {
+            if (depth == 0) break;
+
+            --depth;
+
+            if (depth == 0) {
+                return i + 1;
+            }
+        }
+    }
+
+    printError("could not find the end of the declaration starting at index " + std::to_string(declStart) + " of `" +
+               _fileImports[_currentFileIndex].sourcePath + "`!");
+    return _currentSource->size();
+}
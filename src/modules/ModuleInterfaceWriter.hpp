@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_MODULEINTERFACEWRITER_HPP
+#define GULC_MODULEINTERFACEWRITER_HPP
+
+#include <parsing/ASTFile.hpp>
+#include <ast/decls/ImportDecl.hpp>
+#include <ast/decls/VariableDecl.hpp>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace gulc {
+    /**
+     * Writes the declarations of a module to a module interface (`--emit-module-interface=<file.gmi>`) so other
+     * modules can `import` them without parsing our source files. See `ModuleInterface` for the file layout.
+     *
+     * Declarations are stored as their source with every function body removed, which turns them into prototypes.
+     * Resolved types, struct layouts, and mangled names are NOT stored, the importing module's passes recompute them
+     * from the prototypes the same way they were computed here.
+     *
+     * Bodies that are kept (`@inline` functions, templates, and traits) are compiled again by the importing module, so
+     * any `private` declaration they reference is exported as well. `private` functions keep their body and each
+     * importing module generates its own `internal` copy. Global variables are exported as `extern` declarations.
+     */
+    class ModuleInterfaceWriter {
+    public:
+        explicit ModuleInterfaceWriter(std::vector<std::string> const& filePaths)
+                : _filePaths(filePaths), _currentFileIndex(0), _currentSource(nullptr) {}
+
+        // NOTE: `files` with a `sourceFileID` outside of `filePaths` (i.e. declarations we imported from another
+        //       module interface) are skipped.
+        void writeFiles(std::vector<ASTFile> const& files, std::string const& outputPath);
+
+    private:
+        class BodyReferenceCollector;
+
+        struct DeclSource {
+            std::uint32_t fileIndex;
+            std::string source;
+        };
+
+        struct FileImports {
+            std::string sourcePath;
+            std::string imports;
+            std::string importPaths;
+        };
+
+        std::vector<std::string> const& _filePaths;
+        // Sorted by the namespace path, the same order they are written in
+        std::map<std::string, std::vector<DeclSource>> _namespaceDecls;
+        std::vector<FileImports> _fileImports;
+        std::uint32_t _currentFileIndex;
+        // The source the current file was parsed from, owned by `SourceManager`
+        std::string const* _currentSource;
+        // Names referenced by the bodies the interface keeps, `private` declarations with these names are exported
+        std::set<std::string> _referencedNames;
+
+        void printError(std::string const& message) const;
+
+        void collectReferencedNames(std::vector<ASTFile> const& files);
+        void collectKeptBodyReferences(Decl* decl, bool keepsAllBodies, BodyReferenceCollector& collector);
+        void collectDecl(Decl const* decl, std::string const& namespacePath);
+        void collectImport(ImportDecl const* importDecl);
+
+        bool isExportedDecl(Decl const* decl) const;
+        bool keepsFunctionBody(FunctionDecl const* functionDecl) const;
+        std::string getDeclSource(Decl const* decl) const;
+        std::string getVariableDeclSource(VariableDecl const* variableDecl) const;
+        void collectBodyRanges(Decl const* decl, std::vector<std::pair<std::size_t, std::size_t>>& bodyRanges) const;
+        void collectFunctionBodyRange(FunctionDecl const* functionDecl,
+                                      std::vector<std::pair<std::size_t, std::size_t>>& bodyRanges) const;
+        std::size_t findDeclEnd(std::size_t declStart) const;
+        // Returns the index of `position` within `_currentSource`
+        static std::size_t getSourceIndex(TextPosition position);
+
+    };
+}
+
+#endif //GULC_MODULEINTERFACEWRITER_HPP
@@ -20,167 +20,161 @@
 #include <ast/types/StructType.hpp>
 #include <ast/types/PointerType.hpp>
 #include <ast/types/ReferenceType.hpp>
+#include <ast/types/BoolType.hpp>
+#include <ast/types/SimdType.hpp>
 #include <iostream>
 #include <ast/types/TraitType.hpp>
+#include <ast/types/TemplateTypenameRefType.hpp>
 #include <ast/exprs/TypeExpr.hpp>
 #include <ast/exprs/ValueLiteralExpr.hpp>
 #include "ItaniumMangler.hpp"
 
 void gulc::ItaniumMangler::mangleDecl(gulc::EnumDecl* enumDecl) {
-    mangleDeclEnum(enumDecl, "", "");
+    mangleDeclEnum(enumDecl, {});
 }
 
 void gulc::ItaniumMangler::mangleDecl(gulc::StructDecl* structDecl) {
-    mangleDeclStruct(structDecl, "", "");
+    mangleDeclStruct(structDecl);
 }
 
 void gulc::ItaniumMangler::mangleDecl(gulc::TraitDecl* traitDecl) {
-    mangleDeclTrait(traitDecl, "", "");
+    mangleDeclTrait(traitDecl);
 }
 
 void gulc::ItaniumMangler::mangleDecl(gulc::NamespaceDecl* namespaceDecl) {
-    mangleDeclNamespace(namespaceDecl, "");
+    mangleDeclNamespace(namespaceDecl, {});
 }
 
 void gulc::ItaniumMangler::mangleDecl(gulc::TemplateStructDecl* templateStructDecl) {
-    mangleDeclTemplateStruct(templateStructDecl, "", "");
+    mangleDeclTemplateStruct(templateStructDecl);
 }
 
 void gulc::ItaniumMangler::mangleDecl(gulc::TemplateTraitDecl* templateTraitDecl) {
-    mangleDeclTemplateTrait(templateTraitDecl, "", "");
+    mangleDeclTemplateTrait(templateTraitDecl);
 }
 
-void gulc::ItaniumMangler::mangleDeclEnum(gulc::EnumDecl* enumDecl, std::string const& prefix,
-                                          std::string const& nameSuffix) {
-    std::string nPrefix = prefix + sourceName(enumDecl->identifier().name());
-    enumDecl->setMangledName(nPrefix + nameSuffix);
+void gulc::ItaniumMangler::mangleDeclEnum(gulc::EnumDecl* enumDecl, ManglePath const& prefix) {
+    SubstitutionTable substitutions;
+    enumDecl->setMangledName(declTypeName(enumDecl, substitutions));
+
+    ManglePath nPrefix = nestedPath(prefix, enumDecl);
 
     // TODO: Support nested `Struct` and `Trait`
     for (Decl* decl : enumDecl->ownedMembers()) {
 //        if (llvm::isa<OperatorDecl>(decl)) {
-//            mangleOperator(llvm::dyn_cast<OperatorDecl>(decl), "N" + nPrefix, "E");
+//            mangleOperator(llvm::dyn_cast<OperatorDecl>(decl), nPrefix);
 //        } else if (llvm::isa<CastOperatorDecl>(decl)) {
-//            mangleCastOperator(llvm::dyn_cast<CastOperatorDecl>(decl), "N" + nPrefix, "E");
+//            mangleCastOperator(llvm::dyn_cast<CastOperatorDecl>(decl), nPrefix);
 //        } else
         if (llvm::isa<CallOperatorDecl>(decl)) {
-            mangleCallOperator(llvm::dyn_cast<CallOperatorDecl>(decl), "N" + nPrefix, "E");
+            mangleCallOperator(llvm::dyn_cast<CallOperatorDecl>(decl), nPrefix);
         } else if (llvm::isa<FunctionDecl>(decl)) {
-            mangleFunction(llvm::dyn_cast<FunctionDecl>(decl), "N" + nPrefix, "E");
+            mangleFunction(llvm::dyn_cast<FunctionDecl>(decl), nPrefix);
         }
     }
 }
 
-void gulc::ItaniumMangler::mangleDeclStruct(gulc::StructDecl* structDecl, std::string const& prefix,
-                                            std::string const& nameSuffix) {
-    std::string nPrefix = prefix + sourceName(structDecl);
-    structDecl->setMangledName(nPrefix + nameSuffix);
+void gulc::ItaniumMangler::mangleDeclStruct(gulc::StructDecl* structDecl) {
+    // NOTE: The struct's own mangled name is a complete `<type>` encoding (including any `N...E`) with its own
+    //       substitution dictionary so it can be used on its own (e.g. for the LLVM struct type name)
+    SubstitutionTable substitutions;
+    structDecl->setMangledName(declTypeName(structDecl, substitutions));
 }
 
-void gulc::ItaniumMangler::mangleDeclTrait(gulc::TraitDecl* traitDecl, std::string const& prefix,
-                                           std::string const& nameSuffix) {
-    std::string nPrefix = prefix + sourceName(traitDecl);
-    traitDecl->setMangledName(nPrefix + nameSuffix);
+void gulc::ItaniumMangler::mangleDeclTrait(gulc::TraitDecl* traitDecl) {
+    SubstitutionTable substitutions;
+    traitDecl->setMangledName(declTypeName(traitDecl, substitutions));
 }
 
-void gulc::ItaniumMangler::mangleDeclNamespace(gulc::NamespaceDecl* namespaceDecl, std::string const& prefix) {
-    std::string nPrefix = prefix + sourceName(namespaceDecl->identifier().name());
+void gulc::ItaniumMangler::mangleDeclNamespace(gulc::NamespaceDecl* namespaceDecl, ManglePath const& prefix) {
+    ManglePath nPrefix = nestedPath(prefix, namespaceDecl);
 
     for (Decl* decl : namespaceDecl->nestedDecls()) {
         if (llvm::isa<EnumDecl>(decl)) {
-            mangleDeclEnum(llvm::dyn_cast<EnumDecl>(decl), "N" + nPrefix, "E");
+            mangleDeclEnum(llvm::dyn_cast<EnumDecl>(decl), nPrefix);
         } else if (llvm::isa<NamespaceDecl>(decl)) {
             mangleDeclNamespace(llvm::dyn_cast<NamespaceDecl>(decl), nPrefix);
         } else if (llvm::isa<StructDecl>(decl)) {
-            mangleDeclStruct(llvm::dyn_cast<StructDecl>(decl), "N" + nPrefix, "E");
+            mangleDeclStruct(llvm::dyn_cast<StructDecl>(decl));
         } else if (llvm::isa<TraitDecl>(decl)) {
-            mangleDeclTrait(llvm::dyn_cast<TraitDecl>(decl), "N" + nPrefix, "E");
+            mangleDeclTrait(llvm::dyn_cast<TraitDecl>(decl));
         } else if (llvm::isa<TemplateStructDecl>(decl)) {
-            mangleDeclTemplateStruct(llvm::dyn_cast<TemplateStructDecl>(decl), "N" + nPrefix, "E");
+            mangleDeclTemplateStruct(llvm::dyn_cast<TemplateStructDecl>(decl));
         } else if (llvm::isa<TemplateTraitDecl>(decl)) {
-            mangleDeclTemplateTrait(llvm::dyn_cast<TemplateTraitDecl>(decl), "N" + nPrefix, "E");
+            mangleDeclTemplateTrait(llvm::dyn_cast<TemplateTraitDecl>(decl));
         }
     }
 }
 
-void gulc::ItaniumMangler::mangleDeclTemplateStruct(gulc::TemplateStructDecl* templateStructDecl,
-                                                    std::string const& prefix, std::string const& nameSuffix) {
+void gulc::ItaniumMangler::mangleDeclTemplateStruct(gulc::TemplateStructDecl* templateStructDecl) {
     for (auto templateInst : templateStructDecl->templateInstantiations()) {
-        mangleDeclTemplateStructInst(templateInst, prefix, nameSuffix);
+        // `declTypeName` handles the template arguments of the instantiation for us
+        mangleDeclStruct(templateInst);
     }
 }
 
-void gulc::ItaniumMangler::mangleDeclTemplateTrait(gulc::TemplateTraitDecl* templateTraitDecl,
-                                                   std::string const& prefix, std::string const& nameSuffix) {
+void gulc::ItaniumMangler::mangleDeclTemplateTrait(gulc::TemplateTraitDecl* templateTraitDecl) {
     for (auto templateInst : templateTraitDecl->templateInstantiations()) {
-        mangleDeclTemplateTraitInst(templateInst, prefix, nameSuffix);
+        // `declTypeName` handles the template arguments of the instantiation for us
+        mangleDeclTrait(templateInst);
     }
 }
 
-void gulc::ItaniumMangler::mangleDeclTemplateStructInst(gulc::TemplateStructInstDecl* templateStructInstDecl,
-                                                        std::string const& prefix, std::string const& nameSuffix) {
-    // The `sourceName(StructDecl*)` function will handle setting the proper template struct instantiation name.
-    mangleDeclStruct(templateStructInstDecl, prefix, nameSuffix);
-}
-
-void gulc::ItaniumMangler::mangleDeclTemplateTraitInst(gulc::TemplateTraitInstDecl* templateTraitInstDecl,
-                                                       std::string const& prefix, std::string const& nameSuffix) {
-    // The `sourceName(TraitDecl*)` function will handle setting the proper template trait instantiation name.
-    mangleDeclTrait(templateTraitInstDecl, prefix, nameSuffix);
-}
-
 void gulc::ItaniumMangler::mangle(gulc::FunctionDecl* functionDecl) {
-    mangleFunction(functionDecl, "", "");
+    mangleFunction(functionDecl, {});
 }
 
 void gulc::ItaniumMangler::mangle(gulc::VariableDecl* variableDecl) {
-    mangleVariable(variableDecl, "", "");
+    mangleVariable(variableDecl, {});
 }
 
 void gulc::ItaniumMangler::mangle(gulc::NamespaceDecl* namespaceDecl) {
-    mangleNamespace(namespaceDecl, "");
+    mangleNamespace(namespaceDecl, {});
 }
 
 void gulc::ItaniumMangler::mangle(gulc::StructDecl* structDecl) {
-    mangleStruct(structDecl, "");
+    mangleStruct(structDecl, {});
 }
 
 void gulc::ItaniumMangler::mangle(gulc::TraitDecl* traitDecl) {
-    mangleTrait(traitDecl, "");
+    mangleTrait(traitDecl, {});
 }
 
 void gulc::ItaniumMangler::mangle(gulc::CallOperatorDecl* callOperatorDecl) {
-    mangleCallOperator(callOperatorDecl, "", "");
+    mangleCallOperator(callOperatorDecl, {});
 }
 
 void gulc::ItaniumMangler::mangle(gulc::PropertyDecl* propertyDecl) {
-    mangleProperty(propertyDecl, "", "");
+    mangleProperty(propertyDecl, {});
 }
 
 void gulc::ItaniumMangler::mangle(gulc::TemplateStructDecl* templateStructDecl) {
-    mangleTemplateStruct(templateStructDecl, "");
+    mangleTemplateStruct(templateStructDecl, {});
 }
 
 void gulc::ItaniumMangler::mangle(gulc::TemplateTraitDecl* templateTraitDecl) {
-    mangleTemplateTrait(templateTraitDecl, "");
+    mangleTemplateTrait(templateTraitDecl, {});
 }
 
 void gulc::ItaniumMangler::mangle(gulc::TemplateFunctionDecl* templateFunctionDecl) {
-    mangleTemplateFunction(templateFunctionDecl, "", "");
+    mangleTemplateFunction(templateFunctionDecl, {});
 }
 
-void gulc::ItaniumMangler::mangleFunction(gulc::FunctionDecl* functionDecl, std::string const& prefix,
-                                          std::string const& nameSuffix) {
-    // All mangled names start with "_Z"...
-    std::string mangledName = "_Z" + prefix + unqualifiedName(functionDecl) + nameSuffix;
+void gulc::ItaniumMangler::mangleFunction(gulc::FunctionDecl* functionDecl, ManglePath const& prefix) {
+    SubstitutionTable substitutions;
+    auto templateInst = llvm::dyn_cast<TemplateFunctionInstDecl>(functionDecl);
 
-    if (llvm::isa<TemplateFunctionInstDecl>(functionDecl)) {
-        auto templateInst = llvm::dyn_cast<TemplateFunctionInstDecl>(functionDecl);
+    // All mangled names start with "_Z"...
+    // NOTE: `nestedName` handles the template arguments of template function instantiations for us
+    std::string mangledName = "_Z" + nestedName(prefix, "", unqualifiedName(functionDecl), substitutions,
+                                                templateInst);
 
-        mangledName += templateArgs(templateInst->parentTemplateStruct()->templateParameters(),
-                                    templateInst->templateArguments());
+    if (templateInst != nullptr) {
+        // Parameters that use the template's type parameters are written as `T_`, `T0_`, ...
+        substitutions.templateFunction = templateInst->parentTemplateStruct();
     }
 
-    mangledName += bareFunctionType(functionDecl->parameters());
+    mangledName += bareFunctionType(functionDecl->parameters(), substitutions);
 
     functionDecl->setMangledName(mangledName);
 
@@ -191,27 +185,27 @@ void gulc::ItaniumMangler::mangleFunction(gulc::FunctionDecl* functionDecl, std:
 }
 
 void gulc::ItaniumMangler::mangleTemplateFunction(gulc::TemplateFunctionDecl* templateFunctionDecl,
-                                                  std::string const& prefix, std::string const& nameSuffix) {
+                                                  ManglePath const& prefix) {
     for (auto templateInst : templateFunctionDecl->templateInstantiations()) {
         // `mangleFunction` handles template arguments properly for us
-        mangleFunction(templateInst, prefix, nameSuffix);
+        mangleFunction(templateInst, prefix);
     }
 }
 
-void gulc::ItaniumMangler::mangleVariable(gulc::VariableDecl* variableDecl, std::string const& prefix,
-                                          std::string const& nameSuffix) {
+void gulc::ItaniumMangler::mangleVariable(gulc::VariableDecl* variableDecl, ManglePath const& prefix) {
+    SubstitutionTable substitutions;
     // All mangled names start with "_Z"...
-    variableDecl->setMangledName("_Z" + prefix + unqualifiedName(variableDecl) + nameSuffix);
+    variableDecl->setMangledName("_Z" + nestedName(prefix, "", unqualifiedName(variableDecl), substitutions));
 }
 
-void gulc::ItaniumMangler::mangleNamespace(gulc::NamespaceDecl* namespaceDecl, std::string const& prefix) {
-    std::string nPrefix = prefix + sourceName(namespaceDecl->identifier().name());
+void gulc::ItaniumMangler::mangleNamespace(gulc::NamespaceDecl* namespaceDecl, ManglePath const& prefix) {
+    ManglePath nPrefix = nestedPath(prefix, namespaceDecl);
 
     for (Decl* decl : namespaceDecl->nestedDecls()) {
         if (llvm::isa<FunctionDecl>(decl)) {
-            mangleFunction(llvm::dyn_cast<FunctionDecl>(decl), "N" + nPrefix, "E");
+            mangleFunction(llvm::dyn_cast<FunctionDecl>(decl), nPrefix);
         } else if (llvm::isa<VariableDecl>(decl)) {
-            mangleVariable(llvm::dyn_cast<VariableDecl>(decl), "N" + nPrefix, "E");
+            mangleVariable(llvm::dyn_cast<VariableDecl>(decl), nPrefix);
         } else if (llvm::isa<NamespaceDecl>(decl)) {
             mangleNamespace(llvm::dyn_cast<NamespaceDecl>(decl), nPrefix);
         } else if (llvm::isa<StructDecl>(decl)) {
@@ -219,116 +213,113 @@ void gulc::ItaniumMangler::mangleNamespace(gulc::NamespaceDecl* namespaceDecl, s
         } else if (llvm::isa<TraitDecl>(decl)) {
             mangleTrait(llvm::dyn_cast<TraitDecl>(decl), nPrefix);
         } else if (llvm::isa<PropertyDecl>(decl)) {
-            mangleProperty(llvm::dyn_cast<PropertyDecl>(decl), "N" + nPrefix, "E");
+            mangleProperty(llvm::dyn_cast<PropertyDecl>(decl), nPrefix);
         } else if (llvm::isa<TemplateStructDecl>(decl)) {
             mangleTemplateStruct(llvm::dyn_cast<TemplateStructDecl>(decl), nPrefix);
         } else if (llvm::isa<TemplateTraitDecl>(decl)) {
             mangleTemplateTrait(llvm::dyn_cast<TemplateTraitDecl>(decl), nPrefix);
         } else if (llvm::isa<TemplateFunctionDecl>(decl)) {
-            mangleTemplateFunction(llvm::dyn_cast<TemplateFunctionDecl>(decl), "N" + nPrefix, "E");
+            mangleTemplateFunction(llvm::dyn_cast<TemplateFunctionDecl>(decl), nPrefix);
         }
     }
 }
 
-void gulc::ItaniumMangler::mangleStruct(gulc::StructDecl* structDecl, std::string const& prefix) {
-    std::string nPrefix = prefix + sourceName(structDecl);
+void gulc::ItaniumMangler::mangleStruct(gulc::StructDecl* structDecl, ManglePath const& prefix) {
+    ManglePath nPrefix = nestedPath(prefix, structDecl);
 
     for (ConstructorDecl* constructor : structDecl->constructors()) {
-        mangleConstructor(constructor, "N" + nPrefix, "E");
+        mangleConstructor(constructor, structDecl, nPrefix);
     }
 
     // TODO: Support nested `Struct` and `Trait`
     for (Decl* decl : structDecl->ownedMembers()) {
 //        if (llvm::isa<OperatorDecl>(decl)) {
-//            mangleOperator(llvm::dyn_cast<OperatorDecl>(decl), "N" + nPrefix, "E");
+//            mangleOperator(llvm::dyn_cast<OperatorDecl>(decl), nPrefix);
 //        } else if (llvm::isa<CastOperatorDecl>(decl)) {
-//            mangleCastOperator(llvm::dyn_cast<CastOperatorDecl>(decl), "N" + nPrefix, "E");
+//            mangleCastOperator(llvm::dyn_cast<CastOperatorDecl>(decl), nPrefix);
 //        } else
         if (llvm::isa<CallOperatorDecl>(decl)) {
-            mangleCallOperator(llvm::dyn_cast<CallOperatorDecl>(decl), "N" + nPrefix, "E");
+            mangleCallOperator(llvm::dyn_cast<CallOperatorDecl>(decl), nPrefix);
         } else if (llvm::isa<OperatorDecl>(decl)) {
-            mangleOperator(llvm::dyn_cast<OperatorDecl>(decl), "N" + nPrefix, "E");
+            mangleOperator(llvm::dyn_cast<OperatorDecl>(decl), nPrefix);
         } else if (llvm::isa<FunctionDecl>(decl)) {
-            mangleFunction(llvm::dyn_cast<FunctionDecl>(decl), "N" + nPrefix, "E");
+            mangleFunction(llvm::dyn_cast<FunctionDecl>(decl), nPrefix);
         } else if (llvm::isa<PropertyDecl>(decl)) {
-            mangleProperty(llvm::dyn_cast<PropertyDecl>(decl), "N" + nPrefix, "E");
+            mangleProperty(llvm::dyn_cast<PropertyDecl>(decl), nPrefix);
         } else if (llvm::isa<SubscriptOperatorDecl>(decl)) {
-            mangleSubscript(llvm::dyn_cast<SubscriptOperatorDecl>(decl), "N" + nPrefix, "E");
+            mangleSubscript(llvm::dyn_cast<SubscriptOperatorDecl>(decl), nPrefix);
         } else if (llvm::isa<TemplateFunctionDecl>(decl)) {
-            mangleTemplateFunction(llvm::dyn_cast<TemplateFunctionDecl>(decl), "N" + nPrefix, "E");
+            mangleTemplateFunction(llvm::dyn_cast<TemplateFunctionDecl>(decl), nPrefix);
         }
     }
 
     if (structDecl->destructor != nullptr) {
-        mangleDestructor(structDecl->destructor, "N" + nPrefix, "E");
+        mangleDestructor(structDecl->destructor, nPrefix);
     }
 
-    // Set vtable mangled name
-    if (prefix.empty()) {
-        structDecl->vtableName = "_ZTVN" + nPrefix + "E";
-    } else {
-        structDecl->vtableName = "_ZTV" + nPrefix;
-    }
+    // Set vtable mangled name, `_ZTV <type>`
+    SubstitutionTable substitutions;
+    structDecl->vtableName = "_ZTV" + declTypeName(structDecl, substitutions);
 }
 
 void gulc::ItaniumMangler::mangleTemplateStruct(gulc::TemplateStructDecl* templateStructDecl,
-                                                std::string const& prefix) {
+                                                ManglePath const& prefix) {
     for (auto templateInst : templateStructDecl->templateInstantiations()) {
         // `mangleStruct` handles template arguments properly for us
         mangleStruct(templateInst, prefix);
     }
 }
 
-void gulc::ItaniumMangler::mangleTrait(gulc::TraitDecl* traitDecl, std::string const& prefix) {
-    std::string nPrefix = prefix + sourceName(traitDecl);
+void gulc::ItaniumMangler::mangleTrait(gulc::TraitDecl* traitDecl, ManglePath const& prefix) {
+    ManglePath nPrefix = nestedPath(prefix, traitDecl);
 
     // TODO: Support nested `Struct` and `Trait`
     for (Decl* decl : traitDecl->ownedMembers()) {
 //        if (llvm::isa<OperatorDecl>(decl)) {
-//            mangleOperator(llvm::dyn_cast<OperatorDecl>(decl), "N" + nPrefix, "E");
+//            mangleOperator(llvm::dyn_cast<OperatorDecl>(decl), nPrefix);
 //        } else if (llvm::isa<CastOperatorDecl>(decl)) {
-//            mangleCastOperator(llvm::dyn_cast<CastOperatorDecl>(decl), "N" + nPrefix, "E");
+//            mangleCastOperator(llvm::dyn_cast<CastOperatorDecl>(decl), nPrefix);
 //        } else
         if (llvm::isa<CallOperatorDecl>(decl)) {
-            mangleCallOperator(llvm::dyn_cast<CallOperatorDecl>(decl), "N" + nPrefix, "E");
+            mangleCallOperator(llvm::dyn_cast<CallOperatorDecl>(decl), nPrefix);
         } else if (llvm::isa<OperatorDecl>(decl)) {
-            mangleOperator(llvm::dyn_cast<OperatorDecl>(decl), "N" + nPrefix, "E");
+            mangleOperator(llvm::dyn_cast<OperatorDecl>(decl), nPrefix);
         } else if (llvm::isa<FunctionDecl>(decl)) {
-            mangleFunction(llvm::dyn_cast<FunctionDecl>(decl), "N" + nPrefix, "E");
+            mangleFunction(llvm::dyn_cast<FunctionDecl>(decl), nPrefix);
         } else if (llvm::isa<PropertyDecl>(decl)) {
-            mangleProperty(llvm::dyn_cast<PropertyDecl>(decl), "N" + nPrefix, "E");
+            mangleProperty(llvm::dyn_cast<PropertyDecl>(decl), nPrefix);
         } else if (llvm::isa<SubscriptOperatorDecl>(decl)) {
-            mangleSubscript(llvm::dyn_cast<SubscriptOperatorDecl>(decl), "N" + nPrefix, "E");
+            mangleSubscript(llvm::dyn_cast<SubscriptOperatorDecl>(decl), nPrefix);
         } else if (llvm::isa<TemplateFunctionDecl>(decl)) {
-            mangleTemplateFunction(llvm::dyn_cast<TemplateFunctionDecl>(decl), "N" + nPrefix, "E");
+            mangleTemplateFunction(llvm::dyn_cast<TemplateFunctionDecl>(decl), nPrefix);
         }
     }
 }
 
 void gulc::ItaniumMangler::mangleTemplateTrait(gulc::TemplateTraitDecl* templateTraitDecl,
-                                               std::string const& prefix) {
+                                               ManglePath const& prefix) {
     for (auto templateInst : templateTraitDecl->templateInstantiations()) {
         // `mangleTrait` handles template arguments properly for us
         mangleTrait(templateInst, prefix);
     }
 }
 
-void gulc::ItaniumMangler::mangleCallOperator(gulc::CallOperatorDecl* callOperatorDecl, std::string const& prefix,
-                                              std::string const& nameSuffix) {
-    std::string mangledName = "_Z" + prefix + "cl" + nameSuffix;
+void gulc::ItaniumMangler::mangleCallOperator(gulc::CallOperatorDecl* callOperatorDecl, ManglePath const& prefix) {
+    SubstitutionTable substitutions;
+    std::string mangledName = "_Z" + nestedName(prefix, "", "cl", substitutions);
 
-    mangledName += bareFunctionType(callOperatorDecl->parameters());
+    mangledName += bareFunctionType(callOperatorDecl->parameters(), substitutions);
 
     callOperatorDecl->setMangledName(mangledName);
 }
 
-void gulc::ItaniumMangler::mangleOperator(gulc::OperatorDecl* operatorDecl, std::string const& prefix,
-                                          std::string const& nameSuffix) {
+void gulc::ItaniumMangler::mangleOperator(gulc::OperatorDecl* operatorDecl, ManglePath const& prefix) {
+    SubstitutionTable substitutions;
     // All mangled names start with "_Z"...
-    std::string mangledName = "_Z" + prefix +
-            operatorName(operatorDecl->operatorType(), operatorDecl->operatorIdentifier().name()) + nameSuffix;
+    std::string mangledName = "_Z" + nestedName(prefix, "",
+            operatorName(operatorDecl->operatorType(), operatorDecl->operatorIdentifier().name()), substitutions);
 
-    mangledName += bareFunctionType(operatorDecl->parameters());
+    mangledName += bareFunctionType(operatorDecl->parameters(), substitutions);
 
     operatorDecl->setMangledName(mangledName);
 
@@ -338,152 +329,129 @@ void gulc::ItaniumMangler::mangleOperator(gulc::OperatorDecl* operatorDecl, std:
     //       the function from C
 }
 
-void gulc::ItaniumMangler::mangleProperty(gulc::PropertyDecl* propertyDecl, std::string const& prefix,
-                                          std::string const& nameSuffix) {
-    std::string nPrefix = prefix + sourceName(propertyDecl->identifier().name());
+void gulc::ItaniumMangler::mangleProperty(gulc::PropertyDecl* propertyDecl, ManglePath const& prefix) {
+    ManglePath nPrefix = nestedPath(prefix, propertyDecl);
 
     for (PropertyGetDecl* getter : propertyDecl->getters()) {
-        manglePropertyGet(getter, nPrefix, nameSuffix);
+        manglePropertyGet(getter, nPrefix);
     }
 
     if (propertyDecl->hasSetter()) {
-        manglePropertySet(propertyDecl->setter(), nPrefix, nameSuffix);
+        manglePropertySet(propertyDecl->setter(), nPrefix);
     }
 }
 
-void gulc::ItaniumMangler::manglePropertyGet(gulc::PropertyGetDecl* propertyGetDecl, std::string const& prefix,
-                                             std::string const& nameSuffix) {
+void gulc::ItaniumMangler::manglePropertyGet(gulc::PropertyGetDecl* propertyGetDecl, ManglePath const& prefix) {
+    SubstitutionTable substitutions;
+    // `K` for C++ const/immut
+    std::string qualifiers = propertyGetDecl->isMutable() ? "" : "K";
+    std::string getterName;
+
     switch (propertyGetDecl->getResultType()) {
         case PropertyGetDecl::GetResult::Normal:
-            if (propertyGetDecl->isMutable()) {
-                std::string mangledName = "_Z" + prefix + "pg" + nameSuffix + "v";
-                propertyGetDecl->setMangledName(mangledName);
-            } else {
-                // `K` for C++ const/immut
-                std::string mangledName = "_Z" + prefix + "Kpg" + nameSuffix + "v";
-                propertyGetDecl->setMangledName(mangledName);
-            }
+            getterName = "pg";
             break;
         case PropertyGetDecl::GetResult::Ref:
-            if (propertyGetDecl->isMutable()) {
-                std::string mangledName = "_Z" + prefix + "pgr" + nameSuffix + "v";
-                propertyGetDecl->setMangledName(mangledName);
-            } else {
-                // `K` for C++ const/immut
-                std::string mangledName = "_Z" + prefix + "Kpgr" + nameSuffix + "v";
-                propertyGetDecl->setMangledName(mangledName);
-            }
+            getterName = "pgr";
             break;
         case PropertyGetDecl::GetResult::RefMut:
-            if (propertyGetDecl->isMutable()) {
-                std::string mangledName = "_Z" + prefix + "pgrm" + nameSuffix + "v";
-                propertyGetDecl->setMangledName(mangledName);
-            } else {
-                // `K` for C++ const/immut
-                std::string mangledName = "_Z" + prefix + "Kpgrm" + nameSuffix + "v";
-                propertyGetDecl->setMangledName(mangledName);
-            }
+            getterName = "pgrm";
             break;
     }
+
+    propertyGetDecl->setMangledName("_Z" + nestedName(prefix, qualifiers, getterName, substitutions) + "v");
 }
 
-void gulc::ItaniumMangler::manglePropertySet(gulc::PropertySetDecl* propertySetDecl, std::string const& prefix,
-                                             std::string const& nameSuffix) {
-    std::string mangledName = "_Z" + prefix + "ps" + nameSuffix;
+void gulc::ItaniumMangler::manglePropertySet(gulc::PropertySetDecl* propertySetDecl, ManglePath const& prefix) {
+    SubstitutionTable substitutions;
+    std::string mangledName = "_Z" + nestedName(prefix, "", "ps", substitutions);
 
-    mangledName += bareFunctionType(propertySetDecl->parameters());
+    mangledName += bareFunctionType(propertySetDecl->parameters(), substitutions);
 
     propertySetDecl->setMangledName(mangledName);
 }
 
 void gulc::ItaniumMangler::mangleSubscript(gulc::SubscriptOperatorDecl* subscriptOperatorDecl,
-                                           std::string const& prefix, std::string const& nameSuffix) {
-    std::string nPrefix = prefix + sourceName(subscriptOperatorDecl->identifier().name());
+                                           ManglePath const& prefix) {
+    ManglePath nPrefix = nestedPath(prefix, subscriptOperatorDecl);
 
     for (SubscriptOperatorGetDecl* getter : subscriptOperatorDecl->getters()) {
-        mangleSubscriptGet(getter, nPrefix, nameSuffix);
+        mangleSubscriptGet(getter, nPrefix);
     }
 
     if (subscriptOperatorDecl->hasSetter()) {
-        mangleSubscriptSet(subscriptOperatorDecl->setter(), nPrefix, nameSuffix);
+        mangleSubscriptSet(subscriptOperatorDecl->setter(), nPrefix);
     }
 }
 
 void gulc::ItaniumMangler::mangleSubscriptGet(gulc::SubscriptOperatorGetDecl* subscriptOperatorGetDecl,
-                                              std::string const& prefix, std::string const& nameSuffix) {
+                                              ManglePath const& prefix) {
+    SubstitutionTable substitutions;
+    // `K` for C++ const/immut
+    std::string qualifiers = subscriptOperatorGetDecl->isMutable() ? "" : "K";
+    std::string getterName;
+
     switch (subscriptOperatorGetDecl->getResultType()) {
         case SubscriptOperatorGetDecl::GetResult::Normal:
-            if (subscriptOperatorGetDecl->isMutable()) {
-                std::string mangledName = "_Z" + prefix + "ixg" + nameSuffix;
-                mangledName += bareFunctionType(subscriptOperatorGetDecl->parameters());
-                subscriptOperatorGetDecl->setMangledName(mangledName);
-            } else {
-                // `K` for C++ const/immut
-                std::string mangledName = "_Z" + prefix + "Kixg" + nameSuffix;
-                mangledName += bareFunctionType(subscriptOperatorGetDecl->parameters());
-                subscriptOperatorGetDecl->setMangledName(mangledName);
-            }
+            getterName = "ixg";
             break;
         case SubscriptOperatorGetDecl::GetResult::Ref:
-            if (subscriptOperatorGetDecl->isMutable()) {
-                std::string mangledName = "_Z" + prefix + "ixgr" + nameSuffix;
-                mangledName += bareFunctionType(subscriptOperatorGetDecl->parameters());
-                subscriptOperatorGetDecl->setMangledName(mangledName);
-            } else {
-                // `K` for C++ const/immut
-                std::string mangledName = "_Z" + prefix + "Kixgr" + nameSuffix;
-                mangledName += bareFunctionType(subscriptOperatorGetDecl->parameters());
-                subscriptOperatorGetDecl->setMangledName(mangledName);
-            }
+            getterName = "ixgr";
             break;
         case SubscriptOperatorGetDecl::GetResult::RefMut:
-            if (subscriptOperatorGetDecl->isMutable()) {
-                std::string mangledName = "_Z" + prefix + "ixgrm" + nameSuffix;
-                mangledName += bareFunctionType(subscriptOperatorGetDecl->parameters());
-                subscriptOperatorGetDecl->setMangledName(mangledName);
-            } else {
-                // `K` for C++ const/immut
-                std::string mangledName = "_Z" + prefix + "Kixgrm" + nameSuffix;
-                mangledName += bareFunctionType(subscriptOperatorGetDecl->parameters());
-                subscriptOperatorGetDecl->setMangledName(mangledName);
-            }
+            getterName = "ixgrm";
             break;
     }
+
+    std::string mangledName = "_Z" + nestedName(prefix, qualifiers, getterName, substitutions);
+    mangledName += bareFunctionType(subscriptOperatorGetDecl->parameters(), substitutions);
+    subscriptOperatorGetDecl->setMangledName(mangledName);
 }
 
 void gulc::ItaniumMangler::mangleSubscriptSet(gulc::SubscriptOperatorSetDecl* subscriptOperatorSetDecl,
-                                              std::string const& prefix, std::string const& nameSuffix) {
-    std::string mangledName = "_Z" + prefix + "ixs" + nameSuffix;
+                                              ManglePath const& prefix) {
+    SubstitutionTable substitutions;
+    std::string mangledName = "_Z" + nestedName(prefix, "", "ixs", substitutions);
 
-    mangledName += bareFunctionType(subscriptOperatorSetDecl->parameters());
+    mangledName += bareFunctionType(subscriptOperatorSetDecl->parameters(), substitutions);
 
     subscriptOperatorSetDecl->setMangledName(mangledName);
 }
 
-void gulc::ItaniumMangler::mangleConstructor(gulc::ConstructorDecl* constructorDecl, std::string const& prefix,
-                                             std::string const& nameSuffix) {
-    // All mangled names start with "_Z"...
-    std::string mangledName = "_Z" + prefix + "C2";
-    std::string mangledNameVTable = "_Z" + prefix + "C1";
+void gulc::ItaniumMangler::mangleConstructor(gulc::ConstructorDecl* constructorDecl, gulc::StructDecl* structDecl,
+                                             ManglePath const& prefix) {
+    // Both names share the same components so they end up with the same substitutions
+    SubstitutionTable substitutions;
+    SubstitutionTable substitutionsVTable;
 
-    mangledName += nameSuffix;
-    mangledNameVTable += nameSuffix;
+    // All mangled names start with "_Z"...
+    std::string mangledName = "_Z" + nestedName(prefix, "", "C2", substitutions);
+    std::string mangledNameVTable = "_Z" + nestedName(prefix, "", "C1", substitutionsVTable);
 
     std::string bareFunctionTypeResult;
 
     switch (constructorDecl->constructorType()) {
         case ConstructorType::Normal:
-            bareFunctionTypeResult = bareFunctionType(constructorDecl->parameters());
+            bareFunctionTypeResult = bareFunctionType(constructorDecl->parameters(), substitutions);
             break;
-        case ConstructorType::Copy:
-            bareFunctionTypeResult = "RKS_";
+        case ConstructorType::Copy: {
+            // `RK <struct>`, the struct is always a substitution of the constructor's own prefix
+            SubstitutionTable plainSubstitutions(false);
+            std::string structName = declTypeName(structDecl, substitutions);
+            std::string plainStructName = declTypeName(structDecl, plainSubstitutions);
+            std::string immutStructName = substitute("K" + structName, "K" + plainStructName, substitutions);
+            bareFunctionTypeResult = substitute("R" + immutStructName, "RK" + plainStructName, substitutions);
             break;
-        case ConstructorType::Move:
-            bareFunctionTypeResult = "OS_";
+        }
+        case ConstructorType::Move: {
+            SubstitutionTable plainSubstitutions(false);
+            std::string structName = declTypeName(structDecl, substitutions);
+            std::string plainStructName = declTypeName(structDecl, plainSubstitutions);
+            bareFunctionTypeResult = substitute("O" + structName, "O" + plainStructName, substitutions);
             break;
+        }
     }
 
-    // We only have to use <bare-function-name> since there isn't a namespace yet.
     mangledName += bareFunctionTypeResult;
     mangledNameVTable += bareFunctionTypeResult;
 
@@ -491,16 +459,11 @@ void gulc::ItaniumMangler::mangleConstructor(gulc::ConstructorDecl* constructorD
     constructorDecl->setMangledNameVTable(mangledNameVTable);
 }
 
-void gulc::ItaniumMangler::mangleDestructor(gulc::DestructorDecl* destructorDecl, std::string const& prefix,
-                                            std::string const& nameSuffix) {
+void gulc::ItaniumMangler::mangleDestructor(gulc::DestructorDecl* destructorDecl, ManglePath const& prefix) {
+    SubstitutionTable substitutions;
     // All mangled names start with "_Z"...
-    std::string mangledName = "_Z" + prefix;
+    std::string mangledName = "_Z" + nestedName(prefix, "", "D2", substitutions);
 
-    mangledName += "D2";
-
-    mangledName += nameSuffix;
-
-    // We only have to use <bare-function-name> since there isn't a namespace yet.
     // NOTE: Destructors cannot have parameters but are considered functions so they have to have the 'v' specifier to
     //  show it doesn't accept any parameters here
     mangledName += "v";
@@ -508,169 +471,400 @@ void gulc::ItaniumMangler::mangleDestructor(gulc::DestructorDecl* destructorDecl
     destructorDecl->setMangledName(mangledName);
 }
 
-std::string gulc::ItaniumMangler::unqualifiedName(gulc::FunctionDecl* functionDecl) {
-    return sourceName(functionDecl->identifier().name());
+bool gulc::ItaniumMangler::SubstitutionTable::find(std::string const& key, std::string& result) const {
+    if (!_isEnabled) {
+        return false;
+    }
+
+    auto foundIndex = _indices.find(key);
+
+    if (foundIndex == _indices.end()) {
+        return false;
+    }
+
+    // `<seq-id>` is the index minus one in base 36 using `0-9A-Z`, the first substitution has no `<seq-id>`
+    std::size_t index = foundIndex->second;
+    std::string seqID;
+
+    if (index > 0) {
+        index -= 1;
+
+        do {
+            std::size_t digit = index % 36;
+            seqID.insert(seqID.begin(), static_cast<char>(digit < 10 ? '0' + digit : 'A' + (digit - 10)));
+            index /= 36;
+        } while (index > 0);
+    }
+
+    result = "S" + seqID + "_";
+    return true;
 }
 
-std::string gulc::ItaniumMangler::unqualifiedName(gulc::VariableDecl* variableDecl) {
-    return sourceName(variableDecl->identifier().name());
+void gulc::ItaniumMangler::SubstitutionTable::add(std::string const& key) {
+    if (_isEnabled) {
+        // `emplace` keeps the first index if the key was already added
+        _indices.emplace(key, _indices.size());
+    }
 }
 
-std::string gulc::ItaniumMangler::sourceName(std::string const& s) {
-    return std::to_string(s.length()) + s;
+gulc::ItaniumMangler::ManglePath gulc::ItaniumMangler::nestedPath(ManglePath prefix, gulc::Decl* decl) {
+    prefix.push_back(decl);
+    return prefix;
 }
 
-std::string gulc::ItaniumMangler::sourceName(gulc::StructDecl* structDecl) {
-    auto result = sourceName(structDecl->identifier().name());
+gulc::ItaniumMangler::ManglePath gulc::ItaniumMangler::typeDeclPath(gulc::Decl* decl) {
+    ManglePath result;
 
-    // If the struct is a template instantiation we add the template arguments to the end of the source-name
-    if (llvm::isa<TemplateStructInstDecl>(structDecl)) {
-        auto templateStructInst = llvm::dyn_cast<TemplateStructInstDecl>(structDecl);
+    // Template instantiations use the `container` of their template so this finds the same path the declaration was
+    // mangled with
+    for (Decl* checkDecl = decl; checkDecl != nullptr; checkDecl = checkDecl->container) {
+        if (!llvm::isa<NamespaceDecl>(checkDecl) && !llvm::isa<StructDecl>(checkDecl) &&
+                !llvm::isa<TraitDecl>(checkDecl) && !llvm::isa<EnumDecl>(checkDecl)) {
+            break;
+        }
 
-        result += templateArgs(templateStructInst->parentTemplateStruct()->templateParameters(),
-                templateStructInst->templateArguments());
+        result.insert(result.begin(), checkDecl);
     }
 
     return result;
 }
 
-std::string gulc::ItaniumMangler::sourceName(gulc::TraitDecl* traitDecl) {
-    auto result = sourceName(traitDecl->identifier().name());
+std::string gulc::ItaniumMangler::nestedName(ManglePath const& prefix, std::string const& qualifiers,
+                                             std::string const& unqualifiedName, SubstitutionTable& substitutions,
+                                             gulc::TemplateFunctionInstDecl* templateFunctionInst) {
+    std::string result;
+
+    if (prefix.empty()) {
+        // `<unscoped-name>`, only an `<unscoped-template-name>` is a substitution candidate
+        result = unqualifiedName;
+    } else {
+        // `N [<CV-qualifiers>] <prefix> <unqualified-name> E`, the final name is never a candidate
+        result = "N" + qualifiers + prefixName(prefix, substitutions) + unqualifiedName;
+    }
+
+    if (templateFunctionInst != nullptr) {
+        substitutions.add(plainPrefixName(prefix) + unqualifiedName);
+        result += templateArgs(templateFunctionInst->parentTemplateStruct()->templateParameters(),
+                               templateFunctionInst->templateArguments(), substitutions);
+    }
+
+    if (!prefix.empty()) {
+        result += "E";
+    }
+
+    return result;
+}
 
-    // If the trait is a template instantiation we add the template arguments to the end of the source-name
-    if (llvm::isa<TemplateTraitInstDecl>(traitDecl)) {
-        auto templateTraitInstDecl = llvm::dyn_cast<TemplateTraitInstDecl>(traitDecl);
+std::string gulc::ItaniumMangler::prefixName(ManglePath const& path, SubstitutionTable& substitutions) {
+    std::string result;
+    std::string plainResult;
+
+    // Every prefix of the path is a candidate. Once a component has been seen all of its own prefixes have been too,
+    // so the longest prefix seen so far always wins by replacing `result` whenever a prefix is found.
+    for (Decl* component : path) {
+        std::string componentName = sourceName(component->identifier().name());
+        std::vector<TemplateParameterDecl*>* templateParams = nullptr;
+        std::vector<Expr*>* templateArguments = nullptr;
+
+        if (getTemplateArguments(component, templateParams, templateArguments)) {
+            // `<template-prefix>` is a candidate on its own before the `<template-args>`
+            plainResult += componentName;
+            result = substitute(result + componentName, plainResult, substitutions);
+
+            SubstitutionTable plainSubstitutions(false);
+            plainResult += templateArgs(*templateParams, *templateArguments, plainSubstitutions);
+            result += templateArgs(*templateParams, *templateArguments, substitutions);
+        } else {
+            plainResult += componentName;
+            result += componentName;
+        }
 
-        result += templateArgs(templateTraitInstDecl->parentTemplateTrait()->templateParameters(),
-                               templateTraitInstDecl->templateArguments());
+        result = substitute(result, plainResult, substitutions);
     }
 
     return result;
 }
 
-std::string gulc::ItaniumMangler::bareFunctionType(std::vector<ParameterDecl*>& params) {
+std::string gulc::ItaniumMangler::plainPrefixName(ManglePath const& path) {
+    SubstitutionTable plainSubstitutions(false);
+    return prefixName(path, plainSubstitutions);
+}
+
+std::string gulc::ItaniumMangler::substitute(std::string const& encoding, std::string const& key,
+                                             SubstitutionTable& substitutions) {
+    std::string result;
+
+    if (substitutions.find(key, result)) {
+        return result;
+    }
+
+    substitutions.add(key);
+    return encoding;
+}
+
+std::string gulc::ItaniumMangler::unqualifiedName(gulc::FunctionDecl* functionDecl) {
+    return sourceName(functionDecl->identifier().name());
+}
+
+std::string gulc::ItaniumMangler::unqualifiedName(gulc::VariableDecl* variableDecl) {
+    return sourceName(variableDecl->identifier().name());
+}
+
+std::string gulc::ItaniumMangler::sourceName(std::string const& s) {
+    return std::to_string(s.length()) + s;
+}
+
+std::string gulc::ItaniumMangler::bareFunctionType(std::vector<ParameterDecl*>& params,
+                                                   SubstitutionTable& substitutions) {
     std::string result;
 
     if (params.empty()) {
         return "v";
     }
 
-    for (ParameterDecl* param : params) {
+    for (std::size_t i = 0; i < params.size(); ++i) {
+        ParameterDecl* param = params[i];
         // NOTE: I couldn't think of a better way to match the Itanium ABI while also supporting the argument labels
         //       so we use "U" for `vendor` qualifier then the actual argument source name. This might break some tools
         //       expecting C++ (which should be minimal, tools actually demangling themselves) but within a tool like
         //       "c++filt" this will output our Ghoul signature as a C++ signature that looks like valid C++.
         // TODO: Should we go the `Ual` route instead? Still use `U` so some tools should be ok but then `al` for
         //       "argument label" then the source name of the argument label. Leading us to: `Ual3arg`?
-        result += "U" + sourceName(param->argumentLabel().name());
+        std::string vendorQualifiers = "U" + sourceName(param->argumentLabel().name());
 
         if (param->parameterKind() == ParameterDecl::ParameterKind::In) {
-            result+= "U2in";
+            vendorQualifiers += "U2in";
         } else if (param->parameterKind() == ParameterDecl::ParameterKind::Out) {
-            result+= "U3out";
+            vendorQualifiers += "U3out";
+        }
+
+        // Parameters that reference template type parameters have to use the template reference strings `T_` and
+        // `T{n}_`, for that we need the parameter's type as written in the template function
+        Type* templateType = nullptr;
+
+        if (substitutions.templateFunction != nullptr &&
+                i < substitutions.templateFunction->parameters().size()) {
+            templateType = substitutions.templateFunction->parameters()[i]->type;
         }
 
-        // Parameters that reference template type parameters have to use the template reference strings `T_` and `T{n}_`
-//        if (param->typeTemplateParamNumber > 0) {
-//            if (param->typeTemplateParamNumber - 1 == 0) {
-//                result += "T_";
-//            } else {
-//                result += "T" + std::to_string(param->typeTemplateParamNumber - 2) + "_";
-//            }
-//
-//            continue;
-//        }
+        // NOTE: Demanglers treat the vendor qualifiers, any `K` and the type as a single candidate; only the
+        //       unqualified type underneath is a candidate of its own.
+        std::string qualifiers = vendorQualifiers;
 
         // TODO: Should we ignore `mut` here?
-        result += typeName(param->type);
+        if (param->type->qualifier() == Type::Qualifier::Immut) {
+            qualifiers += "K";
+        }
+
+        SubstitutionTable plainSubstitutions(false);
+        plainSubstitutions.templateFunction = substitutions.templateFunction;
+        std::string plainParam = qualifiers + parameterTypeName(templateType, param->type, plainSubstitutions);
+
+        result += substitute(qualifiers + parameterTypeName(templateType, param->type, substitutions), plainParam,
+                             substitutions);
     }
 
     return result;
 }
 
-std::string gulc::ItaniumMangler::typeName(gulc::Type* type) {
-    std::string prefix;
+std::string gulc::ItaniumMangler::parameterTypeName(gulc::Type* templateType, gulc::Type* type,
+                                                    SubstitutionTable& substitutions) {
+    // NOTE: This returns the unqualified type, qualifiers on `type` itself are written by the caller
+    if (templateType != nullptr && substitutions.templateFunction != nullptr) {
+        if (llvm::isa<TemplateTypenameRefType>(templateType)) {
+            auto templateTypenameRef = llvm::dyn_cast<TemplateTypenameRefType>(templateType);
+            auto& templateParameters = substitutions.templateFunction->templateParameters();
+
+            for (std::size_t i = 0; i < templateParameters.size(); ++i) {
+                if (templateParameters[i] == templateTypenameRef->refTemplateParameter()) {
+                    std::string templateParam = i == 0 ? "T_" : "T" + std::to_string(i - 1) + "_";
+                    return substitute(templateParam, templateParam, substitutions);
+                }
+            }
+        } else if (llvm::isa<PointerType>(templateType) && llvm::isa<PointerType>(type)) {
+            Type* templateNested = llvm::dyn_cast<PointerType>(templateType)->nestedType;
+            Type* nested = llvm::dyn_cast<PointerType>(type)->nestedType;
+            std::string qualifier = nested->qualifier() == Type::Qualifier::Immut ? "K" : "";
+
+            SubstitutionTable plainSubstitutions(false);
+            plainSubstitutions.templateFunction = substitutions.templateFunction;
+            std::string plainNested = qualifier + parameterTypeName(templateNested, nested, plainSubstitutions);
+            std::string nestedName = parameterTypeName(templateNested, nested, substitutions);
+
+            if (!qualifier.empty()) {
+                nestedName = substitute(qualifier + nestedName, plainNested, substitutions);
+            }
+
+            return substitute("P" + nestedName, "P" + plainNested, substitutions);
+        } else if (llvm::isa<ReferenceType>(templateType) && llvm::isa<ReferenceType>(type)) {
+            Type* templateNested = llvm::dyn_cast<ReferenceType>(templateType)->nestedType;
+            Type* nested = llvm::dyn_cast<ReferenceType>(type)->nestedType;
+            std::string qualifier = nested->qualifier() == Type::Qualifier::Immut ? "K" : "";
+
+            SubstitutionTable plainSubstitutions(false);
+            plainSubstitutions.templateFunction = substitutions.templateFunction;
+            std::string plainNested = qualifier + parameterTypeName(templateNested, nested, plainSubstitutions);
+            std::string nestedName = parameterTypeName(templateNested, nested, substitutions);
+
+            if (!qualifier.empty()) {
+                nestedName = substitute(qualifier + nestedName, plainNested, substitutions);
+            }
+
+            return substitute("R" + nestedName, "R" + plainNested, substitutions);
+        }
+    }
 
+    return unqualifiedTypeName(type, substitutions);
+}
+
+std::string gulc::ItaniumMangler::declTypeName(gulc::Decl* decl, SubstitutionTable& substitutions) {
+    ManglePath path = typeDeclPath(decl);
+
+    if (path.size() == 1) {
+        // `<unscoped-name>` or `<unscoped-template-name> <template-args>`
+        return prefixName(path, substitutions);
+    }
+
+    // A nested type that was already written is replaced without the surrounding `N...E`
+    std::string result;
+
+    if (substitutions.find(plainPrefixName(path), result)) {
+        return result;
+    }
+
+    return "N" + prefixName(path, substitutions) + "E";
+}
+
+std::string gulc::ItaniumMangler::typeName(gulc::Type* type, SubstitutionTable& substitutions) {
+    std::string result = unqualifiedTypeName(type, substitutions);
+
+    // Qualified types are candidates separately from the type they qualify
     if (type->qualifier() == Type::Qualifier::Immut) {
-        prefix = "K";
+        std::string plainResult = substitutions.isEnabled() ? plainTypeName(type) : "";
+        result = substitute("K" + result, plainResult, substitutions);
     }
 
+    return result;
+}
+
+std::string gulc::ItaniumMangler::unqualifiedTypeName(gulc::Type* type, SubstitutionTable& substitutions) {
     if (llvm::isa<BuiltInType>(type)) {
         auto builtInType = llvm::dyn_cast<BuiltInType>(type);
         std::string const& checkName = builtInType->name();
 
+        // `v` and `b` are `<builtin-type>`s which are never candidates, the rest are written as `<source-name>`s so
+        // demanglers treat them as class names which are candidates
         if (checkName == "void") {
-            return prefix + "v";
+            return "v";
         } else if (checkName == "bool") {
-            return prefix + "b";
+            return "b";
         } else {
-            return prefix + sourceName(checkName);
+            return substitute(sourceName(checkName), sourceName(checkName), substitutions);
         }
     } else if (llvm::isa<EnumType>(type)) {
         auto enumType = llvm::dyn_cast<EnumType>(type);
 
         // TODO: When do we add 'Te' in front of this?? Neither clang nor gcc seem to do it in my tests
-        return prefix + /*"Te" + */enumType->decl()->mangledName();
+        return /*"Te" + */declTypeName(enumType->decl(), substitutions);
     } else if (llvm::isa<StructType>(type)) {
         auto structType = llvm::dyn_cast<StructType>(type);
 
         if (structType->decl()->structKind() == StructDecl::Kind::Union) {
             // TODO: When do we add 'Tu' in front of this?? Neither clang nor gcc seem to do it in my tests
-            return prefix + /*"Tu" + */structType->decl()->mangledName();
+            return /*"Tu" + */declTypeName(structType->decl(), substitutions);
         } else {
             // TODO: When do we add 'Ts' in front of this?? Neither clang nor gcc seem to do it in my tests
-            return prefix + /*"Ts" + */structType->decl()->mangledName();
+            return /*"Ts" + */declTypeName(structType->decl(), substitutions);
         }
     } else if (llvm::isa<TraitType>(type)) {
         auto traitType = llvm::dyn_cast<TraitType>(type);
 
         // TODO: If we do `Te` and `Ts` then should we do `Tt`, `Ti`, or `Tp`? (for `trait`, `interface`, or `protocol`)
-        return prefix + /*"Tt" + */traitType->decl()->mangledName();
+        return /*"Tt" + */declTypeName(traitType->decl(), substitutions);
+    } else if (llvm::isa<BoolType>(type)) {
+        return "b";
+    }
+
+    // The remaining types are compound types, they are candidates after the types they are made of
+    std::string result;
+
+    if (llvm::isa<SimdType>(type)) {
+        auto simdType = llvm::dyn_cast<SimdType>(type);
+
+        // Vendor extended vector type, the same as Clang and GCC use for `__attribute__((vector_size(N)))`
+        result = "Dv" + std::to_string(simdType->length()) + "_" + typeName(simdType->elementType, substitutions);
     } else if (llvm::isa<PointerType>(type)) {
-        return prefix + "P" + typeName(llvm::dyn_cast<PointerType>(type)->nestedType);
+        result = "P" + typeName(llvm::dyn_cast<PointerType>(type)->nestedType, substitutions);
     } else if (llvm::isa<ReferenceType>(type)) {
-        return prefix + "R" + typeName(llvm::dyn_cast<ReferenceType>(type)->nestedType);
+        result = "R" + typeName(llvm::dyn_cast<ReferenceType>(type)->nestedType, substitutions);
     } else {
         std::cerr << "[INTERNAL NAME MANGLING ERROR] type `" << type->toString() << "` not supported!" << std::endl;
         std::exit(1);
     }
 
-    return "[ERROR]";
+    if (!substitutions.isEnabled()) {
+        return result;
+    }
+
+    SubstitutionTable plainSubstitutions(false);
+    return substitute(result, unqualifiedTypeName(type, plainSubstitutions), substitutions);
+}
+
+std::string gulc::ItaniumMangler::plainTypeName(gulc::Type* type) {
+    SubstitutionTable plainSubstitutions(false);
+    return typeName(type, plainSubstitutions);
+}
+
+bool gulc::ItaniumMangler::getTemplateArguments(gulc::Decl* decl,
+                                                std::vector<TemplateParameterDecl*>*& templateParams,
+                                                std::vector<Expr*>*& templateArgs) {
+    if (llvm::isa<TemplateStructInstDecl>(decl)) {
+        auto templateStructInst = llvm::dyn_cast<TemplateStructInstDecl>(decl);
+
+        templateParams = &templateStructInst->parentTemplateStruct()->templateParameters();
+        templateArgs = &templateStructInst->templateArguments();
+        return true;
+    } else if (llvm::isa<TemplateTraitInstDecl>(decl)) {
+        auto templateTraitInst = llvm::dyn_cast<TemplateTraitInstDecl>(decl);
+
+        templateParams = &templateTraitInst->parentTemplateTrait()->templateParameters();
+        templateArgs = &templateTraitInst->templateArguments();
+        return true;
+    }
+
+    return false;
 }
 
 std::string gulc::ItaniumMangler::templateArgs(std::vector<TemplateParameterDecl*>& templateParams,
-                                               std::vector<Expr*>& templateArgs) {
+                                               std::vector<Expr*>& templateArgs, SubstitutionTable& substitutions) {
     std::string result = "I";
 
     for (std::size_t i = 0; i < templateParams.size(); ++i) {
-        const Expr* templateArgExpr = nullptr;
-
         if (i >= templateArgs.size()) {
             // TODO: Template default value
-//            templateArgExpr = templateParams[i]->defaultArgument();
-        } else {
-            templateArgExpr = templateArgs[i];
+//            result += templateArg(templateParams[i]->defaultArgument(), substitutions);
+            continue;
         }
 
-        result += templateArg(templateArgExpr);
+        result += templateArg(templateArgs[i], substitutions);
     }
 
     return result + "E";
 }
 
-std::string gulc::ItaniumMangler::templateArg(gulc::Expr const* expr) {
+std::string gulc::ItaniumMangler::templateArg(gulc::Expr const* expr, SubstitutionTable& substitutions) {
     if (llvm::isa<TypeExpr>(expr)) {
         auto resolvedType = llvm::dyn_cast<TypeExpr>(expr);
-        return typeName(resolvedType->type);
+        return typeName(resolvedType->type, substitutions);
     } else if (llvm::isa<ValueLiteralExpr>(expr)) {
-        return exprPrimary(expr);
+        return exprPrimary(expr, substitutions);
     } else {
         std::cerr << "[INTERNAL NAME MANGLING ERROR] template argument not supported!" << std::endl;
         std::exit(1);
     }
 }
 
-std::string gulc::ItaniumMangler::exprPrimary(gulc::Expr const* expr) {
+std::string gulc::ItaniumMangler::exprPrimary(gulc::Expr const* expr, SubstitutionTable& substitutions) {
     if (llvm::isa<ValueLiteralExpr>(expr)) {
         auto valueLiteral = llvm::dyn_cast<ValueLiteralExpr>(expr);
         // TODO: If the integer is negative it needs to be lead by an `n`
@@ -679,7 +873,7 @@ std::string gulc::ItaniumMangler::exprPrimary(gulc::Expr const* expr) {
         switch (valueLiteral->literalType()) {
             case ValueLiteralExpr::LiteralType::Integer:
             case ValueLiteralExpr::LiteralType::Float:
-                return "L" + typeName(valueLiteral->valueType) + valueLiteral->value() + "E";
+                return "L" + typeName(valueLiteral->valueType, substitutions) + valueLiteral->value() + "E";
             default:
                 break;
         }
@@ -18,6 +18,7 @@
 #ifndef GULC_ITANIUMMANGLER_HPP
 #define GULC_ITANIUMMANGLER_HPP
 
+#include <unordered_map>
 #include "ManglerBase.hpp"
 
 namespace gulc {
@@ -45,59 +46,88 @@ namespace gulc {
         void mangle(TemplateFunctionDecl* templateFunctionDecl) override;
 
     private:
-        void mangleDeclEnum(EnumDecl* enumDecl, std::string const& prefix, std::string const& nameSuffix);
-        void mangleDeclStruct(StructDecl* structDecl, std::string const& prefix, std::string const& nameSuffix);
-        void mangleDeclTrait(TraitDecl* traitDecl, std::string const& prefix, std::string const& nameSuffix);
-        void mangleDeclNamespace(NamespaceDecl* namespaceDecl, std::string const& prefix);
-        void mangleDeclTemplateStruct(TemplateStructDecl* templateStructDecl, std::string const& prefix,
-                                      std::string const& nameSuffix);
-        void mangleDeclTemplateTrait(TemplateTraitDecl* templateTraitDecl, std::string const& prefix,
-                                     std::string const& nameSuffix);
-        void mangleDeclTemplateStructInst(TemplateStructInstDecl* templateStructInstDecl, std::string const& prefix,
-                                          std::string const& nameSuffix);
-        void mangleDeclTemplateTraitInst(TemplateTraitInstDecl* templateTraitInstDecl, std::string const& prefix,
-                                         std::string const& nameSuffix);
-
-        void mangleFunction(FunctionDecl* functionDecl, std::string const& prefix, std::string const& nameSuffix);
-        void mangleTemplateFunction(TemplateFunctionDecl* templateFunctionDecl, std::string const& prefix,
-                                    std::string const& nameSuffix);
-        void mangleVariable(VariableDecl* variableDecl, std::string const& prefix, std::string const& nameSuffix);
-        void mangleNamespace(NamespaceDecl* namespaceDecl, std::string const& prefix);
-        void mangleStruct(StructDecl* structDecl, std::string const& prefix);
-        void mangleTrait(TraitDecl* traitDecl, std::string const& prefix);
-        void mangleTemplateStruct(TemplateStructDecl* templateStructDecl, std::string const& prefix);
-        void mangleTemplateTrait(TemplateTraitDecl* templateTraitDecl, std::string const& prefix);
-        void mangleCallOperator(CallOperatorDecl* callOperatorDecl, std::string const& prefix,
-                                std::string const& nameSuffix);
-        void mangleOperator(OperatorDecl* operatorDecl, std::string const& prefix, std::string const& nameSuffix);
-        void mangleProperty(PropertyDecl* propertyDecl, std::string const& prefix, std::string const& nameSuffix);
-        void manglePropertyGet(PropertyGetDecl* propertyGetDecl, std::string const& prefix,
-                               std::string const& nameSuffix);
-        void manglePropertySet(PropertySetDecl* propertySetDecl, std::string const& prefix,
-                               std::string const& nameSuffix);
-        void mangleSubscript(SubscriptOperatorDecl* subscriptOperatorDecl, std::string const& prefix,
-                             std::string const& nameSuffix);
-        void mangleSubscriptGet(SubscriptOperatorGetDecl* subscriptOperatorGetDecl, std::string const& prefix,
-                                std::string const& nameSuffix);
-        void mangleSubscriptSet(SubscriptOperatorSetDecl* subscriptOperatorSetDecl, std::string const& prefix,
-                                std::string const& nameSuffix);
-
-        void mangleConstructor(ConstructorDecl* constructorDecl, std::string const& prefix,
-                               std::string const& nameSuffix);
-        void mangleDestructor(DestructorDecl* destructorDecl, std::string const& prefix, std::string const& nameSuffix);
+        // The declarations (namespaces, structs, traits, enums, properties and subscripts) making up the
+        // `<nested-name>` of a declaration, outermost first.
+        using ManglePath = std::vector<Decl*>;
+
+        // The Itanium `<substitution>` dictionary for a single mangled name. Every substitutable component is stored
+        // by its unsubstituted encoding in the order it is first written; the first component is referenced with
+        // `S_` and the ones after it with `S0_`, `S1_`, ..., `SZ_`, `S10_`, ... (the sequence ID is base 36)
+        class SubstitutionTable {
+        public:
+            // A disabled table never substitutes or records anything, it is used to create the plain encodings we
+            // use as the dictionary keys.
+            explicit SubstitutionTable(bool isEnabled = true)
+                    : templateFunction(nullptr), _isEnabled(isEnabled) {}
+
+            // The template function being mangled, parameters referencing its template parameters are written as
+            // `T_`, `T0_`, ... instead of the instantiated type.
+            TemplateFunctionDecl* templateFunction;
+
+            bool isEnabled() const { return _isEnabled; }
+            bool find(std::string const& key, std::string& result) const;
+            void add(std::string const& key);
+
+        private:
+            bool _isEnabled;
+            std::unordered_map<std::string, std::size_t> _indices;
+
+        };
+
+        void mangleDeclEnum(EnumDecl* enumDecl, ManglePath const& prefix);
+        void mangleDeclStruct(StructDecl* structDecl);
+        void mangleDeclTrait(TraitDecl* traitDecl);
+        void mangleDeclNamespace(NamespaceDecl* namespaceDecl, ManglePath const& prefix);
+        void mangleDeclTemplateStruct(TemplateStructDecl* templateStructDecl);
+        void mangleDeclTemplateTrait(TemplateTraitDecl* templateTraitDecl);
+
+        void mangleFunction(FunctionDecl* functionDecl, ManglePath const& prefix);
+        void mangleTemplateFunction(TemplateFunctionDecl* templateFunctionDecl, ManglePath const& prefix);
+        void mangleVariable(VariableDecl* variableDecl, ManglePath const& prefix);
+        void mangleNamespace(NamespaceDecl* namespaceDecl, ManglePath const& prefix);
+        void mangleStruct(StructDecl* structDecl, ManglePath const& prefix);
+        void mangleTrait(TraitDecl* traitDecl, ManglePath const& prefix);
+        void mangleTemplateStruct(TemplateStructDecl* templateStructDecl, ManglePath const& prefix);
+        void mangleTemplateTrait(TemplateTraitDecl* templateTraitDecl, ManglePath const& prefix);
+        void mangleCallOperator(CallOperatorDecl* callOperatorDecl, ManglePath const& prefix);
+        void mangleOperator(OperatorDecl* operatorDecl, ManglePath const& prefix);
+        void mangleProperty(PropertyDecl* propertyDecl, ManglePath const& prefix);
+        void manglePropertyGet(PropertyGetDecl* propertyGetDecl, ManglePath const& prefix);
+        void manglePropertySet(PropertySetDecl* propertySetDecl, ManglePath const& prefix);
+        void mangleSubscript(SubscriptOperatorDecl* subscriptOperatorDecl, ManglePath const& prefix);
+        void mangleSubscriptGet(SubscriptOperatorGetDecl* subscriptOperatorGetDecl, ManglePath const& prefix);
+        void mangleSubscriptSet(SubscriptOperatorSetDecl* subscriptOperatorSetDecl, ManglePath const& prefix);
+
+        void mangleConstructor(ConstructorDecl* constructorDecl, StructDecl* structDecl, ManglePath const& prefix);
+        void mangleDestructor(DestructorDecl* destructorDecl, ManglePath const& prefix);
+
+        ManglePath nestedPath(ManglePath prefix, Decl* decl);
+        ManglePath typeDeclPath(Decl* decl);
+
+        std::string nestedName(ManglePath const& prefix, std::string const& qualifiers,
+                               std::string const& unqualifiedName, SubstitutionTable& substitutions,
+                               TemplateFunctionInstDecl* templateFunctionInst = nullptr);
+        std::string prefixName(ManglePath const& path, SubstitutionTable& substitutions);
+        std::string plainPrefixName(ManglePath const& path);
+        std::string substitute(std::string const& encoding, std::string const& key, SubstitutionTable& substitutions);
 
         std::string unqualifiedName(FunctionDecl* functionDecl);
         std::string unqualifiedName(VariableDecl* variableDecl);
 
         std::string sourceName(std::string const& s);
-        std::string sourceName(StructDecl* structDecl);
-        std::string sourceName(TraitDecl* traitDecl);
-        std::string bareFunctionType(std::vector<ParameterDecl*>& params);
-        std::string typeName(gulc::Type* type);
-
-        std::string templateArgs(std::vector<TemplateParameterDecl*>& templateParams, std::vector<Expr*>& templateArgs);
-        std::string templateArg(Expr const* expr);
-        std::string exprPrimary(Expr const* expr);
+        std::string bareFunctionType(std::vector<ParameterDecl*>& params, SubstitutionTable& substitutions);
+        std::string parameterTypeName(Type* templateType, Type* type, SubstitutionTable& substitutions);
+        std::string declTypeName(Decl* decl, SubstitutionTable& substitutions);
+        std::string typeName(gulc::Type* type, SubstitutionTable& substitutions);
+        std::string unqualifiedTypeName(gulc::Type* type, SubstitutionTable& substitutions);
+        std::string plainTypeName(gulc::Type* type);
+
+        bool getTemplateArguments(Decl* decl, std::vector<TemplateParameterDecl*>*& templateParams,
+                                  std::vector<Expr*>*& templateArgs);
+        std::string templateArgs(std::vector<TemplateParameterDecl*>& templateParams, std::vector<Expr*>& templateArgs,
+                                 SubstitutionTable& substitutions);
+        std::string templateArg(Expr const* expr, SubstitutionTable& substitutions);
+        std::string exprPrimary(Expr const* expr, SubstitutionTable& substitutions);
 
         std::string operatorName(OperatorType operatorType, std::string const& operatorText);
 
@@ -17,11 +17,12 @@
  */
 #include <iostream>
 #include <llvm/IR/LegacyPassManager.h>
+#include <llvm/Transforms/IPO/AlwaysInliner.h>
 #include "ObjGen.hpp"
 
 #include "llvm/Support/FileSystem.h"
 #include "llvm/Support/Host.h"
-#include "llvm/Support/TargetRegistry.h"
+#include "llvm/MC/TargetRegistry.h"
 #include "llvm/Support/TargetSelect.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Target/TargetOptions.h"
@@ -75,12 +76,16 @@ gulc::ObjFile gulc::ObjGen::generate(gulc::Module const& module) {
 
     std::string cpu = "generic";
     llvm::TargetOptions targetOptions;
+    // Section garbage collection and identical code folding both work on whole sections, every function and global
+    // needs its own section for either of them to do anything.
+    targetOptions.FunctionSections = _options.gcSections || _options.icf;
+    targetOptions.DataSections = _options.gcSections || _options.icf;
     auto objTargetMachine = target->createTargetMachine(targetTriple, cpu, "", targetOptions, llvm::Optional<llvm::Reloc::Model>());
 
     module.llvmModule->setDataLayout(objTargetMachine->createDataLayout());
 
     std::error_code errorCode;
-    llvm::raw_fd_ostream dest(filename, errorCode, llvm::sys::fs::OpenFlags::F_None);
+    llvm::raw_fd_ostream dest(filename, errorCode, llvm::sys::fs::OpenFlags::OF_None);
 
     if (errorCode) {
         std::cerr << "Could not open file: " << errorCode.message() << std::endl;
@@ -89,7 +94,11 @@ gulc::ObjFile gulc::ObjGen::generate(gulc::Module const& module) {
 
     llvm::legacy::PassManager pass;
 
-    if (objTargetMachine->addPassesToEmitFile(pass, dest, nullptr, llvm::TargetMachine::CGFT_ObjectFile)) {
+    // `CodeGen` only runs function passes, there is no inliner. `@inline` and `@flatten` mark functions and call sites
+    // `alwaysinline`, this pass is what actually honours those before the object is emitted.
+    pass.add(llvm::createAlwaysInlinerLegacyPass());
+
+    if (objTargetMachine->addPassesToEmitFile(pass, dest, nullptr, llvm::CGFT_ObjectFile)) {
         std::cerr << "Target Machine can't emit a file of this type" << std::endl;
         std::exit(1);
     }
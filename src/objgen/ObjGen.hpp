@@ -19,15 +19,22 @@
 #define GULC_OBJGEN_HPP
 
 #include <codegen/Module.hpp>
+#include <CompilerOptions.hpp>
 #include "ObjFile.hpp"
 
 namespace gulc {
     class ObjGen {
     public:
+        explicit ObjGen(CompilerOptions const& options)
+                : _options(options) {}
+
         static void init();
 
         ObjFile generate(gulc::Module const& module);
 
+    protected:
+        CompilerOptions const& _options;
+
     };
 }
 
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/xxhash.h>
+#include <algorithm>
+#include <iostream>
+#include "ASTCache.hpp"
+#include "ASTCacheFile.hpp"
+#include "ASTCacheReader.hpp"
+#include "ASTCacheWriter.hpp"
+
+std::uint64_t gulc::ASTCache::hashSource(std::string const& sourceCode) {
+    return llvm::xxHash64(sourceCode);
+}
+
+bool gulc::ASTCache::load(unsigned int fileID, unsigned int startOffset, std::uint64_t sourceHash,
+                          std::uint64_t sourceSize, ASTFile& result) const {
+    std::string cachePath = getCachePath(sourceHash);
+    // NOTE: `RequiresNullTerminator` has to be false for `MemoryBuffer` to map the file instead of reading it
+    auto bufferOrError = llvm::MemoryBuffer::getFile(cachePath, -1, false);
+
+    if (!bufferOrError) {
+        return false;
+    }
+
+    std::unique_ptr<llvm::MemoryBuffer> buffer = std::move(bufferOrError.get());
+
+    if (buffer->getBufferSize() < sizeof(ASTCacheFile::Header)) {
+        return false;
+    }
+
+    auto header = reinterpret_cast<ASTCacheFile::Header const*>(buffer->getBufferStart());
+
+    // A cache written by another version of gulc (or a hash collision) is treated the same as a missing cache, it is
+    // replaced once the file has been parsed
+    if (!std::equal(std::begin(ASTCacheFile::magic), std::end(ASTCacheFile::magic), header->magic) ||
+            header->version != ASTCacheFile::version ||
+            header->sourceHash != sourceHash || header->sourceSize != sourceSize) {
+        return false;
+    }
+
+    ASTCacheReader reader(buffer->getBufferStart(), buffer->getBufferSize());
+    std::vector<Decl*> declarations;
+
+    // A corrupt cache is a cache miss as well, the file is parsed and the cache is replaced
+    if (!reader.readDeclarations(fileID, startOffset, declarations)) {
+        std::cout << "gulc warning: AST cache `" << cachePath << "` is corrupt, it will be replaced" << std::endl;
+        return false;
+    }
+
+    result = ASTFile(fileID, std::move(declarations));
+    return true;
+}
+
+void gulc::ASTCache::store(unsigned int startOffset, std::uint64_t sourceHash, std::uint64_t sourceSize,
+                           ASTFile const& file) const {
+    ASTCacheWriter writer;
+    std::string contents = writer.writeFile(file, startOffset, sourceHash, sourceSize);
+
+    if (std::error_code errorCode = llvm::sys::fs::create_directories(_cacheDirectory)) {
+        std::cout << "gulc warning: AST cache directory `" << _cacheDirectory << "` could not be created: "
+                  << errorCode.message() << std::endl;
+        return;
+    }
+
+    // Written to a temporary file first so a concurrent build never maps a partially written cache. Every writer gets
+    // its own temporary file, two builds storing the same source would otherwise write to the same one.
+    std::string cachePath = getCachePath(sourceHash);
+    llvm::SmallString<128> temporaryPath;
+    int temporaryFD;
+    std::error_code errorCode = llvm::sys::fs::createUniqueFile(cachePath + "-%%%%%%%%.tmp", temporaryFD,
+                                                                temporaryPath);
+
+    if (errorCode) {
+        std::cout << "gulc warning: AST cache `" << cachePath << "` could not be written: "
+                  << errorCode.message() << std::endl;
+        return;
+    }
+
+    {
+        llvm::raw_fd_ostream output(temporaryFD, true);
+        output << contents;
+        output.close();
+
+        if (output.has_error()) {
+            errorCode = output.error();
+            output.clear_error();
+        }
+    }
+
+    // NOTE: `rename` replaces `cachePath` atomically, a build that loses the race just replaces the cache with an
+    //       identical one
+    if (!errorCode) {
+        errorCode = llvm::sys::fs::rename(temporaryPath, cachePath);
+    }
+
+    if (errorCode) {
+        std::cout << "gulc warning: AST cache `" << cachePath << "` could not be written: "
+                  << errorCode.message() << std::endl;
+        llvm::sys::fs::remove(temporaryPath);
+    }
+}
+
+std::string gulc::ASTCache::getCachePath(std::uint64_t sourceHash) const {
+    std::string hashString;
+    llvm::raw_string_ostream hashStream(hashString);
+    hashStream << llvm::format_hex_no_prefix(sourceHash, 16);
+    return _cacheDirectory + "/" + hashStream.str() + ".gast";
+}
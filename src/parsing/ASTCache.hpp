@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_ASTCACHE_HPP
+#define GULC_ASTCACHE_HPP
+
+#include <cstdint>
+#include <string>
+#include "ASTFile.hpp"
+
+namespace gulc {
+    /**
+     * A directory of serialized ASTs (`<hash>.gast`) keyed by the hash of the source they were parsed from
+     *
+     * Files that haven't changed since they were last parsed are rebuilt from their memory mapped cache file instead of
+     * being lexed and parsed again.
+     */
+    class ASTCache {
+    public:
+        explicit ASTCache(std::string cacheDirectory)
+                : _cacheDirectory(std::move(cacheDirectory)) {}
+
+        static std::uint64_t hashSource(std::string const& sourceCode);
+
+        /// Fills `result` with the cached AST of the source with the hash `sourceHash`, returns false if the source
+        /// isn't cached. `startOffset` is the offset `SourceManager` gave the source.
+        bool load(unsigned int fileID, unsigned int startOffset, std::uint64_t sourceHash, std::uint64_t sourceSize,
+                  ASTFile& result) const;
+        /// Caches the AST of a file that was just parsed, this has to be called before the AST is modified by any pass
+        void store(unsigned int startOffset, std::uint64_t sourceHash, std::uint64_t sourceSize,
+                   ASTFile const& file) const;
+
+    private:
+        std::string _cacheDirectory;
+
+        std::string getCachePath(std::uint64_t sourceHash) const;
+
+    };
+}
+
+#endif //GULC_ASTCACHE_HPP
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_ASTCACHEFILE_HPP
+#define GULC_ASTCACHEFILE_HPP
+
+#include <cstdint>
+
+namespace gulc {
+    /**
+     * The on-disk layout of a cached AST (`.gast`) written by `ASTCacheWriter` and read by `ASTCacheReader`. Everything
+     * is stored in the host's byte order, the file is memory mapped and the nodes are rebuilt straight from the mapping.
+     *
+     *     Header
+     *     uint32_t nodeOffsets[nodeCount]      - file offset of each node record
+     *     uint32_t stringOffsets[stringCount]  - file offset of each interned string
+     *     uint32_t declarations[declCount]     - node indexes of the top level declarations of the file
+     *     node records
+     *     string data                          - `uint32_t` length followed by the bytes of the string
+     *
+     * A node record starts with its `Node::Kind` and the kind within that node type (`Decl::Kind`, `Expr::Kind`, etc.)
+     * as one byte each, followed by the fields of the node. Child nodes are referenced by their index in the node table
+     * (`nullNode` for a missing child), records are written children first so a record only references records
+     * before it. Every string (identifiers, literal values, etc.) is interned and referenced by its index.
+     *
+     * A `TextPosition` is stored relative to the start of the file (plus one, `0` is still an unknown position) since
+     * the `SourceManager` offset of the file changes between compilations.
+     */
+    namespace ASTCacheFile {
+        constexpr char magic[4] = { 'G', 'A', 'C', '\0' };
+        // Increment whenever the layout below or the fields stored for any node change
+        constexpr std::uint32_t version = 3;
+        constexpr std::uint32_t nullNode = UINT32_MAX;
+
+        struct Header {
+            char magic[4];
+            std::uint32_t version;
+            // `xxHash64` and size of the source the AST was parsed from, a cached AST is only used when both match
+            std::uint64_t sourceHash;
+            std::uint64_t sourceSize;
+            std::uint32_t nodeCount;
+            std::uint32_t stringCount;
+            std::uint32_t declCount;
+        };
+    }
+}
+
+#endif //GULC_ASTCACHEFILE_HPP
@@ -0,0 +1,1013 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <ast/attrs/UnresolvedAttr.hpp>
+#include <ast/conts/EnsuresCont.hpp>
+#include <ast/conts/RequiresCont.hpp>
+#include <ast/conts/ThrowsCont.hpp>
+#include <ast/conts/WhereCont.hpp>
+#include <ast/decls/CallOperatorDecl.hpp>
+#include <ast/decls/ConstructorDecl.hpp>
+#include <ast/decls/DestructorDecl.hpp>
+#include <ast/decls/EnumConstDecl.hpp>
+#include <ast/decls/EnumDecl.hpp>
+#include <ast/decls/ExtensionDecl.hpp>
+#include <ast/decls/FunctionDecl.hpp>
+#include <ast/decls/ImportDecl.hpp>
+#include <ast/decls/NamespaceDecl.hpp>
+#include <ast/decls/OperatorDecl.hpp>
+#include <ast/decls/ParameterDecl.hpp>
+#include <ast/decls/PropertyDecl.hpp>
+#include <ast/decls/PropertyGetDecl.hpp>
+#include <ast/decls/PropertySetDecl.hpp>
+#include <ast/decls/StructDecl.hpp>
+#include <ast/decls/SubscriptOperatorDecl.hpp>
+#include <ast/decls/SubscriptOperatorGetDecl.hpp>
+#include <ast/decls/SubscriptOperatorSetDecl.hpp>
+#include <ast/decls/TemplateFunctionDecl.hpp>
+#include <ast/decls/TemplateParameterDecl.hpp>
+#include <ast/decls/TemplateStructDecl.hpp>
+#include <ast/decls/TemplateTraitDecl.hpp>
+#include <ast/decls/TraitDecl.hpp>
+#include <ast/decls/TraitPrototypeDecl.hpp>
+#include <ast/decls/TypeAliasDecl.hpp>
+#include <ast/decls/TypeSuffixDecl.hpp>
+#include <ast/decls/VariableDecl.hpp>
+#include <ast/exprs/ArrayLiteralExpr.hpp>
+#include <ast/exprs/AsExpr.hpp>
+#include <ast/exprs/AssignmentOperatorExpr.hpp>
+#include <ast/exprs/BoolLiteralExpr.hpp>
+#include <ast/exprs/CheckExtendsTypeExpr.hpp>
+#include <ast/exprs/DeleteExpr.hpp>
+#include <ast/exprs/FunctionCallExpr.hpp>
+#include <ast/exprs/HasExpr.hpp>
+#include <ast/exprs/IdentifierExpr.hpp>
+#include <ast/exprs/InfixOperatorExpr.hpp>
+#include <ast/exprs/IsExpr.hpp>
+#include <ast/exprs/LabeledArgumentExpr.hpp>
+#include <ast/exprs/MemberAccessCallExpr.hpp>
+#include <ast/exprs/NewExpr.hpp>
+#include <ast/exprs/ParenExpr.hpp>
+#include <ast/exprs/PostfixOperatorExpr.hpp>
+#include <ast/exprs/PrefixOperatorExpr.hpp>
+#include <ast/exprs/RefExpr.hpp>
+#include <ast/exprs/SubscriptCallExpr.hpp>
+#include <ast/exprs/TernaryExpr.hpp>
+#include <ast/exprs/TryExpr.hpp>
+#include <ast/exprs/TypeExpr.hpp>
+#include <ast/exprs/ValueLiteralExpr.hpp>
+#include <ast/exprs/VariableDeclExpr.hpp>
+#include <ast/stmts/BreakStmt.hpp>
+#include <ast/stmts/CaseStmt.hpp>
+#include <ast/stmts/CatchStmt.hpp>
+#include <ast/stmts/CompoundStmt.hpp>
+#include <ast/stmts/ContinueStmt.hpp>
+#include <ast/stmts/DoCatchStmt.hpp>
+#include <ast/stmts/DoStmt.hpp>
+#include <ast/stmts/FallthroughStmt.hpp>
+#include <ast/stmts/ForStmt.hpp>
+#include <ast/stmts/GotoStmt.hpp>
+#include <ast/stmts/IfStmt.hpp>
+#include <ast/stmts/LabeledStmt.hpp>
+#include <ast/stmts/RepeatWhileStmt.hpp>
+#include <ast/stmts/ReturnStmt.hpp>
+#include <ast/stmts/SwitchStmt.hpp>
+#include <ast/stmts/ThrowStmt.hpp>
+#include <ast/stmts/WhileStmt.hpp>
+#include <ast/types/DimensionType.hpp>
+#include <ast/types/PointerType.hpp>
+#include <ast/types/ReferenceType.hpp>
+#include <ast/types/UnresolvedNestedType.hpp>
+#include <ast/types/UnresolvedType.hpp>
+#include <cstring>
+#include <iostream>
+#include "ASTCacheReader.hpp"
+
+gulc::ASTCacheReader::ASTCacheReader(char const* data, std::size_t size)
+        : _data(data), _size(size), _header(reinterpret_cast<ASTCacheFile::Header const*>(data)),
+          _nodeOffsets(nullptr), _stringOffsets(nullptr), _declarations(nullptr), _sourceFileID(0), _startOffset(0) {}
+
+bool gulc::ASTCacheReader::readDeclarations(unsigned int sourceFileID, unsigned int startOffset,
+                                            std::vector<Decl*>& result) {
+    _sourceFileID = sourceFileID;
+    _startOffset = startOffset;
+
+    std::size_t nodeTableOffset = sizeof(ASTCacheFile::Header);
+    std::size_t stringTableOffset = nodeTableOffset + _header->nodeCount * sizeof(std::uint32_t);
+    std::size_t declTableOffset = stringTableOffset + _header->stringCount * sizeof(std::uint32_t);
+
+    if (declTableOffset + _header->declCount * sizeof(std::uint32_t) > _size) {
+        return false;
+    }
+
+    _nodeOffsets = reinterpret_cast<std::uint32_t const*>(_data + nodeTableOffset);
+    _stringOffsets = reinterpret_cast<std::uint32_t const*>(_data + stringTableOffset);
+    _declarations = reinterpret_cast<std::uint32_t const*>(_data + declTableOffset);
+
+    result.reserve(_header->declCount);
+
+    try {
+        for (std::uint32_t i = 0; i < _header->declCount; ++i) {
+            Decl* decl = readDecl(_declarations[i]);
+
+            if (decl == nullptr) {
+                throwCorruptError();
+            }
+
+            result.push_back(decl);
+        }
+    } catch (CorruptCacheError const&) {
+        // NOTE: The nodes of the declaration being read when the error was found are lost, the cache only ends up
+        //       corrupt when it was damaged outside of gulc so this isn't worth tracking every partially read node
+        for (Decl* decl : result) {
+            delete decl;
+        }
+
+        result.clear();
+        return false;
+    }
+
+    return true;
+}
+
+void gulc::ASTCacheReader::throwCorruptError() const {
+    throw CorruptCacheError();
+}
+
+gulc::ASTCacheReader::Record gulc::ASTCacheReader::getRecord(std::uint32_t index, Node::Kind nodeKind) const {
+    if (index >= _header->nodeCount || _nodeOffsets[index] >= _size) {
+        throwCorruptError();
+    }
+
+    // Records are only ever followed by other records or the strings so the end of the file is a safe bound
+    Record result { _data + _nodeOffsets[index], _data + _size };
+
+    if (static_cast<Node::Kind>(readU8(result)) != nodeKind) {
+        throwCorruptError();
+    }
+
+    return result;
+}
+
+std::uint8_t gulc::ASTCacheReader::readU8(Record& record) const {
+    if (record.current + 1 > record.end) {
+        throwCorruptError();
+    }
+
+    return static_cast<std::uint8_t>(*record.current++);
+}
+
+std::uint32_t gulc::ASTCacheReader::readU32(Record& record) const {
+    std::uint32_t result;
+
+    if (record.current + sizeof(result) > record.end) {
+        throwCorruptError();
+    }
+
+    // Records aren't padded, the value might not be aligned
+    std::memcpy(&result, record.current, sizeof(result));
+    record.current += sizeof(result);
+    return result;
+}
+
+bool gulc::ASTCacheReader::readBool(Record& record) const {
+    return readU8(record) != 0;
+}
+
+std::string gulc::ASTCacheReader::readString(Record& record) const {
+    std::uint32_t index = readU32(record);
+
+    if (index >= _header->stringCount) {
+        throwCorruptError();
+    }
+
+    Record stringRecord { _data + _stringOffsets[index], _data + _size };
+
+    if (_stringOffsets[index] >= _size) {
+        throwCorruptError();
+    }
+
+    std::uint32_t length = readU32(stringRecord);
+
+    if (length > static_cast<std::size_t>(stringRecord.end - stringRecord.current)) {
+        throwCorruptError();
+    }
+
+    return std::string(stringRecord.current, length);
+}
+
+gulc::TextPosition gulc::ASTCacheReader::readTextPosition(Record& record) const {
+    std::uint32_t fileIndex = readU32(record);
+
+    if (fileIndex == 0) {
+        return TextPosition();
+    }
+
+    return TextPosition(_startOffset + fileIndex - 1);
+}
+
+gulc::Identifier gulc::ASTCacheReader::readIdentifier(Record& record) const {
+    std::string name = readString(record);
+    TextPosition startPosition = readTextPosition(record);
+    TextPosition endPosition = readTextPosition(record);
+    return Identifier(startPosition, endPosition, std::move(name));
+}
+
+std::vector<gulc::Identifier> gulc::ASTCacheReader::readIdentifiers(Record& record) const {
+    std::uint32_t count = readU32(record);
+    std::vector<Identifier> result;
+    result.reserve(count);
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        result.push_back(readIdentifier(record));
+    }
+
+    return result;
+}
+
+gulc::ASTCacheReader::FunctionBase gulc::ASTCacheReader::readFunctionBase(Record& record) {
+    FunctionBase result;
+    result.parameters = readDeclRefs<ParameterDecl>(record);
+    result.returnType = readType(readU32(record));
+    result.contracts = readContRefs(record);
+    result.body = readStmtRefAs<CompoundStmt>(record);
+    result.startPosition = readTextPosition(record);
+    result.endPosition = readTextPosition(record);
+    return result;
+}
+
+std::vector<gulc::Attr*> gulc::ASTCacheReader::readAttrRefs(Record& record) {
+    std::uint32_t count = readU32(record);
+    std::vector<Attr*> result;
+    result.reserve(count);
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        result.push_back(readAttr(readU32(record)));
+    }
+
+    return result;
+}
+
+std::vector<gulc::Cont*> gulc::ASTCacheReader::readContRefs(Record& record) {
+    std::uint32_t count = readU32(record);
+    std::vector<Cont*> result;
+    result.reserve(count);
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        result.push_back(readCont(readU32(record)));
+    }
+
+    return result;
+}
+
+std::vector<gulc::Expr*> gulc::ASTCacheReader::readExprRefs(Record& record) {
+    std::uint32_t count = readU32(record);
+    std::vector<Expr*> result;
+    result.reserve(count);
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        result.push_back(readExpr(readU32(record)));
+    }
+
+    return result;
+}
+
+std::vector<gulc::Stmt*> gulc::ASTCacheReader::readStmtRefs(Record& record) {
+    std::uint32_t count = readU32(record);
+    std::vector<Stmt*> result;
+    result.reserve(count);
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        result.push_back(readStmt(readU32(record)));
+    }
+
+    return result;
+}
+
+std::vector<gulc::Type*> gulc::ASTCacheReader::readTypeRefs(Record& record) {
+    std::uint32_t count = readU32(record);
+    std::vector<Type*> result;
+    result.reserve(count);
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        result.push_back(readType(readU32(record)));
+    }
+
+    return result;
+}
+
+// NOTE: The fields of every record are read into locals in the order they were written, function arguments are
+//       evaluated in an unspecified order so the `read*` calls can't be made within the constructor calls.
+
+gulc::Attr* gulc::ASTCacheReader::readAttr(std::uint32_t index) {
+    if (index == ASTCacheFile::nullNode) return nullptr;
+
+    Record record = getRecord(index, Node::Kind::Attr);
+    auto attrKind = static_cast<Attr::Kind>(readU8(record));
+    TextPosition startPosition = readTextPosition(record);
+    TextPosition endPosition = readTextPosition(record);
+
+    switch (attrKind) {
+        case Attr::Kind::Unresolved: {
+            std::vector<Identifier> namespacePath = readIdentifiers(record);
+            Identifier identifier = readIdentifier(record);
+            std::vector<Expr*> arguments = readExprRefs(record);
+            return new UnresolvedAttr(startPosition, endPosition, namespacePath, identifier, arguments);
+        }
+        default:
+            throwCorruptError();
+            return nullptr;
+    }
+}
+
+gulc::Cont* gulc::ASTCacheReader::readCont(std::uint32_t index) {
+    if (index == ASTCacheFile::nullNode) return nullptr;
+
+    Record record = getRecord(index, Node::Kind::Cont);
+    auto contKind = static_cast<Cont::Kind>(readU8(record));
+    TextPosition startPosition = readTextPosition(record);
+    TextPosition endPosition = readTextPosition(record);
+
+    switch (contKind) {
+        case Cont::Kind::Requires:
+            return new RequiresCont(readExpr(readU32(record)), startPosition, endPosition);
+        case Cont::Kind::Ensures:
+            return new EnsuresCont(readExpr(readU32(record)), startPosition, endPosition);
+        case Cont::Kind::Throws:
+            return new ThrowsCont(startPosition, endPosition, readType(readU32(record)));
+        case Cont::Kind::Where:
+            return new WhereCont(readExpr(readU32(record)), startPosition, endPosition);
+        default:
+            throwCorruptError();
+            return nullptr;
+    }
+}
+
+gulc::Decl* gulc::ASTCacheReader::readDecl(std::uint32_t index) {
+    if (index == ASTCacheFile::nullNode) return nullptr;
+
+    Record record = getRecord(index, Node::Kind::Decl);
+    auto declKind = static_cast<Decl::Kind>(readU8(record));
+    std::vector<Attr*> attributes = readAttrRefs(record);
+    auto visibility = static_cast<Decl::Visibility>(readU8(record));
+    bool isConstExpr = readBool(record);
+    Identifier identifier = readIdentifier(record);
+    auto declModifiers = static_cast<DeclModifiers>(readU32(record));
+
+    switch (declKind) {
+        case Decl::Kind::Import: {
+            TextPosition importStartPosition = readTextPosition(record);
+            TextPosition importEndPosition = readTextPosition(record);
+            std::vector<Identifier> importPath = readIdentifiers(record);
+
+            if (readBool(record)) {
+                TextPosition asStartPosition = readTextPosition(record);
+                TextPosition asEndPosition = readTextPosition(record);
+                Identifier importAlias = readIdentifier(record);
+                return new ImportDecl(_sourceFileID, attributes, importStartPosition, importEndPosition, importPath,
+                                      asStartPosition, asEndPosition, importAlias);
+            }
+
+            return new ImportDecl(_sourceFileID, attributes, importStartPosition, importEndPosition, importPath);
+        }
+        case Decl::Kind::Function: {
+            FunctionBase base = readFunctionBase(record);
+            return new FunctionDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier, declModifiers,
+                                    base.parameters, base.returnType, base.contracts, base.body,
+                                    base.startPosition, base.endPosition);
+        }
+        case Decl::Kind::CallOperator: {
+            FunctionBase base = readFunctionBase(record);
+            return new CallOperatorDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier, declModifiers,
+                                        base.parameters, base.returnType, base.contracts, base.body,
+                                        base.startPosition, base.endPosition);
+        }
+        case Decl::Kind::TypeSuffix: {
+            FunctionBase base = readFunctionBase(record);
+            return new TypeSuffixDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier, declModifiers,
+                                      base.parameters, base.returnType, base.contracts, base.body,
+                                      base.startPosition, base.endPosition);
+        }
+        case Decl::Kind::TemplateFunction: {
+            FunctionBase base = readFunctionBase(record);
+            std::vector<TemplateParameterDecl*> templateParameters = readDeclRefs<TemplateParameterDecl>(record);
+            return new TemplateFunctionDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier,
+                                            declModifiers, base.parameters, base.returnType, base.contracts,
+                                            base.body, base.startPosition, base.endPosition, templateParameters);
+        }
+        case Decl::Kind::Operator: {
+            FunctionBase base = readFunctionBase(record);
+            auto operatorType = static_cast<OperatorType>(readU8(record));
+            Identifier operatorIdentifier = readIdentifier(record);
+            return new OperatorDecl(_sourceFileID, attributes, visibility, isConstExpr, operatorType,
+                                    operatorIdentifier, declModifiers, base.parameters, base.returnType,
+                                    base.contracts, base.body, base.startPosition, base.endPosition);
+        }
+        case Decl::Kind::Constructor: {
+            FunctionBase base = readFunctionBase(record);
+            auto baseConstructorCall = readExprRefAs<FunctionCallExpr>(record);
+            auto constructorType = static_cast<ConstructorType>(readU8(record));
+            return new ConstructorDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier, declModifiers,
+                                       base.parameters, baseConstructorCall, base.contracts, base.body,
+                                       base.startPosition, base.endPosition, constructorType);
+        }
+        case Decl::Kind::Destructor: {
+            FunctionBase base = readFunctionBase(record);
+            return new DestructorDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier, declModifiers,
+                                      base.contracts, base.body, base.startPosition, base.endPosition);
+        }
+        case Decl::Kind::PropertyGet: {
+            FunctionBase base = readFunctionBase(record);
+            auto getResult = static_cast<PropertyGetDecl::GetResult>(readU8(record));
+            return new PropertyGetDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier, declModifiers,
+                                       base.returnType, base.contracts, base.body,
+                                       base.startPosition, base.endPosition, getResult);
+        }
+        case Decl::Kind::SubscriptOperatorGet: {
+            FunctionBase base = readFunctionBase(record);
+            auto getResult = static_cast<SubscriptOperatorGetDecl::GetResult>(readU8(record));
+            return new SubscriptOperatorGetDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier,
+                                                declModifiers, base.returnType, base.contracts, base.body,
+                                                base.startPosition, base.endPosition, getResult);
+        }
+        case Decl::Kind::PropertySet:
+        case Decl::Kind::SubscriptOperatorSet: {
+            FunctionBase base = readFunctionBase(record);
+
+            // The setters create their own parameter from the parameter type, we only keep the type of ours
+            if (base.parameters.size() != 1 || base.parameters[0]->type == nullptr) {
+                throwCorruptError();
+            }
+
+            Type* paramType = base.parameters[0]->type;
+            base.parameters[0]->type = nullptr;
+            delete base.parameters[0];
+
+            if (declKind == Decl::Kind::PropertySet) {
+                return new PropertySetDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier,
+                                           declModifiers, paramType, base.contracts, base.body,
+                                           base.startPosition, base.endPosition);
+            } else {
+                return new SubscriptOperatorSetDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier,
+                                                    declModifiers, paramType, base.contracts, base.body,
+                                                    base.startPosition, base.endPosition);
+            }
+        }
+        case Decl::Kind::Property: {
+            Type* type = readType(readU32(record));
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            std::vector<PropertyGetDecl*> getters = readDeclRefs<PropertyGetDecl>(record);
+            auto setter = readDeclRefAs<PropertySetDecl>(record);
+            return new PropertyDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier, type,
+                                    startPosition, endPosition, declModifiers, getters, setter);
+        }
+        case Decl::Kind::SubscriptOperator: {
+            std::vector<ParameterDecl*> parameters = readDeclRefs<ParameterDecl>(record);
+            Type* type = readType(readU32(record));
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            std::vector<SubscriptOperatorGetDecl*> getters = readDeclRefs<SubscriptOperatorGetDecl>(record);
+            auto setter = readDeclRefAs<SubscriptOperatorSetDecl>(record);
+            return new SubscriptOperatorDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier,
+                                             parameters, type, startPosition, endPosition, declModifiers,
+                                             getters, setter);
+        }
+        case Decl::Kind::Struct:
+        case Decl::Kind::TemplateStruct: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            auto structKind = static_cast<StructDecl::Kind>(readU8(record));
+            std::vector<Type*> inheritedTypes = readTypeRefs(record);
+            std::vector<Cont*> contracts = readContRefs(record);
+            std::vector<Decl*> ownedMembers = readDeclRefs<Decl>(record);
+            std::vector<ConstructorDecl*> constructors = readDeclRefs<ConstructorDecl>(record);
+            auto destructor = readDeclRefAs<DestructorDecl>(record);
+
+            if (declKind == Decl::Kind::TemplateStruct) {
+                std::vector<TemplateParameterDecl*> templateParameters = readDeclRefs<TemplateParameterDecl>(record);
+                return new TemplateStructDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier,
+                                              declModifiers, startPosition, endPosition, structKind, inheritedTypes,
+                                              contracts, ownedMembers, constructors, destructor, templateParameters);
+            }
+
+            return new StructDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier, declModifiers,
+                                  startPosition, endPosition, structKind, inheritedTypes, contracts, ownedMembers,
+                                  constructors, destructor);
+        }
+        case Decl::Kind::Trait:
+        case Decl::Kind::TemplateTrait: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            std::vector<Type*> inheritedTypes = readTypeRefs(record);
+            std::vector<Cont*> contracts = readContRefs(record);
+            std::vector<Decl*> ownedMembers = readDeclRefs<Decl>(record);
+
+            if (declKind == Decl::Kind::TemplateTrait) {
+                std::vector<TemplateParameterDecl*> templateParameters = readDeclRefs<TemplateParameterDecl>(record);
+                return new TemplateTraitDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier,
+                                             declModifiers, startPosition, endPosition, inheritedTypes, contracts,
+                                             ownedMembers, templateParameters);
+            }
+
+            return new TraitDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier, declModifiers,
+                                 startPosition, endPosition, inheritedTypes, contracts, ownedMembers);
+        }
+        case Decl::Kind::TraitPrototype: {
+            Type* traitType = readType(readU32(record));
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new TraitPrototypeDecl(_sourceFileID, attributes, traitType, startPosition, endPosition);
+        }
+        case Decl::Kind::Extension: {
+            Type* typeToExtend = readType(readU32(record));
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            std::vector<Type*> inheritedTypes = readTypeRefs(record);
+            std::vector<Cont*> contracts = readContRefs(record);
+            std::vector<Decl*> ownedMembers = readDeclRefs<Decl>(record);
+            std::vector<ConstructorDecl*> constructors = readDeclRefs<ConstructorDecl>(record);
+            return new ExtensionDecl(_sourceFileID, attributes, visibility, isConstExpr, declModifiers, typeToExtend,
+                                     startPosition, endPosition, inheritedTypes, contracts, ownedMembers,
+                                     constructors);
+        }
+        case Decl::Kind::TypeAlias: {
+            auto typeAliasType = static_cast<TypeAliasType>(readU8(record));
+            std::vector<TemplateParameterDecl*> templateParameters = readDeclRefs<TemplateParameterDecl>(record);
+            Type* typeValue = readType(readU32(record));
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new TypeAliasDecl(_sourceFileID, attributes, visibility, typeAliasType, identifier,
+                                     templateParameters, typeValue, startPosition, endPosition);
+        }
+        case Decl::Kind::Namespace: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            std::vector<Decl*> nestedDecls = readDeclRefs<Decl>(record);
+            return new NamespaceDecl(_sourceFileID, attributes, identifier, startPosition, endPosition, false,
+                                     nestedDecls);
+        }
+        case Decl::Kind::Enum: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            Type* constType = readType(readU32(record));
+            std::vector<EnumConstDecl*> enumConsts = readDeclRefs<EnumConstDecl>(record);
+            std::vector<Decl*> ownedMembers = readDeclRefs<Decl>(record);
+            return new EnumDecl(_sourceFileID, attributes, identifier, startPosition, endPosition, constType,
+                                enumConsts, ownedMembers);
+        }
+        case Decl::Kind::EnumConst: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            Expr* constValue = readExpr(readU32(record));
+            return new EnumConstDecl(_sourceFileID, attributes, identifier, startPosition, endPosition, constValue);
+        }
+        case Decl::Kind::Variable: {
+            Type* type = readType(readU32(record));
+            Expr* initialValue = readExpr(readU32(record));
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new VariableDecl(_sourceFileID, attributes, visibility, isConstExpr, identifier, declModifiers,
+                                    type, initialValue, startPosition, endPosition);
+        }
+        case Decl::Kind::Parameter: {
+            Identifier argumentLabel = readIdentifier(record);
+            Type* type = readType(readU32(record));
+            Expr* defaultValue = readExpr(readU32(record));
+            auto parameterKind = static_cast<ParameterDecl::ParameterKind>(readU8(record));
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new ParameterDecl(_sourceFileID, attributes, argumentLabel, identifier, type, defaultValue,
+                                     parameterKind, startPosition, endPosition);
+        }
+        case Decl::Kind::TemplateParameter: {
+            auto templateParameterKind = static_cast<TemplateParameterDecl::TemplateParameterKind>(readU8(record));
+            Type* type = readType(readU32(record));
+            Expr* defaultValue = readExpr(readU32(record));
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new TemplateParameterDecl(_sourceFileID, attributes, templateParameterKind, identifier, type,
+                                             defaultValue, startPosition, endPosition);
+        }
+        default:
+            throwCorruptError();
+            return nullptr;
+    }
+}
+
+gulc::Expr* gulc::ASTCacheReader::readExpr(std::uint32_t index) {
+    if (index == ASTCacheFile::nullNode) return nullptr;
+
+    Record record = getRecord(index, Node::Kind::Expr);
+    auto exprKind = static_cast<Expr::Kind>(readU8(record));
+
+    switch (exprKind) {
+        case Expr::Kind::ArrayLiteral: {
+            std::vector<Expr*> indexes = readExprRefs(record);
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new ArrayLiteralExpr(indexes, startPosition, endPosition);
+        }
+        case Expr::Kind::As: {
+            Expr* expr = readExpr(readU32(record));
+            Type* asType = readType(readU32(record));
+            TextPosition asStartPosition = readTextPosition(record);
+            TextPosition asEndPosition = readTextPosition(record);
+            return new AsExpr(expr, asType, asStartPosition, asEndPosition);
+        }
+        case Expr::Kind::AssignmentOperator: {
+            Expr* leftValue = readExpr(readU32(record));
+            Expr* rightValue = readExpr(readU32(record));
+            bool hasNestedOperator = readBool(record);
+            auto nestedOperator = static_cast<InfixOperators>(readU8(record));
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+
+            if (hasNestedOperator) {
+                return new AssignmentOperatorExpr(leftValue, rightValue, nestedOperator, startPosition, endPosition);
+            }
+
+            return new AssignmentOperatorExpr(leftValue, rightValue, startPosition, endPosition);
+        }
+        case Expr::Kind::BoolLiteral: {
+            bool value = readBool(record);
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new BoolLiteralExpr(startPosition, endPosition, value);
+        }
+        case Expr::Kind::CheckExtendsType: {
+            Type* checkType = readType(readU32(record));
+            Type* extendsType = readType(readU32(record));
+            TextPosition extendsStartPosition = readTextPosition(record);
+            TextPosition extendsEndPosition = readTextPosition(record);
+            return new CheckExtendsTypeExpr(checkType, extendsType, extendsStartPosition, extendsEndPosition);
+        }
+        case Expr::Kind::Delete: {
+            Expr* pointer = readExpr(readU32(record));
+            TextPosition deleteStartPosition = readTextPosition(record);
+            TextPosition deleteEndPosition = readTextPosition(record);
+            return new DeleteExpr(pointer, deleteStartPosition, deleteEndPosition);
+        }
+        case Expr::Kind::FunctionCall: {
+            Expr* functionReference = readExpr(readU32(record));
+            std::uint32_t argumentCount = readU32(record);
+            std::vector<LabeledArgumentExpr*> arguments;
+            arguments.reserve(argumentCount);
+
+            for (std::uint32_t i = 0; i < argumentCount; ++i) {
+                arguments.push_back(readExprRefAs<LabeledArgumentExpr>(record));
+            }
+
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new FunctionCallExpr(functionReference, arguments, startPosition, endPosition);
+        }
+        case Expr::Kind::Has: {
+            Expr* expr = readExpr(readU32(record));
+            Decl* decl = readDecl(readU32(record));
+            TextPosition hasStartPosition = readTextPosition(record);
+            TextPosition hasEndPosition = readTextPosition(record);
+            return new HasExpr(expr, decl, hasStartPosition, hasEndPosition);
+        }
+        case Expr::Kind::Identifier: {
+            Identifier identifier = readIdentifier(record);
+            std::vector<Expr*> templateArguments = readExprRefs(record);
+            return new IdentifierExpr(identifier, templateArguments);
+        }
+        case Expr::Kind::InfixOperator: {
+            auto infixOperator = static_cast<InfixOperators>(readU8(record));
+            Expr* leftValue = readExpr(readU32(record));
+            Expr* rightValue = readExpr(readU32(record));
+            return new InfixOperatorExpr(infixOperator, leftValue, rightValue);
+        }
+        case Expr::Kind::Is: {
+            Expr* expr = readExpr(readU32(record));
+            Type* isType = readType(readU32(record));
+            TextPosition isStartPosition = readTextPosition(record);
+            TextPosition isEndPosition = readTextPosition(record);
+            return new IsExpr(expr, isType, isStartPosition, isEndPosition);
+        }
+        case Expr::Kind::LabeledArgument: {
+            Identifier label = readIdentifier(record);
+            Expr* argument = readExpr(readU32(record));
+            return new LabeledArgumentExpr(label, argument);
+        }
+        case Expr::Kind::MemberAccessCall: {
+            bool isArrowCall = readBool(record);
+            Expr* objectRef = readExpr(readU32(record));
+            auto member = readExprRefAs<IdentifierExpr>(record);
+            return new MemberAccessCallExpr(isArrowCall, objectRef, member);
+        }
+        case Expr::Kind::New: {
+            Expr* initializer = readExpr(readU32(record));
+            TextPosition newStartPosition = readTextPosition(record);
+            TextPosition newEndPosition = readTextPosition(record);
+            return new NewExpr(initializer, newStartPosition, newEndPosition);
+        }
+        case Expr::Kind::Paren: {
+            Expr* nestedExpr = readExpr(readU32(record));
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new ParenExpr(nestedExpr, startPosition, endPosition);
+        }
+        case Expr::Kind::PostfixOperator: {
+            auto postfixOperator = static_cast<PostfixOperators>(readU8(record));
+            Expr* nestedExpr = readExpr(readU32(record));
+            TextPosition operatorStartPosition = readTextPosition(record);
+            TextPosition operatorEndPosition = readTextPosition(record);
+            return new PostfixOperatorExpr(postfixOperator, nestedExpr, operatorStartPosition, operatorEndPosition);
+        }
+        case Expr::Kind::PrefixOperator: {
+            auto prefixOperator = static_cast<PrefixOperators>(readU8(record));
+            Expr* nestedExpr = readExpr(readU32(record));
+            TextPosition operatorStartPosition = readTextPosition(record);
+            TextPosition operatorEndPosition = readTextPosition(record);
+            return new PrefixOperatorExpr(prefixOperator, nestedExpr, operatorStartPosition, operatorEndPosition);
+        }
+        case Expr::Kind::Ref: {
+            bool isMutable = readBool(record);
+            Expr* nestedExpr = readExpr(readU32(record));
+            TextPosition refStartPosition = readTextPosition(record);
+            TextPosition refEndPosition = readTextPosition(record);
+            return new RefExpr(isMutable, nestedExpr, refStartPosition, refEndPosition);
+        }
+        case Expr::Kind::SubscriptCall: {
+            Expr* subscriptReference = readExpr(readU32(record));
+            std::uint32_t argumentCount = readU32(record);
+            std::vector<LabeledArgumentExpr*> arguments;
+            arguments.reserve(argumentCount);
+
+            for (std::uint32_t i = 0; i < argumentCount; ++i) {
+                arguments.push_back(readExprRefAs<LabeledArgumentExpr>(record));
+            }
+
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new SubscriptCallExpr(subscriptReference, arguments, startPosition, endPosition);
+        }
+        case Expr::Kind::Ternary: {
+            Expr* condition = readExpr(readU32(record));
+            Expr* trueExpr = readExpr(readU32(record));
+            Expr* falseExpr = readExpr(readU32(record));
+            return new TernaryExpr(condition, trueExpr, falseExpr);
+        }
+        case Expr::Kind::Try: {
+            Expr* nestedExpr = readExpr(readU32(record));
+            TextPosition tryStartPosition = readTextPosition(record);
+            TextPosition tryEndPosition = readTextPosition(record);
+            return new TryExpr(nestedExpr, tryStartPosition, tryEndPosition);
+        }
+        case Expr::Kind::Type:
+            return new TypeExpr(readType(readU32(record)));
+        case Expr::Kind::ValueLiteral: {
+            auto literalType = static_cast<ValueLiteralExpr::LiteralType>(readU8(record));
+            std::string value = readString(record);
+            std::string suffix = readString(record);
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new ValueLiteralExpr(literalType, value, suffix, startPosition, endPosition);
+        }
+        case Expr::Kind::VariableDecl: {
+            Identifier identifier = readIdentifier(record);
+            Type* type = readType(readU32(record));
+            Expr* initialValue = readExpr(readU32(record));
+            bool isAssignable = readBool(record);
+            auto initialValueAssignmentType = static_cast<InitialValueAssignmentType>(readU8(record));
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            auto result = new VariableDeclExpr(identifier, type, initialValue, isAssignable,
+                                               startPosition, endPosition);
+            result->initialValueAssignmentType = initialValueAssignmentType;
+            return result;
+        }
+        default:
+            throwCorruptError();
+            return nullptr;
+    }
+}
+
+gulc::Stmt* gulc::ASTCacheReader::readStmt(std::uint32_t index) {
+    if (index == ASTCacheFile::nullNode) return nullptr;
+
+    // Expressions used as statements are stored as expressions
+    if (index < _header->nodeCount && _nodeOffsets[index] < _size &&
+            static_cast<Node::Kind>(_data[_nodeOffsets[index]]) == Node::Kind::Expr) {
+        return readExpr(index);
+    }
+
+    Record record = getRecord(index, Node::Kind::Stmt);
+    auto stmtKind = static_cast<Stmt::Kind>(readU8(record));
+
+    switch (stmtKind) {
+        case Stmt::Kind::Break: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+
+            if (readBool(record)) {
+                return new BreakStmt(startPosition, endPosition, readIdentifier(record));
+            }
+
+            return new BreakStmt(startPosition, endPosition);
+        }
+        case Stmt::Kind::Case: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            bool isDefault = readBool(record);
+            Expr* condition = readExpr(readU32(record));
+            std::vector<Stmt*> body = readStmtRefs(record);
+            return new CaseStmt(startPosition, endPosition, isDefault, condition, body);
+        }
+        case Stmt::Kind::Catch: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            auto body = readStmtRefAs<CompoundStmt>(record);
+            Type* exceptionType = readType(readU32(record));
+
+            if (readBool(record)) {
+                return new CatchStmt(startPosition, endPosition, body, exceptionType, readIdentifier(record));
+            }
+
+            return new CatchStmt(startPosition, endPosition, body, exceptionType);
+        }
+        case Stmt::Kind::Compound: {
+            std::vector<Stmt*> statements = readStmtRefs(record);
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new CompoundStmt(statements, startPosition, endPosition);
+        }
+        case Stmt::Kind::Continue: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+
+            if (readBool(record)) {
+                return new ContinueStmt(startPosition, endPosition, readIdentifier(record));
+            }
+
+            return new ContinueStmt(startPosition, endPosition);
+        }
+        case Stmt::Kind::Do: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            auto body = readStmtRefAs<CompoundStmt>(record);
+            return new DoStmt(startPosition, endPosition, body);
+        }
+        case Stmt::Kind::DoCatch: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            auto body = readStmtRefAs<CompoundStmt>(record);
+            std::uint32_t catchCount = readU32(record);
+            std::vector<CatchStmt*> catchStatements;
+            catchStatements.reserve(catchCount);
+
+            for (std::uint32_t i = 0; i < catchCount; ++i) {
+                catchStatements.push_back(readStmtRefAs<CatchStmt>(record));
+            }
+
+            auto finallyStatement = readStmtRefAs<CompoundStmt>(record);
+            return new DoCatchStmt(startPosition, endPosition, body, catchStatements, finallyStatement);
+        }
+        case Stmt::Kind::Fallthrough: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new FallthroughStmt(startPosition, endPosition);
+        }
+        case Stmt::Kind::For: {
+            Expr* init = readExpr(readU32(record));
+            Expr* condition = readExpr(readU32(record));
+            Expr* iteration = readExpr(readU32(record));
+            auto body = readStmtRefAs<CompoundStmt>(record);
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new ForStmt(init, condition, iteration, body, startPosition, endPosition);
+        }
+        case Stmt::Kind::Goto: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            Identifier label = readIdentifier(record);
+            return new GotoStmt(startPosition, endPosition, label);
+        }
+        case Stmt::Kind::If: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            Expr* condition = readExpr(readU32(record));
+            auto trueBody = readStmtRefAs<CompoundStmt>(record);
+            Stmt* falseBody = readStmt(readU32(record));
+            auto result = new IfStmt(startPosition, endPosition, condition, trueBody, falseBody);
+            result->attributes = readAttrRefs(record);
+            return result;
+        }
+        case Stmt::Kind::Labeled: {
+            Identifier label = readIdentifier(record);
+            Stmt* labeledStmt = readStmt(readU32(record));
+            return new LabeledStmt(label, labeledStmt);
+        }
+        case Stmt::Kind::RepeatWhile: {
+            auto body = readStmtRefAs<CompoundStmt>(record);
+            Expr* condition = readExpr(readU32(record));
+            TextPosition repeatStartPosition = readTextPosition(record);
+            TextPosition repeatEndPosition = readTextPosition(record);
+            TextPosition whileStartPosition = readTextPosition(record);
+            TextPosition whileEndPosition = readTextPosition(record);
+            return new RepeatWhileStmt(body, condition, repeatStartPosition, repeatEndPosition,
+                                       whileStartPosition, whileEndPosition);
+        }
+        case Stmt::Kind::Return: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            Expr* returnValue = readExpr(readU32(record));
+            return new ReturnStmt(startPosition, endPosition, returnValue);
+        }
+        case Stmt::Kind::Switch: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            Expr* condition = readExpr(readU32(record));
+            std::uint32_t caseCount = readU32(record);
+            std::vector<CaseStmt*> cases;
+            cases.reserve(caseCount);
+
+            for (std::uint32_t i = 0; i < caseCount; ++i) {
+                cases.push_back(readStmtRefAs<CaseStmt>(record));
+            }
+
+            return new SwitchStmt(startPosition, endPosition, condition, cases);
+        }
+        case Stmt::Kind::Throw: {
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            Expr* thrownValue = readExpr(readU32(record));
+            return new ThrowStmt(startPosition, endPosition, thrownValue);
+        }
+        case Stmt::Kind::While: {
+            Expr* condition = readExpr(readU32(record));
+            auto body = readStmtRefAs<CompoundStmt>(record);
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            return new WhileStmt(condition, body, startPosition, endPosition);
+        }
+        default:
+            throwCorruptError();
+            return nullptr;
+    }
+}
+
+gulc::Type* gulc::ASTCacheReader::readType(std::uint32_t index) {
+    if (index == ASTCacheFile::nullNode) return nullptr;
+
+    Record record = getRecord(index, Node::Kind::Type);
+    auto typeKind = static_cast<Type::Kind>(readU8(record));
+    auto qualifier = static_cast<Type::Qualifier>(readU8(record));
+    bool isLValue = readBool(record);
+    Type* result = nullptr;
+
+    switch (typeKind) {
+        case Type::Kind::Dimension: {
+            Type* nestedType = readType(readU32(record));
+            std::uint32_t dimensions = readU32(record);
+            result = new DimensionType(qualifier, nestedType, dimensions);
+            break;
+        }
+        case Type::Kind::Pointer:
+            result = new PointerType(qualifier, readType(readU32(record)));
+            break;
+        case Type::Kind::Reference:
+            result = new ReferenceType(qualifier, readType(readU32(record)));
+            break;
+        case Type::Kind::Unresolved: {
+            std::vector<Identifier> namespacePath = readIdentifiers(record);
+            Identifier identifier = readIdentifier(record);
+            std::vector<Expr*> templateArguments = readExprRefs(record);
+            result = new UnresolvedType(qualifier, namespacePath, identifier, templateArguments);
+            break;
+        }
+        case Type::Kind::UnresolvedNested: {
+            Type* container = readType(readU32(record));
+            Identifier identifier = readIdentifier(record);
+            std::vector<Expr*> templateArguments = readExprRefs(record);
+            TextPosition startPosition = readTextPosition(record);
+            TextPosition endPosition = readTextPosition(record);
+            result = new UnresolvedNestedType(qualifier, container, identifier, templateArguments,
+                                              startPosition, endPosition);
+            break;
+        }
+        default:
+            throwCorruptError();
+            return nullptr;
+    }
+
+    result->setIsLValue(isLValue);
+    return result;
+}
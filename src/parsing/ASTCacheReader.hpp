@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_ASTCACHEREADER_HPP
+#define GULC_ASTCACHEREADER_HPP
+
+#include <ast/Attr.hpp>
+#include <ast/Cont.hpp>
+#include <ast/Decl.hpp>
+#include <ast/Expr.hpp>
+#include <ast/Stmt.hpp>
+#include <ast/Type.hpp>
+#include <ast/decls/ParameterDecl.hpp>
+#include <ast/stmts/CompoundStmt.hpp>
+#include <llvm/Support/Casting.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "ASTCacheFile.hpp"
+
+namespace gulc {
+    /**
+     * Rebuilds the AST of a file from the `ASTCacheFile` layout written by `ASTCacheWriter`
+     *
+     * NOTE: `data` is only read while `readDeclarations` runs, the created nodes don't reference it.
+     */
+    class ASTCacheReader {
+    public:
+        /// The header of `data` has to be validated by the caller
+        ASTCacheReader(char const* data, std::size_t size);
+
+        /// Creates the top level declarations of the cached file, every `Decl` is given `sourceFileID` and every
+        /// position is moved to the `SourceManager` offset `startOffset`
+        ///
+        /// Returns false if the cache is corrupt, `result` is left empty.
+        bool readDeclarations(unsigned int sourceFileID, unsigned int startOffset, std::vector<Decl*>& result);
+
+    private:
+        // Thrown from anywhere within the reader when the cache is corrupt, caught by `readDeclarations`
+        struct CorruptCacheError {};
+
+        // Read position within a single node record
+        struct Record {
+            char const* current;
+            char const* end;
+        };
+
+        // The fields written by `ASTCacheWriter::writeFunctionBase`
+        struct FunctionBase {
+            std::vector<ParameterDecl*> parameters;
+            Type* returnType;
+            std::vector<Cont*> contracts;
+            CompoundStmt* body;
+            TextPosition startPosition;
+            TextPosition endPosition;
+        };
+
+        char const* _data;
+        std::size_t _size;
+        ASTCacheFile::Header const* _header;
+        std::uint32_t const* _nodeOffsets;
+        std::uint32_t const* _stringOffsets;
+        std::uint32_t const* _declarations;
+        unsigned int _sourceFileID;
+        unsigned int _startOffset;
+
+        [[noreturn]] void throwCorruptError() const;
+
+        // Returns the record of node `index` after checking it is a `nodeKind` node, `current` is left on the kind
+        // within the node type
+        Record getRecord(std::uint32_t index, Node::Kind nodeKind) const;
+
+        std::uint8_t readU8(Record& record) const;
+        std::uint32_t readU32(Record& record) const;
+        bool readBool(Record& record) const;
+        std::string readString(Record& record) const;
+        TextPosition readTextPosition(Record& record) const;
+        Identifier readIdentifier(Record& record) const;
+        std::vector<Identifier> readIdentifiers(Record& record) const;
+
+        FunctionBase readFunctionBase(Record& record);
+
+        std::vector<Attr*> readAttrRefs(Record& record);
+        std::vector<Cont*> readContRefs(Record& record);
+        std::vector<Expr*> readExprRefs(Record& record);
+        std::vector<Stmt*> readStmtRefs(Record& record);
+        std::vector<Type*> readTypeRefs(Record& record);
+
+        // Reads a reference to a node that has to be a `T` (or missing)
+        template<typename T>
+        T* readDeclRefAs(Record& record) {
+            Decl* decl = readDecl(readU32(record));
+
+            if (decl != nullptr && !llvm::isa<T>(decl)) {
+                throwCorruptError();
+            }
+
+            return static_cast<T*>(decl);
+        }
+        template<typename T>
+        T* readExprRefAs(Record& record) {
+            Expr* expr = readExpr(readU32(record));
+
+            if (expr != nullptr && !llvm::isa<T>(expr)) {
+                throwCorruptError();
+            }
+
+            return static_cast<T*>(expr);
+        }
+        template<typename T>
+        T* readStmtRefAs(Record& record) {
+            Stmt* stmt = readStmt(readU32(record));
+
+            if (stmt != nullptr && !llvm::isa<T>(stmt)) {
+                throwCorruptError();
+            }
+
+            return static_cast<T*>(stmt);
+        }
+        template<typename T>
+        std::vector<T*> readDeclRefs(Record& record) {
+            std::uint32_t count = readU32(record);
+            std::vector<T*> result;
+            result.reserve(count);
+
+            for (std::uint32_t i = 0; i < count; ++i) {
+                result.push_back(readDeclRefAs<T>(record));
+            }
+
+            return result;
+        }
+
+        // NOTE: `ASTCacheFile::nullNode` returns `nullptr`
+        Attr* readAttr(std::uint32_t index);
+        Cont* readCont(std::uint32_t index);
+        Decl* readDecl(std::uint32_t index);
+        Expr* readExpr(std::uint32_t index);
+        Stmt* readStmt(std::uint32_t index);
+        Type* readType(std::uint32_t index);
+
+    };
+}
+
+#endif //GULC_ASTCACHEREADER_HPP
@@ -0,0 +1,972 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <ast/attrs/UnresolvedAttr.hpp>
+#include <ast/conts/EnsuresCont.hpp>
+#include <ast/conts/RequiresCont.hpp>
+#include <ast/conts/ThrowsCont.hpp>
+#include <ast/conts/WhereCont.hpp>
+#include <ast/decls/CallOperatorDecl.hpp>
+#include <ast/decls/ConstructorDecl.hpp>
+#include <ast/decls/DestructorDecl.hpp>
+#include <ast/decls/EnumConstDecl.hpp>
+#include <ast/decls/EnumDecl.hpp>
+#include <ast/decls/ExtensionDecl.hpp>
+#include <ast/decls/FunctionDecl.hpp>
+#include <ast/decls/ImportDecl.hpp>
+#include <ast/decls/NamespaceDecl.hpp>
+#include <ast/decls/OperatorDecl.hpp>
+#include <ast/decls/ParameterDecl.hpp>
+#include <ast/decls/PropertyDecl.hpp>
+#include <ast/decls/PropertyGetDecl.hpp>
+#include <ast/decls/PropertySetDecl.hpp>
+#include <ast/decls/StructDecl.hpp>
+#include <ast/decls/SubscriptOperatorDecl.hpp>
+#include <ast/decls/SubscriptOperatorGetDecl.hpp>
+#include <ast/decls/SubscriptOperatorSetDecl.hpp>
+#include <ast/decls/TemplateFunctionDecl.hpp>
+#include <ast/decls/TemplateParameterDecl.hpp>
+#include <ast/decls/TemplateStructDecl.hpp>
+#include <ast/decls/TemplateTraitDecl.hpp>
+#include <ast/decls/TraitDecl.hpp>
+#include <ast/decls/TraitPrototypeDecl.hpp>
+#include <ast/decls/TypeAliasDecl.hpp>
+#include <ast/decls/TypeSuffixDecl.hpp>
+#include <ast/decls/VariableDecl.hpp>
+#include <ast/exprs/ArrayLiteralExpr.hpp>
+#include <ast/exprs/AsExpr.hpp>
+#include <ast/exprs/AssignmentOperatorExpr.hpp>
+#include <ast/exprs/BoolLiteralExpr.hpp>
+#include <ast/exprs/CheckExtendsTypeExpr.hpp>
+#include <ast/exprs/DeleteExpr.hpp>
+#include <ast/exprs/FunctionCallExpr.hpp>
+#include <ast/exprs/HasExpr.hpp>
+#include <ast/exprs/IdentifierExpr.hpp>
+#include <ast/exprs/InfixOperatorExpr.hpp>
+#include <ast/exprs/IsExpr.hpp>
+#include <ast/exprs/LabeledArgumentExpr.hpp>
+#include <ast/exprs/MemberAccessCallExpr.hpp>
+#include <ast/exprs/NewExpr.hpp>
+#include <ast/exprs/ParenExpr.hpp>
+#include <ast/exprs/PostfixOperatorExpr.hpp>
+#include <ast/exprs/PrefixOperatorExpr.hpp>
+#include <ast/exprs/RefExpr.hpp>
+#include <ast/exprs/SubscriptCallExpr.hpp>
+#include <ast/exprs/TernaryExpr.hpp>
+#include <ast/exprs/TryExpr.hpp>
+#include <ast/exprs/TypeExpr.hpp>
+#include <ast/exprs/ValueLiteralExpr.hpp>
+#include <ast/exprs/VariableDeclExpr.hpp>
+#include <ast/stmts/BreakStmt.hpp>
+#include <ast/stmts/CaseStmt.hpp>
+#include <ast/stmts/CatchStmt.hpp>
+#include <ast/stmts/CompoundStmt.hpp>
+#include <ast/stmts/ContinueStmt.hpp>
+#include <ast/stmts/DoCatchStmt.hpp>
+#include <ast/stmts/DoStmt.hpp>
+#include <ast/stmts/FallthroughStmt.hpp>
+#include <ast/stmts/ForStmt.hpp>
+#include <ast/stmts/GotoStmt.hpp>
+#include <ast/stmts/IfStmt.hpp>
+#include <ast/stmts/LabeledStmt.hpp>
+#include <ast/stmts/RepeatWhileStmt.hpp>
+#include <ast/stmts/ReturnStmt.hpp>
+#include <ast/stmts/SwitchStmt.hpp>
+#include <ast/stmts/ThrowStmt.hpp>
+#include <ast/stmts/WhileStmt.hpp>
+#include <ast/types/DimensionType.hpp>
+#include <ast/types/PointerType.hpp>
+#include <ast/types/ReferenceType.hpp>
+#include <ast/types/UnresolvedNestedType.hpp>
+#include <ast/types/UnresolvedType.hpp>
+#include <cstring>
+#include <iostream>
+#include "ASTCacheFile.hpp"
+#include "ASTCacheWriter.hpp"
+
+std::string gulc::ASTCacheWriter::writeFile(ASTFile const& file, unsigned int startOffset, std::uint64_t sourceHash,
+                                            std::uint64_t sourceSize) {
+    _startOffset = startOffset;
+    _nodeRecords.clear();
+    _strings.clear();
+    _stringIndexes.clear();
+
+    std::vector<std::uint32_t> declarations;
+    declarations.reserve(file.declarations.size());
+
+    for (Decl const* decl : file.declarations) {
+        declarations.push_back(writeDecl(decl));
+    }
+
+    ASTCacheFile::Header header {};
+    std::memcpy(header.magic, ASTCacheFile::magic, sizeof(header.magic));
+    header.version = ASTCacheFile::version;
+    header.sourceHash = sourceHash;
+    header.sourceSize = sourceSize;
+    header.nodeCount = _nodeRecords.size();
+    header.stringCount = _strings.size();
+    header.declCount = declarations.size();
+
+    // The tables come first, we need their size to know where the node records and strings will start
+    std::size_t currentOffset = sizeof(header) +
+                                (_nodeRecords.size() + _strings.size() + declarations.size()) * sizeof(std::uint32_t);
+    std::vector<std::uint32_t> nodeOffsets;
+    std::vector<std::uint32_t> stringOffsets;
+    nodeOffsets.reserve(_nodeRecords.size());
+    stringOffsets.reserve(_strings.size());
+
+    for (std::string const& nodeRecord : _nodeRecords) {
+        nodeOffsets.push_back(currentOffset);
+        currentOffset += nodeRecord.size();
+    }
+
+    for (std::string const& string : _strings) {
+        stringOffsets.push_back(currentOffset);
+        currentOffset += sizeof(std::uint32_t) + string.size();
+    }
+
+    if (currentOffset > UINT32_MAX) {
+        printError("the AST is too large to be cached!");
+    }
+
+    std::string result;
+    result.reserve(currentOffset);
+    result.append(reinterpret_cast<char const*>(&header), sizeof(header));
+    result.append(reinterpret_cast<char const*>(nodeOffsets.data()), nodeOffsets.size() * sizeof(std::uint32_t));
+    result.append(reinterpret_cast<char const*>(stringOffsets.data()), stringOffsets.size() * sizeof(std::uint32_t));
+    result.append(reinterpret_cast<char const*>(declarations.data()), declarations.size() * sizeof(std::uint32_t));
+
+    for (std::string const& nodeRecord : _nodeRecords) {
+        result += nodeRecord;
+    }
+
+    for (std::string const& string : _strings) {
+        writeU32(result, string.size());
+        result += string;
+    }
+
+    return result;
+}
+
+void gulc::ASTCacheWriter::printError(std::string const& message) const {
+    std::cout << "gulc error: " << message << std::endl;
+    std::exit(1);
+}
+
+std::uint32_t gulc::ASTCacheWriter::addNodeRecord(std::string record) {
+    _nodeRecords.push_back(std::move(record));
+    return _nodeRecords.size() - 1;
+}
+
+std::uint32_t gulc::ASTCacheWriter::internString(std::string const& value) {
+    auto foundString = _stringIndexes.find(value);
+
+    if (foundString != _stringIndexes.end()) {
+        return foundString->second;
+    }
+
+    std::uint32_t result = _strings.size();
+    _strings.push_back(value);
+    _stringIndexes.insert({value, result});
+    return result;
+}
+
+void gulc::ASTCacheWriter::writeU8(std::string& record, std::uint8_t value) {
+    record.push_back(static_cast<char>(value));
+}
+
+void gulc::ASTCacheWriter::writeU32(std::string& record, std::uint32_t value) {
+    record.append(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+void gulc::ASTCacheWriter::writeBool(std::string& record, bool value) {
+    writeU8(record, value ? 1 : 0);
+}
+
+void gulc::ASTCacheWriter::writeString(std::string& record, std::string const& value) {
+    writeU32(record, internString(value));
+}
+
+void gulc::ASTCacheWriter::writeTextPosition(std::string& record, TextPosition const& position) {
+    // Positions are written relative to the start of the file plus one so `0` stays an unknown position
+    if (position.index < _startOffset) {
+        writeU32(record, 0);
+    } else {
+        writeU32(record, position.index - _startOffset + 1);
+    }
+}
+
+void gulc::ASTCacheWriter::writeIdentifier(std::string& record, Identifier const& identifier) {
+    writeString(record, identifier.name());
+    writeTextPosition(record, identifier.startPosition());
+    writeTextPosition(record, identifier.endPosition());
+}
+
+void gulc::ASTCacheWriter::writeIdentifiers(std::string& record, std::vector<Identifier> const& identifiers) {
+    writeU32(record, identifiers.size());
+
+    for (Identifier const& identifier : identifiers) {
+        writeIdentifier(record, identifier);
+    }
+}
+
+void gulc::ASTCacheWriter::writeDeclBase(std::string& record, Decl const* decl) {
+    writeAttrRefs(record, decl->attributes());
+    writeU8(record, static_cast<std::uint8_t>(decl->visibility()));
+    writeBool(record, decl->isConstExpr());
+    writeIdentifier(record, decl->identifier());
+    writeU32(record, static_cast<std::uint32_t>(decl->declModifiers()));
+}
+
+void gulc::ASTCacheWriter::writeFunctionBase(std::string& record, FunctionDecl const* functionDecl) {
+    writeDeclRefs(record, functionDecl->parameters());
+    writeU32(record, writeType(functionDecl->returnType));
+    writeContRefs(record, functionDecl->contracts());
+    writeU32(record, writeStmt(functionDecl->body()));
+    writeTextPosition(record, functionDecl->startPosition());
+    writeTextPosition(record, functionDecl->endPosition());
+}
+
+void gulc::ASTCacheWriter::writeAttrRefs(std::string& record, std::vector<Attr*> const& attributes) {
+    writeU32(record, attributes.size());
+
+    for (Attr const* attribute : attributes) {
+        writeU32(record, writeAttr(attribute));
+    }
+}
+
+void gulc::ASTCacheWriter::writeContRefs(std::string& record, std::vector<Cont*> const& contracts) {
+    writeU32(record, contracts.size());
+
+    for (Cont const* contract : contracts) {
+        writeU32(record, writeCont(contract));
+    }
+}
+
+void gulc::ASTCacheWriter::writeExprRefs(std::string& record, std::vector<Expr*> const& exprs) {
+    writeU32(record, exprs.size());
+
+    for (Expr const* expr : exprs) {
+        writeU32(record, writeExpr(expr));
+    }
+}
+
+void gulc::ASTCacheWriter::writeStmtRefs(std::string& record, std::vector<Stmt*> const& stmts) {
+    writeU32(record, stmts.size());
+
+    for (Stmt const* stmt : stmts) {
+        writeU32(record, writeStmt(stmt));
+    }
+}
+
+void gulc::ASTCacheWriter::writeTypeRefs(std::string& record, std::vector<Type*> const& types) {
+    writeU32(record, types.size());
+
+    for (Type const* type : types) {
+        writeU32(record, writeType(type));
+    }
+}
+
+std::uint32_t gulc::ASTCacheWriter::writeAttr(Attr const* attr) {
+    if (attr == nullptr) return ASTCacheFile::nullNode;
+
+    std::string record;
+    writeU8(record, static_cast<std::uint8_t>(Node::Kind::Attr));
+    writeU8(record, static_cast<std::uint8_t>(attr->getAttrKind()));
+    writeTextPosition(record, attr->startPosition());
+    writeTextPosition(record, attr->endPosition());
+
+    switch (attr->getAttrKind()) {
+        case Attr::Kind::Unresolved: {
+            auto unresolvedAttr = llvm::dyn_cast<UnresolvedAttr>(attr);
+            writeIdentifiers(record, unresolvedAttr->namespacePath());
+            writeIdentifier(record, unresolvedAttr->identifier());
+            writeExprRefs(record, unresolvedAttr->arguments);
+            break;
+        }
+        default:
+            printError("unsupported attribute found while writing the AST cache!");
+            break;
+    }
+
+    return addNodeRecord(std::move(record));
+}
+
+std::uint32_t gulc::ASTCacheWriter::writeCont(Cont const* cont) {
+    if (cont == nullptr) return ASTCacheFile::nullNode;
+
+    std::string record;
+    writeU8(record, static_cast<std::uint8_t>(Node::Kind::Cont));
+    writeU8(record, static_cast<std::uint8_t>(cont->getContKind()));
+    writeTextPosition(record, cont->startPosition());
+    writeTextPosition(record, cont->endPosition());
+
+    switch (cont->getContKind()) {
+        case Cont::Kind::Requires:
+            writeU32(record, writeExpr(llvm::dyn_cast<RequiresCont>(cont)->condition));
+            break;
+        case Cont::Kind::Ensures:
+            writeU32(record, writeExpr(llvm::dyn_cast<EnsuresCont>(cont)->condition));
+            break;
+        case Cont::Kind::Throws:
+            writeU32(record, writeType(llvm::dyn_cast<ThrowsCont>(cont)->exceptionType));
+            break;
+        case Cont::Kind::Where:
+            writeU32(record, writeExpr(llvm::dyn_cast<WhereCont>(cont)->condition));
+            break;
+    }
+
+    return addNodeRecord(std::move(record));
+}
+
+std::uint32_t gulc::ASTCacheWriter::writeDecl(Decl const* decl) {
+    if (decl == nullptr) return ASTCacheFile::nullNode;
+
+    std::string record;
+    writeU8(record, static_cast<std::uint8_t>(Node::Kind::Decl));
+    writeU8(record, static_cast<std::uint8_t>(decl->getDeclKind()));
+    writeDeclBase(record, decl);
+
+    switch (decl->getDeclKind()) {
+        case Decl::Kind::Import: {
+            auto importDecl = llvm::dyn_cast<ImportDecl>(decl);
+            writeTextPosition(record, importDecl->importStartPosition());
+            writeTextPosition(record, importDecl->importEndPosition());
+            writeIdentifiers(record, importDecl->importPath());
+            writeBool(record, importDecl->hasAlias());
+
+            if (importDecl->hasAlias()) {
+                writeTextPosition(record, importDecl->asStartPosition());
+                writeTextPosition(record, importDecl->asEndPosition());
+                writeIdentifier(record, importDecl->importAlias());
+            }
+
+            break;
+        }
+        case Decl::Kind::Function:
+        case Decl::Kind::CallOperator:
+        case Decl::Kind::TypeSuffix:
+            writeFunctionBase(record, static_cast<FunctionDecl const*>(decl));
+            break;
+        case Decl::Kind::TemplateFunction: {
+            auto templateFunctionDecl = llvm::dyn_cast<TemplateFunctionDecl>(decl);
+            writeFunctionBase(record, templateFunctionDecl);
+            writeDeclRefs(record, templateFunctionDecl->templateParameters());
+            break;
+        }
+        case Decl::Kind::Operator: {
+            auto operatorDecl = llvm::dyn_cast<OperatorDecl>(decl);
+            writeFunctionBase(record, operatorDecl);
+            writeU8(record, static_cast<std::uint8_t>(operatorDecl->operatorType()));
+            writeIdentifier(record, operatorDecl->operatorIdentifier());
+            break;
+        }
+        case Decl::Kind::Constructor: {
+            auto constructorDecl = llvm::dyn_cast<ConstructorDecl>(decl);
+            writeFunctionBase(record, constructorDecl);
+            writeU32(record, writeExpr(constructorDecl->baseConstructorCall));
+            writeU8(record, static_cast<std::uint8_t>(constructorDecl->constructorType()));
+            break;
+        }
+        case Decl::Kind::Destructor:
+            writeFunctionBase(record, llvm::dyn_cast<DestructorDecl>(decl));
+            break;
+        case Decl::Kind::PropertyGet: {
+            auto propertyGetDecl = llvm::dyn_cast<PropertyGetDecl>(decl);
+            writeFunctionBase(record, propertyGetDecl);
+            writeU8(record, static_cast<std::uint8_t>(propertyGetDecl->getResultType()));
+            break;
+        }
+        case Decl::Kind::SubscriptOperatorGet: {
+            auto subscriptOperatorGetDecl = llvm::dyn_cast<SubscriptOperatorGetDecl>(decl);
+            writeFunctionBase(record, subscriptOperatorGetDecl);
+            writeU8(record, static_cast<std::uint8_t>(subscriptOperatorGetDecl->getResultType()));
+            break;
+        }
+        // The setter's parameter is created by its constructor from the parameter type so the type is all that
+        // needs to be stored for it, the parameter is still written as part of `writeFunctionBase`
+        case Decl::Kind::PropertySet:
+            writeFunctionBase(record, llvm::dyn_cast<PropertySetDecl>(decl));
+            break;
+        case Decl::Kind::SubscriptOperatorSet:
+            writeFunctionBase(record, llvm::dyn_cast<SubscriptOperatorSetDecl>(decl));
+            break;
+        case Decl::Kind::Property: {
+            auto propertyDecl = llvm::dyn_cast<PropertyDecl>(decl);
+            writeU32(record, writeType(propertyDecl->type));
+            writeTextPosition(record, propertyDecl->startPosition());
+            writeTextPosition(record, propertyDecl->endPosition());
+            writeDeclRefs(record, propertyDecl->getters());
+            writeU32(record, writeDecl(propertyDecl->setter()));
+            break;
+        }
+        case Decl::Kind::SubscriptOperator: {
+            auto subscriptOperatorDecl = llvm::dyn_cast<SubscriptOperatorDecl>(decl);
+            writeDeclRefs(record, subscriptOperatorDecl->parameters());
+            writeU32(record, writeType(subscriptOperatorDecl->type));
+            writeTextPosition(record, subscriptOperatorDecl->startPosition());
+            writeTextPosition(record, subscriptOperatorDecl->endPosition());
+            writeDeclRefs(record, subscriptOperatorDecl->getters());
+            writeU32(record, writeDecl(subscriptOperatorDecl->setter()));
+            break;
+        }
+        case Decl::Kind::Struct:
+        case Decl::Kind::TemplateStruct: {
+            auto structDecl = static_cast<StructDecl const*>(decl);
+            writeTextPosition(record, structDecl->startPosition());
+            writeTextPosition(record, structDecl->endPosition());
+            writeU8(record, static_cast<std::uint8_t>(structDecl->structKind()));
+            writeTypeRefs(record, structDecl->inheritedTypes());
+            writeContRefs(record, structDecl->contracts());
+            writeDeclRefs(record, structDecl->ownedMembers());
+            writeDeclRefs(record, structDecl->constructors());
+            writeU32(record, writeDecl(structDecl->destructor));
+
+            if (auto templateStructDecl = llvm::dyn_cast<TemplateStructDecl>(decl)) {
+                writeDeclRefs(record, templateStructDecl->templateParameters());
+            }
+
+            break;
+        }
+        case Decl::Kind::Trait:
+        case Decl::Kind::TemplateTrait: {
+            auto traitDecl = static_cast<TraitDecl const*>(decl);
+            writeTextPosition(record, traitDecl->startPosition());
+            writeTextPosition(record, traitDecl->endPosition());
+            writeTypeRefs(record, traitDecl->inheritedTypes());
+            writeContRefs(record, traitDecl->contracts());
+            writeDeclRefs(record, traitDecl->ownedMembers());
+
+            if (auto templateTraitDecl = llvm::dyn_cast<TemplateTraitDecl>(decl)) {
+                writeDeclRefs(record, templateTraitDecl->templateParameters());
+            }
+
+            break;
+        }
+        case Decl::Kind::TraitPrototype: {
+            auto traitPrototypeDecl = llvm::dyn_cast<TraitPrototypeDecl>(decl);
+            writeU32(record, writeType(traitPrototypeDecl->traitType));
+            writeTextPosition(record, traitPrototypeDecl->startPosition());
+            writeTextPosition(record, traitPrototypeDecl->endPosition());
+            break;
+        }
+        case Decl::Kind::Extension: {
+            auto extensionDecl = llvm::dyn_cast<ExtensionDecl>(decl);
+            writeU32(record, writeType(extensionDecl->typeToExtend));
+            writeTextPosition(record, extensionDecl->startPosition());
+            writeTextPosition(record, extensionDecl->endPosition());
+            writeTypeRefs(record, extensionDecl->inheritedTypes());
+            writeContRefs(record, extensionDecl->contracts());
+            writeDeclRefs(record, extensionDecl->ownedMembers());
+            writeDeclRefs(record, extensionDecl->constructors());
+            break;
+        }
+        case Decl::Kind::TypeAlias: {
+            auto typeAliasDecl = llvm::dyn_cast<TypeAliasDecl>(decl);
+            writeU8(record, static_cast<std::uint8_t>(typeAliasDecl->typeAliasType()));
+            writeDeclRefs(record, typeAliasDecl->templateParameters());
+            writeU32(record, writeType(typeAliasDecl->typeValue));
+            writeTextPosition(record, typeAliasDecl->startPosition());
+            writeTextPosition(record, typeAliasDecl->endPosition());
+            break;
+        }
+        case Decl::Kind::Namespace: {
+            auto namespaceDecl = llvm::dyn_cast<NamespaceDecl>(decl);
+            writeTextPosition(record, namespaceDecl->startPosition());
+            writeTextPosition(record, namespaceDecl->endPosition());
+            writeDeclRefs(record, namespaceDecl->nestedDecls());
+            break;
+        }
+        case Decl::Kind::Enum: {
+            auto enumDecl = llvm::dyn_cast<EnumDecl>(decl);
+            writeTextPosition(record, enumDecl->startPosition());
+            writeTextPosition(record, enumDecl->endPosition());
+            writeU32(record, writeType(enumDecl->constType));
+            writeDeclRefs(record, enumDecl->enumConsts());
+            writeDeclRefs(record, enumDecl->ownedMembers());
+            break;
+        }
+        case Decl::Kind::EnumConst: {
+            auto enumConstDecl = llvm::dyn_cast<EnumConstDecl>(decl);
+            writeTextPosition(record, enumConstDecl->startPosition());
+            writeTextPosition(record, enumConstDecl->endPosition());
+            writeU32(record, writeExpr(enumConstDecl->constValue));
+            break;
+        }
+        case Decl::Kind::Variable: {
+            auto variableDecl = llvm::dyn_cast<VariableDecl>(decl);
+            writeU32(record, writeType(variableDecl->type));
+            writeU32(record, writeExpr(variableDecl->initialValue));
+            writeTextPosition(record, variableDecl->startPosition());
+            writeTextPosition(record, variableDecl->endPosition());
+            break;
+        }
+        case Decl::Kind::Parameter: {
+            auto parameterDecl = llvm::dyn_cast<ParameterDecl>(decl);
+            writeIdentifier(record, parameterDecl->argumentLabel());
+            writeU32(record, writeType(parameterDecl->type));
+            writeU32(record, writeExpr(parameterDecl->defaultValue));
+            writeU8(record, static_cast<std::uint8_t>(parameterDecl->parameterKind()));
+            writeTextPosition(record, parameterDecl->startPosition());
+            writeTextPosition(record, parameterDecl->endPosition());
+            break;
+        }
+        case Decl::Kind::TemplateParameter: {
+            auto templateParameterDecl = llvm::dyn_cast<TemplateParameterDecl>(decl);
+            writeU8(record, static_cast<std::uint8_t>(templateParameterDecl->templateParameterKind()));
+            writeU32(record, writeType(templateParameterDecl->type));
+            writeU32(record, writeExpr(templateParameterDecl->defaultValue));
+            writeTextPosition(record, templateParameterDecl->startPosition());
+            writeTextPosition(record, templateParameterDecl->endPosition());
+            break;
+        }
+        default:
+            printError("unsupported declaration found while writing the AST cache!");
+            break;
+    }
+
+    return addNodeRecord(std::move(record));
+}
+
+std::uint32_t gulc::ASTCacheWriter::writeExpr(Expr const* expr) {
+    if (expr == nullptr) return ASTCacheFile::nullNode;
+
+    std::string record;
+    writeU8(record, static_cast<std::uint8_t>(Node::Kind::Expr));
+    writeU8(record, static_cast<std::uint8_t>(expr->getExprKind()));
+
+    switch (expr->getExprKind()) {
+        case Expr::Kind::ArrayLiteral: {
+            auto arrayLiteralExpr = llvm::dyn_cast<ArrayLiteralExpr>(expr);
+            writeExprRefs(record, arrayLiteralExpr->indexes);
+            writeTextPosition(record, arrayLiteralExpr->startPosition());
+            writeTextPosition(record, arrayLiteralExpr->endPosition());
+            break;
+        }
+        case Expr::Kind::As: {
+            auto asExpr = llvm::dyn_cast<AsExpr>(expr);
+            writeU32(record, writeExpr(asExpr->expr));
+            writeU32(record, writeType(asExpr->asType));
+            writeTextPosition(record, asExpr->asStartPosition());
+            writeTextPosition(record, asExpr->asEndPosition());
+            break;
+        }
+        case Expr::Kind::AssignmentOperator: {
+            auto assignmentOperatorExpr = llvm::dyn_cast<AssignmentOperatorExpr>(expr);
+            writeU32(record, writeExpr(assignmentOperatorExpr->leftValue));
+            writeU32(record, writeExpr(assignmentOperatorExpr->rightValue));
+            writeBool(record, assignmentOperatorExpr->hasNestedOperator());
+            writeU8(record, static_cast<std::uint8_t>(assignmentOperatorExpr->nestedOperator()));
+            writeTextPosition(record, assignmentOperatorExpr->startPosition());
+            writeTextPosition(record, assignmentOperatorExpr->endPosition());
+            break;
+        }
+        case Expr::Kind::BoolLiteral: {
+            auto boolLiteralExpr = llvm::dyn_cast<BoolLiteralExpr>(expr);
+            writeBool(record, boolLiteralExpr->value());
+            writeTextPosition(record, boolLiteralExpr->startPosition());
+            writeTextPosition(record, boolLiteralExpr->endPosition());
+            break;
+        }
+        case Expr::Kind::CheckExtendsType: {
+            auto checkExtendsTypeExpr = llvm::dyn_cast<CheckExtendsTypeExpr>(expr);
+            writeU32(record, writeType(checkExtendsTypeExpr->checkType));
+            writeU32(record, writeType(checkExtendsTypeExpr->extendsType));
+            writeTextPosition(record, checkExtendsTypeExpr->extendsStartPosition());
+            writeTextPosition(record, checkExtendsTypeExpr->extendsEndPosition());
+            break;
+        }
+        case Expr::Kind::Delete: {
+            auto deleteExpr = llvm::dyn_cast<DeleteExpr>(expr);
+            writeU32(record, writeExpr(deleteExpr->pointer));
+            writeTextPosition(record, deleteExpr->deleteStartPosition());
+            writeTextPosition(record, deleteExpr->deleteEndPosition());
+            break;
+        }
+        case Expr::Kind::FunctionCall: {
+            auto functionCallExpr = llvm::dyn_cast<FunctionCallExpr>(expr);
+            writeU32(record, writeExpr(functionCallExpr->functionReference));
+            writeU32(record, functionCallExpr->arguments.size());
+
+            for (LabeledArgumentExpr const* argument : functionCallExpr->arguments) {
+                writeU32(record, writeExpr(argument));
+            }
+
+            writeTextPosition(record, functionCallExpr->startPosition());
+            writeTextPosition(record, functionCallExpr->endPosition());
+            break;
+        }
+        case Expr::Kind::Has: {
+            auto hasExpr = llvm::dyn_cast<HasExpr>(expr);
+            writeU32(record, writeExpr(hasExpr->expr));
+            writeU32(record, writeDecl(hasExpr->decl));
+            writeTextPosition(record, hasExpr->hasStartPosition());
+            writeTextPosition(record, hasExpr->hasEndPosition());
+            break;
+        }
+        case Expr::Kind::Identifier: {
+            auto identifierExpr = llvm::dyn_cast<IdentifierExpr>(expr);
+            writeIdentifier(record, identifierExpr->identifier());
+            writeExprRefs(record, identifierExpr->templateArguments());
+            break;
+        }
+        case Expr::Kind::InfixOperator: {
+            auto infixOperatorExpr = llvm::dyn_cast<InfixOperatorExpr>(expr);
+            writeU8(record, static_cast<std::uint8_t>(infixOperatorExpr->infixOperator()));
+            writeU32(record, writeExpr(infixOperatorExpr->leftValue));
+            writeU32(record, writeExpr(infixOperatorExpr->rightValue));
+            break;
+        }
+        case Expr::Kind::Is: {
+            auto isExpr = llvm::dyn_cast<IsExpr>(expr);
+            writeU32(record, writeExpr(isExpr->expr));
+            writeU32(record, writeType(isExpr->isType));
+            writeTextPosition(record, isExpr->isStartPosition());
+            writeTextPosition(record, isExpr->isEndPosition());
+            break;
+        }
+        case Expr::Kind::LabeledArgument: {
+            auto labeledArgumentExpr = llvm::dyn_cast<LabeledArgumentExpr>(expr);
+            writeIdentifier(record, labeledArgumentExpr->label());
+            writeU32(record, writeExpr(labeledArgumentExpr->argument));
+            break;
+        }
+        case Expr::Kind::MemberAccessCall: {
+            auto memberAccessCallExpr = llvm::dyn_cast<MemberAccessCallExpr>(expr);
+            writeBool(record, memberAccessCallExpr->isArrowCall());
+            writeU32(record, writeExpr(memberAccessCallExpr->objectRef));
+            writeU32(record, writeExpr(memberAccessCallExpr->member));
+            break;
+        }
+        case Expr::Kind::New: {
+            auto newExpr = llvm::dyn_cast<NewExpr>(expr);
+            writeU32(record, writeExpr(newExpr->initializer));
+            writeTextPosition(record, newExpr->newStartPosition());
+            writeTextPosition(record, newExpr->newEndPosition());
+            break;
+        }
+        case Expr::Kind::Paren: {
+            auto parenExpr = llvm::dyn_cast<ParenExpr>(expr);
+            writeU32(record, writeExpr(parenExpr->nestedExpr));
+            writeTextPosition(record, parenExpr->startPosition());
+            writeTextPosition(record, parenExpr->endPosition());
+            break;
+        }
+        case Expr::Kind::PostfixOperator: {
+            auto postfixOperatorExpr = llvm::dyn_cast<PostfixOperatorExpr>(expr);
+            writeU8(record, static_cast<std::uint8_t>(postfixOperatorExpr->postfixOperator()));
+            writeU32(record, writeExpr(postfixOperatorExpr->nestedExpr));
+            writeTextPosition(record, postfixOperatorExpr->operatorStartPosition());
+            writeTextPosition(record, postfixOperatorExpr->operatorEndPosition());
+            break;
+        }
+        case Expr::Kind::PrefixOperator: {
+            auto prefixOperatorExpr = llvm::dyn_cast<PrefixOperatorExpr>(expr);
+            writeU8(record, static_cast<std::uint8_t>(prefixOperatorExpr->prefixOperator()));
+            writeU32(record, writeExpr(prefixOperatorExpr->nestedExpr));
+            writeTextPosition(record, prefixOperatorExpr->operatorStartPosition());
+            writeTextPosition(record, prefixOperatorExpr->operatorEndPosition());
+            break;
+        }
+        case Expr::Kind::Ref: {
+            auto refExpr = llvm::dyn_cast<RefExpr>(expr);
+            writeBool(record, refExpr->isMutable);
+            writeU32(record, writeExpr(refExpr->nestedExpr));
+            writeTextPosition(record, refExpr->refStartPosition());
+            writeTextPosition(record, refExpr->refEndPosition());
+            break;
+        }
+        case Expr::Kind::SubscriptCall: {
+            auto subscriptCallExpr = llvm::dyn_cast<SubscriptCallExpr>(expr);
+            writeU32(record, writeExpr(subscriptCallExpr->subscriptReference));
+            writeU32(record, subscriptCallExpr->arguments.size());
+
+            for (LabeledArgumentExpr const* argument : subscriptCallExpr->arguments) {
+                writeU32(record, writeExpr(argument));
+            }
+
+            writeTextPosition(record, subscriptCallExpr->startPosition());
+            writeTextPosition(record, subscriptCallExpr->endPosition());
+            break;
+        }
+        case Expr::Kind::Ternary: {
+            auto ternaryExpr = llvm::dyn_cast<TernaryExpr>(expr);
+            writeU32(record, writeExpr(ternaryExpr->condition));
+            writeU32(record, writeExpr(ternaryExpr->trueExpr));
+            writeU32(record, writeExpr(ternaryExpr->falseExpr));
+            break;
+        }
+        case Expr::Kind::Try: {
+            auto tryExpr = llvm::dyn_cast<TryExpr>(expr);
+            writeU32(record, writeExpr(tryExpr->nestedExpr));
+            writeTextPosition(record, tryExpr->tryStartPosition());
+            writeTextPosition(record, tryExpr->tryEndPosition());
+            break;
+        }
+        case Expr::Kind::Type:
+            writeU32(record, writeType(llvm::dyn_cast<TypeExpr>(expr)->type));
+            break;
+        case Expr::Kind::ValueLiteral: {
+            auto valueLiteralExpr = llvm::dyn_cast<ValueLiteralExpr>(expr);
+            writeU8(record, static_cast<std::uint8_t>(valueLiteralExpr->literalType()));
+            writeString(record, valueLiteralExpr->value());
+            writeString(record, valueLiteralExpr->suffix());
+            writeTextPosition(record, valueLiteralExpr->startPosition());
+            writeTextPosition(record, valueLiteralExpr->endPosition());
+            break;
+        }
+        case Expr::Kind::VariableDecl: {
+            auto variableDeclExpr = llvm::dyn_cast<VariableDeclExpr>(expr);
+            writeIdentifier(record, variableDeclExpr->identifier());
+            writeU32(record, writeType(variableDeclExpr->type));
+            writeU32(record, writeExpr(variableDeclExpr->initialValue));
+            writeBool(record, variableDeclExpr->isAssignable());
+            writeU8(record, static_cast<std::uint8_t>(variableDeclExpr->initialValueAssignmentType));
+            writeTextPosition(record, variableDeclExpr->startPosition());
+            writeTextPosition(record, variableDeclExpr->endPosition());
+            break;
+        }
+        default:
+            printError("unsupported expression found while writing the AST cache!");
+            break;
+    }
+
+    return addNodeRecord(std::move(record));
+}
+
+std::uint32_t gulc::ASTCacheWriter::writeStmt(Stmt const* stmt) {
+    if (stmt == nullptr) return ASTCacheFile::nullNode;
+
+    if (stmt->getStmtKind() == Stmt::Kind::Expr) {
+        return writeExpr(llvm::dyn_cast<Expr>(stmt));
+    }
+
+    std::string record;
+    writeU8(record, static_cast<std::uint8_t>(Node::Kind::Stmt));
+    writeU8(record, static_cast<std::uint8_t>(stmt->getStmtKind()));
+
+    switch (stmt->getStmtKind()) {
+        case Stmt::Kind::Break: {
+            auto breakStmt = llvm::dyn_cast<BreakStmt>(stmt);
+            writeTextPosition(record, breakStmt->startPosition());
+            writeTextPosition(record, breakStmt->endPosition());
+            writeBool(record, breakStmt->hasBreakLabel());
+
+            if (breakStmt->hasBreakLabel()) {
+                writeIdentifier(record, breakStmt->breakLabel());
+            }
+
+            break;
+        }
+        case Stmt::Kind::Case: {
+            auto caseStmt = llvm::dyn_cast<CaseStmt>(stmt);
+            writeTextPosition(record, caseStmt->startPosition());
+            writeTextPosition(record, caseStmt->endPosition());
+            writeBool(record, caseStmt->isDefault());
+            writeU32(record, writeExpr(caseStmt->condition));
+            writeStmtRefs(record, caseStmt->body);
+            break;
+        }
+        case Stmt::Kind::Catch: {
+            auto catchStmt = llvm::dyn_cast<CatchStmt>(stmt);
+            writeTextPosition(record, catchStmt->catchStartPosition());
+            writeTextPosition(record, catchStmt->catchEndPosition());
+            writeU32(record, writeStmt(catchStmt->body()));
+            writeU32(record, writeType(catchStmt->exceptionType));
+            writeBool(record, catchStmt->hasVarName());
+
+            if (catchStmt->hasVarName()) {
+                writeIdentifier(record, catchStmt->varName());
+            }
+
+            break;
+        }
+        case Stmt::Kind::Compound: {
+            auto compoundStmt = llvm::dyn_cast<CompoundStmt>(stmt);
+            writeStmtRefs(record, compoundStmt->statements);
+            writeTextPosition(record, compoundStmt->startPosition());
+            writeTextPosition(record, compoundStmt->endPosition());
+            break;
+        }
+        case Stmt::Kind::Continue: {
+            auto continueStmt = llvm::dyn_cast<ContinueStmt>(stmt);
+            writeTextPosition(record, continueStmt->startPosition());
+            writeTextPosition(record, continueStmt->endPosition());
+            writeBool(record, continueStmt->hasContinueLabel());
+
+            if (continueStmt->hasContinueLabel()) {
+                writeIdentifier(record, continueStmt->continueLabel());
+            }
+
+            break;
+        }
+        case Stmt::Kind::Do: {
+            auto doStmt = llvm::dyn_cast<DoStmt>(stmt);
+            writeTextPosition(record, doStmt->startPosition());
+            writeTextPosition(record, doStmt->endPosition());
+            writeU32(record, writeStmt(doStmt->body()));
+            break;
+        }
+        case Stmt::Kind::DoCatch: {
+            auto doCatchStmt = llvm::dyn_cast<DoCatchStmt>(stmt);
+            writeTextPosition(record, doCatchStmt->startPosition());
+            writeTextPosition(record, doCatchStmt->endPosition());
+            writeU32(record, writeStmt(doCatchStmt->body()));
+            writeU32(record, doCatchStmt->catchStatements().size());
+
+            for (CatchStmt const* catchStmt : doCatchStmt->catchStatements()) {
+                writeU32(record, writeStmt(catchStmt));
+            }
+
+            writeU32(record, writeStmt(doCatchStmt->finallyStatement()));
+            break;
+        }
+        case Stmt::Kind::Fallthrough:
+            writeTextPosition(record, stmt->startPosition());
+            writeTextPosition(record, stmt->endPosition());
+            break;
+        case Stmt::Kind::For: {
+            auto forStmt = llvm::dyn_cast<ForStmt>(stmt);
+            writeU32(record, writeExpr(forStmt->init));
+            writeU32(record, writeExpr(forStmt->condition));
+            writeU32(record, writeExpr(forStmt->iteration));
+            writeU32(record, writeStmt(forStmt->body()));
+            writeTextPosition(record, forStmt->startPosition());
+            writeTextPosition(record, forStmt->endPosition());
+            break;
+        }
+        case Stmt::Kind::Goto: {
+            auto gotoStmt = llvm::dyn_cast<GotoStmt>(stmt);
+            writeTextPosition(record, gotoStmt->gotoStartPosition());
+            writeTextPosition(record, gotoStmt->gotoEndPosition());
+            writeIdentifier(record, gotoStmt->label());
+            break;
+        }
+        case Stmt::Kind::If: {
+            auto ifStmt = llvm::dyn_cast<IfStmt>(stmt);
+            writeTextPosition(record, ifStmt->startPosition());
+            writeTextPosition(record, ifStmt->endPosition());
+            writeU32(record, writeExpr(ifStmt->condition));
+            writeU32(record, writeStmt(ifStmt->trueBody()));
+            writeU32(record, writeStmt(ifStmt->falseBody()));
+            writeAttrRefs(record, ifStmt->attributes);
+            break;
+        }
+        case Stmt::Kind::Labeled: {
+            auto labeledStmt = llvm::dyn_cast<LabeledStmt>(stmt);
+            writeIdentifier(record, labeledStmt->label());
+            writeU32(record, writeStmt(labeledStmt->labeledStmt));
+            break;
+        }
+        case Stmt::Kind::RepeatWhile: {
+            auto repeatWhileStmt = llvm::dyn_cast<RepeatWhileStmt>(stmt);
+            writeU32(record, writeStmt(repeatWhileStmt->body()));
+            writeU32(record, writeExpr(repeatWhileStmt->condition));
+            writeTextPosition(record, repeatWhileStmt->startPosition());
+            writeTextPosition(record, repeatWhileStmt->endPosition());
+            writeTextPosition(record, repeatWhileStmt->whileStartPosition());
+            writeTextPosition(record, repeatWhileStmt->whileEndPosition());
+            break;
+        }
+        case Stmt::Kind::Return: {
+            auto returnStmt = llvm::dyn_cast<ReturnStmt>(stmt);
+            writeTextPosition(record, returnStmt->returnStartPosition());
+            writeTextPosition(record, returnStmt->returnEndPosition());
+            writeU32(record, writeExpr(returnStmt->returnValue));
+            break;
+        }
+        case Stmt::Kind::Switch: {
+            auto switchStmt = llvm::dyn_cast<SwitchStmt>(stmt);
+            writeTextPosition(record, switchStmt->startPosition());
+            writeTextPosition(record, switchStmt->endPosition());
+            writeU32(record, writeExpr(switchStmt->condition));
+            writeU32(record, switchStmt->cases.size());
+
+            for (CaseStmt const* caseStmt : switchStmt->cases) {
+                writeU32(record, writeStmt(caseStmt));
+            }
+
+            break;
+        }
+        case Stmt::Kind::Throw: {
+            auto throwStmt = llvm::dyn_cast<ThrowStmt>(stmt);
+            writeTextPosition(record, throwStmt->throwStartPosition());
+            writeTextPosition(record, throwStmt->throwEndPosition());
+            writeU32(record, writeExpr(throwStmt->thrownValue));
+            break;
+        }
+        case Stmt::Kind::While: {
+            auto whileStmt = llvm::dyn_cast<WhileStmt>(stmt);
+            writeU32(record, writeExpr(whileStmt->condition));
+            writeU32(record, writeStmt(whileStmt->body()));
+            writeTextPosition(record, whileStmt->startPosition());
+            writeTextPosition(record, whileStmt->endPosition());
+            break;
+        }
+        default:
+            printError("unsupported statement found while writing the AST cache!");
+            break;
+    }
+
+    return addNodeRecord(std::move(record));
+}
+
+std::uint32_t gulc::ASTCacheWriter::writeType(Type const* type) {
+    if (type == nullptr) return ASTCacheFile::nullNode;
+
+    std::string record;
+    writeU8(record, static_cast<std::uint8_t>(Node::Kind::Type));
+    writeU8(record, static_cast<std::uint8_t>(type->getTypeKind()));
+    writeU8(record, static_cast<std::uint8_t>(type->qualifier()));
+    writeBool(record, type->isLValue());
+
+    switch (type->getTypeKind()) {
+        case Type::Kind::Dimension: {
+            auto dimensionType = llvm::dyn_cast<DimensionType>(type);
+            writeU32(record, writeType(dimensionType->nestedType));
+            writeU32(record, dimensionType->dimensions());
+            break;
+        }
+        case Type::Kind::Pointer:
+            writeU32(record, writeType(llvm::dyn_cast<PointerType>(type)->nestedType));
+            break;
+        case Type::Kind::Reference:
+            writeU32(record, writeType(llvm::dyn_cast<ReferenceType>(type)->nestedType));
+            break;
+        case Type::Kind::Unresolved: {
+            auto unresolvedType = llvm::dyn_cast<UnresolvedType>(type);
+            writeIdentifiers(record, unresolvedType->namespacePath());
+            writeIdentifier(record, unresolvedType->identifier());
+            writeExprRefs(record, unresolvedType->templateArguments);
+            break;
+        }
+        case Type::Kind::UnresolvedNested: {
+            auto unresolvedNestedType = llvm::dyn_cast<UnresolvedNestedType>(type);
+            writeU32(record, writeType(unresolvedNestedType->container));
+            writeIdentifier(record, unresolvedNestedType->identifier());
+            writeExprRefs(record, unresolvedNestedType->templateArguments());
+            writeTextPosition(record, unresolvedNestedType->startPosition());
+            writeTextPosition(record, unresolvedNestedType->endPosition());
+            break;
+        }
+        default:
+            printError("unsupported type found while writing the AST cache!");
+            break;
+    }
+
+    return addNodeRecord(std::move(record));
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_ASTCACHEWRITER_HPP
+#define GULC_ASTCACHEWRITER_HPP
+
+#include <ast/Attr.hpp>
+#include <ast/Cont.hpp>
+#include <ast/Decl.hpp>
+#include <ast/Expr.hpp>
+#include <ast/Stmt.hpp>
+#include <ast/Type.hpp>
+#include <ast/decls/FunctionDecl.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "ASTFile.hpp"
+
+namespace gulc {
+    /**
+     * Serializes the AST of a freshly parsed file into the `ASTCacheFile` layout
+     *
+     * NOTE: Only the nodes created by `Parser` are supported, the AST has to be written before any pass modifies it.
+     */
+    class ASTCacheWriter {
+    public:
+        ASTCacheWriter()
+                : _startOffset(0), _nodeRecords(), _strings(), _stringIndexes() {}
+
+        /// Returns the contents of the cache file for `file`, `startOffset`, `sourceHash` and `sourceSize` describe
+        /// the source it was parsed from
+        std::string writeFile(ASTFile const& file, unsigned int startOffset, std::uint64_t sourceHash,
+                              std::uint64_t sourceSize);
+
+    private:
+        unsigned int _startOffset;
+        std::vector<std::string> _nodeRecords;
+        std::vector<std::string> _strings;
+        std::unordered_map<std::string, std::uint32_t> _stringIndexes;
+
+        void printError(std::string const& message) const;
+
+        std::uint32_t addNodeRecord(std::string record);
+        std::uint32_t internString(std::string const& value);
+
+        void writeU8(std::string& record, std::uint8_t value);
+        void writeU32(std::string& record, std::uint32_t value);
+        void writeBool(std::string& record, bool value);
+        void writeString(std::string& record, std::string const& value);
+        void writeTextPosition(std::string& record, TextPosition const& position);
+        void writeIdentifier(std::string& record, Identifier const& identifier);
+        void writeIdentifiers(std::string& record, std::vector<Identifier> const& identifiers);
+
+        // Writes the fields shared by every `Decl` and every `FunctionDecl`
+        void writeDeclBase(std::string& record, Decl const* decl);
+        void writeFunctionBase(std::string& record, FunctionDecl const* functionDecl);
+
+        void writeAttrRefs(std::string& record, std::vector<Attr*> const& attributes);
+        void writeContRefs(std::string& record, std::vector<Cont*> const& contracts);
+        void writeExprRefs(std::string& record, std::vector<Expr*> const& exprs);
+        void writeStmtRefs(std::string& record, std::vector<Stmt*> const& stmts);
+        void writeTypeRefs(std::string& record, std::vector<Type*> const& types);
+        template<typename T>
+        void writeDeclRefs(std::string& record, std::vector<T*> const& decls) {
+            writeU32(record, decls.size());
+
+            for (T const* decl : decls) {
+                writeU32(record, writeDecl(decl));
+            }
+        }
+
+        // Each of these write the node's children, then the node, and return the index of the node's record
+        // NOTE: Passing `nullptr` returns `ASTCacheFile::nullNode`
+        std::uint32_t writeAttr(Attr const* attr);
+        std::uint32_t writeCont(Cont const* cont);
+        std::uint32_t writeDecl(Decl const* decl);
+        std::uint32_t writeExpr(Expr const* expr);
+        std::uint32_t writeStmt(Stmt const* stmt);
+        std::uint32_t writeType(Type const* type);
+
+    };
+}
+
+#endif //GULC_ASTCACHEWRITER_HPP
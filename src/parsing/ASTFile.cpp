@@ -16,30 +16,28 @@
  * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
  */
 #include "ASTFile.hpp"
-#include <ast/decls/ExtensionDecl.hpp>
-#include <utilities/TypeCompareUtil.hpp>
+
+void gulc::ASTFile::indexTypeExtensions() {
+    _typeExtensionIndex.build(scopeExtensions);
+    _cachedTypeExtensions.clear();
+}
 
 std::vector<gulc::ExtensionDecl*>* gulc::ASTFile::getTypeExtensions(const gulc::Type* forType) {
-    auto foundExtensions = _cachedTypeExtensions.find(forType);
+    std::string typeKey = TypeExtensionIndex::getTypeKey(forType);
+    auto foundExtensions = _cachedTypeExtensions.find(typeKey);
 
     if (foundExtensions == _cachedTypeExtensions.end()) {
         // The key doesn't already exist, we will have to generate the list...
         std::vector<ExtensionDecl*> typeExtensions;
-        TypeCompareUtil typeCompareUtil;
 
-        for (ExtensionDecl* checkExtension : scopeExtensions) {
-            if (typeCompareUtil.compareAreSameOrInherits(forType, checkExtension->typeToExtend)) {
-                typeExtensions.push_back(checkExtension);
-            }
-        }
+        _typeExtensionIndex.findExtensions(forType, typeExtensions);
 
-        if (typeExtensions.empty()) {
-            return nullptr;
-        } else {
-            _cachedTypeExtensions.insert({forType, typeExtensions});
+        // NOTE: We cache empty results as well, most types have no extensions at all
+        foundExtensions = _cachedTypeExtensions.insert({typeKey, std::move(typeExtensions)}).first;
+    }
 
-            return &_cachedTypeExtensions[forType];
-        }
+    if (foundExtensions->second.empty()) {
+        return nullptr;
     } else {
         return &foundExtensions->second;
     }
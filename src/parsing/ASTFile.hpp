@@ -21,6 +21,7 @@
 #include <vector>
 #include <ast/Decl.hpp>
 #include <ast/decls/ImportDecl.hpp>
+#include <utilities/TypeExtensionIndex.hpp>
 
 namespace gulc {
     class ASTFile {
@@ -37,10 +38,15 @@ namespace gulc {
         ASTFile(unsigned int sourceFileID, std::vector<Decl*> declarations)
                 : sourceFileID(sourceFileID), declarations(std::move(declarations)) {}
 
+        // Builds the `scopeExtensions` index, this has to be called after `DeclInstantiator` has resolved the
+        // extended types and before any calls to `getTypeExtensions`
+        void indexTypeExtensions();
         std::vector<ExtensionDecl*>* getTypeExtensions(Type const* forType);
 
     protected:
-        std::map<Type const*, std::vector<ExtensionDecl*>> _cachedTypeExtensions;
+        TypeExtensionIndex _typeExtensionIndex;
+        // Keyed by `TypeExtensionIndex::getTypeKey` so separate `Type` allocations of the same type share results.
+        std::unordered_map<std::string, std::vector<ExtensionDecl*>> _cachedTypeExtensions;
 
     };
 }
@@ -61,8 +61,8 @@ Token Lexer::nextToken() {
         //_nextToken.tokenMetaType = TokenMetaType::NIL;
         _nextToken.currentSymbol = "";
         _nextToken.currentChar = 0;
-        _nextToken.startPosition = TextPosition(0, 0, 0);
-        _nextToken.endPosition = TextPosition(0, 0, 0);
+        _nextToken.startPosition = TextPosition();
+        _nextToken.endPosition = TextPosition();
     }
 
     return result;
@@ -83,13 +83,11 @@ LexerCheckpoint Lexer::createCheckpoint() {
     Token checkpointNextToken = Token(_nextToken.tokenType, _nextToken.metaType, _nextToken.currentSymbol,
                                       _nextToken.currentChar, _nextToken.startPosition, _nextToken.endPosition,
                                       _nextToken.hasLeadingWhitespace);
-    return LexerCheckpoint(checkpointNextToken, _currentLine, _currentColumn, _currentIndex);
+    return LexerCheckpoint(checkpointNextToken, _currentIndex);
 }
 
 void Lexer::returnToCheckpoint(const LexerCheckpoint& checkpoint) {
     _nextToken = checkpoint._nextToken;
-    _currentLine = checkpoint.currentLine;
-    _currentColumn = checkpoint.currentColumn;
     _currentIndex = checkpoint.currentIndex;
 }
 
@@ -102,7 +100,8 @@ void Lexer::setRightShiftState(bool enabled) {
 }
 
 void Lexer::printError(const std::string& errorText, int errorCode) {
-    std::cout << "gulc lexer error[" << _filePath << ", " << _currentLine << ", " << _currentColumn << "]: "
+    TextPosition position = currentPosition();
+    std::cout << "gulc lexer error[" << _filePath << ", " << position.line() << ", " << position.column() << "]: "
               << errorText << std::endl;
     std::exit(errorCode);
 }
@@ -112,14 +111,14 @@ void Lexer::errorUnexpectedEOF() {
 }
 
 Token Lexer::lexOneToken() {
-    TextPosition startPosition(_currentIndex, _currentLine, _currentColumn);
+    TextPosition startPosition = currentPosition();
     std::string tmpTokenText;
     Token result(TokenType::NIL, TokenMetaType::NIL, "", 0,
-                 startPosition, TextPosition(_currentIndex, _currentLine, _currentColumn),
+                 startPosition, currentPosition(),
                  false);
 
 #define PARSE_AND_RETURN_IF_TOKEN_TEXT_NOT_EMPTY() if (!tmpTokenText.empty()) return parseToken(tmpTokenText, startPosition, result.hasLeadingWhitespace);
-#define RETURN_GENERIC_TOKEN(nTokenType, nMetaType, nSymbol, nChar) ++_currentIndex; ++_currentColumn; return Token((nTokenType), (nMetaType), (nSymbol), (nChar), startPosition, TextPosition(_currentIndex, _currentLine, _currentColumn), result.hasLeadingWhitespace);
+#define RETURN_GENERIC_TOKEN(nTokenType, nMetaType, nSymbol, nChar) ++_currentIndex; return Token((nTokenType), (nMetaType), (nSymbol), (nChar), startPosition, currentPosition(), result.hasLeadingWhitespace);
 #define CHECK_NEXT_CHAR() (_currentIndex + 1) < _sourceCode.length() && _sourceCode[_currentIndex + 1]
 #define CHECK_AND_RETURN_EOF() if (_currentIndex == _sourceCode.length()) { result.tokenType = TokenType::ENDOFFILE; return result; }
 #define ERROR_IF_EOF() if (_currentIndex == _sourceCode.length()) { errorUnexpectedEOF(); }
@@ -129,30 +128,22 @@ Token Lexer::lexOneToken() {
 
     for (; _sourceCode[_currentIndex] == '\r' || _sourceCode[_currentIndex] == '\n' || isspace(_sourceCode[_currentIndex]); ++_currentIndex) {
         if (_sourceCode[_currentIndex] == '\r' || _sourceCode[_currentIndex] == '\n') {
-            ++_currentLine;
-            _currentColumn = 1;
-
             // If the character was '\r' then remove the '\n' that comes next
             if (_sourceCode[_currentIndex] == '\r' && (_currentIndex + 1) < _sourceCode.length() && _sourceCode[_currentIndex + 1] == '\n') {
                 ++_currentIndex;
             }
-        } else if (isspace(_sourceCode[_currentIndex])) {
-            ++_currentColumn;
         }
 
         result.hasLeadingWhitespace = true;
     }
 
-    startPosition = TextPosition(_currentIndex, _currentLine, _currentColumn);
+    startPosition = currentPosition();
 
-    for (; _currentIndex < _sourceCode.length(); ++_currentIndex, ++_currentColumn) {
+    for (; _currentIndex < _sourceCode.length(); ++_currentIndex) {
         if (_sourceCode[_currentIndex] == '\r' || _sourceCode[_currentIndex] == '\n') {
             PARSE_AND_RETURN_IF_TOKEN_TEXT_NOT_EMPTY();
             result.hasLeadingWhitespace = true;
 
-            ++_currentLine;
-            _currentColumn = 1;
-
             // If the character was '\r' then remove the '\n' that comes next
             if (_sourceCode[_currentIndex] == '\r' &&
                 (_currentIndex + 1) < _sourceCode.length() &&
@@ -177,9 +168,9 @@ if (isEscaped) { tmpString += static_cast<char>(escapedChar); isEscaped = false;
 else { tmpString += (unescapedChar); }
 
                     // We increment once to ignore the current double-quote
-                    for (++_currentIndex, ++_currentColumn;
+                    for (++_currentIndex;
                          _currentIndex < _sourceCode.length();
-                         ++_currentIndex, ++_currentColumn) {
+                         ++_currentIndex) {
                         switch (_sourceCode[_currentIndex]) {
                             case '"':
                                 if (isEscaped) {
@@ -250,7 +241,6 @@ else { tmpString += (unescapedChar); }
                     PARSE_AND_RETURN_IF_TOKEN_TEXT_NOT_EMPTY();
 
                     ++_currentIndex;
-                    ++_currentColumn;
 
                     ERROR_IF_EOF();
 
@@ -265,7 +255,6 @@ else { tmpString += (unescapedChar); }
                     switch (_sourceCode[_currentIndex]) {
                         case '\\':
                             ++_currentIndex;
-                            ++_currentColumn;
 
                             ERROR_IF_EOF();
 
@@ -318,13 +307,11 @@ else { tmpString += (unescapedChar); }
                             }
 
                             ++_currentIndex;
-                            ++_currentColumn;
 
                             break;
                         default:
                             resultChar = static_cast<unsigned int>(_sourceCode[_currentIndex]);
                             ++_currentIndex;
-                            ++_currentColumn;
                             break;
                     }
 
@@ -372,7 +359,6 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == '=') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::EQUALEQUALS, TokenMetaType::OPERATOR, "==", 0);
                     } else {
                         RETURN_GENERIC_TOKEN(TokenType::EQUALS, TokenMetaType::OPERATOR, "=", 0);
@@ -382,14 +368,12 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == '=') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::GREATEREQUALS, TokenMetaType::OPERATOR, ">=", 0);
                     } else if (_rightShiftEnabled && CHECK_NEXT_CHAR() == '>') {
                         ++_currentIndex;
-                        ++_currentColumn;
 
                         if (CHECK_NEXT_CHAR() == '=') {
-                            // TODO: Shouldn't we increment the index and column?
+                            // TODO: Shouldn't we increment the index?
                             RETURN_GENERIC_TOKEN(TokenType::RIGHTEQUALS, TokenMetaType::OPERATOR, ">>=", 0);
                         } else {
                             RETURN_GENERIC_TOKEN(TokenType::RIGHT, TokenMetaType::OPERATOR, ">>", 0);
@@ -406,14 +390,12 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == '=') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::LESSEQUALS, TokenMetaType::OPERATOR, "<", 0);
                     } else if (CHECK_NEXT_CHAR() == '<') {
                         ++_currentIndex;
-                        ++_currentColumn;
 
                         if (CHECK_NEXT_CHAR() == '=') {
-                            // TODO: Shouldn't we increment the index and column?
+                            // TODO: Shouldn't we increment the index?
                             RETURN_GENERIC_TOKEN(TokenType::LEFTEQUALS, TokenMetaType::OPERATOR, "<<=", 0);
                         } else {
                             RETURN_GENERIC_TOKEN(TokenType::LEFT, TokenMetaType::OPERATOR, "<<", 0);
@@ -426,7 +408,6 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == '=') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::NOTEQUALS, TokenMetaType::OPERATOR, "!=", 0);
                     } else {
                         RETURN_GENERIC_TOKEN(TokenType::NOT, TokenMetaType::OPERATOR, "!", 0);
@@ -439,11 +420,9 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == '=') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::PLUSEQUALS, TokenMetaType::OPERATOR, "+=", 0);
                     } else if (CHECK_NEXT_CHAR() == '+') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::PLUSPLUS, TokenMetaType::OPERATOR, "++", 0);
                     } else {
                         RETURN_GENERIC_TOKEN(TokenType::PLUS, TokenMetaType::OPERATOR, "+", 0);
@@ -453,15 +432,12 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == '=') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::MINUSEQUALS, TokenMetaType::OPERATOR, "-=", 0);
                     } else if (CHECK_NEXT_CHAR() == '-') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::MINUSMINUS, TokenMetaType::OPERATOR, "--", 0);
                     } else if (CHECK_NEXT_CHAR() == '>') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::ARROW, TokenMetaType::OPERATOR, "->", 0);
                     } else {
                         RETURN_GENERIC_TOKEN(TokenType::MINUS, TokenMetaType::OPERATOR, "-", 0);
@@ -471,7 +447,6 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == '=') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::STAREQUALS, TokenMetaType::OPERATOR, "*=", 0);
                     } else {
                         RETURN_GENERIC_TOKEN(TokenType::STAR, TokenMetaType::OPERATOR, "*", 0);
@@ -481,10 +456,9 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == '=') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::SLASHEQUALS, TokenMetaType::OPERATOR, "/=", 0);
                     } else if (CHECK_NEXT_CHAR() == '/') {
-                        for (_currentColumn = 1, ++_currentLine;
+                        for (;
                              _currentIndex < _sourceCode.length();
                              ++_currentIndex) {
                             if (_sourceCode[_currentIndex] == '\r') {
@@ -501,20 +475,16 @@ else { tmpString += (unescapedChar); }
 
                         continue;
                     } else if (CHECK_NEXT_CHAR() == '*') {
-                        for (++_currentIndex, ++_currentColumn;
+                        for (++_currentIndex;
                              _currentIndex < _sourceCode.length();
-                             ++_currentIndex, ++_currentColumn) {
+                             ++_currentIndex) {
                             if (_sourceCode[_currentIndex] == '\r' || _sourceCode[_currentIndex] == '\n') {
-                                _currentColumn = 1;
-                                ++_currentLine;
-
                                 if (_sourceCode[_currentIndex] == '\r' && CHECK_NEXT_CHAR() == '\n') {
                                     ++_currentIndex;
                                 }
                             } else if (_sourceCode[_currentIndex] == '*') {
                                 if (CHECK_NEXT_CHAR() == '/') {
                                     ++_currentIndex;
-                                    ++_currentColumn;
                                     break;
                                 }
                             }
@@ -529,7 +499,6 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == '=') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::PERCENTEQUALS, TokenMetaType::OPERATOR, "%=", 0);
                     } else {
                         RETURN_GENERIC_TOKEN(TokenType::PERCENT, TokenMetaType::OPERATOR, "%", 0);
@@ -547,11 +516,9 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == '=') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::AMPERSANDEQUALS, TokenMetaType::OPERATOR, "&=", 0);
                     } else if (CHECK_NEXT_CHAR() == '&') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::AMPERSANDAMPERSAND, TokenMetaType::OPERATOR, "&&", 0);
                     } else {
                         RETURN_GENERIC_TOKEN(TokenType::AMPERSAND, TokenMetaType::OPERATOR, "&", 0);
@@ -561,11 +528,9 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == '=') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::PIPEEQUALS, TokenMetaType::OPERATOR, "|=", 0);
                     } else if (CHECK_NEXT_CHAR() == '|') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::PIPEPIPE, TokenMetaType::OPERATOR, "||", 0);
                     } else {
                         RETURN_GENERIC_TOKEN(TokenType::PIPE, TokenMetaType::OPERATOR, "|", 0);
@@ -575,14 +540,12 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == '=') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::CARETEQUALS, TokenMetaType::OPERATOR, "^=", 0);
                     } else if (CHECK_NEXT_CHAR() == '^') {
                         ++_currentIndex;
-                        ++_currentColumn;
 
                         if (CHECK_NEXT_CHAR() == '=') {
-                            // TODO: Shouldn't we increment the index and column?
+                            // TODO: Shouldn't we increment the index?
                             RETURN_GENERIC_TOKEN(TokenType::CARETCARETEQUALS, TokenMetaType::OPERATOR, "^^=", 0);
                         } else {
                             RETURN_GENERIC_TOKEN(TokenType::CARETCARET, TokenMetaType::OPERATOR, "^^", 0);
@@ -598,7 +561,6 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == ':') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::COLONCOLON, TokenMetaType::OPERATOR, "::", 0);
                     } else {
                         RETURN_GENERIC_TOKEN(TokenType::COLON, TokenMetaType::OPERATOR, ":", 0);
@@ -608,28 +570,22 @@ else { tmpString += (unescapedChar); }
 
                     if (CHECK_NEXT_CHAR() == '?') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::QUESTIONQUESTION, TokenMetaType::OPERATOR, "??", 0);
                     } else if (CHECK_NEXT_CHAR() == '.') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::QUESTIONPERIOD, TokenMetaType::OPERATOR, "?.", 0);
                     } else if (CHECK_NEXT_CHAR() == '[') {
                         ++_currentIndex;
-                        ++_currentColumn;
                         RETURN_GENERIC_TOKEN(TokenType::QUESTIONLSQUARE, TokenMetaType::OPERATOR, "?[", 0);
                     } else if (CHECK_NEXT_CHAR() == '-') {
                         ++_currentIndex;
-                        ++_currentColumn;
 
                         if (CHECK_NEXT_CHAR() == '>') {
                             ++_currentIndex;
-                            ++_currentColumn;
 
                             RETURN_GENERIC_TOKEN(TokenType::QUESTIONARROW, TokenMetaType::OPERATOR, "?->", 0);
                         } else {
                             --_currentIndex;
-                            --_currentColumn;
                         }
                     }
 
@@ -660,7 +616,7 @@ else { tmpString += (unescapedChar); }
 
 Token Lexer::parseToken(std::string& tokenText, TextPosition startPosition, bool hasLeadingWhitespace) {
     Token result(TokenType::NIL, TokenMetaType::NIL, {}, 0,
-                 startPosition, TextPosition(_currentIndex, _currentLine, _currentColumn), hasLeadingWhitespace);
+                 startPosition, currentPosition(), hasLeadingWhitespace);
 
     if (std::isdigit(static_cast<unsigned char>(tokenText[0]))) {
         result.metaType = TokenMetaType::VALUE;
@@ -24,22 +24,19 @@
 namespace gulc {
     struct LexerCheckpoint {
         Token _nextToken = Token(TokenType::NIL, TokenMetaType::NIL, {}, 0, {}, {}, false);
-        unsigned int currentLine = 1;
-        unsigned int currentColumn = 0;
         unsigned int currentIndex = 0;
 
-        LexerCheckpoint(Token nextToken, unsigned int currentLine, unsigned int currentColumn,
-                        unsigned int currentIndex)
-                : _nextToken(std::move(nextToken)),
-                  currentLine(currentLine), currentColumn(currentColumn), currentIndex(currentIndex) { }
+        LexerCheckpoint(Token nextToken, unsigned int currentIndex)
+                : _nextToken(std::move(nextToken)), currentIndex(currentIndex) { }
 
     };
 
     class Lexer {
     public:
         Lexer() = default;
-        Lexer(std::string filePath, std::string sourceCode)
-                : _filePath(std::move(filePath)), _sourceCode(std::move(sourceCode)) { }
+        // `startOffset` is the offset `SourceManager` gave the first character of `sourceCode`
+        Lexer(std::string filePath, std::string sourceCode, unsigned int startOffset)
+                : _filePath(std::move(filePath)), _sourceCode(std::move(sourceCode)), _startOffset(startOffset) { }
 
         TokenType peekType();
         TokenMetaType peekMeta();
@@ -61,13 +58,14 @@ namespace gulc {
         std::string _filePath;
         std::string _sourceCode;
         Token _nextToken = Token(TokenType::NIL, TokenMetaType::NIL, {}, 0, {}, {}, false);
-        unsigned int _currentLine = 1;
-        unsigned int _currentColumn = 1;
+        unsigned int _startOffset = 0;
         unsigned int _currentIndex = 0;
         // We support disabling this so we can do 'GenericType1<GenericType2<GenericType3<int>>>' easily
         // This will make it so the last three '>' characters will come in as separate tokens rather than coming in as one '>' token and one '>>' token
         bool _rightShiftEnabled = true;
 
+        TextPosition currentPosition() const { return TextPosition(_startOffset + _currentIndex); }
+
         Token lexOneToken();
         Token parseToken(std::string& tokenText, TextPosition startPosition, bool hasLeadingWhitespace);
 
@@ -46,8 +46,12 @@
 #include <ast/exprs/CheckExtendsTypeExpr.hpp>
 #include <ast/exprs/TryExpr.hpp>
 #include <ast/exprs/RefExpr.hpp>
+#include <ast/exprs/NewExpr.hpp>
+#include <ast/exprs/DeleteExpr.hpp>
 #include <ast/decls/TraitPrototypeDecl.hpp>
 #include <ast/stmts/DoStmt.hpp>
+#include <ast/SourceManager.hpp>
+#include "ASTCache.hpp"
 #include "Parser.hpp"
 
 using namespace gulc;
@@ -59,13 +63,41 @@ ASTFile Parser::parseFile(unsigned int fileID, std::string const& filePath) {
         std::stringstream buffer;
         buffer << fileStream.rdbuf();
 
-        _lexer = Lexer(filePath, buffer.str());
-        _fileID = fileID;
-        _filePath = filePath;
+        if (_astCacheDirectory.empty()) {
+            return parseSource(fileID, filePath, buffer.str());
+        }
+
+        std::string sourceCode = buffer.str();
+        // A cached AST still needs its source registered, its positions are stored relative to the start of the file
+        unsigned int startOffset = SourceManager::get().addFile(filePath, sourceCode);
+        ASTCache astCache(_astCacheDirectory);
+        std::uint64_t sourceHash = ASTCache::hashSource(sourceCode);
+        std::uint64_t sourceSize = sourceCode.size();
+        ASTFile result;
+
+        if (astCache.load(fileID, startOffset, sourceHash, sourceSize, result)) {
+            return result;
+        }
+
+        result = parseSource(fileID, filePath, std::move(sourceCode), startOffset);
+        astCache.store(startOffset, sourceHash, sourceSize, result);
+        return result;
     } else {
         std::cout << "gulc error: file '" << filePath << "' was not found!" << std::endl;
         std::exit(1);
     }
+}
+
+ASTFile Parser::parseSource(unsigned int fileID, std::string const& filePath, std::string sourceCode) {
+    unsigned int startOffset = SourceManager::get().addFile(filePath, sourceCode);
+    return parseSource(fileID, filePath, std::move(sourceCode), startOffset);
+}
+
+ASTFile Parser::parseSource(unsigned int fileID, std::string const& filePath, std::string sourceCode,
+                            unsigned int startOffset) {
+    _lexer = Lexer(filePath, std::move(sourceCode), startOffset);
+    _fileID = fileID;
+    _filePath = filePath;
 
     std::vector<Decl*> result;
 
@@ -86,8 +118,8 @@ ASTFile Parser::parseFile(unsigned int fileID, std::string const& filePath) {
  */
 void Parser::printError(const std::string& errorMessage, TextPosition startPosition, TextPosition endPosition) {
     std::cout << "gulc parser error[" << _filePath << ", "
-                                   "{" << startPosition.line << ", " << startPosition.column << "} "
-                                   "to {" << endPosition.line << ", " << endPosition.column << "}]: "
+                                   "{" << startPosition.line() << ", " << startPosition.column() << "} "
+                                   "to {" << endPosition.line() << ", " << endPosition.column() << "}]: "
               << errorMessage
               << std::endl;
 
@@ -103,8 +135,8 @@ void Parser::printError(const std::string& errorMessage, TextPosition startPosit
  */
 void Parser::printWarning(const std::string &warningMessage, TextPosition startPosition, TextPosition endPosition) {
     std::cout << "gulc parser warning[" << _filePath << ", "
-                                     "{" << startPosition.line << ", " << startPosition.column << "} "
-                                     "to {" << endPosition.line << ", " << endPosition.column << "}]: "
+                                     "{" << startPosition.line() << ", " << startPosition.column() << "} "
+                                     "to {" << endPosition.line() << ", " << endPosition.column() << "}]: "
               << warningMessage
               << std::endl;
 }
@@ -1464,13 +1496,13 @@ PropertyDecl* Parser::parsePropertyDecl(std::vector<Attr*> attributes, Decl::Vis
 
     // We use these for detecting multiple `get` or `set` on the same line without `;` separating them
     bool isFirst = true;
-    TextPosition previousEndPosition = TextPosition(0, 0, 0);
+    TextPosition previousEndPosition = TextPosition();
 
     while (_lexer.peekType() != TokenType::RCURLY && _lexer.peekType() != TokenType::ENDOFFILE) {
         TextPosition getSetStartPosition = _lexer.peekStartPosition();
 
         if (!isFirst) {
-            if (previousEndPosition.line == getSetStartPosition.line) {
+            if (previousEndPosition.line() == getSetStartPosition.line()) {
                 printError("multiple `get` and `set` declarations can only be on the same line when separated by `;`!",
                            _lexer.peekStartPosition(), _lexer.peekEndPosition());
             }
@@ -1708,13 +1740,13 @@ SubscriptOperatorDecl* Parser::parseSubscriptOperator(std::vector<Attr*> attribu
 
     // We use these for detecting multiple `get` or `set` on the same line without `;` separating them
     bool isFirst = true;
-    TextPosition previousEndPosition = TextPosition(0, 0, 0);
+    TextPosition previousEndPosition = TextPosition();
 
     while (_lexer.peekType() != TokenType::RCURLY && _lexer.peekType() != TokenType::ENDOFFILE) {
         TextPosition getSetStartPosition = _lexer.peekStartPosition();
 
         if (!isFirst) {
-            if (previousEndPosition.line == getSetStartPosition.line) {
+            if (previousEndPosition.line() == getSetStartPosition.line()) {
                 printError("multiple `get` and `set` declarations can only be on the same line when separated by `;`!",
                            _lexer.peekStartPosition(), _lexer.peekEndPosition());
             }
@@ -2079,7 +2111,7 @@ ThrowsCont* Parser::parseThrowsCont() {
     }
 
     if (_lexer.peekType() == TokenType::SYMBOL) {
-        Identifier exceptionType = parseIdentifier();
+        Type* exceptionType = parseType();
 
         return new ThrowsCont(startPosition, endPosition, exceptionType);
     } else {
@@ -2152,8 +2184,34 @@ Stmt* Parser::parseStmt() {
             return parseReturnStmt();
         case TokenType::SWITCH:
             return parseSwitchStmt();
+        case TokenType::THROW:
+            return parseThrowStmt();
         case TokenType::WHILE:
             return parseWhileStmt();
+        case TokenType::ATSYMBOL: {
+            TextPosition atStartPosition = _lexer.peekStartPosition();
+            _lexer.consumeType(TokenType::ATSYMBOL);
+
+            // `@new` and `@delete` are expressions, not attributes
+            if (_lexer.peekCurrentSymbol() == "new" || _lexer.peekCurrentSymbol() == "delete") {
+                return parseMemoryExpr(atStartPosition);
+            }
+
+            // Statement attributes are only used for branch hints right now (`@likely if ...`)
+            std::vector<Attr*> attributes { parseAttr() };
+            std::vector<Attr*> remainingAttributes = parseAttrs();
+            attributes.insert(attributes.end(), remainingAttributes.begin(), remainingAttributes.end());
+
+            if (_lexer.peekType() != TokenType::IF) {
+                printError("statement attributes can only be applied to `if` statements, found `" +
+                           _lexer.peekCurrentSymbol() + "`!",
+                           _lexer.peekStartPosition(), _lexer.peekEndPosition());
+            }
+
+            IfStmt* ifStmt = parseIfStmt();
+            ifStmt->attributes = std::move(attributes);
+            return ifStmt;
+        }
         case TokenType::LCURLY:
             printError("`{` cannot appear alone as a statement, did you mean `do {`?",
                        _lexer.peekStartPosition(), _lexer.peekEndPosition());
@@ -2250,7 +2308,7 @@ CaseStmt* Parser::parseCaseStmt() {
 
             // If the preceding token wasn't a `;` we have to validate each statement is on its own line.
             if (!precedingTokenWasSemicolon && previousStmt != nullptr) {
-                if (previousStmt->endPosition().line == parsedStmt->startPosition().line) {
+                if (previousStmt->endPosition().line() == parsedStmt->startPosition().line()) {
                     printError("multiple statements on the same line must be separated by a `;`!",
                                previousStmt->startPosition(), parsedStmt->endPosition());
                 }
@@ -2268,6 +2326,11 @@ CatchStmt* Parser::parseCatchStmt() {
     TextPosition startPosition = _lexer.peekStartPosition();
     TextPosition endPosition = _lexer.peekEndPosition();
 
+    if (!_lexer.consumeType(TokenType::CATCH)) {
+        printError("expected `catch`, found `" + _lexer.peekCurrentSymbol() + "`!",
+                   _lexer.peekStartPosition(), _lexer.peekEndPosition());
+    }
+
     if (_lexer.peekType() == TokenType::SYMBOL) {
         // `catch e: exception`
         Identifier varName = parseIdentifier();
@@ -2321,7 +2384,7 @@ CompoundStmt* Parser::parseCompoundStmt() {
 
             // If the preceding token wasn't a `;` we have to validate each statement is on its own line.
             if (!precedingTokenWasSemicolon && previousStmt != nullptr) {
-                if (previousStmt->endPosition().line == parsedStmt->startPosition().line) {
+                if (previousStmt->endPosition().line() == parsedStmt->startPosition().line()) {
                     printError("multiple statements on the same line must be separated by a `;`!",
                             previousStmt->startPosition(), parsedStmt->endPosition());
                 }
@@ -2611,6 +2674,31 @@ SwitchStmt* Parser::parseSwitchStmt() {
     return new SwitchStmt(startPosition, endPosition, condition, cases);
 }
 
+ThrowStmt* Parser::parseThrowStmt() {
+    TextPosition startPosition = _lexer.peekStartPosition();
+    TextPosition endPosition = _lexer.peekEndPosition();
+
+    _lexer.consumeType(TokenType::THROW);
+
+    TokenMetaType checkTokenMetaType = _lexer.peekMeta();
+    TokenType checkTokenType = _lexer.peekType();
+
+    // The thrown value follows the same rules as the value after `return`
+    if (checkTokenMetaType == TokenMetaType::VALUE || checkTokenMetaType == TokenMetaType::OPERATOR ||
+            checkTokenType == TokenType::SIZEOF || checkTokenType == TokenType::ALIGNOF ||
+            checkTokenType == TokenType::OFFSETOF || checkTokenType == TokenType::NAMEOF ||
+            checkTokenType == TokenType::TRAITSOF || checkTokenType == TokenType::TRY ||
+            checkTokenType == TokenType::TRUE || checkTokenType == TokenType::FALSE ||
+            checkTokenType == TokenType::LSQUARE || checkTokenType == TokenType::LPAREN ||
+            checkTokenType == TokenType::GRAVE || checkTokenType == TokenType::REF) {
+        Expr* thrownValue = parseExpr();
+
+        return new ThrowStmt(startPosition, endPosition, thrownValue);
+    } else {
+        return new ThrowStmt(startPosition, endPosition);
+    }
+}
+
 WhileStmt* Parser::parseWhileStmt() {
     TextPosition startPosition = _lexer.peekStartPosition();
     TextPosition endPosition = _lexer.peekEndPosition();
@@ -3214,11 +3302,35 @@ Expr* Parser::parsePrefixes() {
 
             return new RefExpr(isMutable, expr, startPosition, endPosition);
         }
+        case TokenType::ATSYMBOL:
+            _lexer.consumeType(TokenType::ATSYMBOL);
+            return parseMemoryExpr(startPosition);
         default:
             return parseCallPostfixOrMemberAccess();
     }
 }
 
+Expr* Parser::parseMemoryExpr(TextPosition atStartPosition) {
+    TextPosition endPosition = _lexer.peekEndPosition();
+
+    if (_lexer.peekCurrentSymbol() == "new") {
+        _lexer.consumeType(TokenType::SYMBOL);
+        // `@new Type(...)`, the call is resolved to a constructor in `CodeProcessor`
+        Expr* initializer = parseCallPostfixOrMemberAccess();
+
+        return new NewExpr(initializer, atStartPosition, endPosition);
+    } else if (_lexer.peekCurrentSymbol() == "delete") {
+        _lexer.consumeType(TokenType::SYMBOL);
+        Expr* pointer = parsePrefixes();
+
+        return new DeleteExpr(pointer, atStartPosition, endPosition);
+    } else {
+        printError("expected `new` or `delete` after `@` in expression, found `" + _lexer.peekCurrentSymbol() + "`!",
+                   _lexer.peekStartPosition(), _lexer.peekEndPosition());
+        return nullptr;
+    }
+}
+
 Expr* Parser::parseCallPostfixOrMemberAccess() {
     Expr* result = parseIdentifierOrLiteralExpr();
 
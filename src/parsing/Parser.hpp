@@ -37,6 +37,7 @@
 #include <ast/stmts/LabeledStmt.hpp>
 #include <ast/stmts/ReturnStmt.hpp>
 #include <ast/stmts/SwitchStmt.hpp>
+#include <ast/stmts/ThrowStmt.hpp>
 #include <ast/stmts/DoCatchStmt.hpp>
 #include <ast/stmts/WhileStmt.hpp>
 #include <ast/decls/FunctionDecl.hpp>
@@ -67,13 +68,27 @@
 namespace gulc {
     class Parser {
     public:
+        Parser() = default;
+        /// `astCacheDirectory` enables caching the parsed ASTs, unchanged files are loaded from the cache instead of
+        /// being parsed again (see `ASTCache`)
+        explicit Parser(std::string astCacheDirectory)
+                : _astCacheDirectory(std::move(astCacheDirectory)) {}
+
         ASTFile parseFile(unsigned int fileID, std::string const& filePath);
+        // Parses `sourceCode` that was not read from `filePath` directly (e.g. declarations stored in a module
+        // interface), `filePath` is only used for error messages
+        ASTFile parseSource(unsigned int fileID, std::string const& filePath, std::string sourceCode);
 
     private:
+        std::string _astCacheDirectory;
         unsigned int _fileID;
         std::string _filePath;
         gulc::Lexer _lexer;
 
+        // `startOffset` is the offset `SourceManager` gave the first character of `sourceCode`
+        ASTFile parseSource(unsigned int fileID, std::string const& filePath, std::string sourceCode,
+                            unsigned int startOffset);
+
         void printError(const std::string& errorMessage, TextPosition startPosition, TextPosition endPosition);
         void printWarning(const std::string& warningMessage, TextPosition startPosition, TextPosition endPosition);
 
@@ -154,6 +169,7 @@ namespace gulc {
         RepeatWhileStmt* parseRepeatWhileStmt();
         ReturnStmt* parseReturnStmt();
         SwitchStmt* parseSwitchStmt();
+        ThrowStmt* parseThrowStmt();
         WhileStmt* parseWhileStmt();
 
         Expr* parseVariableExpr();
@@ -172,6 +188,8 @@ namespace gulc {
         Expr* parseMultiplicationDivisionOrRemainder();
         Expr* parseIsAsHas();
         Expr* parsePrefixes();
+        // Parses `new ...` or `delete ...` after its `@` was consumed
+        Expr* parseMemoryExpr(TextPosition atStartPosition);
         Expr* parseCallPostfixOrMemberAccess();
         // closeToken - `)` for functions, `]` for subscripts
         std::vector<LabeledArgumentExpr*> parseCallArguments(TokenType closeToken);
@@ -23,25 +23,24 @@
 #include <ast/types/StructType.hpp>
 #include <ast/types/DependentType.hpp>
 #include <ast/types/TraitType.hpp>
+#include <ast/attrs/UnresolvedAttr.hpp>
+#include <ast/attrs/CopyAttr.hpp>
+#include <ast/attrs/PodAttr.hpp>
+#include <ast/attrs/DynAttr.hpp>
+#include <ast/attrs/SoaAttr.hpp>
+#include <ast/attrs/FunctionHintAttr.hpp>
+#include <make_reverse_iterator.hpp>
 #include "BasicDeclValidator.hpp"
 
 void gulc::BasicDeclValidator::processFiles(std::vector<ASTFile>& files) {
-    for (ASTFile& file : files) {
-        _currentFile = &file;
-
-        validateImports(file.imports);
-
-        for (Decl* decl : file.declarations) {
-            validateDecl(decl);
-        }
-    }
+    traverseFiles(files);
 }
 
 void gulc::BasicDeclValidator::printError(const std::string& message, gulc::TextPosition startPosition,
                                           gulc::TextPosition endPosition) const {
     std::cerr << "gulc error[" << _filePaths[_currentFile->sourceFileID] << ", "
-                           "{" << startPosition.line << ", " << startPosition.column << " "
-                           "to " << endPosition.line << ", " << endPosition.column << "}]: "
+                           "{" << startPosition.line() << ", " << startPosition.column() << " "
+                           "to " << endPosition.line() << ", " << endPosition.column() << "}]: "
               << message << std::endl;
     std::exit(1);
 }
@@ -49,11 +48,179 @@ void gulc::BasicDeclValidator::printError(const std::string& message, gulc::Text
 void gulc::BasicDeclValidator::printWarning(const std::string& message, gulc::TextPosition startPosition,
                                             gulc::TextPosition endPosition) const {
     std::cerr << "gulc warning[" << _filePaths[_currentFile->sourceFileID] << ", "
-                             "{" << startPosition.line << ", " << startPosition.column << " "
-                             "to " << endPosition.line << ", " << endPosition.column << "}]: "
+                             "{" << startPosition.line() << ", " << startPosition.column() << " "
+                             "to " << endPosition.line() << ", " << endPosition.column() << "}]: "
               << message << std::endl;
 }
 
+gulc::Decl* gulc::BasicDeclValidator::currentContainerDecl() const {
+    // Members of an `enum` are given the container of the `enum`, not the `enum` itself
+    for (Decl* containingDecl : gulc::reverse(_containingDecls)) {
+        if (!llvm::isa<EnumDecl>(containingDecl)) {
+            return containingDecl;
+        }
+    }
+
+    return nullptr;
+}
+
+bool gulc::BasicDeclValidator::isGlobal() const {
+    return _containingDecls.empty() || llvm::isa<NamespaceDecl>(_containingDecls.back());
+}
+
+void gulc::BasicDeclValidator::setContainer(gulc::Decl* decl, gulc::Decl* container, bool containedInTemplate,
+                                            gulc::Type* containerTemplateType) const {
+    decl->container = container;
+    decl->containedInTemplate = containedInTemplate;
+
+    switch (decl->getDeclKind()) {
+        case Decl::Kind::Enum: {
+            auto enumDecl = llvm::dyn_cast<EnumDecl>(decl);
+            enumDecl->containerTemplateType = copyContainerTemplateType(containerTemplateType);
+
+            for (EnumConstDecl* enumConst : enumDecl->enumConsts()) {
+                setContainer(enumConst, enumDecl, containedInTemplate, containerTemplateType);
+            }
+
+            // Members of an `enum` are given the container of the `enum`, not the `enum` itself
+            for (Decl* ownedMember : enumDecl->ownedMembers()) {
+                setContainer(ownedMember, container, containedInTemplate, containerTemplateType);
+            }
+
+            break;
+        }
+        case Decl::Kind::Extension: {
+            auto extensionDecl = llvm::dyn_cast<ExtensionDecl>(decl);
+
+            for (Decl* ownedMember : extensionDecl->ownedMembers()) {
+                setContainer(ownedMember, extensionDecl, containedInTemplate, containerTemplateType);
+            }
+
+            break;
+        }
+        case Decl::Kind::Namespace: {
+            auto namespaceDecl = llvm::dyn_cast<NamespaceDecl>(decl);
+
+            for (Decl* nestedDecl : namespaceDecl->nestedDecls()) {
+                setContainer(nestedDecl, namespaceDecl, containedInTemplate, containerTemplateType);
+            }
+
+            break;
+        }
+        case Decl::Kind::Property: {
+            auto propertyDecl = llvm::dyn_cast<PropertyDecl>(decl);
+
+            for (PropertyGetDecl* getter : propertyDecl->getters()) {
+                setContainer(getter, propertyDecl, containedInTemplate, containerTemplateType);
+            }
+
+            if (propertyDecl->hasSetter()) {
+                setContainer(propertyDecl->setter(), propertyDecl, containedInTemplate, containerTemplateType);
+            }
+
+            break;
+        }
+        case Decl::Kind::SubscriptOperator: {
+            auto subscriptOperatorDecl = llvm::dyn_cast<SubscriptOperatorDecl>(decl);
+
+            for (SubscriptOperatorGetDecl* getter : subscriptOperatorDecl->getters()) {
+                setContainer(getter, subscriptOperatorDecl, containedInTemplate, containerTemplateType);
+            }
+
+            if (subscriptOperatorDecl->hasSetter()) {
+                setContainer(subscriptOperatorDecl->setter(), subscriptOperatorDecl, containedInTemplate,
+                             containerTemplateType);
+            }
+
+            break;
+        }
+        case Decl::Kind::Struct: {
+            auto structDecl = llvm::dyn_cast<StructDecl>(decl);
+            structDecl->containerTemplateType = copyContainerTemplateType(containerTemplateType);
+
+            // Nested structs within a template are dependent on the template (and every struct between them and the
+            // template)
+            setMemberContainers(structDecl, containedInTemplate,
+                                containerTemplateType == nullptr ? nullptr :
+                                new DependentType(Type::Qualifier::Unassigned, containerTemplateType,
+                                                  new StructType(Type::Qualifier::Unassigned, structDecl, {}, {})));
+            break;
+        }
+        case Decl::Kind::TemplateStruct: {
+            auto templateStructDecl = llvm::dyn_cast<TemplateStructDecl>(decl);
+            templateStructDecl->containerTemplateType = copyContainerTemplateType(containerTemplateType);
+
+            Type* templateStructType = new TemplateStructType(Type::Qualifier::Unassigned,
+                                                              createContainerTemplateArguments(
+                                                                      templateStructDecl->templateParameters()),
+                                                              templateStructDecl, {}, {});
+
+            setMemberContainers(templateStructDecl, true,
+                                containerTemplateType == nullptr ? templateStructType :
+                                new DependentType(Type::Qualifier::Unassigned, containerTemplateType,
+                                                  templateStructType));
+            break;
+        }
+        case Decl::Kind::Trait: {
+            auto traitDecl = llvm::dyn_cast<TraitDecl>(decl);
+            traitDecl->containerTemplateType = copyContainerTemplateType(containerTemplateType);
+
+            setMemberContainers(traitDecl, containedInTemplate,
+                                containerTemplateType == nullptr ? nullptr :
+                                new DependentType(Type::Qualifier::Unassigned, containerTemplateType,
+                                                  new TraitType(Type::Qualifier::Unassigned, traitDecl, {}, {})));
+            break;
+        }
+        case Decl::Kind::TemplateTrait: {
+            auto templateTraitDecl = llvm::dyn_cast<TemplateTraitDecl>(decl);
+            templateTraitDecl->containerTemplateType = copyContainerTemplateType(containerTemplateType);
+
+            Type* templateTraitType = new TemplateTraitType(Type::Qualifier::Unassigned,
+                                                            createContainerTemplateArguments(
+                                                                    templateTraitDecl->templateParameters()),
+                                                            templateTraitDecl, {}, {});
+
+            setMemberContainers(templateTraitDecl, true,
+                                containerTemplateType == nullptr ? templateTraitType :
+                                new DependentType(Type::Qualifier::Unassigned, containerTemplateType,
+                                                  templateTraitType));
+            break;
+        }
+        case Decl::Kind::TypeAlias:
+            llvm::dyn_cast<TypeAliasDecl>(decl)->containerTemplateType =
+                    copyContainerTemplateType(containerTemplateType);
+            break;
+        default:
+            break;
+    }
+}
+
+void gulc::BasicDeclValidator::setMemberContainers(gulc::StructDecl* structDecl, bool containedInTemplate,
+                                                   gulc::Type* memberContainerTemplateType) const {
+    for (ConstructorDecl* constructorDecl : structDecl->constructors()) {
+        setContainer(constructorDecl, structDecl, containedInTemplate, memberContainerTemplateType);
+    }
+
+    for (Decl* ownedMember : structDecl->ownedMembers()) {
+        setContainer(ownedMember, structDecl, containedInTemplate, memberContainerTemplateType);
+    }
+
+    if (structDecl->destructor != nullptr) {
+        setContainer(structDecl->destructor, structDecl, containedInTemplate, memberContainerTemplateType);
+    }
+}
+
+void gulc::BasicDeclValidator::setMemberContainers(gulc::TraitDecl* traitDecl, bool containedInTemplate,
+                                                   gulc::Type* memberContainerTemplateType) const {
+    for (Decl* ownedMember : traitDecl->ownedMembers()) {
+        setContainer(ownedMember, traitDecl, containedInTemplate, memberContainerTemplateType);
+    }
+}
+
+gulc::Type* gulc::BasicDeclValidator::copyContainerTemplateType(gulc::Type* containerTemplateType) {
+    return containerTemplateType == nullptr ? nullptr : containerTemplateType->deepCopy();
+}
+
 void gulc::BasicDeclValidator::validateImports(std::vector<ImportDecl*>& imports) const {
     for (ImportDecl* importDecl : imports) {
         bool importFound = false;
@@ -130,25 +297,26 @@ gulc::Decl* gulc::BasicDeclValidator::getRedefinition(std::string const& findNam
     if (findName == "_") return nullptr;
 
     std::vector<Decl*>* searchDecls = nullptr;
+    Decl* containerDecl = currentContainerDecl();
 
-    if (_currentContainerDecl == nullptr) {
+    if (containerDecl == nullptr) {
         searchDecls = &_currentFile->declarations;
     } else {
-        if (llvm::isa<NamespaceDecl>(_currentContainerDecl)) {
+        if (llvm::isa<NamespaceDecl>(containerDecl)) {
             // Namespaces are a special case where we have to grab their prototype for them to work properly
             // NOTE: We don't check if `prototype` is null because the prototype will be set by this point
-            searchDecls = &llvm::dyn_cast<NamespaceDecl>(_currentContainerDecl)->prototype->nestedDecls();
-        } else if (llvm::isa<StructDecl>(_currentContainerDecl)) {
-            searchDecls = &llvm::dyn_cast<StructDecl>(_currentContainerDecl)->ownedMembers();
-        } else if (llvm::isa<TraitDecl>(_currentContainerDecl)) {
-            searchDecls = &llvm::dyn_cast<TraitDecl>(_currentContainerDecl)->ownedMembers();
-        } else if (llvm::isa<TemplateStructDecl>(_currentContainerDecl)) {
-            searchDecls = &llvm::dyn_cast<TemplateStructDecl>(_currentContainerDecl)->ownedMembers();
-        } else if (llvm::isa<TemplateTraitDecl>(_currentContainerDecl)) {
-            searchDecls = &llvm::dyn_cast<TemplateTraitDecl>(_currentContainerDecl)->ownedMembers();
+            searchDecls = &llvm::dyn_cast<NamespaceDecl>(containerDecl)->prototype->nestedDecls();
+        } else if (llvm::isa<StructDecl>(containerDecl)) {
+            searchDecls = &llvm::dyn_cast<StructDecl>(containerDecl)->ownedMembers();
+        } else if (llvm::isa<TraitDecl>(containerDecl)) {
+            searchDecls = &llvm::dyn_cast<TraitDecl>(containerDecl)->ownedMembers();
+        } else if (llvm::isa<TemplateStructDecl>(containerDecl)) {
+            searchDecls = &llvm::dyn_cast<TemplateStructDecl>(containerDecl)->ownedMembers();
+        } else if (llvm::isa<TemplateTraitDecl>(containerDecl)) {
+            searchDecls = &llvm::dyn_cast<TemplateTraitDecl>(containerDecl)->ownedMembers();
         } else {
             printError("[INTERNAL] unknown containing decl found in `BasicDeclValidator::getRedefinition`!",
-                       _currentContainerDecl->startPosition(), _currentContainerDecl->endPosition());
+                       containerDecl->startPosition(), containerDecl->endPosition());
         }
     }
 
@@ -236,236 +404,510 @@ void gulc::BasicDeclValidator::validateTemplateParameters(const std::vector<Temp
     }
 }
 
-void gulc::BasicDeclValidator::validateDecl(gulc::Decl* decl, bool isGlobal) {
-    decl->container = _currentContainerDecl;
-    decl->containedInTemplate = !_templateParameters.empty();
+void gulc::BasicDeclValidator::resolveBuiltInAttributes(gulc::Decl* decl) const {
+    for (Attr*& attribute : decl->attributes()) {
+        auto unresolvedAttr = llvm::dyn_cast<UnresolvedAttr>(attribute);
 
-    switch (decl->getDeclKind()) {
-        case Decl::Kind::CallOperator:
-            validateCallOperatorDecl(llvm::dyn_cast<CallOperatorDecl>(decl));
-            break;
-        case Decl::Kind::Constructor:
-            validateConstructorDecl(llvm::dyn_cast<ConstructorDecl>(decl));
-            break;
-        case Decl::Kind::Destructor:
-            validateDestructorDecl(llvm::dyn_cast<DestructorDecl>(decl));
-            break;
-        case Decl::Kind::Enum:
-            validateEnumDecl(llvm::dyn_cast<EnumDecl>(decl));
-            break;
-        case Decl::Kind::EnumConst:
-            printError("enum `case` cannot appear outside of an `enum`!",
-                       decl->startPosition(), decl->endPosition());
-            break;
-        case Decl::Kind::Extension:
-            validateExtensionDecl(llvm::dyn_cast<ExtensionDecl>(decl));
-            break;
-        case Decl::Kind::Function:
-            validateFunctionDecl(llvm::dyn_cast<FunctionDecl>(decl));
-            break;
-        case Decl::Kind::Import:
-            // Imports have already been validated.
-            break;
-        case Decl::Kind::Namespace:
-            validateNamespaceDecl(llvm::dyn_cast<NamespaceDecl>(decl));
-            break;
-        case Decl::Kind::Operator:
-            validateOperatorDecl(llvm::dyn_cast<OperatorDecl>(decl));
-            break;
-        case Decl::Kind::Parameter:
-            // There isn't anything we can do for single parameters here.
-            break;
-        case Decl::Kind::Property:
-            validatePropertyDecl(llvm::dyn_cast<PropertyDecl>(decl), isGlobal);
-            break;
-        case Decl::Kind::PropertyGet:
-            validatePropertyGetDecl(llvm::dyn_cast<PropertyGetDecl>(decl));
-            break;
-        case Decl::Kind::PropertySet:
-            validatePropertySetDecl(llvm::dyn_cast<PropertySetDecl>(decl));
-            break;
-        case Decl::Kind::Struct:
-            validateStructDecl(llvm::dyn_cast<StructDecl>(decl), true, true);
-            break;
-        case Decl::Kind::SubscriptOperator:
-            validateSubscriptOperatorDecl(llvm::dyn_cast<SubscriptOperatorDecl>(decl), isGlobal);
-            break;
-        case Decl::Kind::SubscriptOperatorGet:
-            validateSubscriptOperatorGetDecl(llvm::dyn_cast<SubscriptOperatorGetDecl>(decl));
-            break;
-        case Decl::Kind::SubscriptOperatorSet:
-            validateSubscriptOperatorSetDecl(llvm::dyn_cast<SubscriptOperatorSetDecl>(decl));
-            break;
-        case Decl::Kind::TemplateFunction:
-            validateTemplateFunctionDecl(llvm::dyn_cast<TemplateFunctionDecl>(decl));
-            break;
-        case Decl::Kind::TemplateParameter:
-            // There isn't anything we can do for single template parameters here.
-            break;
-        case Decl::Kind::TemplateStruct:
-            validateTemplateStructDecl(llvm::dyn_cast<TemplateStructDecl>(decl));
-            break;
-        case Decl::Kind::TemplateStructInst:
-            // Template struct instantiations shouldn't exist yet here.
-            break;
-        case Decl::Kind::TemplateTrait:
-            validateTemplateTraitDecl(llvm::dyn_cast<TemplateTraitDecl>(decl));
-            break;
-        case Decl::Kind::TemplateTraitInst:
-            // Template trait instantiations shouldn't exist yet here.
-            break;
-        case Decl::Kind::Trait:
-            validateTraitDecl(llvm::dyn_cast<TraitDecl>(decl), true, true);
-            break;
-        case Decl::Kind::TypeAlias:
-            validateTypeAliasDecl(llvm::dyn_cast<TypeAliasDecl>(decl));
-            break;
-        case Decl::Kind::TypeSuffix:
-            validateTypeSuffixDecl(llvm::dyn_cast<TypeSuffixDecl>(decl), isGlobal);
-            break;
-        case Decl::Kind::Variable:
-            validateVariableDecl(llvm::dyn_cast<VariableDecl>(decl), isGlobal);
-            break;
-        default:
-            printError("[INTERNAL ERROR] unsupported Decl found in `BasicDeclValidator::processDecl`!",
-                       decl->startPosition(), decl->endPosition());
-            break;
-    }
-}
+        // Built-in attributes are never namespaced, anything else is left for a later custom attribute pass.
+        if (unresolvedAttr == nullptr || !unresolvedAttr->namespacePath().empty()) {
+            continue;
+        }
 
-void gulc::BasicDeclValidator::validateCallOperatorDecl(gulc::CallOperatorDecl* callOperatorDecl) const {
-    // `call` cannot be `static` because the syntax would be too ambiguous when paired with the constructor syntax
-    // (i.e. is `ExampleType()` a `call` or an `init`?)
-    if (callOperatorDecl->isStatic()) {
-        printError("`call` cannot be marked `static`!",
-                   callOperatorDecl->startPosition(), callOperatorDecl->endPosition());
-    }
+        std::string const& attrName = unresolvedAttr->identifier().name();
+        Attr* resolvedAttr = nullptr;
 
-    validateFunctionDecl(callOperatorDecl);
-}
+        if (attrName == "copy") {
+            resolvedAttr = new CopyAttr(unresolvedAttr->startPosition(), unresolvedAttr->endPosition());
+        } else if (attrName == "pod") {
+            if (!llvm::isa<StructDecl>(decl) && !llvm::isa<TemplateStructDecl>(decl)) {
+                printError("`@pod` can only be applied to a `struct` or `class`!",
+                           unresolvedAttr->startPosition(), unresolvedAttr->endPosition());
+            }
 
-void gulc::BasicDeclValidator::validateConstructorDecl(gulc::ConstructorDecl* constructorDecl) const {
-    if (constructorDecl->isAnyVirtual()) {
-        printError("`init` cannot be marked `virtual`, `abstract`, or `override`!",
-                   constructorDecl->startPosition(), constructorDecl->endPosition());
-    }
+            resolvedAttr = new PodAttr(unresolvedAttr->startPosition(), unresolvedAttr->endPosition());
+        } else if (attrName == "soa") {
+            if (!llvm::isa<StructDecl>(decl) && !llvm::isa<TemplateStructDecl>(decl)) {
+                printError("`@soa` can only be applied to a `struct` or `class`!",
+                           unresolvedAttr->startPosition(), unresolvedAttr->endPosition());
+            }
 
-    if (constructorDecl->isStatic()) {
-        printError("`init` cannot be marked `static`!",
-                   constructorDecl->startPosition(), constructorDecl->endPosition());
-    }
+            resolvedAttr = new SoaAttr(unresolvedAttr->startPosition(), unresolvedAttr->endPosition());
+        } else if (attrName == "dyn") {
+            if (!llvm::isa<TemplateFunctionDecl>(decl)) {
+                printError("`@dyn` can only be applied to a template function!",
+                           unresolvedAttr->startPosition(), unresolvedAttr->endPosition());
+            }
 
-    if (constructorDecl->isMutable()) {
-        printError("`init` cannot be marked `mut`, `init` is implicitly `mut` by default!",
-                   constructorDecl->startPosition(), constructorDecl->endPosition());
-    }
+            resolvedAttr = new DynAttr(unresolvedAttr->startPosition(), unresolvedAttr->endPosition());
+        } else if (attrName == "inline" || attrName == "noinline" || attrName == "cold" || attrName == "hot" ||
+                   attrName == "flatten" || attrName == "minsize") {
+            bool canHaveFunctionHints = false;
+
+            switch (decl->getDeclKind()) {
+                case Decl::Kind::CallOperator:
+                case Decl::Kind::Function:
+                case Decl::Kind::Operator:
+                case Decl::Kind::Property:
+                case Decl::Kind::PropertyGet:
+                case Decl::Kind::PropertySet:
+                case Decl::Kind::SubscriptOperator:
+                case Decl::Kind::SubscriptOperatorGet:
+                case Decl::Kind::SubscriptOperatorSet:
+                case Decl::Kind::TypeSuffix:
+                    canHaveFunctionHints = true;
+                    break;
+                default:
+                    break;
+            }
 
-    validateFunctionDecl(constructorDecl);
-}
+            if (!canHaveFunctionHints) {
+                printError("`@" + attrName + "` can only be applied to functions, operators, properties, and "
+                           "subscripts!",
+                           unresolvedAttr->startPosition(), unresolvedAttr->endPosition());
+            }
 
-void gulc::BasicDeclValidator::validateDestructorDecl(gulc::DestructorDecl* destructorDecl) const {
-    if (destructorDecl->isMutable()) {
-        printError("`deinit` cannot be marked `mut`, `deinit` is implicitly `mut` by default!",
-                   destructorDecl->startPosition(), destructorDecl->endPosition());
-    }
+            FunctionHintAttr::Hint hint;
+
+            if (attrName == "inline") {
+                hint = FunctionHintAttr::Hint::Inline;
+            } else if (attrName == "noinline") {
+                hint = FunctionHintAttr::Hint::NoInline;
+            } else if (attrName == "cold") {
+                hint = FunctionHintAttr::Hint::Cold;
+            } else if (attrName == "hot") {
+                hint = FunctionHintAttr::Hint::Hot;
+            } else if (attrName == "flatten") {
+                hint = FunctionHintAttr::Hint::Flatten;
+            } else {
+                hint = FunctionHintAttr::Hint::MinSize;
+            }
 
-    if (destructorDecl->isStatic()) {
-        printError("`deinit` cannot be marked `static`!",
-                   destructorDecl->startPosition(), destructorDecl->endPosition());
-    }
+            resolvedAttr = new FunctionHintAttr(hint, unresolvedAttr->startPosition(),
+                                                unresolvedAttr->endPosition());
+        } else if (attrName == "likely" || attrName == "unlikely") {
+            printError("`@" + attrName + "` can only be applied to an `if` statement!",
+                       unresolvedAttr->startPosition(), unresolvedAttr->endPosition());
+        }
 
-    validateFunctionDecl(destructorDecl);
-}
+        if (resolvedAttr != nullptr) {
+            if (!unresolvedAttr->arguments.empty()) {
+                printError("attribute `@" + attrName + "` does not accept any arguments!",
+                           unresolvedAttr->startPosition(), unresolvedAttr->endPosition());
+            }
 
-void gulc::BasicDeclValidator::validateEnumDecl(gulc::EnumDecl* enumDecl) {
-    if (enumDecl->isConstExpr()) {
-        printError("`enum` cannot be marked `const`, enums are `const` by default!",
-                   enumDecl->startPosition(), enumDecl->endPosition());
+            delete attribute;
+            attribute = resolvedAttr;
+        }
     }
 
-    if (enumDecl->isStatic()) {
-        printError("enums cannot be marked `static`!",
-                   enumDecl->startPosition(), enumDecl->endPosition());
-    }
+    // Contradicting hints are almost always a copy and paste mistake, we error instead of silently picking one
+    bool hasInline = false;
+    bool hasNoInline = false;
+    bool hasCold = false;
+    bool hasHot = false;
+
+    for (Attr* attribute : decl->attributes()) {
+        if (auto functionHintAttr = llvm::dyn_cast<FunctionHintAttr>(attribute)) {
+            switch (functionHintAttr->hint()) {
+                case FunctionHintAttr::Hint::Inline:
+                    hasInline = true;
+                    break;
+                case FunctionHintAttr::Hint::NoInline:
+                    hasNoInline = true;
+                    break;
+                case FunctionHintAttr::Hint::Cold:
+                    hasCold = true;
+                    break;
+                case FunctionHintAttr::Hint::Hot:
+                    hasHot = true;
+                    break;
+                default:
+                    break;
+            }
 
-    if (enumDecl->isMutable()) {
-        printError("enums cannot be marked `mut`!",
-                   enumDecl->startPosition(), enumDecl->endPosition());
+            if ((hasInline && hasNoInline) || (hasCold && hasHot)) {
+                printError("`@" + functionHintAttr->hintName() + "` contradicts another attribute on the same "
+                           "declaration!",
+                           functionHintAttr->startPosition(), functionHintAttr->endPosition());
+            }
+        }
     }
+}
 
-    if (enumDecl->isAnyVirtual()) {
-        printError("enums cannot be marked `virtual`, `abstract`, or `override`!",
-                   enumDecl->startPosition(), enumDecl->endPosition());
+void gulc::BasicDeclValidator::validateFunctionDecl(gulc::FunctionDecl* functionDecl) const {
+    validateParameters(functionDecl->parameters());
+
+    if (functionDecl->isConstExpr() && (functionDecl->isExtern() || functionDecl->isPrototype())) {
+        printError("`const` functions must have a body to be run at compile time!",
+                   functionDecl->startPosition(), functionDecl->endPosition());
     }
 
-    if (enumDecl->isVolatile()) {
-        printError("enums cannot be marked `override`!",
-                   enumDecl->startPosition(), enumDecl->endPosition());
+    if (functionDecl->isExtern() && !functionDecl->isPrototype()) {
+        printError("`extern` functions cannot have a provided body!",
+                   functionDecl->startPosition(), functionDecl->endPosition());
     }
 
-    if (enumDecl->isExtern()) {
-        printError("enums cannot be marked `extern`!",
-                   enumDecl->startPosition(), enumDecl->endPosition());
+    if (functionDecl->isAbstract() && !functionDecl->isPrototype()) {
+        printError("`abstract` functions cannot have a provided body!",
+                   functionDecl->startPosition(), functionDecl->endPosition());
     }
+}
 
-    enumDecl->containerTemplateType = _currentContainerTemplateType != nullptr ?
-                                      _currentContainerTemplateType->deepCopy() : nullptr;
+void gulc::BasicDeclValidator::validateStructDecl(gulc::StructDecl* structDecl, bool checkForRedefinition) const {
+    if (structDecl->isMutable()) {
+        printError("`" + structDecl->structKindName() + " " + structDecl->identifier().name() + "` cannot be marked `mut`!",
+                   structDecl->startPosition(), structDecl->endPosition());
+    }
 
-    for (EnumConstDecl* enumConst : enumDecl->enumConsts()) {
-        enumConst->container = enumDecl;
-        enumConst->containedInTemplate = enumDecl->containedInTemplate;
+    if (structDecl->isOverride()) {
+        printError("`" + structDecl->structKindName() + " " + structDecl->identifier().name() + "` cannot be marked `override`!",
+                   structDecl->startPosition(), structDecl->endPosition());
+    }
 
-        for (EnumConstDecl* checkDuplicate : enumDecl->enumConsts()) {
-            if (checkDuplicate == enumConst) continue;
+    if (structDecl->isVirtual()) {
+        printError("`" + structDecl->structKindName() + " " + structDecl->identifier().name() + "` cannot be marked `virtual`!",
+                   structDecl->startPosition(), structDecl->endPosition());
+    }
 
-            if (enumDecl->identifier().name() == checkDuplicate->identifier().name()) {
-                printError("enum `" + enumDecl->identifier().name() + "` contains multiple definitions of "
-                           "const `" + checkDuplicate->identifier().name() + "`!",
-                           checkDuplicate->startPosition(), checkDuplicate->endPosition());
-            }
-        }
+    if (structDecl->isExtern()) {
+        printError("`" + structDecl->structKindName() + " " + structDecl->identifier().name() + "` cannot be marked `extern`!",
+                   structDecl->startPosition(), structDecl->endPosition());
     }
 
-    for (Decl* ownedMember : enumDecl->ownedMembers()) {
-        ownedMember->container = enumDecl;
-        ownedMember->containedInTemplate = enumDecl->containedInTemplate;
+    if (structDecl->isVolatile()) {
+        printError("`" + structDecl->structKindName() + " " + structDecl->identifier().name() + "` cannot be marked `volatile`!",
+                   structDecl->startPosition(), structDecl->endPosition());
+    }
 
-        if (llvm::isa<NamespaceDecl>(ownedMember)) {
-            printError("`namespace` cannot be contained within `enum`!",
-                       ownedMember->startPosition(), ownedMember->endPosition());
+    if (structDecl->structKind() == StructDecl::Kind::Union) {
+        // Unions cannot be `static` or `abstract`
+        if (structDecl->isStatic()) {
+            printError("unions cannot be marked `static`!",
+                       structDecl->startPosition(), structDecl->endPosition());
         }
 
-        if (llvm::isa<ImportDecl>(ownedMember)) {
-            printError("`import` cannot be contained within `enum`!",
-                       ownedMember->startPosition(), ownedMember->endPosition());
+        if (structDecl->isAbstract()) {
+            printError("unions cannot be marked `abstract`!",
+                       structDecl->startPosition(), structDecl->endPosition());
         }
+    }
 
-        if (llvm::isa<ExtensionDecl>(ownedMember)) {
-            printError("`extension` cannot be contained within `enum`!",
-                       ownedMember->startPosition(), ownedMember->endPosition());
+    if (structDecl->isStatic()) {
+        // Static structs CANNOT have constructors or destructors
+        if (!structDecl->constructors().empty()) {
+            printError("`static " + structDecl->structKindName() + "` cannot have constructors!",
+                       structDecl->startPosition(), structDecl->endPosition());
         }
 
-        // TODO: What about `const var` is that allowed?
-        if (llvm::isa<VariableDecl>(ownedMember) && !(ownedMember->isStatic())) {
-            printError("non-static `var` cannot be container within `enum`!",
-                       ownedMember->startPosition(), ownedMember->endPosition());
+        if (structDecl->destructor != nullptr) {
+            printError("`static " + structDecl->structKindName() + "` cannot have a destructor!",
+                       structDecl->startPosition(), structDecl->endPosition());
         }
-
-        validateDecl(ownedMember, false);
     }
 
-    Decl* redefinition = getRedefinition(enumDecl->identifier().name(), enumDecl);
-
-    if (redefinition != nullptr) {
-        printError("redefinition of symbol `" + enumDecl->identifier().name() + "` detected!",
-                   redefinition->startPosition(), redefinition->endPosition());
+    if (structDecl->isConstExpr()) {
+        printError("[INTERNAL] `const` is not yet supported!",
+                   structDecl->startPosition(), structDecl->endPosition());
     }
-}
 
-void gulc::BasicDeclValidator::validateExtensionDecl(gulc::ExtensionDecl* extensionDecl) {
-    if (extensionDecl->isConstExpr()) {
-        printError("extensions cannot be marked `const`!",
-                   extensionDecl->startPosition(), extensionDecl->endPosition());
+    for (Decl* checkDecl : structDecl->ownedMembers()) {
+        if (llvm::isa<NamespaceDecl>(checkDecl)) {
+            printError("`namespace` cannot be contained within `" + structDecl->structKindName() + "`!",
+                       checkDecl->startPosition(), checkDecl->endPosition());
+        }
+
+        if (llvm::isa<ImportDecl>(checkDecl)) {
+            printError("`import` cannot be contained within `" + structDecl->structKindName() + "`!",
+                       checkDecl->startPosition(), checkDecl->endPosition());
+        }
+
+        if (llvm::isa<ExtensionDecl>(checkDecl)) {
+            printError("`extension` cannot be contained within `" + structDecl->structKindName() + "`!",
+                       checkDecl->startPosition(), checkDecl->endPosition());
+        }
+
+        if (structDecl->isStatic()) {
+            if (llvm::isa<FunctionDecl>(checkDecl) || llvm::isa<PropertyDecl>(checkDecl) ||
+                llvm::isa<SubscriptOperatorDecl>(checkDecl) || llvm::isa<VariableDecl>(checkDecl)) {
+                if (!checkDecl->isStatic()) {
+                    printError("`static " + structDecl->structKindName() + "` can only contain static members!",
+                               checkDecl->startPosition(), checkDecl->endPosition());
+                }
+            } else if (llvm::isa<CallOperatorDecl>(checkDecl)) {
+                printError("`static " + structDecl->structKindName() + "` cannot contain a `call` definition!",
+                           checkDecl->startPosition(), checkDecl->endPosition());
+            }
+        }
+    }
+
+    if (checkForRedefinition) {
+        Decl* redefinition = getRedefinition(structDecl->identifier().name(), structDecl);
+
+        if (redefinition != nullptr) {
+            printError("redefinition of symbol `" + structDecl->identifier().name() + "` detected!",
+                       redefinition->startPosition(), redefinition->endPosition());
+        }
+    }
+}
+
+void gulc::BasicDeclValidator::validateTraitDecl(gulc::TraitDecl* traitDecl, bool checkForRedefinition) const {
+    if (traitDecl->isAbstract()) {
+        printError("traits cannot be marked `abstract`!",
+                   traitDecl->startPosition(), traitDecl->endPosition());
+    }
+
+    if (traitDecl->isStatic()) {
+        printError("traits cannot be marked `static`!",
+                   traitDecl->startPosition(), traitDecl->endPosition());
+    }
+
+    if (traitDecl->isVirtual()) {
+        printError("traits cannot be marked `virtual`!",
+                   traitDecl->startPosition(), traitDecl->endPosition());
+    }
+
+    if (traitDecl->isOverride()) {
+        printError("traits cannot be marked `override`!",
+                   traitDecl->startPosition(), traitDecl->endPosition());
+    }
+
+    if (traitDecl->isMutable()) {
+        printError("traits cannot be marked `mut`!",
+                   traitDecl->startPosition(), traitDecl->endPosition());
+    }
+
+    if (traitDecl->isExtern()) {
+        printError("traits cannot be marked `extern`!",
+                   traitDecl->startPosition(), traitDecl->endPosition());
+    }
+
+    if (traitDecl->isVolatile()) {
+        printError("traits cannot be marked `volatile`!",
+                   traitDecl->startPosition(), traitDecl->endPosition());
+    }
+
+    if (traitDecl->isConstExpr()) {
+        printError("[INTERNAL] `const` is not yet supported!",
+                   traitDecl->startPosition(), traitDecl->endPosition());
+    }
+
+    for (Decl* checkDecl : traitDecl->ownedMembers()) {
+        if (llvm::isa<NamespaceDecl>(checkDecl)) {
+            printError("`namespace` cannot be contained within traits!",
+                       checkDecl->startPosition(), checkDecl->endPosition());
+        }
+
+        if (llvm::isa<ImportDecl>(checkDecl)) {
+            printError("`import` cannot be contained within traits!",
+                       checkDecl->startPosition(), checkDecl->endPosition());
+        }
+
+        if (llvm::isa<VariableDecl>(checkDecl)) {
+            auto checkVariable = llvm::dyn_cast<VariableDecl>(checkDecl);
+
+            // Traits cannot contain data members
+            if (!checkVariable->isConstExpr() && !checkVariable->isStatic()) {
+                printError("traits cannot contain variables that are not marked `static` or `const`!",
+                           checkVariable->startPosition(), checkVariable->endPosition());
+            }
+        }
+
+        if (checkDecl->isAnyVirtual()) {
+            printError("trait members cannot be marked `abstract`, `virtual`, or `override`!",
+                       checkDecl->startPosition(), checkDecl->endPosition());
+        }
+    }
+
+    if (checkForRedefinition) {
+        Decl* redefinition = getRedefinition(traitDecl->identifier().name(), traitDecl);
+
+        if (redefinition != nullptr) {
+            printError("redefinition of symbol `" + traitDecl->identifier().name() + "` detected!",
+                       redefinition->startPosition(), redefinition->endPosition());
+        }
+    }
+}
+
+std::vector<gulc::Expr*> gulc::BasicDeclValidator::createContainerTemplateArguments(
+        std::vector<TemplateParameterDecl*> const& templateParameters) const {
+    // Create the list of template parameters from the template parameters
+    std::vector<Expr*> containerTemplateArguments;
+    containerTemplateArguments.reserve(templateParameters.size());
+
+    for (TemplateParameterDecl* templateParameter : templateParameters) {
+        if (templateParameter->templateParameterKind() == TemplateParameterDecl::TemplateParameterKind::Typename) {
+            containerTemplateArguments.push_back(new TypeExpr(new TemplateTypenameRefType(Type::Qualifier::Unassigned,
+                                                                                          templateParameter, {}, {})));
+        } else {
+            containerTemplateArguments.push_back(new TemplateConstRefExpr(templateParameter));
+        }
+    }
+
+    return containerTemplateArguments;
+}
+
+bool gulc::BasicDeclValidator::visit(gulc::ASTFile* file) {
+    _currentFile = file;
+
+    validateImports(file->imports);
+
+    // `BasicTypeResolver` looks up members of declarations the walk hasn't reached yet (e.g. `Outer.Inner`) so every
+    // declaration in the file is given its container before the file is walked
+    for (Decl* decl : file->declarations) {
+        setContainer(decl, nullptr, false, nullptr);
+    }
+
+    return true;
+}
+
+bool gulc::BasicDeclValidator::visit(gulc::CallOperatorDecl* callOperatorDecl) {
+    resolveBuiltInAttributes(callOperatorDecl);
+
+    // `call` cannot be `static` because the syntax would be too ambiguous when paired with the constructor syntax
+    // (i.e. is `ExampleType()` a `call` or an `init`?)
+    if (callOperatorDecl->isStatic()) {
+        printError("`call` cannot be marked `static`!",
+                   callOperatorDecl->startPosition(), callOperatorDecl->endPosition());
+    }
+
+    validateFunctionDecl(callOperatorDecl);
+    return true;
+}
+
+bool gulc::BasicDeclValidator::visit(gulc::ConstructorDecl* constructorDecl) {
+    resolveBuiltInAttributes(constructorDecl);
+
+    if (constructorDecl->isAnyVirtual()) {
+        printError("`init` cannot be marked `virtual`, `abstract`, or `override`!",
+                   constructorDecl->startPosition(), constructorDecl->endPosition());
+    }
+
+    if (constructorDecl->isStatic()) {
+        printError("`init` cannot be marked `static`!",
+                   constructorDecl->startPosition(), constructorDecl->endPosition());
+    }
+
+    if (constructorDecl->isMutable()) {
+        printError("`init` cannot be marked `mut`, `init` is implicitly `mut` by default!",
+                   constructorDecl->startPosition(), constructorDecl->endPosition());
+    }
+
+    validateFunctionDecl(constructorDecl);
+    return true;
+}
+
+bool gulc::BasicDeclValidator::visit(gulc::DestructorDecl* destructorDecl) {
+    resolveBuiltInAttributes(destructorDecl);
+
+    if (destructorDecl->isMutable()) {
+        printError("`deinit` cannot be marked `mut`, `deinit` is implicitly `mut` by default!",
+                   destructorDecl->startPosition(), destructorDecl->endPosition());
+    }
+
+    if (destructorDecl->isStatic()) {
+        printError("`deinit` cannot be marked `static`!",
+                   destructorDecl->startPosition(), destructorDecl->endPosition());
+    }
+
+    validateFunctionDecl(destructorDecl);
+    return true;
+}
+
+bool gulc::BasicDeclValidator::visit(gulc::EnumConstDecl* enumConstDecl) {
+    // The `enum` sets itself as the container of its cases before they're walked
+    if (enumConstDecl->container == nullptr || !llvm::isa<EnumDecl>(enumConstDecl->container)) {
+        printError("enum `case` cannot appear outside of an `enum`!",
+                   enumConstDecl->startPosition(), enumConstDecl->endPosition());
+    }
+
+    return true;
+}
+
+bool gulc::BasicDeclValidator::visit(gulc::EnumDecl* enumDecl) {
+    resolveBuiltInAttributes(enumDecl);
+
+    if (enumDecl->isConstExpr()) {
+        printError("`enum` cannot be marked `const`, enums are `const` by default!",
+                   enumDecl->startPosition(), enumDecl->endPosition());
+    }
+
+    if (enumDecl->isStatic()) {
+        printError("enums cannot be marked `static`!",
+                   enumDecl->startPosition(), enumDecl->endPosition());
+    }
+
+    if (enumDecl->isMutable()) {
+        printError("enums cannot be marked `mut`!",
+                   enumDecl->startPosition(), enumDecl->endPosition());
+    }
+
+    if (enumDecl->isAnyVirtual()) {
+        printError("enums cannot be marked `virtual`, `abstract`, or `override`!",
+                   enumDecl->startPosition(), enumDecl->endPosition());
+    }
+
+    if (enumDecl->isVolatile()) {
+        printError("enums cannot be marked `override`!",
+                   enumDecl->startPosition(), enumDecl->endPosition());
+    }
+
+    if (enumDecl->isExtern()) {
+        printError("enums cannot be marked `extern`!",
+                   enumDecl->startPosition(), enumDecl->endPosition());
+    }
+
+    for (EnumConstDecl* enumConst : enumDecl->enumConsts()) {
+        for (EnumConstDecl* checkDuplicate : enumDecl->enumConsts()) {
+            if (checkDuplicate == enumConst) continue;
+
+            if (enumDecl->identifier().name() == checkDuplicate->identifier().name()) {
+                printError("enum `" + enumDecl->identifier().name() + "` contains multiple definitions of "
+                           "const `" + checkDuplicate->identifier().name() + "`!",
+                           checkDuplicate->startPosition(), checkDuplicate->endPosition());
+            }
+        }
+    }
+
+    for (Decl* ownedMember : enumDecl->ownedMembers()) {
+        if (llvm::isa<NamespaceDecl>(ownedMember)) {
+            printError("`namespace` cannot be contained within `enum`!",
+                       ownedMember->startPosition(), ownedMember->endPosition());
+        }
+
+        if (llvm::isa<ImportDecl>(ownedMember)) {
+            printError("`import` cannot be contained within `enum`!",
+                       ownedMember->startPosition(), ownedMember->endPosition());
+        }
+
+        if (llvm::isa<ExtensionDecl>(ownedMember)) {
+            printError("`extension` cannot be contained within `enum`!",
+                       ownedMember->startPosition(), ownedMember->endPosition());
+        }
+
+        // TODO: What about `const var` is that allowed?
+        if (llvm::isa<VariableDecl>(ownedMember) && !(ownedMember->isStatic())) {
+            printError("non-static `var` cannot be container within `enum`!",
+                       ownedMember->startPosition(), ownedMember->endPosition());
+        }
+    }
+
+    Decl* redefinition = getRedefinition(enumDecl->identifier().name(), enumDecl);
+
+    if (redefinition != nullptr) {
+        printError("redefinition of symbol `" + enumDecl->identifier().name() + "` detected!",
+                   redefinition->startPosition(), redefinition->endPosition());
+    }
+
+    _containingDecls.push_back(enumDecl);
+    return true;
+}
+
+bool gulc::BasicDeclValidator::visit(gulc::ExtensionDecl* extensionDecl) {
+    resolveBuiltInAttributes(extensionDecl);
+
+    if (extensionDecl->isConstExpr()) {
+        printError("extensions cannot be marked `const`!",
+                   extensionDecl->startPosition(), extensionDecl->endPosition());
     }
 
     if (extensionDecl->isStatic()) {
@@ -483,14 +925,13 @@ void gulc::BasicDeclValidator::validateExtensionDecl(gulc::ExtensionDecl* extens
                    extensionDecl->startPosition(), extensionDecl->endPosition());
     }
 
-    if (_currentContainerDecl != nullptr && !llvm::isa<NamespaceDecl>(_currentContainerDecl)) {
+    Decl* containerDecl = currentContainerDecl();
+
+    if (containerDecl != nullptr && !llvm::isa<NamespaceDecl>(containerDecl)) {
         printError("extensions can only be contained within namespaces!",
                    extensionDecl->startPosition(), extensionDecl->endPosition());
     }
 
-    Decl* oldContainer = _currentContainerDecl;
-    _currentContainerDecl = extensionDecl;
-
     for (Decl* checkDecl : extensionDecl->ownedMembers()) {
         if (llvm::isa<NamespaceDecl>(checkDecl)) {
             printError("`namespace` cannot be contained within extensions!",
@@ -509,8 +950,6 @@ void gulc::BasicDeclValidator::validateExtensionDecl(gulc::ExtensionDecl* extens
             }
         }
 
-        validateDecl(checkDecl, false);
-
         // TODO: Can extensions contain `override`? I think they should be able to but I'm not entirely decided.
         if (checkDecl->isAbstract()) {
             printError("extensions cannot contain `abstract` members!",
@@ -523,71 +962,60 @@ void gulc::BasicDeclValidator::validateExtensionDecl(gulc::ExtensionDecl* extens
         }
     }
 
-    _currentContainerDecl = oldContainer;
+    _containingDecls.push_back(extensionDecl);
+    return true;
 }
 
-void gulc::BasicDeclValidator::validateFunctionDecl(gulc::FunctionDecl* functionDecl) const {
-    validateParameters(functionDecl->parameters());
+bool gulc::BasicDeclValidator::visit(gulc::FunctionDecl* functionDecl) {
+    resolveBuiltInAttributes(functionDecl);
 
-    if (functionDecl->isConstExpr()) {
-        printError("[INTERNAL] `const` is not yet supported!",
-                   functionDecl->startPosition(), functionDecl->endPosition());
-    }
+    validateFunctionDecl(functionDecl);
+    return true;
+}
 
-    if (functionDecl->isExtern() && !functionDecl->isPrototype()) {
-        printError("`extern` functions cannot have a provided body!",
-                   functionDecl->startPosition(), functionDecl->endPosition());
-    }
+bool gulc::BasicDeclValidator::visit(gulc::NamespaceDecl* namespaceDecl) {
+    resolveBuiltInAttributes(namespaceDecl);
 
-    if (functionDecl->isAbstract() && !functionDecl->isPrototype()) {
-        printError("`abstract` functions cannot have a provided body!",
-                   functionDecl->startPosition(), functionDecl->endPosition());
-    }
-}
+    Decl* containerDecl = currentContainerDecl();
 
-void gulc::BasicDeclValidator::validateNamespaceDecl(gulc::NamespaceDecl* namespaceDecl) {
     // Namespaces can only be contained within other namespaces or the top level of a file
-    if (_currentContainerDecl != nullptr && !llvm::isa<NamespaceDecl>(_currentContainerDecl)) {
+    if (containerDecl != nullptr && !llvm::isa<NamespaceDecl>(containerDecl)) {
         printError("namespaces can only be nested within other namespaces!",
                    namespaceDecl->startPosition(), namespaceDecl->endPosition());
     }
 
-    Decl* oldContainer = _currentContainerDecl;
-    _currentContainerDecl = namespaceDecl;
-
     for (Decl* nestedDecl : namespaceDecl->nestedDecls()) {
         if (llvm::isa<ImportDecl>(nestedDecl)) {
             printError("`import` cannot be contained within a `namespace`!",
                        nestedDecl->startPosition(), nestedDecl->endPosition());
         }
-
-        validateDecl(nestedDecl, true);
     }
 
-    _currentContainerDecl = oldContainer;
+    _containingDecls.push_back(namespaceDecl);
+    return true;
 }
 
-void gulc::BasicDeclValidator::validateOperatorDecl(gulc::OperatorDecl* operatorDecl) const {
+bool gulc::BasicDeclValidator::visit(gulc::OperatorDecl* operatorDecl) {
+    resolveBuiltInAttributes(operatorDecl);
+
     if (operatorDecl->isStatic()) {
         printError("`operator` cannot be marked `static`!",
                    operatorDecl->startPosition(), operatorDecl->endPosition());
     }
 
     validateFunctionDecl(operatorDecl);
+    return true;
 }
 
-void gulc::BasicDeclValidator::validatePropertyDecl(gulc::PropertyDecl* propertyDecl, bool isGlobal) {
-    if (isGlobal) {
+bool gulc::BasicDeclValidator::visit(gulc::PropertyDecl* propertyDecl) {
+    resolveBuiltInAttributes(propertyDecl);
+
+    if (isGlobal()) {
         printError("properties cannot appear outside of a trait, union, struct, or class!",
                    propertyDecl->startPosition(), propertyDecl->endPosition());
     }
 
     for (PropertyGetDecl* getter : propertyDecl->getters()) {
-        getter->container = propertyDecl;
-        getter->containedInTemplate = propertyDecl->containedInTemplate;
-
-        validatePropertyGetDecl(getter);
-
         if (propertyDecl->isAbstract() && !getter->isPrototype()) {
             printError("abstract properties cannot contain `get` declarations with a body!",
                        propertyDecl->startPosition(), propertyDecl->endPosition());
@@ -597,210 +1025,94 @@ void gulc::BasicDeclValidator::validatePropertyDecl(gulc::PropertyDecl* property
             printError("extern properties cannot contain `get` declarations with a body!",
                        propertyDecl->startPosition(), propertyDecl->endPosition());
         }
-    }
-
-    if (propertyDecl->hasSetter()) {
-        propertyDecl->setter()->container = propertyDecl;
-        propertyDecl->setter()->containedInTemplate = propertyDecl->containedInTemplate;
-
-        validatePropertySetDecl(propertyDecl->setter());
-
-        if (propertyDecl->isAbstract() && !propertyDecl->setter()->isPrototype()) {
-            printError("abstract properties cannot contain a `set` declaration with a body!",
-                       propertyDecl->startPosition(), propertyDecl->endPosition());
-        }
-
-        if (propertyDecl->isExtern() && !propertyDecl->setter()->isPrototype()) {
-            printError("extern properties cannot contain a `set` declaration with a body!",
-                       propertyDecl->startPosition(), propertyDecl->endPosition());
-        }
-    }
-
-    for (PropertyGetDecl* checkGetter : propertyDecl->getters()) {
-        for (PropertyGetDecl* checkDuplicate : propertyDecl->getters()) {
-            // Skip ourself
-            if (checkGetter == checkDuplicate) continue;
-
-            if (checkGetter->getResultType() == checkDuplicate->getResultType() &&
-                    checkGetter->isMutable() == checkDuplicate->isMutable()) {
-                printError("duplicate `get` definition found for property `" + propertyDecl->identifier().name() + "`!",
-                           checkDuplicate->startPosition(), checkDuplicate->endPosition());
-            }
-        }
-    }
-
-    if (propertyDecl->isConstExpr()) {
-        printError("[INTERNAL] `const` is not yet supported!",
-                   propertyDecl->startPosition(), propertyDecl->endPosition());
-    }
-}
-
-void gulc::BasicDeclValidator::validatePropertyGetDecl(gulc::PropertyGetDecl* propertyGetDecl) {
-    if (propertyGetDecl->isStatic()) {
-        printError("property `get` cannot be marked `static`!",
-                   propertyGetDecl->startPosition(), propertyGetDecl->endPosition());
-    }
-
-    if (propertyGetDecl->isAnyVirtual()) {
-        printError("property `get` cannot be marked `virtual`, `abstract`, or `override`; "
-                   "mark the `property` as `virtual`, `abstract`, or `override` instead!",
-                   propertyGetDecl->startPosition(), propertyGetDecl->endPosition());
-    }
-
-    if (propertyGetDecl->isConstExpr()) {
-        printError("[INTERNAL] `const` is not yet supported!",
-                   propertyGetDecl->startPosition(), propertyGetDecl->endPosition());
-    }
-}
-
-void gulc::BasicDeclValidator::validatePropertySetDecl(gulc::PropertySetDecl* propertySetDecl) {
-    if (propertySetDecl->isStatic()) {
-        printError("property `set` cannot be marked `static`!",
-                   propertySetDecl->startPosition(), propertySetDecl->endPosition());
-    }
-
-    if (propertySetDecl->isAnyVirtual()) {
-        printError("property `set` cannot be marked `virtual`, `abstract`, or `override`; "
-                   "mark the `property` as `virtual`, `abstract`, or `override` instead!",
-                   propertySetDecl->startPosition(), propertySetDecl->endPosition());
-    }
-
-    if (propertySetDecl->isConstExpr()) {
-        printError("[INTERNAL] `const` is not yet supported!",
-                   propertySetDecl->startPosition(), propertySetDecl->endPosition());
-    }
-}
-
-void gulc::BasicDeclValidator::validateStructDecl(gulc::StructDecl* structDecl, bool checkForRedefinition,
-                                                  bool setTemplateContainer) {
-    if (structDecl->isMutable()) {
-        printError("`" + structDecl->structKindName() + " " + structDecl->identifier().name() + "` cannot be marked `mut`!",
-                   structDecl->startPosition(), structDecl->endPosition());
-    }
-
-    if (structDecl->isOverride()) {
-        printError("`" + structDecl->structKindName() + " " + structDecl->identifier().name() + "` cannot be marked `override`!",
-                   structDecl->startPosition(), structDecl->endPosition());
-    }
-
-    if (structDecl->isVirtual()) {
-        printError("`" + structDecl->structKindName() + " " + structDecl->identifier().name() + "` cannot be marked `virtual`!",
-                   structDecl->startPosition(), structDecl->endPosition());
-    }
-
-    if (structDecl->isExtern()) {
-        printError("`" + structDecl->structKindName() + " " + structDecl->identifier().name() + "` cannot be marked `extern`!",
-                   structDecl->startPosition(), structDecl->endPosition());
-    }
-
-    if (structDecl->isVolatile()) {
-        printError("`" + structDecl->structKindName() + " " + structDecl->identifier().name() + "` cannot be marked `volatile`!",
-                   structDecl->startPosition(), structDecl->endPosition());
-    }
-
-    if (structDecl->structKind() == StructDecl::Kind::Union) {
-        // Unions cannot be `static` or `abstract`
-        if (structDecl->isStatic()) {
-            printError("unions cannot be marked `static`!",
-                       structDecl->startPosition(), structDecl->endPosition());
+    }
+
+    if (propertyDecl->hasSetter()) {
+        if (propertyDecl->isAbstract() && !propertyDecl->setter()->isPrototype()) {
+            printError("abstract properties cannot contain a `set` declaration with a body!",
+                       propertyDecl->startPosition(), propertyDecl->endPosition());
         }
 
-        if (structDecl->isAbstract()) {
-            printError("unions cannot be marked `abstract`!",
-                       structDecl->startPosition(), structDecl->endPosition());
+        if (propertyDecl->isExtern() && !propertyDecl->setter()->isPrototype()) {
+            printError("extern properties cannot contain a `set` declaration with a body!",
+                       propertyDecl->startPosition(), propertyDecl->endPosition());
         }
     }
 
-    if (structDecl->isStatic()) {
-        // Static structs CANNOT have constructors or destructors
-        if (!structDecl->constructors().empty()) {
-            printError("`static " + structDecl->structKindName() + "` cannot have constructors!",
-                       structDecl->startPosition(), structDecl->endPosition());
-        }
+    for (PropertyGetDecl* checkGetter : propertyDecl->getters()) {
+        for (PropertyGetDecl* checkDuplicate : propertyDecl->getters()) {
+            // Skip ourself
+            if (checkGetter == checkDuplicate) continue;
 
-        if (structDecl->destructor != nullptr) {
-            printError("`static " + structDecl->structKindName() + "` cannot have a destructor!",
-                       structDecl->startPosition(), structDecl->endPosition());
+            if (checkGetter->getResultType() == checkDuplicate->getResultType() &&
+                    checkGetter->isMutable() == checkDuplicate->isMutable()) {
+                printError("duplicate `get` definition found for property `" + propertyDecl->identifier().name() + "`!",
+                           checkDuplicate->startPosition(), checkDuplicate->endPosition());
+            }
         }
     }
 
-    if (structDecl->isConstExpr()) {
+    if (propertyDecl->isConstExpr()) {
         printError("[INTERNAL] `const` is not yet supported!",
-                   structDecl->startPosition(), structDecl->endPosition());
+                   propertyDecl->startPosition(), propertyDecl->endPosition());
     }
 
-    structDecl->containerTemplateType = _currentContainerTemplateType != nullptr ?
-                                        _currentContainerTemplateType->deepCopy() : nullptr;
-
-    Type* oldContainerTemplateType = _currentContainerTemplateType;
+    return true;
+}
 
-    if (setTemplateContainer && _currentContainerTemplateType != nullptr) {
-        _currentContainerTemplateType = new DependentType(Type::Qualifier::Unassigned,
-                                                          _currentContainerTemplateType,
-                                                          new StructType(Type::Qualifier::Unassigned,
-                                                                         structDecl, {}, {}));
+bool gulc::BasicDeclValidator::visit(gulc::PropertyGetDecl* propertyGetDecl) {
+    if (propertyGetDecl->isStatic()) {
+        printError("property `get` cannot be marked `static`!",
+                   propertyGetDecl->startPosition(), propertyGetDecl->endPosition());
     }
 
-    Decl* oldContainer = _currentContainerDecl;
-    _currentContainerDecl = structDecl;
-
-    for (ConstructorDecl* constructorDecl : structDecl->constructors()) {
-        // NOTE: We call `validateDecl` instead of `validateConstructorDecl` so that the container is being set properly
-        validateDecl(constructorDecl, false);
+    if (propertyGetDecl->isAnyVirtual()) {
+        printError("property `get` cannot be marked `virtual`, `abstract`, or `override`; "
+                   "mark the `property` as `virtual`, `abstract`, or `override` instead!",
+                   propertyGetDecl->startPosition(), propertyGetDecl->endPosition());
     }
 
-    for (Decl* checkDecl : structDecl->ownedMembers()) {
-        if (llvm::isa<NamespaceDecl>(checkDecl)) {
-            printError("`namespace` cannot be contained within `" + structDecl->structKindName() + "`!",
-                       checkDecl->startPosition(), checkDecl->endPosition());
-        }
-
-        if (llvm::isa<ImportDecl>(checkDecl)) {
-            printError("`import` cannot be contained within `" + structDecl->structKindName() + "`!",
-                       checkDecl->startPosition(), checkDecl->endPosition());
-        }
+    if (propertyGetDecl->isConstExpr()) {
+        printError("[INTERNAL] `const` is not yet supported!",
+                   propertyGetDecl->startPosition(), propertyGetDecl->endPosition());
+    }
 
-        if (llvm::isa<ExtensionDecl>(checkDecl)) {
-            printError("`extension` cannot be contained within `" + structDecl->structKindName() + "`!",
-                       checkDecl->startPosition(), checkDecl->endPosition());
-        }
+    return true;
+}
 
-        validateDecl(checkDecl, false);
+bool gulc::BasicDeclValidator::visit(gulc::PropertySetDecl* propertySetDecl) {
+    if (propertySetDecl->isStatic()) {
+        printError("property `set` cannot be marked `static`!",
+                   propertySetDecl->startPosition(), propertySetDecl->endPosition());
+    }
 
-        if (structDecl->isStatic()) {
-            if (llvm::isa<FunctionDecl>(checkDecl) || llvm::isa<PropertyDecl>(checkDecl) ||
-                llvm::isa<SubscriptOperatorDecl>(checkDecl) || llvm::isa<VariableDecl>(checkDecl)) {
-                if (!checkDecl->isStatic()) {
-                    printError("`static " + structDecl->structKindName() + "` can only contain static members!",
-                               checkDecl->startPosition(), checkDecl->endPosition());
-                }
-            } else if (llvm::isa<CallOperatorDecl>(checkDecl)) {
-                printError("`static " + structDecl->structKindName() + "` cannot contain a `call` definition!",
-                           checkDecl->startPosition(), checkDecl->endPosition());
-            }
-        }
+    if (propertySetDecl->isAnyVirtual()) {
+        printError("property `set` cannot be marked `virtual`, `abstract`, or `override`; "
+                   "mark the `property` as `virtual`, `abstract`, or `override` instead!",
+                   propertySetDecl->startPosition(), propertySetDecl->endPosition());
     }
 
-    if (structDecl->destructor != nullptr) {
-        validateDecl(structDecl->destructor);
+    if (propertySetDecl->isConstExpr()) {
+        printError("[INTERNAL] `const` is not yet supported!",
+                   propertySetDecl->startPosition(), propertySetDecl->endPosition());
     }
 
-    _currentContainerDecl = oldContainer;
-    _currentContainerTemplateType = oldContainerTemplateType;
+    return true;
+}
 
-    if (checkForRedefinition) {
-        Decl* redefinition = getRedefinition(structDecl->identifier().name(), structDecl);
+bool gulc::BasicDeclValidator::visit(gulc::StructDecl* structDecl) {
+    resolveBuiltInAttributes(structDecl);
 
-        if (redefinition != nullptr) {
-            printError("redefinition of symbol `" + structDecl->identifier().name() + "` detected!",
-                       redefinition->startPosition(), redefinition->endPosition());
-        }
-    }
+    validateStructDecl(structDecl, true);
+
+    _containingDecls.push_back(structDecl);
+    return true;
 }
 
-void gulc::BasicDeclValidator::validateSubscriptOperatorDecl(gulc::SubscriptOperatorDecl* subscriptOperatorDecl,
-                                                             bool isGlobal) {
-    if (isGlobal) {
+bool gulc::BasicDeclValidator::visit(gulc::SubscriptOperatorDecl* subscriptOperatorDecl) {
+    resolveBuiltInAttributes(subscriptOperatorDecl);
+
+    if (isGlobal()) {
         printError("properties cannot appear outside of a trait, union, struct, or class!",
                    subscriptOperatorDecl->startPosition(), subscriptOperatorDecl->endPosition());
     }
@@ -808,11 +1120,6 @@ void gulc::BasicDeclValidator::validateSubscriptOperatorDecl(gulc::SubscriptOper
     validateParameters(subscriptOperatorDecl->parameters());
 
     for (SubscriptOperatorGetDecl* getter : subscriptOperatorDecl->getters()) {
-        getter->container = subscriptOperatorDecl;
-        getter->containedInTemplate = subscriptOperatorDecl->containedInTemplate;
-
-        validateSubscriptOperatorGetDecl(getter);
-
         if (subscriptOperatorDecl->isAbstract() && !getter->isPrototype()) {
             printError("abstract subscripts cannot contain `get` declarations with a body!",
                        subscriptOperatorDecl->startPosition(), subscriptOperatorDecl->endPosition());
@@ -825,11 +1132,6 @@ void gulc::BasicDeclValidator::validateSubscriptOperatorDecl(gulc::SubscriptOper
     }
 
     if (subscriptOperatorDecl->hasSetter()) {
-        subscriptOperatorDecl->setter()->container = subscriptOperatorDecl;
-        subscriptOperatorDecl->setter()->containedInTemplate = subscriptOperatorDecl->containedInTemplate;
-
-        validateSubscriptOperatorSetDecl(subscriptOperatorDecl->setter());
-
         if (subscriptOperatorDecl->isAbstract() && !subscriptOperatorDecl->setter()->isPrototype()) {
             printError("abstract subscripts cannot contain a `set` declaration with a body!",
                        subscriptOperatorDecl->startPosition(), subscriptOperatorDecl->endPosition());
@@ -858,9 +1160,11 @@ void gulc::BasicDeclValidator::validateSubscriptOperatorDecl(gulc::SubscriptOper
         printError("[INTERNAL] `const` is not yet supported!",
                    subscriptOperatorDecl->startPosition(), subscriptOperatorDecl->endPosition());
     }
+
+    return true;
 }
 
-void gulc::BasicDeclValidator::validateSubscriptOperatorGetDecl(gulc::SubscriptOperatorGetDecl* subscriptOperatorGetDecl) {
+bool gulc::BasicDeclValidator::visit(gulc::SubscriptOperatorGetDecl* subscriptOperatorGetDecl) {
     if (subscriptOperatorGetDecl->isStatic()) {
         printError("subscript `get` cannot be marked `static`!",
                    subscriptOperatorGetDecl->startPosition(), subscriptOperatorGetDecl->endPosition());
@@ -876,9 +1180,11 @@ void gulc::BasicDeclValidator::validateSubscriptOperatorGetDecl(gulc::SubscriptO
         printError("[INTERNAL] `const` is not yet supported!",
                    subscriptOperatorGetDecl->startPosition(), subscriptOperatorGetDecl->endPosition());
     }
+
+    return true;
 }
 
-void gulc::BasicDeclValidator::validateSubscriptOperatorSetDecl(gulc::SubscriptOperatorSetDecl* subscriptOperatorSetDecl) {
+bool gulc::BasicDeclValidator::visit(gulc::SubscriptOperatorSetDecl* subscriptOperatorSetDecl) {
     if (subscriptOperatorSetDecl->isStatic()) {
         printError("subscript `set` cannot be marked `static`!",
                    subscriptOperatorSetDecl->startPosition(), subscriptOperatorSetDecl->endPosition());
@@ -894,208 +1200,54 @@ void gulc::BasicDeclValidator::validateSubscriptOperatorSetDecl(gulc::SubscriptO
         printError("[INTERNAL] `const` is not yet supported!",
                    subscriptOperatorSetDecl->startPosition(), subscriptOperatorSetDecl->endPosition());
     }
+
+    return true;
 }
 
-void gulc::BasicDeclValidator::validateTemplateFunctionDecl(gulc::TemplateFunctionDecl* templateFunctionDecl) {
+bool gulc::BasicDeclValidator::visit(gulc::TemplateFunctionDecl* templateFunctionDecl) {
+    resolveBuiltInAttributes(templateFunctionDecl);
+
     validateTemplateParameters(templateFunctionDecl->templateParameters());
 
     _templateParameters.push_back(&templateFunctionDecl->templateParameters());
 
     validateFunctionDecl(templateFunctionDecl);
-
-    _templateParameters.pop_back();
+    return true;
 }
 
-void gulc::BasicDeclValidator::validateTemplateStructDecl(gulc::TemplateStructDecl* templateStructDecl) {
-    validateTemplateParameters(templateStructDecl->templateParameters());
-
-    Type* oldContainerTemplateType = _currentContainerTemplateType;
-
-    // Create the list of template parameters from the template parameters
-    std::vector<Expr*> containerTemplateArguments;
-    containerTemplateArguments.reserve(templateStructDecl->templateParameters().size());
-
-    for (TemplateParameterDecl* templateParameter : templateStructDecl->templateParameters()) {
-        if (templateParameter->templateParameterKind() == TemplateParameterDecl::TemplateParameterKind::Typename) {
-            containerTemplateArguments.push_back(new TypeExpr(new TemplateTypenameRefType(Type::Qualifier::Unassigned,
-                                                                                          templateParameter, {}, {})));
-        } else {
-            containerTemplateArguments.push_back(new TemplateConstRefExpr(templateParameter));
-        }
-    }
-
-    Type* containerTemplateType = new TemplateStructType(Type::Qualifier::Unassigned,
-                                                         containerTemplateArguments,
-                                                         templateStructDecl, {}, {});
+bool gulc::BasicDeclValidator::visit(gulc::TemplateStructDecl* templateStructDecl) {
+    resolveBuiltInAttributes(templateStructDecl);
 
-    if (_currentContainerTemplateType != nullptr) {
-        _currentContainerTemplateType = new DependentType(Type::Qualifier::Unassigned,
-                                                          _currentContainerTemplateType,
-                                                          containerTemplateType);
-    } else {
-        _currentContainerTemplateType = containerTemplateType;
-    }
+    validateTemplateParameters(templateStructDecl->templateParameters());
+    validateStructDecl(templateStructDecl, false);
 
     _templateParameters.push_back(&templateStructDecl->templateParameters());
-
-    validateStructDecl(templateStructDecl, false, false);
-
-    // We set `containerTemplateType` AFTER `validateStructDecl` since `validateStructDecl` will set it to
-    // `_currentContainerTemplateType` which we do NOT want.
-    templateStructDecl->containerTemplateType = oldContainerTemplateType != nullptr ?
-                                                oldContainerTemplateType->deepCopy() : nullptr;
-
-    _templateParameters.pop_back();
-
-    _currentContainerTemplateType = oldContainerTemplateType;
+    _containingDecls.push_back(templateStructDecl);
+    return true;
 }
 
-void gulc::BasicDeclValidator::validateTemplateTraitDecl(gulc::TemplateTraitDecl* templateTraitDecl) {
-    validateTemplateParameters(templateTraitDecl->templateParameters());
-
-    Type* oldContainerTemplateType = _currentContainerTemplateType;
-
-    // Create the list of template parameters from the template parameters
-    std::vector<Expr*> containerTemplateArguments;
-    containerTemplateArguments.reserve(templateTraitDecl->templateParameters().size());
-
-    for (TemplateParameterDecl* templateParameter : templateTraitDecl->templateParameters()) {
-        if (templateParameter->templateParameterKind() == TemplateParameterDecl::TemplateParameterKind::Typename) {
-            containerTemplateArguments.push_back(new TypeExpr(new TemplateTypenameRefType(Type::Qualifier::Unassigned,
-                                                                                          templateParameter, {}, {})));
-        } else {
-            containerTemplateArguments.push_back(new TemplateConstRefExpr(templateParameter));
-        }
-    }
-
-    Type* containerTemplateType = new TemplateTraitType(Type::Qualifier::Unassigned,
-                                                        containerTemplateArguments,
-                                                        templateTraitDecl, {}, {});
+bool gulc::BasicDeclValidator::visit(gulc::TemplateTraitDecl* templateTraitDecl) {
+    resolveBuiltInAttributes(templateTraitDecl);
 
-    if (_currentContainerTemplateType != nullptr) {
-        _currentContainerTemplateType = new DependentType(Type::Qualifier::Unassigned,
-                                                          _currentContainerTemplateType,
-                                                          containerTemplateType);
-    } else {
-        _currentContainerTemplateType = containerTemplateType;
-    }
+    validateTemplateParameters(templateTraitDecl->templateParameters());
+    validateTraitDecl(templateTraitDecl, false);
 
     _templateParameters.push_back(&templateTraitDecl->templateParameters());
-
-    validateTraitDecl(templateTraitDecl, false, false);
-
-    // We set `containerTemplateType` AFTER `validateTraitDecl` since `validateTraitDecl` will set it to
-    // `_currentContainerTemplateType` which we do NOT want.
-    templateTraitDecl->containerTemplateType = oldContainerTemplateType != nullptr ?
-                                               oldContainerTemplateType->deepCopy() : nullptr;
-
-    _templateParameters.pop_back();
-
-    _currentContainerTemplateType = oldContainerTemplateType;
+    _containingDecls.push_back(templateTraitDecl);
+    return true;
 }
 
-void gulc::BasicDeclValidator::validateTraitDecl(gulc::TraitDecl* traitDecl, bool checkForRedefinition,
-                                                 bool setTemplateContainer) {
-    if (traitDecl->isAbstract()) {
-        printError("traits cannot be marked `abstract`!",
-                   traitDecl->startPosition(), traitDecl->endPosition());
-    }
-
-    if (traitDecl->isStatic()) {
-        printError("traits cannot be marked `static`!",
-                   traitDecl->startPosition(), traitDecl->endPosition());
-    }
-
-    if (traitDecl->isVirtual()) {
-        printError("traits cannot be marked `virtual`!",
-                   traitDecl->startPosition(), traitDecl->endPosition());
-    }
-
-    if (traitDecl->isOverride()) {
-        printError("traits cannot be marked `override`!",
-                   traitDecl->startPosition(), traitDecl->endPosition());
-    }
-
-    if (traitDecl->isMutable()) {
-        printError("traits cannot be marked `mut`!",
-                   traitDecl->startPosition(), traitDecl->endPosition());
-    }
-
-    if (traitDecl->isExtern()) {
-        printError("traits cannot be marked `extern`!",
-                   traitDecl->startPosition(), traitDecl->endPosition());
-    }
-
-    if (traitDecl->isVolatile()) {
-        printError("traits cannot be marked `volatile`!",
-                   traitDecl->startPosition(), traitDecl->endPosition());
-    }
-
-    if (traitDecl->isConstExpr()) {
-        printError("[INTERNAL] `const` is not yet supported!",
-                   traitDecl->startPosition(), traitDecl->endPosition());
-    }
-
-    traitDecl->containerTemplateType = _currentContainerTemplateType != nullptr ?
-                                       _currentContainerTemplateType->deepCopy() : nullptr;
+bool gulc::BasicDeclValidator::visit(gulc::TraitDecl* traitDecl) {
+    resolveBuiltInAttributes(traitDecl);
 
-    Type* oldContainerTemplateType = _currentContainerTemplateType;
+    validateTraitDecl(traitDecl, true);
 
-    if (setTemplateContainer && _currentContainerTemplateType != nullptr) {
-        _currentContainerTemplateType = new DependentType(Type::Qualifier::Unassigned,
-                                                          _currentContainerTemplateType,
-                                                          new TraitType(Type::Qualifier::Unassigned,
-                                                                        traitDecl, {}, {}));
-    }
-
-    Decl* oldContainer = _currentContainerDecl;
-    _currentContainerDecl = traitDecl;
-
-    for (Decl* checkDecl : traitDecl->ownedMembers()) {
-        if (llvm::isa<NamespaceDecl>(checkDecl)) {
-            printError("`namespace` cannot be contained within traits!",
-                       checkDecl->startPosition(), checkDecl->endPosition());
-        }
-
-        if (llvm::isa<ImportDecl>(checkDecl)) {
-            printError("`import` cannot be contained within traits!",
-                       checkDecl->startPosition(), checkDecl->endPosition());
-        }
-
-        if (llvm::isa<VariableDecl>(checkDecl)) {
-            auto checkVariable = llvm::dyn_cast<VariableDecl>(checkDecl);
-
-            // Traits cannot contain data members
-            if (!checkVariable->isConstExpr() && !checkVariable->isStatic()) {
-                printError("traits cannot contain variables that are not marked `static` or `const`!",
-                           checkVariable->startPosition(), checkVariable->endPosition());
-            }
-        }
-
-        if (checkDecl->isAnyVirtual()) {
-            printError("trait members cannot be marked `abstract`, `virtual`, or `override`!",
-                       checkDecl->startPosition(), checkDecl->endPosition());
-        }
-
-        validateDecl(checkDecl, false);
-    }
-
-    _currentContainerDecl = oldContainer;
-    _currentContainerTemplateType = oldContainerTemplateType;
-
-    if (checkForRedefinition) {
-        Decl* redefinition = getRedefinition(traitDecl->identifier().name(), traitDecl);
-
-        if (redefinition != nullptr) {
-            printError("redefinition of symbol `" + traitDecl->identifier().name() + "` detected!",
-                       redefinition->startPosition(), redefinition->endPosition());
-        }
-    }
+    _containingDecls.push_back(traitDecl);
+    return true;
 }
 
-void gulc::BasicDeclValidator::validateTypeAliasDecl(gulc::TypeAliasDecl* typeAliasDecl) {
-    typeAliasDecl->containerTemplateType = _currentContainerTemplateType != nullptr ?
-                                           _currentContainerTemplateType->deepCopy() : nullptr;
+bool gulc::BasicDeclValidator::visit(gulc::TypeAliasDecl* typeAliasDecl) {
+    resolveBuiltInAttributes(typeAliasDecl);
 
     // The only thing we can validate here is if the type alias is redefined OR the template parameters are duplicates
     if (typeAliasDecl->hasTemplateParameters()) {
@@ -1108,10 +1260,14 @@ void gulc::BasicDeclValidator::validateTypeAliasDecl(gulc::TypeAliasDecl* typeAl
                        redefinition->startPosition(), redefinition->endPosition());
         }
     }
+
+    return true;
 }
 
-void gulc::BasicDeclValidator::validateTypeSuffixDecl(gulc::TypeSuffixDecl* typeSuffixDecl, bool isGlobal) {
-    if (!isGlobal) {
+bool gulc::BasicDeclValidator::visit(gulc::TypeSuffixDecl* typeSuffixDecl) {
+    resolveBuiltInAttributes(typeSuffixDecl);
+
+    if (!isGlobal()) {
         printError("`typesuffix` can only be declared in a global context! (they cannot appear within structs, traits, etc.)",
                    typeSuffixDecl->startPosition(), typeSuffixDecl->endPosition());
     }
@@ -1150,10 +1306,14 @@ void gulc::BasicDeclValidator::validateTypeSuffixDecl(gulc::TypeSuffixDecl* type
         default:
             break;
     }
+
+    return true;
 }
 
-void gulc::BasicDeclValidator::validateVariableDecl(gulc::VariableDecl* variableDecl, bool isGlobal) const {
-    if (isGlobal) {
+bool gulc::BasicDeclValidator::visit(gulc::VariableDecl* variableDecl) {
+    resolveBuiltInAttributes(variableDecl);
+
+    if (isGlobal()) {
         if (!variableDecl->isConstExpr() && !variableDecl->isStatic()) {
             printError("global variables must be marked `const` or `static`!",
                        variableDecl->startPosition(), variableDecl->endPosition());
@@ -1164,4 +1324,40 @@ void gulc::BasicDeclValidator::validateVariableDecl(gulc::VariableDecl* variable
         printError("variables outside of function bodies and similar MUST have a type specified!",
                    variableDecl->startPosition(), variableDecl->endPosition());
     }
+
+    return true;
+}
+
+void gulc::BasicDeclValidator::endVisit(gulc::EnumDecl* enumDecl) {
+    _containingDecls.pop_back();
+}
+
+void gulc::BasicDeclValidator::endVisit(gulc::ExtensionDecl* extensionDecl) {
+    _containingDecls.pop_back();
+}
+
+void gulc::BasicDeclValidator::endVisit(gulc::NamespaceDecl* namespaceDecl) {
+    _containingDecls.pop_back();
+}
+
+void gulc::BasicDeclValidator::endVisit(gulc::StructDecl* structDecl) {
+    _containingDecls.pop_back();
+}
+
+void gulc::BasicDeclValidator::endVisit(gulc::TemplateFunctionDecl* templateFunctionDecl) {
+    _templateParameters.pop_back();
+}
+
+void gulc::BasicDeclValidator::endVisit(gulc::TemplateStructDecl* templateStructDecl) {
+    _containingDecls.pop_back();
+    _templateParameters.pop_back();
+}
+
+void gulc::BasicDeclValidator::endVisit(gulc::TemplateTraitDecl* templateTraitDecl) {
+    _containingDecls.pop_back();
+    _templateParameters.pop_back();
+}
+
+void gulc::BasicDeclValidator::endVisit(gulc::TraitDecl* traitDecl) {
+    _containingDecls.pop_back();
 }
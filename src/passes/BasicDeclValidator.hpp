@@ -36,13 +36,22 @@
 #include <ast/decls/EnumDecl.hpp>
 #include <ast/decls/TypeSuffixDecl.hpp>
 #include <ast/decls/ExtensionDecl.hpp>
+#include <ast/ASTVisitor.hpp>
 
 namespace gulc {
-    class BasicDeclValidator {
+    /**
+     * BasicDeclValidator validates imports, checks for obvious redefinitions and modifiers that don't make sense, sets
+     * the `Decl::container` member, etc.
+     *
+     * `container`, `containedInTemplate` and `containerTemplateType` are set for every declaration in a file before the
+     * file is walked, `BasicTypeResolver` runs in the same walk and can look up a member the walk hasn't reached yet.
+     */
+    class BasicDeclValidator : public ASTVisitor<BasicDeclValidator> {
     public:
+        static constexpr bool walksParsedAST = true;
+
         BasicDeclValidator(std::vector<std::string> const& filePaths, std::vector<NamespaceDecl*>& namespacePrototypes)
-                : _filePaths(filePaths), _namespacePrototypes(namespacePrototypes), _currentFile(),
-                  _currentContainerDecl(), _currentContainerTemplateType() {}
+                : _filePaths(filePaths), _namespacePrototypes(namespacePrototypes), _currentFile() {}
 
         void processFiles(std::vector<ASTFile>& files);
 
@@ -54,14 +63,24 @@ namespace gulc {
         //     struct Example1<T> { struct Example2<S> { func example3<U>(); } }
         // The above would result in three separate lists.
         std::vector<std::vector<TemplateParameterDecl*>*> _templateParameters;
-        // The container of the currently processing Decl.
-        gulc::Decl* _currentContainerDecl;
-        // This is null unless we're processing decls within a template.
-        Type* _currentContainerTemplateType;
+        // The declarations containing the currently processing Decl.
+        // NOTE: `enum` is in this list but it isn't the `container` of its members, see `currentContainerDecl`
+        std::vector<Decl*> _containingDecls;
 
         void printError(std::string const& message, TextPosition startPosition, TextPosition endPosition) const;
         void printWarning(std::string const& message, TextPosition startPosition, TextPosition endPosition) const;
 
+        // The container of the currently processing Decl.
+        Decl* currentContainerDecl() const;
+        bool isGlobal() const;
+        // Sets `container`, `containedInTemplate` and `containerTemplateType` for `decl` and everything it contains
+        void setContainer(Decl* decl, Decl* container, bool containedInTemplate, Type* containerTemplateType) const;
+        void setMemberContainers(StructDecl* structDecl, bool containedInTemplate,
+                                 Type* memberContainerTemplateType) const;
+        void setMemberContainers(TraitDecl* traitDecl, bool containedInTemplate,
+                                 Type* memberContainerTemplateType) const;
+        static Type* copyContainerTemplateType(Type* containerTemplateType);
+
         void validateImports(std::vector<ImportDecl*>& imports) const;
         bool resolveImport(std::vector<Identifier> const& importPath, std::size_t pathIndex,
                            NamespaceDecl* checkNamespace, NamespaceDecl** foundNamespace) const;
@@ -71,29 +90,52 @@ namespace gulc {
         void validateParameters(std::vector<ParameterDecl*> const& parameters) const;
         void validateTemplateParameters(std::vector<TemplateParameterDecl*> const& templateParameters) const;
 
-        void validateDecl(Decl* decl, bool isGlobal = true);
-        void validateCallOperatorDecl(CallOperatorDecl* callOperatorDecl) const;
-        void validateConstructorDecl(ConstructorDecl* constructorDecl) const;
-        void validateDestructorDecl(DestructorDecl* destructorDecl) const;
-        void validateEnumDecl(EnumDecl* enumDecl);
-        void validateExtensionDecl(ExtensionDecl* extensionDecl);
+        // Replaces any `UnresolvedAttr` that names a compiler built-in attribute (e.g. `@copy`) with its real `Attr`
+        void resolveBuiltInAttributes(Decl* decl) const;
         void validateFunctionDecl(FunctionDecl* functionDecl) const;
-        void validateNamespaceDecl(NamespaceDecl* namespaceDecl);
-        void validateOperatorDecl(OperatorDecl* operatorDecl) const;
-        void validatePropertyDecl(PropertyDecl* propertyDecl, bool isGlobal);
-        void validatePropertyGetDecl(PropertyGetDecl* propertyGetDecl);
-        void validatePropertySetDecl(PropertySetDecl* propertySetDecl);
-        void validateStructDecl(StructDecl* structDecl, bool checkForRedefinition, bool setTemplateContainer);
-        void validateSubscriptOperatorDecl(SubscriptOperatorDecl* subscriptOperatorDecl, bool isGlobal);
-        void validateSubscriptOperatorGetDecl(SubscriptOperatorGetDecl* subscriptOperatorGetDecl);
-        void validateSubscriptOperatorSetDecl(SubscriptOperatorSetDecl* subscriptOperatorSetDecl);
-        void validateTemplateFunctionDecl(TemplateFunctionDecl* templateFunctionDecl);
-        void validateTemplateStructDecl(TemplateStructDecl* templateStructDecl);
-        void validateTemplateTraitDecl(TemplateTraitDecl* templateTraitDecl);
-        void validateTraitDecl(TraitDecl* traitDecl, bool checkForRedefinition, bool setTemplateContainer);
-        void validateTypeAliasDecl(TypeAliasDecl* typeAliasDecl);
-        void validateTypeSuffixDecl(TypeSuffixDecl* typeSuffixDecl, bool isGlobal);
-        void validateVariableDecl(VariableDecl* variableDecl, bool isGlobal) const;
+        void validateStructDecl(StructDecl* structDecl, bool checkForRedefinition) const;
+        void validateTraitDecl(TraitDecl* traitDecl, bool checkForRedefinition) const;
+        std::vector<Expr*> createContainerTemplateArguments(
+                std::vector<TemplateParameterDecl*> const& templateParameters) const;
+
+        friend class ASTVisitor<BasicDeclValidator>;
+        template<typename...> friend class FusedASTVisitor;
+        using ASTVisitor<BasicDeclValidator>::visit;
+        using ASTVisitor<BasicDeclValidator>::endVisit;
+
+        bool visit(ASTFile* file);
+        bool visit(CallOperatorDecl* callOperatorDecl);
+        bool visit(ConstructorDecl* constructorDecl);
+        bool visit(DestructorDecl* destructorDecl);
+        bool visit(EnumConstDecl* enumConstDecl);
+        bool visit(EnumDecl* enumDecl);
+        bool visit(ExtensionDecl* extensionDecl);
+        bool visit(FunctionDecl* functionDecl);
+        bool visit(NamespaceDecl* namespaceDecl);
+        bool visit(OperatorDecl* operatorDecl);
+        bool visit(PropertyDecl* propertyDecl);
+        bool visit(PropertyGetDecl* propertyGetDecl);
+        bool visit(PropertySetDecl* propertySetDecl);
+        bool visit(StructDecl* structDecl);
+        bool visit(SubscriptOperatorDecl* subscriptOperatorDecl);
+        bool visit(SubscriptOperatorGetDecl* subscriptOperatorGetDecl);
+        bool visit(SubscriptOperatorSetDecl* subscriptOperatorSetDecl);
+        bool visit(TemplateFunctionDecl* templateFunctionDecl);
+        bool visit(TemplateStructDecl* templateStructDecl);
+        bool visit(TemplateTraitDecl* templateTraitDecl);
+        bool visit(TraitDecl* traitDecl);
+        bool visit(TypeAliasDecl* typeAliasDecl);
+        bool visit(TypeSuffixDecl* typeSuffixDecl);
+        bool visit(VariableDecl* variableDecl);
+
+        void endVisit(EnumDecl* enumDecl);
+        void endVisit(ExtensionDecl* extensionDecl);
+        void endVisit(NamespaceDecl* namespaceDecl);
+        void endVisit(StructDecl* structDecl);
+        void endVisit(TemplateFunctionDecl* templateFunctionDecl);
+        void endVisit(TemplateStructDecl* templateStructDecl);
+        void endVisit(TemplateTraitDecl* templateTraitDecl);
+        void endVisit(TraitDecl* traitDecl);
 
     };
 }
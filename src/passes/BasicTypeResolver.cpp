@@ -27,6 +27,8 @@
 #include <ast/types/TraitType.hpp>
 #include <ast/types/UnresolvedNestedType.hpp>
 #include <ast/conts/WhereCont.hpp>
+#include <ast/conts/RequiresCont.hpp>
+#include <ast/conts/EnsuresCont.hpp>
 #include <ast/types/DependentType.hpp>
 #include <make_reverse_iterator.hpp>
 #include <ast/types/SelfType.hpp>
@@ -35,24 +37,14 @@
 #include "BasicTypeResolver.hpp"
 
 void gulc::BasicTypeResolver::processFiles(std::vector<ASTFile>& files) {
-    for (ASTFile& file : files) {
-        _currentFile = &file;
-
-        for (Decl* decl : file.declarations) {
-            processDecl(decl);
-
-            if (llvm::isa<ExtensionDecl>(decl)) {
-                _currentFile->scopeExtensions.push_back(llvm::dyn_cast<ExtensionDecl>(decl));
-            }
-        }
-    }
+    traverseFiles(files);
 }
 
 void gulc::BasicTypeResolver::printError(std::string const& message, gulc::TextPosition startPosition,
                                          gulc::TextPosition endPosition) const {
     std::cerr << "gulc type resolver error[" << _filePaths[_currentFile->sourceFileID] << ", "
-                                         "{" << startPosition.line << ", " << startPosition.column << " "
-                                         "to " << endPosition.line << ", " << endPosition.column << "}]: "
+                                         "{" << startPosition.line() << ", " << startPosition.column() << " "
+                                         "to " << endPosition.line() << ", " << endPosition.column() << "}]: "
               << message << std::endl;
     std::exit(1);
 }
@@ -60,8 +52,8 @@ void gulc::BasicTypeResolver::printError(std::string const& message, gulc::TextP
 void gulc::BasicTypeResolver::printWarning(std::string const& message, gulc::TextPosition startPosition,
                                            gulc::TextPosition endPosition) const {
     std::cerr << "gulc type resolver warning[" << _filePaths[_currentFile->sourceFileID] << ", "
-                                           "{" << startPosition.line << ", " << startPosition.column << " "
-                                           "to " << endPosition.line << ", " << endPosition.column << "}]: "
+                                           "{" << startPosition.line() << ", " << startPosition.column() << " "
+                                           "to " << endPosition.line() << ", " << endPosition.column() << "}]: "
               << message << std::endl;
 }
 
@@ -95,7 +87,7 @@ void gulc::BasicTypeResolver::processType(gulc::Type*& type) {
     } else if (llvm::isa<FlatArrayType>(type)) {
         auto flatArrayType = llvm::dyn_cast<FlatArrayType>(type);
 
-        processExpr(flatArrayType->length);
+        traverseExpr(flatArrayType->length);
         processType(flatArrayType->indexType);
     } else if (llvm::isa<UnresolvedNestedType>(type)) {
         auto nestedType = llvm::dyn_cast<UnresolvedNestedType>(type);
@@ -160,21 +152,31 @@ void gulc::BasicTypeResolver::processContracts(std::vector<Cont*>& contracts) {
             case Cont::Kind::Where: {
                 auto whereCont = llvm::dyn_cast<WhereCont>(contract);
 
-                processExpr(whereCont->condition);
+                traverseExpr(whereCont->condition);
                 break;
             }
-            case Cont::Kind::Requires:
-                printError("`requires` not yet supported!",
-                           contract->startPosition(), contract->endPosition());
+            case Cont::Kind::Requires: {
+                auto requiresCont = llvm::dyn_cast<RequiresCont>(contract);
+
+                traverseExpr(requiresCont->condition);
                 break;
-            case Cont::Kind::Ensures:
-                printError("`ensures` not yet supported!",
-                           contract->startPosition(), contract->endPosition());
+            }
+            case Cont::Kind::Ensures: {
+                auto ensuresCont = llvm::dyn_cast<EnsuresCont>(contract);
+
+                traverseExpr(ensuresCont->condition);
                 break;
-            case Cont::Kind::Throws:
-                printError("`throws` not yet supported!",
-                           contract->startPosition(), contract->endPosition());
+            }
+            case Cont::Kind::Throws: {
+                auto throwsCont = llvm::dyn_cast<ThrowsCont>(contract);
+
+                if (throwsCont->hasExceptionType() && !resolveType(throwsCont->exceptionType)) {
+                    printError("throws type `" + throwsCont->exceptionType->toString() + "` was not found!",
+                               throwsCont->exceptionType->startPosition(), throwsCont->exceptionType->endPosition());
+                }
+
                 break;
+            }
             default:
                 printError("unknown contract!",
                            contract->startPosition(), contract->endPosition());
@@ -183,149 +185,62 @@ void gulc::BasicTypeResolver::processContracts(std::vector<Cont*>& contracts) {
     }
 }
 
-void gulc::BasicTypeResolver::processDecl(gulc::Decl* decl, bool isGlobal) {
-    switch (decl->getDeclKind()) {
-        case Decl::Kind::Import:
-            // We skip imports, they're no longer useful here...
-            break;
-
-        case Decl::Kind::Enum:
-            processEnumDecl(llvm::dyn_cast<EnumDecl>(decl));
-            break;
-        case Decl::Kind::Extension:
-            processExtensionDecl(llvm::dyn_cast<ExtensionDecl>(decl));
-            break;
-        case Decl::Kind::CallOperator:
-        case Decl::Kind::Constructor:
-        case Decl::Kind::Destructor:
-        case Decl::Kind::Function:
-        case Decl::Kind::Operator:
-        case Decl::Kind::TypeSuffix:
-            processFunctionDecl(llvm::dyn_cast<FunctionDecl>(decl));
-            break;
-        case Decl::Kind::Namespace:
-            processNamespaceDecl(llvm::dyn_cast<NamespaceDecl>(decl));
-            break;
-        case Decl::Kind::Property:
-            processPropertyDecl(llvm::dyn_cast<PropertyDecl>(decl));
-            break;
-        case Decl::Kind::PropertyGet:
-            processPropertyGetDecl(llvm::dyn_cast<PropertyGetDecl>(decl));
-            break;
-        case Decl::Kind::PropertySet:
-            processPropertySetDecl(llvm::dyn_cast<PropertySetDecl>(decl));
-            break;
-        case Decl::Kind::Struct:
-            processStructDecl(llvm::dyn_cast<StructDecl>(decl));
-            break;
-        case Decl::Kind::SubscriptOperator:
-            processSubscriptOperatorDecl(llvm::dyn_cast<SubscriptOperatorDecl>(decl));
-            break;
-        case Decl::Kind::SubscriptOperatorGet:
-            processSubscriptOperatorGetDecl(llvm::dyn_cast<SubscriptOperatorGetDecl>(decl));
-            break;
-        case Decl::Kind::SubscriptOperatorSet:
-            processSubscriptOperatorSetDecl(llvm::dyn_cast<SubscriptOperatorSetDecl>(decl));
-            break;
-        case Decl::Kind::TemplateFunction:
-            processTemplateFunctionDecl(llvm::dyn_cast<TemplateFunctionDecl>(decl));
-            break;
-        case Decl::Kind::TemplateStruct:
-            processTemplateStructDecl(llvm::dyn_cast<TemplateStructDecl>(decl));
-            break;
-        case Decl::Kind::TemplateTrait:
-            processTemplateTraitDecl(llvm::dyn_cast<TemplateTraitDecl>(decl));
-            break;
-        case Decl::Kind::Trait:
-            processTraitDecl(llvm::dyn_cast<TraitDecl>(decl));
-            break;
-        case Decl::Kind::TypeAlias:
-            processTypeAliasDecl(llvm::dyn_cast<TypeAliasDecl>(decl));
-            break;
-        case Decl::Kind::Variable:
-            processVariableDecl(llvm::dyn_cast<VariableDecl>(decl), isGlobal);
-            break;
-
-        default:
-            printError("INTERNAL ERROR - unhandled Decl type found in `BasicTypeResolver`!",
-                       decl->startPosition(), decl->endPosition());
-            break;
-    }
-}
-
-void gulc::BasicTypeResolver::processPrototypeDecl(gulc::Decl* decl, bool isGlobal) {
-    switch (decl->getDeclKind()) {
-        case Decl::Kind::TraitPrototype:
-            processTraitPrototypeDecl(llvm::dyn_cast<TraitPrototypeDecl>(decl));
-            break;
-        default:
-            processDecl(decl, isGlobal);
-            break;
-    }
-}
-
-void gulc::BasicTypeResolver::processEnumDecl(gulc::EnumDecl* enumDecl) {
-    if (enumDecl->constType != nullptr) {
-        if (!resolveType(enumDecl->constType)) {
-            printError("enum base type `" + enumDecl->constType->toString() + "` was not found!",
-                       enumDecl->startPosition(), enumDecl->endPosition());
+void gulc::BasicTypeResolver::processTemplateParameterDecl(gulc::TemplateParameterDecl* templateParameterDecl) {
+    // If the template parameter is a const then we have to process its underlying type
+    if (templateParameterDecl->templateParameterKind() == TemplateParameterDecl::TemplateParameterKind::Const) {
+        if (!resolveType(templateParameterDecl->type)) {
+            printError("const template parameter type `" + templateParameterDecl->type->toString() + "` was not found!",
+                       templateParameterDecl->startPosition(), templateParameterDecl->endPosition());
         }
     } else {
-        enumDecl->constType = gulc::BuiltInType::get(Type::Qualifier::Unassigned, "i32", {}, {});
-    }
-
-    _containingDecls.push_back(enumDecl);
-
-    for (EnumConstDecl* enumConst : enumDecl->enumConsts()) {
-        // TODO: If the `constValue` is null we will need to handle setting the default values
-        if (enumConst->constValue != nullptr) {
-            processExpr(enumConst->constValue);
+        // `typename` parameters don't have to have specialization types...
+        if (templateParameterDecl->type != nullptr) {
+            if (!resolveType(templateParameterDecl->type)) {
+                printError("template parameter specialized type `" +
+                           templateParameterDecl->type->toString() + "` was not found!",
+                           templateParameterDecl->startPosition(), templateParameterDecl->endPosition());
+            }
         }
     }
 
-    for (Decl* member : enumDecl->ownedMembers()) {
-        processDecl(member, false);
+    if (templateParameterDecl->defaultValue != nullptr) {
+        processTemplateArgumentExpr(templateParameterDecl->defaultValue);
     }
-
-    _containingDecls.pop_back();
 }
 
-void gulc::BasicTypeResolver::processExtensionDecl(gulc::ExtensionDecl* extensionDecl) {
-    processContracts(extensionDecl->contracts());
-
-    if (!resolveType(extensionDecl->typeToExtend)) {
-        printError("extension type `" + extensionDecl->typeToExtend->toString() + "` was not found!",
-                   extensionDecl->typeToExtend->startPosition(), extensionDecl->typeToExtend->endPosition());
-    }
+void gulc::BasicTypeResolver::processTemplateArgumentExpr(gulc::Expr*& expr) {
+    // TODO: Support more than just the `IdentifierExpr` (i.e. we need to support saying `std.math.vec2`
+    if (llvm::isa<IdentifierExpr>(expr)) {
+        // TODO: What happens if something is shadowing a type? Do we disallow `const` variables from being able to
+        //       shadow Decls? This could prevent that issue from ever arising...
+        auto identifierExpr = llvm::dyn_cast<IdentifierExpr>(expr);
 
-    for (Type*& inheritedType : extensionDecl->inheritedTypes()) {
-        if (!resolveType(inheritedType)) {
-            printError("extension inherited type `" + inheritedType->toString() + "` was not found!",
-                       inheritedType->startPosition(), inheritedType->endPosition());
-        }
-    }
+        Type* tmpType = new UnresolvedType(Type::Qualifier::Unassigned, {},
+                                           identifierExpr->identifier(),
+                                           identifierExpr->templateArguments());
 
-    _containingDecls.push_back(extensionDecl);
+        if (resolveType(tmpType)) {
+            // We clear them as they should now be used by `tmpType` OR no be deleted...
+            identifierExpr->templateArguments().clear();
 
-    for (Decl* member : extensionDecl->ownedMembers()) {
-        processDecl(member, false);
-    }
+            expr = new TypeExpr(tmpType);
 
-    // Make sure we process the constructors since they are NOT in the `ownedMembers` list...
-    for (ConstructorDecl* constructor : extensionDecl->constructors()) {
-        processDecl(constructor);
+            // Delete the no longer needed identifier expression
+            delete identifierExpr;
+        } else {
+            // TODO: When the type isn't found we should delete `tmpType` and look for a potential `const var`
+            //       (but only if there aren't template parameters...)
+            printError("type `" + identifierExpr->identifier().name() + "` was not found!",
+                       identifierExpr->startPosition(), identifierExpr->endPosition());
+        }
+    } else {
+        traverseExpr(expr);
     }
-
-    _containingDecls.pop_back();
 }
 
-void gulc::BasicTypeResolver::processFunctionDecl(gulc::FunctionDecl* functionDecl) {
+bool gulc::BasicTypeResolver::processFunctionDecl(gulc::FunctionDecl* functionDecl) {
     processContracts(functionDecl->contracts());
 
-    for (ParameterDecl* parameter : functionDecl->parameters()) {
-        processParameterDecl(parameter);
-    }
-
     // Return type might be null for `void`
     if (functionDecl->returnType != nullptr) {
         if (!resolveType(functionDecl->returnType)) {
@@ -340,9 +255,16 @@ void gulc::BasicTypeResolver::processFunctionDecl(gulc::FunctionDecl* functionDe
     // Clear any old values
     _labelIdentifiers.clear();
 
-    processCompoundStmt(functionDecl->body());
+    return true;
+}
+
+void gulc::BasicTypeResolver::addUnresolvedLabel(gulc::Identifier const& label) {
+    if (_labelIdentifiers.find(label.name()) == _labelIdentifiers.end()) {
+        _labelIdentifiers.insert({label.name(), LabelStatus(false, label.startPosition(), label.endPosition())});
+    }
+}
 
-    // Check if any labels were used but not found
+void gulc::BasicTypeResolver::checkLabels() const {
     for (auto const& checkLabel : _labelIdentifiers) {
         if (!checkLabel.second.status) {
             printError("label `" + checkLabel.first + "` was not found!",
@@ -351,56 +273,104 @@ void gulc::BasicTypeResolver::processFunctionDecl(gulc::FunctionDecl* functionDe
     }
 }
 
-void gulc::BasicTypeResolver::processNamespaceDecl(gulc::NamespaceDecl* namespaceDecl) {
-    _containingDecls.push_back(namespaceDecl);
+bool gulc::BasicTypeResolver::visit(gulc::ASTFile* file) {
+    _currentFile = file;
+    return true;
+}
 
-    for (Decl* nestedDecl : namespaceDecl->nestedDecls()) {
-        processDecl(nestedDecl);
+bool gulc::BasicTypeResolver::visit(gulc::CallOperatorDecl* callOperatorDecl) {
+    return processFunctionDecl(callOperatorDecl);
+}
+
+bool gulc::BasicTypeResolver::visit(gulc::ConstructorDecl* constructorDecl) {
+    return processFunctionDecl(constructorDecl);
+}
+
+bool gulc::BasicTypeResolver::visit(gulc::DestructorDecl* destructorDecl) {
+    return processFunctionDecl(destructorDecl);
+}
 
-        if (llvm::isa<ExtensionDecl>(nestedDecl)) {
-            namespaceDecl->scopeExtensions.push_back(llvm::dyn_cast<ExtensionDecl>(nestedDecl));
+bool gulc::BasicTypeResolver::visit(gulc::EnumDecl* enumDecl) {
+    if (enumDecl->constType != nullptr) {
+        if (!resolveType(enumDecl->constType)) {
+            printError("enum base type `" + enumDecl->constType->toString() + "` was not found!",
+                       enumDecl->startPosition(), enumDecl->endPosition());
         }
+    } else {
+        enumDecl->constType = gulc::BuiltInType::get(Type::Qualifier::Unassigned, "i32", {}, {});
     }
 
-    _containingDecls.pop_back();
+    // TODO: If the `constValue` of a case is null we will need to handle setting the default values
+    _containingDecls.push_back(enumDecl);
+    return true;
 }
 
-void gulc::BasicTypeResolver::processParameterDecl(gulc::ParameterDecl* parameterDecl) {
+bool gulc::BasicTypeResolver::visit(gulc::ExtensionDecl* extensionDecl) {
+    processContracts(extensionDecl->contracts());
+
+    if (!resolveType(extensionDecl->typeToExtend)) {
+        printError("extension type `" + extensionDecl->typeToExtend->toString() + "` was not found!",
+                   extensionDecl->typeToExtend->startPosition(), extensionDecl->typeToExtend->endPosition());
+    }
+
+    for (Type*& inheritedType : extensionDecl->inheritedTypes()) {
+        if (!resolveType(inheritedType)) {
+            printError("extension inherited type `" + inheritedType->toString() + "` was not found!",
+                       inheritedType->startPosition(), inheritedType->endPosition());
+        }
+    }
+
+    // Extensions are only visible within the scope they were declared in
+    if (_containingDecls.empty()) {
+        _currentFile->scopeExtensions.push_back(extensionDecl);
+    } else if (llvm::isa<NamespaceDecl>(_containingDecls.back())) {
+        llvm::dyn_cast<NamespaceDecl>(_containingDecls.back())->scopeExtensions.push_back(extensionDecl);
+    }
+
+    _containingDecls.push_back(extensionDecl);
+    return true;
+}
+
+bool gulc::BasicTypeResolver::visit(gulc::FunctionDecl* functionDecl) {
+    return processFunctionDecl(functionDecl);
+}
+
+bool gulc::BasicTypeResolver::visit(gulc::NamespaceDecl* namespaceDecl) {
+    _containingDecls.push_back(namespaceDecl);
+    return true;
+}
+
+bool gulc::BasicTypeResolver::visit(gulc::OperatorDecl* operatorDecl) {
+    return processFunctionDecl(operatorDecl);
+}
+
+bool gulc::BasicTypeResolver::visit(gulc::ParameterDecl* parameterDecl) {
     if (!resolveType(parameterDecl->type)) {
         printError("function parameter type `" + parameterDecl->type->toString() + "` was not found!",
                    parameterDecl->startPosition(), parameterDecl->endPosition());
     }
 
-    if (parameterDecl->defaultValue != nullptr) {
-        processExpr(parameterDecl->defaultValue);
-    }
+    return true;
 }
 
-void gulc::BasicTypeResolver::processPropertyDecl(gulc::PropertyDecl* propertyDecl) {
+bool gulc::BasicTypeResolver::visit(gulc::PropertyDecl* propertyDecl) {
     if (!resolveType(propertyDecl->type)) {
         printError("property type `" + propertyDecl->type->toString() + "` was not found!",
                    propertyDecl->startPosition(), propertyDecl->endPosition());
     }
 
-    for (PropertyGetDecl* getter : propertyDecl->getters()) {
-        // We call the generic `processDecl` so that our attributes are processed properly
-        processDecl(getter);
-    }
-
-    if (propertyDecl->hasSetter()) {
-        processDecl(propertyDecl->setter());
-    }
+    return true;
 }
 
-void gulc::BasicTypeResolver::processPropertyGetDecl(gulc::PropertyGetDecl* propertyGetDecl) {
-    processFunctionDecl(propertyGetDecl);
+bool gulc::BasicTypeResolver::visit(gulc::PropertyGetDecl* propertyGetDecl) {
+    return processFunctionDecl(propertyGetDecl);
 }
 
-void gulc::BasicTypeResolver::processPropertySetDecl(gulc::PropertySetDecl* propertySetDecl) {
-    processFunctionDecl(propertySetDecl);
+bool gulc::BasicTypeResolver::visit(gulc::PropertySetDecl* propertySetDecl) {
+    return processFunctionDecl(propertySetDecl);
 }
 
-void gulc::BasicTypeResolver::processStructDecl(gulc::StructDecl* structDecl) {
+bool gulc::BasicTypeResolver::visit(gulc::StructDecl* structDecl) {
     processContracts(structDecl->contracts());
 
     for (Type*& inheritedType : structDecl->inheritedTypes()) {
@@ -411,28 +381,10 @@ void gulc::BasicTypeResolver::processStructDecl(gulc::StructDecl* structDecl) {
     }
 
     _containingDecls.push_back(structDecl);
-
-    for (Decl* member : structDecl->ownedMembers()) {
-        processDecl(member, false);
-    }
-
-    // Make sure we process the constructors and destructor since they are NOT in the `ownedMembers` list...
-    for (ConstructorDecl* constructor : structDecl->constructors()) {
-        processDecl(constructor);
-    }
-
-    if (structDecl->destructor != nullptr) {
-        processDecl(structDecl->destructor);
-    }
-
-    _containingDecls.pop_back();
+    return true;
 }
 
-void gulc::BasicTypeResolver::processSubscriptOperatorDecl(gulc::SubscriptOperatorDecl* subscriptOperatorDecl) {
-    for (ParameterDecl* parameter : subscriptOperatorDecl->parameters()) {
-        processParameterDecl(parameter);
-    }
-
+bool gulc::BasicTypeResolver::visit(gulc::SubscriptOperatorDecl* subscriptOperatorDecl) {
     // Return type might be null for `void`
     if (subscriptOperatorDecl->type != nullptr) {
         if (!resolveType(subscriptOperatorDecl->type)) {
@@ -444,83 +396,48 @@ void gulc::BasicTypeResolver::processSubscriptOperatorDecl(gulc::SubscriptOperat
                    subscriptOperatorDecl->startPosition(), subscriptOperatorDecl->endPosition());
     }
 
-    for (SubscriptOperatorGetDecl* getter : subscriptOperatorDecl->getters()) {
-        processDecl(getter);
-    }
-
-    if (subscriptOperatorDecl->hasSetter()) {
-        processDecl(subscriptOperatorDecl->setter());
-    }
+    return true;
 }
 
-void gulc::BasicTypeResolver::processSubscriptOperatorGetDecl(gulc::SubscriptOperatorGetDecl* subscriptOperatorGetDecl) {
-    processFunctionDecl(subscriptOperatorGetDecl);
+bool gulc::BasicTypeResolver::visit(gulc::SubscriptOperatorGetDecl* subscriptOperatorGetDecl) {
+    return processFunctionDecl(subscriptOperatorGetDecl);
 }
 
-void gulc::BasicTypeResolver::processSubscriptOperatorSetDecl(gulc::SubscriptOperatorSetDecl* subscriptOperatorSetDecl) {
-    processFunctionDecl(subscriptOperatorSetDecl);
+bool gulc::BasicTypeResolver::visit(gulc::SubscriptOperatorSetDecl* subscriptOperatorSetDecl) {
+    return processFunctionDecl(subscriptOperatorSetDecl);
 }
 
-void gulc::BasicTypeResolver::processTemplateFunctionDecl(gulc::TemplateFunctionDecl* templateFunctionDecl) {
+bool gulc::BasicTypeResolver::visit(gulc::TemplateFunctionDecl* templateFunctionDecl) {
     for (TemplateParameterDecl* templateParameter : templateFunctionDecl->templateParameters()) {
         processTemplateParameterDecl(templateParameter);
     }
 
     _templateParameters.push_back(&templateFunctionDecl->templateParameters());
 
-    processFunctionDecl(templateFunctionDecl);
-
-    _templateParameters.pop_back();
-}
-
-void gulc::BasicTypeResolver::processTemplateParameterDecl(gulc::TemplateParameterDecl* templateParameterDecl) {
-    // If the template parameter is a const then we have to process its underlying type
-    if (templateParameterDecl->templateParameterKind() == TemplateParameterDecl::TemplateParameterKind::Const) {
-        if (!resolveType(templateParameterDecl->type)) {
-            printError("const template parameter type `" + templateParameterDecl->type->toString() + "` was not found!",
-                       templateParameterDecl->startPosition(), templateParameterDecl->endPosition());
-        }
-    } else {
-        // `typename` parameters don't have to have specialization types...
-        if (templateParameterDecl->type != nullptr) {
-            if (!resolveType(templateParameterDecl->type)) {
-                printError("template parameter specialized type `" +
-                           templateParameterDecl->type->toString() + "` was not found!",
-                           templateParameterDecl->startPosition(), templateParameterDecl->endPosition());
-            }
-        }
-    }
-
-    if (templateParameterDecl->defaultValue != nullptr) {
-        processTemplateArgumentExpr(templateParameterDecl->defaultValue);
-    }
+    return processFunctionDecl(templateFunctionDecl);
 }
 
-void gulc::BasicTypeResolver::processTemplateStructDecl(gulc::TemplateStructDecl* templateStructDecl) {
+bool gulc::BasicTypeResolver::visit(gulc::TemplateStructDecl* templateStructDecl) {
     for (TemplateParameterDecl* templateParameter : templateStructDecl->templateParameters()) {
         processTemplateParameterDecl(templateParameter);
     }
 
     _templateParameters.push_back(&templateStructDecl->templateParameters());
 
-    processStructDecl(templateStructDecl);
-
-    _templateParameters.pop_back();
+    return visit(static_cast<StructDecl*>(templateStructDecl));
 }
 
-void gulc::BasicTypeResolver::processTemplateTraitDecl(gulc::TemplateTraitDecl* templateTraitDecl) {
+bool gulc::BasicTypeResolver::visit(gulc::TemplateTraitDecl* templateTraitDecl) {
     for (TemplateParameterDecl* templateParameter : templateTraitDecl->templateParameters()) {
         processTemplateParameterDecl(templateParameter);
     }
 
     _templateParameters.push_back(&templateTraitDecl->templateParameters());
 
-    processTraitDecl(templateTraitDecl);
-
-    _templateParameters.pop_back();
+    return visit(static_cast<TraitDecl*>(templateTraitDecl));
 }
 
-void gulc::BasicTypeResolver::processTraitDecl(gulc::TraitDecl* traitDecl) {
+bool gulc::BasicTypeResolver::visit(gulc::TraitDecl* traitDecl) {
     processContracts(traitDecl->contracts());
 
     for (Type*& inheritedType : traitDecl->inheritedTypes()) {
@@ -530,11 +447,7 @@ void gulc::BasicTypeResolver::processTraitDecl(gulc::TraitDecl* traitDecl) {
         }
     }
 
-    _containingDecls.push_back(traitDecl);
-
     for (Decl* member : traitDecl->ownedMembers()) {
-        processDecl(member, false);
-
         if (llvm::isa<VariableDecl>(member)) {
             // Trait members can only be `const` or `static`
             auto variableMember = llvm::dyn_cast<VariableDecl>(member);
@@ -546,17 +459,20 @@ void gulc::BasicTypeResolver::processTraitDecl(gulc::TraitDecl* traitDecl) {
         }
     }
 
-    _containingDecls.pop_back();
+    _containingDecls.push_back(traitDecl);
+    return true;
 }
 
-void gulc::BasicTypeResolver::processTraitPrototypeDecl(gulc::TraitPrototypeDecl* traitPrototypeDecl) {
+bool gulc::BasicTypeResolver::visit(gulc::TraitPrototypeDecl* traitPrototypeDecl) {
     if (!resolveType(traitPrototypeDecl->traitType)) {
         printError("trait type `" + traitPrototypeDecl->traitType->toString() + "` was not found!",
                    traitPrototypeDecl->startPosition(), traitPrototypeDecl->endPosition());
     }
+
+    return true;
 }
 
-void gulc::BasicTypeResolver::processTypeAliasDecl(gulc::TypeAliasDecl* typeAliasDecl) {
+bool gulc::BasicTypeResolver::visit(gulc::TypeAliasDecl* typeAliasDecl) {
     // TODO: Detect circular references with the potential for `typealias prefix ^<T> = ^T;` or something.
     for (TemplateParameterDecl* templateParameter : typeAliasDecl->templateParameters()) {
         processTemplateParameterDecl(templateParameter);
@@ -574,16 +490,16 @@ void gulc::BasicTypeResolver::processTypeAliasDecl(gulc::TypeAliasDecl* typeAlia
     if (typeAliasDecl->hasTemplateParameters()) {
         _templateParameters.pop_back();
     }
+
+    return true;
 }
 
-void gulc::BasicTypeResolver::processVariableDecl(gulc::VariableDecl* variableDecl, bool isGlobal) {
-    if (isGlobal) {
-        if (!variableDecl->isConstExpr() && !variableDecl->isStatic()) {
-            printError("global variables must be marked `const` or `static`!",
-                       variableDecl->startPosition(), variableDecl->endPosition());
-        }
-    }
+bool gulc::BasicTypeResolver::visit(gulc::TypeSuffixDecl* typeSuffixDecl) {
+    return processFunctionDecl(typeSuffixDecl);
+}
 
+bool gulc::BasicTypeResolver::visit(gulc::VariableDecl* variableDecl) {
+    // NOTE: `BasicDeclValidator` already checked that global variables are `const` or `static`
     if (variableDecl->type == nullptr) {
         printError("variables outside of function bodies and similar MUST have a type specified!",
                    variableDecl->startPosition(), variableDecl->endPosition());
@@ -594,161 +510,42 @@ void gulc::BasicTypeResolver::processVariableDecl(gulc::VariableDecl* variableDe
         }
     }
 
-    if (variableDecl->initialValue != nullptr) {
-        processExpr(variableDecl->initialValue);
-    }
-}
-
-void gulc::BasicTypeResolver::processStmt(gulc::Stmt* stmt) {
-    switch (stmt->getStmtKind()) {
-        case Stmt::Kind::Break:
-            processBreakStmt(llvm::dyn_cast<BreakStmt>(stmt));
-            break;
-        case Stmt::Kind::Case:
-            processCaseStmt(llvm::dyn_cast<CaseStmt>(stmt));
-            break;
-        case Stmt::Kind::Catch:
-            processCatchStmt(llvm::dyn_cast<CatchStmt>(stmt));
-            break;
-        case Stmt::Kind::Compound:
-            processCompoundStmt(llvm::dyn_cast<CompoundStmt>(stmt));
-            break;
-        case Stmt::Kind::Continue:
-            processContinueStmt(llvm::dyn_cast<ContinueStmt>(stmt));
-            break;
-        case Stmt::Kind::DoCatch:
-            processDoCatchStmt(llvm::dyn_cast<DoCatchStmt>(stmt));
-            break;
-        case Stmt::Kind::For:
-            processForStmt(llvm::dyn_cast<ForStmt>(stmt));
-            break;
-        case Stmt::Kind::Goto:
-            processGotoStmt(llvm::dyn_cast<GotoStmt>(stmt));
-            break;
-        case Stmt::Kind::If:
-            processIfStmt(llvm::dyn_cast<IfStmt>(stmt));
-            break;
-        case Stmt::Kind::Labeled:
-            processLabeledStmt(llvm::dyn_cast<LabeledStmt>(stmt));
-            break;
-        case Stmt::Kind::RepeatWhile:
-            processRepeatWhileStmt(llvm::dyn_cast<RepeatWhileStmt>(stmt));
-            break;
-        case Stmt::Kind::Return:
-            processReturnStmt(llvm::dyn_cast<ReturnStmt>(stmt));
-            break;
-        case Stmt::Kind::Switch:
-            processSwitchStmt(llvm::dyn_cast<SwitchStmt>(stmt));
-            break;
-        case Stmt::Kind::While:
-            processWhileStmt(llvm::dyn_cast<WhileStmt>(stmt));
-            break;
-        case Stmt::Kind::Expr:
-            processExpr(llvm::dyn_cast<Expr>(stmt));
-            break;
-
-        default:
-            printError("INTERNAL ERROR - unhandled Stmt type found in `BasicTypeResolver`!",
-                       stmt->startPosition(), stmt->endPosition());
-            break;
-    }
+    return true;
 }
 
-void gulc::BasicTypeResolver::processBreakStmt(gulc::BreakStmt* breakStmt) {
+bool gulc::BasicTypeResolver::visit(gulc::BreakStmt* breakStmt) {
     if (breakStmt->hasBreakLabel()) {
-        if (_labelIdentifiers.find(breakStmt->breakLabel().name()) == _labelIdentifiers.end()) {
-            _labelIdentifiers.insert({breakStmt->breakLabel().name(),
-                                      LabelStatus(false, breakStmt->breakLabel().startPosition(),
-                                                  breakStmt->breakLabel().endPosition())});
-        }
+        addUnresolvedLabel(breakStmt->breakLabel());
     }
-}
 
-void gulc::BasicTypeResolver::processCaseStmt(gulc::CaseStmt* caseStmt) {
-    if (!caseStmt->isDefault()) {
-        processExpr(caseStmt->condition);
-    }
-
-    for (Stmt*& statement : caseStmt->body) {
-        processStmt(statement);
-    }
+    return true;
 }
 
-void gulc::BasicTypeResolver::processCatchStmt(gulc::CatchStmt* catchStmt) {
+bool gulc::BasicTypeResolver::visit(gulc::CatchStmt* catchStmt) {
     if (catchStmt->hasExceptionType()) {
         if (!resolveType(catchStmt->exceptionType)) {
-            printError("catch type `" + catchStmt->exceptionType->toString() = "` was not found!",
+            printError("catch type `" + catchStmt->exceptionType->toString() + "` was not found!",
                        catchStmt->exceptionType->startPosition(), catchStmt->exceptionType->endPosition());
         }
     }
 
-    processStmt(catchStmt->body());
+    return true;
 }
 
-void gulc::BasicTypeResolver::processCompoundStmt(gulc::CompoundStmt* compoundStmt) {
-    for (Stmt* statement : compoundStmt->statements) {
-        processStmt(statement);
-    }
-}
-
-void gulc::BasicTypeResolver::processContinueStmt(gulc::ContinueStmt* continueStmt) {
+bool gulc::BasicTypeResolver::visit(gulc::ContinueStmt* continueStmt) {
     if (continueStmt->hasContinueLabel()) {
-        if (_labelIdentifiers.find(continueStmt->continueLabel().name()) == _labelIdentifiers.end()) {
-            _labelIdentifiers.insert({continueStmt->continueLabel().name(),
-                                      LabelStatus(false, continueStmt->continueLabel().startPosition(),
-                                                  continueStmt->continueLabel().endPosition())});
-        }
-    }
-}
-
-void gulc::BasicTypeResolver::processDoCatchStmt(gulc::DoCatchStmt* doCatchStmt) {
-    processStmt(doCatchStmt->body());
-
-    for (CatchStmt* catchStmt : doCatchStmt->catchStatements()) {
-        processCatchStmt(catchStmt);
-    }
-
-    if (doCatchStmt->hasFinallyStatement()) {
-        processStmt(doCatchStmt->finallyStatement());
-    }
-}
-
-void gulc::BasicTypeResolver::processForStmt(gulc::ForStmt* forStmt) {
-    if (forStmt->init != nullptr) {
-        processExpr(forStmt->init);
-    }
-
-    if (forStmt->condition != nullptr) {
-        processExpr(forStmt->condition);
+        addUnresolvedLabel(continueStmt->continueLabel());
     }
 
-    if (forStmt->iteration != nullptr) {
-        processExpr(forStmt->iteration);
-    }
-
-    processStmt(forStmt->body());
+    return true;
 }
 
-void gulc::BasicTypeResolver::processGotoStmt(gulc::GotoStmt* gotoStmt) {
-    if (_labelIdentifiers.find(gotoStmt->label().name()) == _labelIdentifiers.end()) {
-        _labelIdentifiers.insert({gotoStmt->label().name(),
-                                  LabelStatus(false, gotoStmt->label().startPosition(),
-                                              gotoStmt->label().endPosition())});
-    }
+bool gulc::BasicTypeResolver::visit(gulc::GotoStmt* gotoStmt) {
+    addUnresolvedLabel(gotoStmt->label());
+    return true;
 }
 
-void gulc::BasicTypeResolver::processIfStmt(gulc::IfStmt* ifStmt) {
-    processExpr(ifStmt->condition);
-    processStmt(ifStmt->trueBody());
-
-    if (ifStmt->hasFalseBody()) {
-        processStmt(ifStmt->falseBody());
-    }
-}
-
-void gulc::BasicTypeResolver::processLabeledStmt(gulc::LabeledStmt* labeledStmt) {
-    processStmt(labeledStmt->labeledStmt);
-
+bool gulc::BasicTypeResolver::visit(gulc::LabeledStmt* labeledStmt) {
     // Either store the status as already being true or change the status to true
     if (_labelIdentifiers.find(labeledStmt->label().name()) == _labelIdentifiers.end()) {
         _labelIdentifiers.insert({labeledStmt->label().name(),
@@ -766,159 +563,20 @@ void gulc::BasicTypeResolver::processLabeledStmt(gulc::LabeledStmt* labeledStmt)
         _labelIdentifiers[labeledStmt->label().name()] = LabelStatus(true, labeledStmt->label().startPosition(),
                                                                      labeledStmt->label().endPosition());
     }
-}
-
-void gulc::BasicTypeResolver::processRepeatWhileStmt(gulc::RepeatWhileStmt* repeatWhileStmt) {
-    processStmt(repeatWhileStmt->body());
-    processExpr(repeatWhileStmt->condition);
-}
-
-void gulc::BasicTypeResolver::processReturnStmt(gulc::ReturnStmt* returnStmt) {
-    if (returnStmt->returnValue != nullptr) {
-        processExpr(returnStmt->returnValue);
-    }
-}
-
-void gulc::BasicTypeResolver::processSwitchStmt(gulc::SwitchStmt* switchStmt) {
-    processExpr(switchStmt->condition);
-
-    for (CaseStmt* statement : switchStmt->cases) {
-        processCaseStmt(statement);
-    }
-}
-
-void gulc::BasicTypeResolver::processWhileStmt(gulc::WhileStmt* whileStmt) {
-    processExpr(whileStmt->condition);
-    processStmt(whileStmt->body());
-}
-
-void gulc::BasicTypeResolver::processTemplateArgumentExpr(gulc::Expr*& expr) {
-    // TODO: Support more than just the `IdentifierExpr` (i.e. we need to support saying `std.math.vec2`
-    if (llvm::isa<IdentifierExpr>(expr)) {
-        // TODO: What happens if something is shadowing a type? Do we disallow `const` variables from being able to
-        //       shadow Decls? This could prevent that issue from ever arising...
-        auto identifierExpr = llvm::dyn_cast<IdentifierExpr>(expr);
-
-        Type* tmpType = new UnresolvedType(Type::Qualifier::Unassigned, {},
-                                           identifierExpr->identifier(),
-                                           identifierExpr->templateArguments());
-
-        if (resolveType(tmpType)) {
-            // We clear them as they should now be used by `tmpType` OR no be deleted...
-            identifierExpr->templateArguments().clear();
-
-            expr = new TypeExpr(tmpType);
-
-            // Delete the no longer needed identifier expression
-            delete identifierExpr;
-        } else {
-            // TODO: When the type isn't found we should delete `tmpType` and look for a potential `const var`
-            //       (but only if there aren't template parameters...)
-            printError("type `" + identifierExpr->identifier().name() + "` was not found!",
-                       identifierExpr->startPosition(), identifierExpr->endPosition());
-        }
-    } else {
-        processExpr(expr);
-    }
-}
-
-void gulc::BasicTypeResolver::processExpr(gulc::Expr* expr) {
-    switch (expr->getExprKind()) {
-        case Expr::Kind::ArrayLiteral:
-            processArrayLiteralExpr(llvm::dyn_cast<ArrayLiteralExpr>(expr));
-            break;
-        case Expr::Kind::As:
-            processAsExpr(llvm::dyn_cast<AsExpr>(expr));
-            break;
-        case Expr::Kind::AssignmentOperator:
-            processAssignmentOperatorExpr(llvm::dyn_cast<AssignmentOperatorExpr>(expr));
-            break;
-        case Expr::Kind::BoolLiteral:
-            // Nothing to do here, no type needs resolving.
-            break;
-        case Expr::Kind::CheckExtendsType:
-            processCheckExtendsTypeExpr(llvm::dyn_cast<CheckExtendsTypeExpr>(expr));
-            break;
-        case Expr::Kind::FunctionCall:
-            processFunctionCallExpr(llvm::dyn_cast<FunctionCallExpr>(expr));
-            break;
-        case Expr::Kind::Has:
-            processHasExpr(llvm::dyn_cast<HasExpr>(expr));
-            break;
-        case Expr::Kind::Identifier:
-            processIdentifierExpr(llvm::dyn_cast<IdentifierExpr>(expr));
-            break;
-        case Expr::Kind::InfixOperator:
-            processInfixOperatorExpr(llvm::dyn_cast<InfixOperatorExpr>(expr));
-            break;
-        case Expr::Kind::Is:
-            processIsExpr(llvm::dyn_cast<IsExpr>(expr));
-            break;
-        case Expr::Kind::LabeledArgument:
-            processLabeledArgumentExpr(llvm::dyn_cast<LabeledArgumentExpr>(expr));
-            break;
-        case Expr::Kind::MemberAccessCall:
-            processMemberAccessCallExpr(llvm::dyn_cast<MemberAccessCallExpr>(expr));
-            break;
-        case Expr::Kind::Paren:
-            processParenExpr(llvm::dyn_cast<ParenExpr>(expr));
-            break;
-        case Expr::Kind::PostfixOperator:
-            processPostfixOperatorExpr(llvm::dyn_cast<PostfixOperatorExpr>(expr));
-            break;
-        case Expr::Kind::PrefixOperator:
-            processPrefixOperatorExpr(llvm::dyn_cast<PrefixOperatorExpr>(expr));
-            break;
-        case Expr::Kind::Ref:
-            processRefExpr(llvm::dyn_cast<RefExpr>(expr));
-            break;
-        case Expr::Kind::SubscriptCall:
-            processSubscriptCallExpr(llvm::dyn_cast<SubscriptCallExpr>(expr));
-            break;
-        case Expr::Kind::Ternary:
-            processTernaryExpr(llvm::dyn_cast<TernaryExpr>(expr));
-            break;
-        case Expr::Kind::Try:
-            processTryExpr(llvm::dyn_cast<TryExpr>(expr));
-            break;
-        case Expr::Kind::Type:
-            processTypeExpr(llvm::dyn_cast<TypeExpr>(expr));
-            break;
-        case Expr::Kind::ValueLiteral:
-            processValueLiteralExpr(llvm::dyn_cast<ValueLiteralExpr>(expr));
-            break;
-        case Expr::Kind::VariableDecl:
-            processVariableDeclExpr(llvm::dyn_cast<VariableDeclExpr>(expr));
-            break;
-
-        default:
-            printError("INTERNAL ERROR - unhandled Expr type found in `BasicTypeResolver`!",
-                       expr->startPosition(), expr->endPosition());
-            break;
-    }
-}
 
-void gulc::BasicTypeResolver::processArrayLiteralExpr(gulc::ArrayLiteralExpr* arrayLiteralExpr) {
-    for (Expr* index : arrayLiteralExpr->indexes) {
-        processExpr(index);
-    }
+    return true;
 }
 
-void gulc::BasicTypeResolver::processAsExpr(gulc::AsExpr* asExpr) {
-    processExpr(asExpr->expr);
-
+bool gulc::BasicTypeResolver::visit(gulc::AsExpr* asExpr) {
     if (!resolveType(asExpr->asType)) {
         printError("as type `" + asExpr->asType->toString() + "` was not found!",
                    asExpr->asType->startPosition(), asExpr->asType->endPosition());
     }
-}
 
-void gulc::BasicTypeResolver::processAssignmentOperatorExpr(gulc::AssignmentOperatorExpr* assignmentOperatorExpr) {
-    processExpr(assignmentOperatorExpr->leftValue);
-    processExpr(assignmentOperatorExpr->rightValue);
+    return true;
 }
 
-void gulc::BasicTypeResolver::processCheckExtendsTypeExpr(gulc::CheckExtendsTypeExpr* checkExtendsTypeExpr) {
+bool gulc::BasicTypeResolver::visit(gulc::CheckExtendsTypeExpr* checkExtendsTypeExpr) {
     if (!resolveType(checkExtendsTypeExpr->checkType)) {
         printError("type `" + checkExtendsTypeExpr->checkType->toString() + "` was not found!",
                    checkExtendsTypeExpr->checkType->startPosition(),
@@ -930,103 +588,116 @@ void gulc::BasicTypeResolver::processCheckExtendsTypeExpr(gulc::CheckExtendsType
                    checkExtendsTypeExpr->extendsType->startPosition(),
                    checkExtendsTypeExpr->extendsType->endPosition());
     }
+
+    return true;
 }
 
-void gulc::BasicTypeResolver::processFunctionCallExpr(gulc::FunctionCallExpr* functionCallExpr) {
-    processExpr(functionCallExpr->functionReference);
+bool gulc::BasicTypeResolver::visit(gulc::HasExpr* hasExpr) {
+    // The prototype isn't part of the walk, `BasicDeclValidator` has nothing to check in it
+    traverseDecl(hasExpr->decl);
+    return true;
+}
 
-    for (LabeledArgumentExpr* argument : functionCallExpr->arguments) {
-        processLabeledArgumentExpr(argument);
+bool gulc::BasicTypeResolver::visit(gulc::IsExpr* isExpr) {
+    if (!resolveType(isExpr->isType)) {
+        printError("is type `" + isExpr->isType->toString() + "` was not found!",
+                   isExpr->isType->startPosition(), isExpr->isType->endPosition());
     }
+
+    return true;
 }
 
-void gulc::BasicTypeResolver::processHasExpr(gulc::HasExpr* hasExpr) {
-    processExpr(hasExpr->expr);
-    processPrototypeDecl(hasExpr->decl, false);
+bool gulc::BasicTypeResolver::visit(gulc::TypeExpr* typeExpr) {
+    if (!resolveType(typeExpr->type)) {
+        printError("type `" + typeExpr->toString() + "` was not found!",
+                   typeExpr->startPosition(), typeExpr->endPosition());
+    }
+
+    return true;
 }
 
-void gulc::BasicTypeResolver::processIdentifierExpr(gulc::IdentifierExpr* identifierExpr) {
-    for (Expr* templateArgument : identifierExpr->templateArguments()) {
-        processExpr(templateArgument);
+bool gulc::BasicTypeResolver::visit(gulc::VariableDeclExpr* variableDeclExpr) {
+    if (variableDeclExpr->type != nullptr) {
+        if (!resolveType(variableDeclExpr->type)) {
+            printError("local variable type `" + variableDeclExpr->type->toString() + "` was not found!",
+                       variableDeclExpr->type->startPosition(), variableDeclExpr->type->endPosition());
+        }
     }
+
+    return true;
 }
 
-void gulc::BasicTypeResolver::processInfixOperatorExpr(gulc::InfixOperatorExpr* infixOperatorExpr) {
-    processExpr(infixOperatorExpr->leftValue);
-    processExpr(infixOperatorExpr->rightValue);
+void gulc::BasicTypeResolver::endVisit(gulc::CallOperatorDecl* callOperatorDecl) {
+    checkLabels();
 }
 
-void gulc::BasicTypeResolver::processIsExpr(gulc::IsExpr* isExpr) {
-    processExpr(isExpr->expr);
+void gulc::BasicTypeResolver::endVisit(gulc::ConstructorDecl* constructorDecl) {
+    checkLabels();
+}
 
-    if (!resolveType(isExpr->isType)) {
-        printError("is type `" + isExpr->isType->toString() + "` was not found!",
-                   isExpr->isType->startPosition(), isExpr->isType->endPosition());
-    }
+void gulc::BasicTypeResolver::endVisit(gulc::DestructorDecl* destructorDecl) {
+    checkLabels();
 }
 
-void gulc::BasicTypeResolver::processLabeledArgumentExpr(gulc::LabeledArgumentExpr* labeledArgumentExpr) {
-    processExpr(labeledArgumentExpr->argument);
+void gulc::BasicTypeResolver::endVisit(gulc::EnumDecl* enumDecl) {
+    _containingDecls.pop_back();
 }
 
-void gulc::BasicTypeResolver::processMemberAccessCallExpr(gulc::MemberAccessCallExpr* memberAccessCallExpr) {
-    processExpr(memberAccessCallExpr->objectRef);
+void gulc::BasicTypeResolver::endVisit(gulc::ExtensionDecl* extensionDecl) {
+    _containingDecls.pop_back();
 }
 
-void gulc::BasicTypeResolver::processParenExpr(gulc::ParenExpr* parenExpr) {
-    processExpr(parenExpr->nestedExpr);
+void gulc::BasicTypeResolver::endVisit(gulc::FunctionDecl* functionDecl) {
+    checkLabels();
 }
 
-void gulc::BasicTypeResolver::processPostfixOperatorExpr(gulc::PostfixOperatorExpr* postfixOperatorExpr) {
-    processExpr(postfixOperatorExpr->nestedExpr);
+void gulc::BasicTypeResolver::endVisit(gulc::NamespaceDecl* namespaceDecl) {
+    _containingDecls.pop_back();
 }
 
-void gulc::BasicTypeResolver::processPrefixOperatorExpr(gulc::PrefixOperatorExpr* prefixOperatorExpr) {
-    processExpr(prefixOperatorExpr->nestedExpr);
+void gulc::BasicTypeResolver::endVisit(gulc::OperatorDecl* operatorDecl) {
+    checkLabels();
 }
 
-void gulc::BasicTypeResolver::processRefExpr(gulc::RefExpr* refExpr) {
-    processExpr(refExpr->nestedExpr);
+void gulc::BasicTypeResolver::endVisit(gulc::PropertyGetDecl* propertyGetDecl) {
+    checkLabels();
 }
 
-void gulc::BasicTypeResolver::processSubscriptCallExpr(gulc::SubscriptCallExpr* subscriptCallExpr) {
-    processExpr(subscriptCallExpr->subscriptReference);
+void gulc::BasicTypeResolver::endVisit(gulc::PropertySetDecl* propertySetDecl) {
+    checkLabels();
+}
 
-    for (LabeledArgumentExpr* argument : subscriptCallExpr->arguments) {
-        processLabeledArgumentExpr(argument);
-    }
+void gulc::BasicTypeResolver::endVisit(gulc::StructDecl* structDecl) {
+    _containingDecls.pop_back();
 }
 
-void gulc::BasicTypeResolver::processTernaryExpr(gulc::TernaryExpr* ternaryExpr) {
-    processExpr(ternaryExpr->condition);
-    processExpr(ternaryExpr->trueExpr);
-    processExpr(ternaryExpr->falseExpr);
+void gulc::BasicTypeResolver::endVisit(gulc::SubscriptOperatorGetDecl* subscriptOperatorGetDecl) {
+    checkLabels();
 }
 
-void gulc::BasicTypeResolver::processTryExpr(gulc::TryExpr* tryExpr) {
-    processExpr(tryExpr->nestedExpr);
+void gulc::BasicTypeResolver::endVisit(gulc::SubscriptOperatorSetDecl* subscriptOperatorSetDecl) {
+    checkLabels();
 }
 
-void gulc::BasicTypeResolver::processTypeExpr(gulc::TypeExpr* typeExpr) {
-    if (!resolveType(typeExpr->type)) {
-        printError("type `" + typeExpr->toString() + "` was not found!",
-                   typeExpr->startPosition(), typeExpr->endPosition());
-    }
+void gulc::BasicTypeResolver::endVisit(gulc::TemplateFunctionDecl* templateFunctionDecl) {
+    checkLabels();
+    _templateParameters.pop_back();
 }
 
-void gulc::BasicTypeResolver::processValueLiteralExpr(gulc::ValueLiteralExpr* valueLiteralExpr) const {
-    // TODO: Is there anything we can do here? I don't think there is anything we can do until `DeclInstantiator`...
+void gulc::BasicTypeResolver::endVisit(gulc::TemplateStructDecl* templateStructDecl) {
+    _containingDecls.pop_back();
+    _templateParameters.pop_back();
 }
 
-void gulc::BasicTypeResolver::processVariableDeclExpr(gulc::VariableDeclExpr* variableDeclExpr) {
-    if (variableDeclExpr->type != nullptr) {
-        if (!resolveType(variableDeclExpr->type)) {
-            printError("local variable type `" + variableDeclExpr->type->toString() + "` was not found!",
-                       variableDeclExpr->type->startPosition(), variableDeclExpr->type->endPosition());
-        }
-    }
+void gulc::BasicTypeResolver::endVisit(gulc::TemplateTraitDecl* templateTraitDecl) {
+    _containingDecls.pop_back();
+    _templateParameters.pop_back();
+}
 
-    if (variableDeclExpr->initialValue != nullptr) {
-        processExpr(variableDeclExpr->initialValue);
-    }
+void gulc::BasicTypeResolver::endVisit(gulc::TraitDecl* traitDecl) {
+    _containingDecls.pop_back();
+}
+
+void gulc::BasicTypeResolver::endVisit(gulc::TypeSuffixDecl* typeSuffixDecl) {
+    checkLabels();
 }
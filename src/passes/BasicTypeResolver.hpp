@@ -35,6 +35,7 @@
 #include <ast/stmts/LabeledStmt.hpp>
 #include <ast/stmts/ReturnStmt.hpp>
 #include <ast/stmts/SwitchStmt.hpp>
+#include <ast/stmts/ThrowStmt.hpp>
 #include <ast/stmts/DoCatchStmt.hpp>
 #include <ast/stmts/WhileStmt.hpp>
 #include <ast/exprs/ArrayLiteralExpr.hpp>
@@ -65,7 +66,10 @@
 #include <ast/exprs/TryExpr.hpp>
 #include <ast/exprs/BoolLiteralExpr.hpp>
 #include <ast/exprs/RefExpr.hpp>
+#include <ast/exprs/NewExpr.hpp>
+#include <ast/exprs/DeleteExpr.hpp>
 #include <ast/decls/TraitPrototypeDecl.hpp>
+#include <ast/ASTVisitor.hpp>
 
 namespace gulc {
     /**
@@ -77,9 +81,12 @@ namespace gulc {
      * This will handle top level types AND types contained within `FunctionDecl` bodies.
      *
      * NOTE: This will also handle some basic validation within `Stmt` instances
+     * NOTE: `main` runs this in the same walk as `BasicDeclValidator`, every node is validated before it is resolved
      */
-    class BasicTypeResolver {
+    class BasicTypeResolver : public ASTVisitor<BasicTypeResolver> {
     public:
+        static constexpr bool walksParsedAST = true;
+
         BasicTypeResolver(std::vector<std::string> const& filePaths, std::vector<NamespaceDecl*>& namespacePrototypes)
                 : _filePaths(filePaths), _namespacePrototypes(namespacePrototypes), _currentFile() {}
 
@@ -123,69 +130,75 @@ namespace gulc {
         void processType(Type*& type);
 
         void processContracts(std::vector<Cont*>& contracts);
-
-        void processDecl(Decl* decl, bool isGlobal = true);
-        void processPrototypeDecl(Decl* decl, bool isGlobal = true);
-        void processEnumDecl(EnumDecl* enumDecl);
-        void processExtensionDecl(ExtensionDecl* extensionDecl);
-        void processFunctionDecl(FunctionDecl* functionDecl);
-        void processNamespaceDecl(NamespaceDecl* namespaceDecl);
-        void processParameterDecl(ParameterDecl* parameterDecl);
-        void processPropertyDecl(PropertyDecl* propertyDecl);
-        void processPropertyGetDecl(PropertyGetDecl* propertyGetDecl);
-        void processPropertySetDecl(PropertySetDecl* propertySetDecl);
-        void processStructDecl(StructDecl* structDecl);
-        void processSubscriptOperatorDecl(SubscriptOperatorDecl* subscriptOperatorDecl);
-        void processSubscriptOperatorGetDecl(SubscriptOperatorGetDecl* subscriptOperatorGetDecl);
-        void processSubscriptOperatorSetDecl(SubscriptOperatorSetDecl* subscriptOperatorSetDecl);
-        void processTemplateFunctionDecl(TemplateFunctionDecl* templateFunctionDecl);
+        bool processFunctionDecl(FunctionDecl* functionDecl);
         void processTemplateParameterDecl(TemplateParameterDecl* templateParameterDecl);
-        void processTemplateStructDecl(TemplateStructDecl* templateStructDecl);
-        void processTemplateTraitDecl(TemplateTraitDecl* templateTraitDecl);
-        void processTraitDecl(TraitDecl* traitDecl);
-        void processTraitPrototypeDecl(TraitPrototypeDecl* traitPrototypeDecl);
-        void processTypeAliasDecl(TypeAliasDecl* typeAliasDecl);
-        void processVariableDecl(VariableDecl* variableDecl, bool isGlobal);
-
-        void processStmt(Stmt* stmt);
-        void processBreakStmt(BreakStmt* breakStmt);
-        void processCaseStmt(CaseStmt* caseStmt);
-        void processCatchStmt(CatchStmt* catchStmt);
-        void processCompoundStmt(CompoundStmt* compoundStmt);
-        void processContinueStmt(ContinueStmt* continueStmt);
-        void processDoCatchStmt(DoCatchStmt* doCatchStmt);
-        void processForStmt(ForStmt* forStmt);
-        void processGotoStmt(GotoStmt* gotoStmt);
-        void processIfStmt(IfStmt* ifStmt);
-        void processLabeledStmt(LabeledStmt* labeledStmt);
-        void processRepeatWhileStmt(RepeatWhileStmt* repeatWhileStmt);
-        void processReturnStmt(ReturnStmt* returnStmt);
-        void processSwitchStmt(SwitchStmt* switchStmt);
-        void processWhileStmt(WhileStmt* whileStmt);
-
         void processTemplateArgumentExpr(Expr*& expr);
-        void processExpr(Expr* expr);
-        void processArrayLiteralExpr(ArrayLiteralExpr* arrayLiteralExpr);
-        void processAsExpr(AsExpr* asExpr);
-        void processAssignmentOperatorExpr(AssignmentOperatorExpr* assignmentOperatorExpr);
-        void processCheckExtendsTypeExpr(CheckExtendsTypeExpr* checkExtendsTypeExpr);
-        void processFunctionCallExpr(FunctionCallExpr* functionCallExpr);
-        void processHasExpr(HasExpr* hasExpr);
-        void processIdentifierExpr(IdentifierExpr* identifierExpr);
-        void processInfixOperatorExpr(InfixOperatorExpr* infixOperatorExpr);
-        void processIsExpr(IsExpr* isExpr);
-        void processLabeledArgumentExpr(LabeledArgumentExpr* labeledArgumentExpr);
-        void processMemberAccessCallExpr(MemberAccessCallExpr* memberAccessCallExpr);
-        void processParenExpr(ParenExpr* parenExpr);
-        void processPostfixOperatorExpr(PostfixOperatorExpr* postfixOperatorExpr);
-        void processPrefixOperatorExpr(PrefixOperatorExpr* prefixOperatorExpr);
-        void processRefExpr(RefExpr* refExpr);
-        void processSubscriptCallExpr(SubscriptCallExpr* indexerCallExpr);
-        void processTernaryExpr(TernaryExpr* ternaryExpr);
-        void processTryExpr(TryExpr* tryExpr);
-        void processTypeExpr(TypeExpr* typeExpr);
-        void processValueLiteralExpr(ValueLiteralExpr* valueLiteralExpr) const;
-        void processVariableDeclExpr(VariableDeclExpr* variableDeclExpr);
+        void addUnresolvedLabel(Identifier const& label);
+        // Check if any labels were used but not found
+        void checkLabels() const;
+
+        friend class ASTVisitor<BasicTypeResolver>;
+        template<typename...> friend class FusedASTVisitor;
+        using ASTVisitor<BasicTypeResolver>::visit;
+        using ASTVisitor<BasicTypeResolver>::endVisit;
+
+        bool visit(ASTFile* file);
+        bool visit(CallOperatorDecl* callOperatorDecl);
+        bool visit(ConstructorDecl* constructorDecl);
+        bool visit(DestructorDecl* destructorDecl);
+        bool visit(EnumDecl* enumDecl);
+        bool visit(ExtensionDecl* extensionDecl);
+        bool visit(FunctionDecl* functionDecl);
+        bool visit(NamespaceDecl* namespaceDecl);
+        bool visit(OperatorDecl* operatorDecl);
+        bool visit(ParameterDecl* parameterDecl);
+        bool visit(PropertyDecl* propertyDecl);
+        bool visit(PropertyGetDecl* propertyGetDecl);
+        bool visit(PropertySetDecl* propertySetDecl);
+        bool visit(StructDecl* structDecl);
+        bool visit(SubscriptOperatorDecl* subscriptOperatorDecl);
+        bool visit(SubscriptOperatorGetDecl* subscriptOperatorGetDecl);
+        bool visit(SubscriptOperatorSetDecl* subscriptOperatorSetDecl);
+        bool visit(TemplateFunctionDecl* templateFunctionDecl);
+        bool visit(TemplateStructDecl* templateStructDecl);
+        bool visit(TemplateTraitDecl* templateTraitDecl);
+        bool visit(TraitDecl* traitDecl);
+        bool visit(TraitPrototypeDecl* traitPrototypeDecl);
+        bool visit(TypeAliasDecl* typeAliasDecl);
+        bool visit(TypeSuffixDecl* typeSuffixDecl);
+        bool visit(VariableDecl* variableDecl);
+
+        bool visit(BreakStmt* breakStmt);
+        bool visit(CatchStmt* catchStmt);
+        bool visit(ContinueStmt* continueStmt);
+        bool visit(GotoStmt* gotoStmt);
+        bool visit(LabeledStmt* labeledStmt);
+
+        bool visit(AsExpr* asExpr);
+        bool visit(CheckExtendsTypeExpr* checkExtendsTypeExpr);
+        bool visit(HasExpr* hasExpr);
+        bool visit(IsExpr* isExpr);
+        bool visit(TypeExpr* typeExpr);
+        bool visit(VariableDeclExpr* variableDeclExpr);
+
+        void endVisit(CallOperatorDecl* callOperatorDecl);
+        void endVisit(ConstructorDecl* constructorDecl);
+        void endVisit(DestructorDecl* destructorDecl);
+        void endVisit(EnumDecl* enumDecl);
+        void endVisit(ExtensionDecl* extensionDecl);
+        void endVisit(FunctionDecl* functionDecl);
+        void endVisit(NamespaceDecl* namespaceDecl);
+        void endVisit(OperatorDecl* operatorDecl);
+        void endVisit(PropertyGetDecl* propertyGetDecl);
+        void endVisit(PropertySetDecl* propertySetDecl);
+        void endVisit(StructDecl* structDecl);
+        void endVisit(SubscriptOperatorGetDecl* subscriptOperatorGetDecl);
+        void endVisit(SubscriptOperatorSetDecl* subscriptOperatorSetDecl);
+        void endVisit(TemplateFunctionDecl* templateFunctionDecl);
+        void endVisit(TemplateStructDecl* templateStructDecl);
+        void endVisit(TemplateTraitDecl* templateTraitDecl);
+        void endVisit(TraitDecl* traitDecl);
+        void endVisit(TypeSuffixDecl* typeSuffixDecl);
 
     };
 }
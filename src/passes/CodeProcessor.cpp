@@ -26,6 +26,8 @@
 #include <ast/types/TraitType.hpp>
 #include <ast/types/TemplateTraitType.hpp>
 #include <ast/exprs/VTableFunctionReferenceExpr.hpp>
+#include <ast/exprs/WitnessFunctionReferenceExpr.hpp>
+#include <utilities/WitnessTableUtil.hpp>
 #include <ast/exprs/FunctionReferenceExpr.hpp>
 #include <ast/exprs/MemberFunctionCallExpr.hpp>
 #include <ast/types/ReferenceType.hpp>
@@ -35,6 +37,7 @@
 #include <ast/exprs/ParameterRefExpr.hpp>
 #include <ast/exprs/EnumConstRefExpr.hpp>
 #include <utilities/TypeHelper.hpp>
+#include <utilities/TemplateInstHelper.hpp>
 #include <ast/exprs/MemberVariableRefExpr.hpp>
 #include <ast/exprs/VariableRefExpr.hpp>
 #include <ast/exprs/ImplicitCastExpr.hpp>
@@ -54,8 +57,17 @@
 #include <ast/exprs/SubscriptOperatorSetCallExpr.hpp>
 #include <ast/exprs/RValueToInRefExpr.hpp>
 #include <ast/exprs/MemberInfixOperatorCallExpr.hpp>
+#include <ast/conts/RequiresCont.hpp>
+#include <ast/conts/EnsuresCont.hpp>
+#include <ast/conts/ThrowsCont.hpp>
+#include <ast/exprs/FlatArrayIndexExpr.hpp>
+#include <ast/exprs/SimdBuiltInCallExpr.hpp>
+#include <ast/attrs/UnresolvedAttr.hpp>
+#include <ast/attrs/BranchHintAttr.hpp>
 
 void gulc::CodeProcessor::processFiles(std::vector<ASTFile>& files) {
+    _files = &files;
+
     for (ASTFile& file : files) {
         _currentFile = &file;
 
@@ -63,13 +75,17 @@ void gulc::CodeProcessor::processFiles(std::vector<ASTFile>& files) {
             processDecl(decl);
         }
     }
+
+    // Template instantiation member functions are only instantiated once something references them, everything
+    // referenced by the files above (and by those bodies in turn) is handled here.
+    processPendingFunctionBodies();
 }
 
 void gulc::CodeProcessor::printError(const std::string& message, gulc::TextPosition startPosition,
                                      gulc::TextPosition endPosition) const {
     std::cerr << "gulc error[" << _filePaths[_currentFile->sourceFileID] << ", "
-                            "{" << startPosition.line << ", " << startPosition.column << " "
-                            "to " << endPosition.line << ", " << endPosition.column << "}]: "
+                            "{" << startPosition.line() << ", " << startPosition.column() << " "
+                            "to " << endPosition.line() << ", " << endPosition.column() << "}]: "
               << message << std::endl;
     std::exit(1);
 }
@@ -77,8 +93,8 @@ void gulc::CodeProcessor::printError(const std::string& message, gulc::TextPosit
 void gulc::CodeProcessor::printWarning(const std::string& message, gulc::TextPosition startPosition,
                                        gulc::TextPosition endPosition) const {
     std::cout << "gulc warning[" << _filePaths[_currentFile->sourceFileID] << ", "
-                              "{" << startPosition.line << ", " << startPosition.column << " "
-                              "to " << endPosition.line << ", " << endPosition.column << "}]: "
+                              "{" << startPosition.line() << ", " << startPosition.column() << " "
+                              "to " << endPosition.line() << ", " << endPosition.column() << "}]: "
               << message << std::endl;
 }
 
@@ -414,6 +430,8 @@ void gulc::CodeProcessor::processFunctionDecl(gulc::FunctionDecl* functionDecl)
         processParameterDecl(parameter);
     }
 
+    processFunctionContracts(functionDecl);
+
     // Prototypes don't have bodies
     if (!functionDecl->isPrototype()) {
         processCompoundStmt(functionDecl->body());
@@ -423,6 +441,55 @@ void gulc::CodeProcessor::processFunctionDecl(gulc::FunctionDecl* functionDecl)
     _currentFunction = oldFunction;
 }
 
+void gulc::CodeProcessor::processFunctionContracts(gulc::FunctionDecl* functionDecl) {
+    // NOTE: `requires` and `ensures` are processed the same way as an `if` condition, the only difference is that
+    //       they can only reference the parameters and `self`
+    for (Cont* contract : functionDecl->contracts()) {
+        Expr** condition;
+
+        if (llvm::isa<RequiresCont>(contract)) {
+            condition = &llvm::dyn_cast<RequiresCont>(contract)->condition;
+        } else if (llvm::isa<EnsuresCont>(contract)) {
+            condition = &llvm::dyn_cast<EnsuresCont>(contract)->condition;
+        } else if (llvm::isa<ThrowsCont>(contract)) {
+            auto throwsCont = llvm::dyn_cast<ThrowsCont>(contract);
+
+            if (throwsCont->hasExceptionType()) {
+                checkErrorType(throwsCont->exceptionType);
+            }
+
+            continue;
+        } else {
+            continue;
+        }
+
+        processExpr(*condition);
+
+        *condition = handleGetter(*condition);
+        *condition = convertLValueToRValue(*condition);
+        *condition = dereferenceReference(*condition);
+
+        if (!llvm::isa<BoolType>((*condition)->valueType)) {
+            printError("contract condition must be of type `bool`, found `" + (*condition)->valueType->toString() +
+                       "`!",
+                       contract->startPosition(), contract->endPosition());
+        }
+    }
+}
+
+void gulc::CodeProcessor::checkErrorType(gulc::Type const* errorType) {
+    // Errors are returned through a hidden slot in the caller's frame and are never destructed, so for now we only
+    // allow plain values such as error codes and `enum`s
+    bool isVoid = llvm::isa<BuiltInType>(errorType) && llvm::dyn_cast<BuiltInType>(errorType)->sizeInBytes() == 0;
+
+    if (isVoid || !(llvm::isa<BuiltInType>(errorType) || llvm::isa<BoolType>(errorType) ||
+                    llvm::isa<EnumType>(errorType))) {
+        printError("error type `" + errorType->toString() + "` is not supported, only built in types and `enum`s "
+                   "can be thrown!",
+                   errorType->startPosition(), errorType->endPosition());
+    }
+}
+
 void gulc::CodeProcessor::processNamespaceDecl(gulc::NamespaceDecl* namespaceDecl) {
     Decl* oldContainer = _currentContainer;
     _currentContainer = namespaceDecl;
@@ -549,6 +616,92 @@ void gulc::CodeProcessor::processVariableDecl(gulc::VariableDecl* variableDecl)
     }
 }
 
+void gulc::CodeProcessor::requireFunctionBody(gulc::FunctionDecl* functionDecl) {
+    // Only template function instantiations and the members of template instantiations are lazy, everything else is
+    // processed in declaration order
+    // NOTE: Template function instantiations aren't part of any file's declarations, their body is always processed
+    //       here even when it was already copied from the template
+    if ((functionDecl->bodyIsInstantiated && !llvm::isa<TemplateFunctionInstDecl>(functionDecl)) ||
+            _pendingFunctionBodiesSet.count(functionDecl) > 0) {
+        return;
+    }
+
+    _pendingFunctionBodiesSet.insert(functionDecl);
+    _pendingFunctionBodies.push(functionDecl);
+
+    if (llvm::isa<ConstructorDecl>(functionDecl)) {
+        requireStructSpecialMembers(llvm::dyn_cast<StructDecl>(functionDecl->container));
+    }
+}
+
+void gulc::CodeProcessor::requireStructSpecialMembers(gulc::StructDecl* structDecl) {
+    // Once a struct can be constructed it can also be copied, moved, and destructed by `CodeTransformer` without any
+    // reference we could see here. The `vtable` also references every virtual function.
+    if (structDecl->cachedCopyConstructor != nullptr) {
+        requireFunctionBody(structDecl->cachedCopyConstructor);
+    }
+
+    if (structDecl->cachedMoveConstructor != nullptr) {
+        requireFunctionBody(structDecl->cachedMoveConstructor);
+    }
+
+    if (structDecl->destructor != nullptr) {
+        requireFunctionBody(structDecl->destructor);
+    }
+
+    for (FunctionDecl* vtableFunction : structDecl->vtable) {
+        requireFunctionBody(vtableFunction);
+    }
+
+    if (structDecl->baseStruct != nullptr) {
+        requireStructSpecialMembers(structDecl->baseStruct);
+    }
+}
+
+void gulc::CodeProcessor::processPendingFunctionBodies() {
+    ASTFile* oldFile = _currentFile;
+    Decl* oldContainer = _currentContainer;
+
+    while (!_pendingFunctionBodies.empty()) {
+        FunctionDecl* functionDecl = _pendingFunctionBodies.front();
+        _pendingFunctionBodies.pop();
+
+        TemplateInstHelper templateInstHelper;
+        templateInstHelper.instantiateFunctionDeclBody(functionDecl);
+
+        // The body is processed from within the file the template was declared in, not the file that referenced it
+        for (ASTFile& file : *_files) {
+            if (file.sourceFileID == functionDecl->sourceFileID()) {
+                _currentFile = &file;
+                break;
+            }
+        }
+
+        // `get` and `set` are contained within their property/subscript but are processed with the struct as the
+        // container, the same as `processStructDecl` does
+        _currentContainer = functionDecl->container;
+
+        while (_currentContainer != nullptr &&
+                (llvm::isa<PropertyDecl>(_currentContainer) || llvm::isa<SubscriptOperatorDecl>(_currentContainer))) {
+            _currentContainer = _currentContainer->container;
+        }
+
+        if (llvm::isa<ConstructorDecl>(functionDecl)) {
+            auto temporaryInitializersCompoundStmt =
+                    createStructMemberInitializersCompoundStmt(llvm::dyn_cast<StructDecl>(_currentContainer));
+
+            processConstructorDecl(llvm::dyn_cast<ConstructorDecl>(functionDecl), temporaryInitializersCompoundStmt);
+
+            delete temporaryInitializersCompoundStmt;
+        } else {
+            processFunctionDecl(functionDecl);
+        }
+    }
+
+    _currentContainer = oldContainer;
+    _currentFile = oldFile;
+}
+
 void gulc::CodeProcessor::processBaseConstructorCall(gulc::StructDecl* structDecl,
                                                      gulc::FunctionCallExpr*& functionCallExpr) {
     for (LabeledArgumentExpr* labeledArgumentExpr : functionCallExpr->arguments) {
@@ -814,6 +967,9 @@ void gulc::CodeProcessor::processStmt(gulc::Stmt*& stmt) {
         case Stmt::Kind::Switch:
             processSwitchStmt(llvm::dyn_cast<SwitchStmt>(stmt));
             break;
+        case Stmt::Kind::Throw:
+            processThrowStmt(llvm::dyn_cast<ThrowStmt>(stmt));
+            break;
         case Stmt::Kind::While:
             processWhileStmt(llvm::dyn_cast<WhileStmt>(stmt));
             break;
@@ -830,6 +986,8 @@ void gulc::CodeProcessor::processStmt(gulc::Stmt*& stmt) {
                        stmt->startPosition(), stmt->endPosition());
             break;
     }
+
+    checkSoaElementsAccessed();
 }
 
 void gulc::CodeProcessor::processBreakStmt(gulc::BreakStmt* breakStmt) {
@@ -853,7 +1011,31 @@ void gulc::CodeProcessor::processCaseStmt(gulc::CaseStmt* caseStmt) {
 }
 
 void gulc::CodeProcessor::processCatchStmt(gulc::CatchStmt* catchStmt) {
+    std::size_t oldLocalVariableCount = _localVariables.size();
+
+    if (catchStmt->hasExceptionType()) {
+        checkErrorType(catchStmt->exceptionType);
+
+        // `catch e: exception` declares `e` as a local variable that only exists within the `catch` body
+        if (catchStmt->hasVarName()) {
+            for (VariableDeclExpr* checkVariable : _localVariables) {
+                if (checkVariable->identifier().name() == catchStmt->varName().name()) {
+                    printError("local variable `" + catchStmt->varName().name() + "` redefined!",
+                               catchStmt->varName().startPosition(), catchStmt->varName().endPosition());
+                }
+            }
+
+            catchStmt->exceptionVariable = new VariableDeclExpr(catchStmt->varName(),
+                                                                catchStmt->exceptionType->deepCopy(), nullptr,
+                                                                false, catchStmt->varName().startPosition(),
+                                                                catchStmt->varName().endPosition());
+            _localVariables.push_back(catchStmt->exceptionVariable);
+        }
+    }
+
     processCompoundStmt(catchStmt->body());
+
+    _localVariables.resize(oldLocalVariableCount);
 }
 
 void gulc::CodeProcessor::processCompoundStmt(gulc::CompoundStmt* compoundStmt) {
@@ -880,7 +1062,10 @@ void gulc::CodeProcessor::processDoCatchStmt(gulc::DoCatchStmt* doCatchStmt) {
     }
 
     if (doCatchStmt->hasFinallyStatement()) {
-        processCompoundStmt(doCatchStmt->finallyStatement());
+        // TODO: `finally` has to run on every way out of the `do`, including `return`, `break`, etc. Until the cleanup
+        //       chains support that we don't allow it.
+        printError("`finally` is not yet supported!",
+                   doCatchStmt->finallyStatement()->startPosition(), doCatchStmt->finallyStatement()->endPosition());
     }
 }
 
@@ -913,6 +1098,41 @@ void gulc::CodeProcessor::processGotoStmt(gulc::GotoStmt* gotoStmt) {
 }
 
 void gulc::CodeProcessor::processIfStmt(gulc::IfStmt* ifStmt) {
+    bool hasBranchHint = false;
+
+    for (Attr*& attribute : ifStmt->attributes) {
+        if (llvm::isa<BranchHintAttr>(attribute)) {
+            // Already resolved (e.g. the statement was copied from an already processed template)
+            hasBranchHint = true;
+            continue;
+        }
+
+        auto unresolvedAttr = llvm::dyn_cast<UnresolvedAttr>(attribute);
+        std::string const& attrName = unresolvedAttr->identifier().name();
+
+        if (!unresolvedAttr->namespacePath().empty() || (attrName != "likely" && attrName != "unlikely")) {
+            printError("unknown `if` statement attribute `@" + attrName + "`!",
+                       unresolvedAttr->startPosition(), unresolvedAttr->endPosition());
+        }
+
+        if (!unresolvedAttr->arguments.empty()) {
+            printError("attribute `@" + attrName + "` does not accept any arguments!",
+                       unresolvedAttr->startPosition(), unresolvedAttr->endPosition());
+        }
+
+        if (hasBranchHint) {
+            printError("`if` statements can only have one `@likely` or `@unlikely` attribute!",
+                       unresolvedAttr->startPosition(), unresolvedAttr->endPosition());
+        }
+
+        hasBranchHint = true;
+
+        Attr* resolvedAttr = new BranchHintAttr(attrName == "likely", unresolvedAttr->startPosition(),
+                                                unresolvedAttr->endPosition());
+        delete attribute;
+        attribute = resolvedAttr;
+    }
+
     processExpr(ifStmt->condition);
     processCompoundStmt(ifStmt->trueBody());
 
@@ -972,6 +1192,18 @@ void gulc::CodeProcessor::processSwitchStmt(gulc::SwitchStmt* switchStmt) {
     }
 }
 
+void gulc::CodeProcessor::processThrowStmt(gulc::ThrowStmt* throwStmt) {
+    if (throwStmt->hasThrownValue()) {
+        processExpr(throwStmt->thrownValue);
+
+        throwStmt->thrownValue = handleGetter(throwStmt->thrownValue);
+        throwStmt->thrownValue = convertLValueToRValue(throwStmt->thrownValue);
+        throwStmt->thrownValue = dereferenceReference(throwStmt->thrownValue);
+
+        checkErrorType(throwStmt->thrownValue->valueType);
+    }
+}
+
 void gulc::CodeProcessor::processWhileStmt(gulc::WhileStmt* whileStmt) {
     processExpr(whileStmt->condition);
     processCompoundStmt(whileStmt->body());
@@ -1008,8 +1240,24 @@ void gulc::CodeProcessor::processExpr(gulc::Expr*& expr) {
         case Expr::Kind::CheckExtendsType:
             processCheckExtendsTypeExpr(llvm::dyn_cast<CheckExtendsTypeExpr>(expr));
             break;
+        case Expr::Kind::Delete:
+            processDeleteExpr(llvm::dyn_cast<DeleteExpr>(expr));
+            break;
         case Expr::Kind::FunctionCall: {
             auto functionCallExpr = llvm::dyn_cast<FunctionCallExpr>(expr);
+
+            // The `simd_*` functions are built in and have no declaration to resolve to
+            if (llvm::isa<IdentifierExpr>(functionCallExpr->functionReference)) {
+                auto identifierExpr = llvm::dyn_cast<IdentifierExpr>(functionCallExpr->functionReference);
+                SimdBuiltInCallExpr::BuiltIn simdBuiltIn;
+
+                if (!identifierExpr->hasTemplateArguments() &&
+                        SimdBuiltInCallExpr::getBuiltIn(identifierExpr->identifier().name(), simdBuiltIn)) {
+                    processSimdBuiltInCallExpr(expr);
+                    break;
+                }
+            }
+
             processFunctionCallExpr(functionCallExpr);
             expr = functionCallExpr;
             break;
@@ -1036,6 +1284,9 @@ void gulc::CodeProcessor::processExpr(gulc::Expr*& expr) {
         case Expr::Kind::MemberAccessCall:
             processMemberAccessCallExpr(expr);
             break;
+        case Expr::Kind::New:
+            processNewExpr(llvm::dyn_cast<NewExpr>(expr));
+            break;
         case Expr::Kind::Paren:
             processParenExpr(llvm::dyn_cast<ParenExpr>(expr));
             break;
@@ -1359,7 +1610,7 @@ void gulc::CodeProcessor::processBoolLiteralExpr(gulc::BoolLiteralExpr* boolLite
 }
 
 void gulc::CodeProcessor::processCallOperatorReferenceExpr(gulc::CallOperatorReferenceExpr* callOperatorReferenceExpr) {
-
+    requireFunctionBody(callOperatorReferenceExpr->callOperator);
 }
 
 void gulc::CodeProcessor::processCheckExtendsTypeExpr(gulc::CheckExtendsTypeExpr* checkExtendsTypeExpr) {
@@ -1371,7 +1622,28 @@ void gulc::CodeProcessor::processConstructorCallExpr(gulc::ConstructorCallExpr*
 }
 
 void gulc::CodeProcessor::processConstructorReferenceExpr(gulc::ConstructorReferenceExpr* constructorReferenceExpr) {
+    requireFunctionBody(constructorReferenceExpr->constructor);
+}
+
+void gulc::CodeProcessor::processDeleteExpr(gulc::DeleteExpr* deleteExpr) {
+    processExpr(deleteExpr->pointer);
+
+    deleteExpr->pointer = handleGetter(deleteExpr->pointer);
+    deleteExpr->pointer = convertLValueToRValue(deleteExpr->pointer);
+    deleteExpr->pointer = dereferenceReference(deleteExpr->pointer);
+
+    auto pointerType = llvm::dyn_cast<PointerType>(deleteExpr->pointer->valueType);
+
+    // Only memory from `@new` can be deleted and `@new` only constructs structs
+    if (pointerType == nullptr || !llvm::isa<StructType>(pointerType->nestedType)) {
+        printError("`@delete` expects a pointer to a struct, found `" +
+                   deleteExpr->pointer->valueType->toString() + "`!",
+                   deleteExpr->startPosition(), deleteExpr->endPosition());
+    }
 
+    requireStructSpecialMembers(llvm::dyn_cast<StructType>(pointerType->nestedType)->decl());
+
+    deleteExpr->valueType = BuiltInType::get(Type::Qualifier::Immut, "void", {}, {});
 }
 
 void gulc::CodeProcessor::processEnumConstRefExpr(gulc::EnumConstRefExpr* enumConstRefExpr) {
@@ -1823,6 +2095,7 @@ void gulc::CodeProcessor::processFunctionCallExpr(gulc::FunctionCallExpr*& funct
                             identifierExpr->endPosition(),
                             contextPropertyDecl
                     );
+                    processPropertyRefExpr(llvm::dyn_cast<PropertyRefExpr>(refPropertyDecl));
 
                     // We can't use a `PropertyRefExpr` by itself. It needs to be converted into the `get` call
                     refPropertyDecl = handleGetter(refPropertyDecl);
@@ -1869,6 +2142,7 @@ void gulc::CodeProcessor::processFunctionCallExpr(gulc::FunctionCallExpr*& funct
                         identifierExpr->endPosition(),
                         foundConstructor
                 );
+                processConstructorReferenceExpr(constructorReferenceExpr);
                 auto constructorCallExpr = new ConstructorCallExpr(
                         constructorReferenceExpr,
                         nullptr,
@@ -1934,6 +2208,8 @@ void gulc::CodeProcessor::processFunctionCallExpr(gulc::FunctionCallExpr*& funct
                     delete functionCallExpr;
                     functionCallExpr = newExpr;
                 } else {
+                    requireFunctionBody(functionDecl);
+
                     // Delete the old function reference and replace it with the new one.
                     delete functionCallExpr->functionReference;
                     functionCallExpr->functionReference = createStaticFunctionReference(functionCallExpr, functionDecl);
@@ -2207,6 +2483,7 @@ void gulc::CodeProcessor::processFunctionCallExpr(gulc::FunctionCallExpr*& funct
                             memberAccessCallExpr->objectRef,
                             contextProperty
                     );
+                    processMemberPropertyRefExpr(memberRef);
 
                     selfRef = handleGetter(memberRef);
                 } else if (llvm::isa<VariableDecl>(foundDecl.contextDecl)) {
@@ -2262,6 +2539,7 @@ void gulc::CodeProcessor::processFunctionCallExpr(gulc::FunctionCallExpr*& funct
                         memberAccessCallExpr->member->endPosition(),
                         foundConstructor
                 );
+                processConstructorReferenceExpr(constructorReferenceExpr);
                 auto constructorCallExpr = new ConstructorCallExpr(
                         constructorReferenceExpr,
                         nullptr,
@@ -2304,7 +2582,43 @@ void gulc::CodeProcessor::processFunctionCallExpr(gulc::FunctionCallExpr*& funct
                 // converting from lvalue to rvalue, casting, and other rules for us.
                 handleArgumentCasting(functionDecl->parameters(), functionCallExpr->arguments);
 
-                if (functionDecl->isMemberFunction()) {
+                if (functionDecl->isMemberFunction() &&
+                        llvm::isa<TraitType>(memberAccessCallExpr->objectRef->valueType)) {
+                    // Calls through a trait object are dispatched through the witness table the object carries
+                    auto traitType = llvm::dyn_cast<TraitType>(memberAccessCallExpr->objectRef->valueType);
+                    long witnessIndex = WitnessTableUtil::getWitnessIndex(traitType->decl(), functionDecl);
+
+                    if (witnessIndex < 0) {
+                        printError("function `" + functionDecl->identifier().name() + "` cannot be called through "
+                                   "trait object `" + traitType->toString() + "`!",
+                                   functionCallExpr->startPosition(), functionCallExpr->endPosition());
+                    }
+
+                    auto functionReference = new WitnessFunctionReferenceExpr(
+                            memberAccessCallExpr->startPosition(),
+                            memberAccessCallExpr->member->endPosition(),
+                            traitType->decl(),
+                            static_cast<std::size_t>(witnessIndex),
+                            functionDecl
+                    );
+                    functionReference->valueType = TypeHelper::getFunctionPointerTypeFromDecl(functionDecl);
+                    // The trait object is passed around by value, we only need its `{ self, witness table }` pair
+                    auto newExpr = new MemberFunctionCallExpr(
+                            functionReference,
+                            convertLValueToRValue(memberAccessCallExpr->objectRef),
+                            functionCallExpr->arguments,
+                            functionCallExpr->startPosition(),
+                            functionCallExpr->endPosition()
+                    );
+
+                    // We steal the object reference
+                    memberAccessCallExpr->objectRef = nullptr;
+                    // And we steal the arguments
+                    functionCallExpr->arguments.clear();
+                    // Delete the old function call and replace it with the new one
+                    delete functionCallExpr;
+                    functionCallExpr = newExpr;
+                } else if (functionDecl->isMemberFunction()) {
                     // TODO: Support `vtable` calls?
                     auto functionReference = new FunctionReferenceExpr(
                             memberAccessCallExpr->startPosition(),
@@ -2328,6 +2642,8 @@ void gulc::CodeProcessor::processFunctionCallExpr(gulc::FunctionCallExpr*& funct
                     delete functionCallExpr;
                     functionCallExpr = newExpr;
                 } else {
+                    requireFunctionBody(functionDecl);
+
                     // Delete the old function reference and replace it with the new one.
                     delete functionCallExpr->functionReference;
                     functionCallExpr->functionReference = createStaticFunctionReference(functionCallExpr, functionDecl);
@@ -3249,6 +3565,7 @@ gulc::Expr* gulc::CodeProcessor::createStaticFunctionReference(Expr* forExpr, gu
 }
 
 void gulc::CodeProcessor::processFunctionReferenceExpr(gulc::FunctionReferenceExpr* functionReferenceExpr) {
+    requireFunctionBody(functionReferenceExpr->functionDecl());
     functionReferenceExpr->valueType = TypeHelper::getFunctionPointerTypeFromDecl(functionReferenceExpr->functionDecl());
 }
 
@@ -3632,6 +3949,7 @@ void gulc::CodeProcessor::processIdentifierExpr(gulc::Expr*& expr) {
             // NOTE: This will be handled upstream through `handle*Getter` and `handleSetter`
             auto propertyDecl = llvm::dyn_cast<PropertyDecl>(foundDecl);
             auto newExpr = new PropertyRefExpr(expr->startPosition(), expr->endPosition(), propertyDecl);
+            processPropertyRefExpr(newExpr);
             // Delete the old identifier
             delete expr;
             expr = newExpr;
@@ -3894,6 +4212,7 @@ void gulc::CodeProcessor::processInfixOperatorExpr(gulc::InfixOperatorExpr*& inf
             // We handle argument casting and conversion no matter what. The below function will handle
             // converting from lvalue to rvalue, casting, and other rules for us.
             handleArgumentCasting(foundOperator->parameters()[0], infixOperatorExpr->rightValue);
+            requireFunctionBody(foundOperator);
 
             auto newMemberInfixOperatorCall = new MemberInfixOperatorCallExpr(
                     foundOperator,
@@ -3922,6 +4241,11 @@ void gulc::CodeProcessor::processInfixOperatorExpr(gulc::InfixOperatorExpr*& inf
     auto leftType = infixOperatorExpr->leftValue->valueType;
     auto rightType = infixOperatorExpr->rightValue->valueType;
 
+    if (llvm::isa<SimdType>(leftType) || llvm::isa<SimdType>(rightType)) {
+        processSimdInfixOperatorExpr(infixOperatorExpr);
+        return;
+    }
+
     switch (infixOperatorExpr->infixOperator()) {
         case InfixOperators::LogicalAnd: // &&
         case InfixOperators::LogicalOr: // ||
@@ -4018,11 +4342,15 @@ void gulc::CodeProcessor::processInfixOperatorExpr(gulc::InfixOperatorExpr*& inf
         //       references.
         infixOperatorExpr->rightValue = new ImplicitCastExpr(infixOperatorExpr->rightValue,
                                                              leftBuiltIn->deepCopy());
+        infixOperatorExpr->rightValue->valueType = leftBuiltIn->deepCopy();
+        infixOperatorExpr->rightValue->valueType->setIsLValue(false);
     } else if (rightBuiltIn->sizeInBytes() > leftBuiltIn->sizeInBytes()) {
         // Cast `left` to the type of `right`
         // TODO: Check if there is an extension to implicitly cast `left` to `right` as that is overloadable
         infixOperatorExpr->leftValue = new ImplicitCastExpr(infixOperatorExpr->leftValue,
                                                             rightBuiltIn->deepCopy());
+        infixOperatorExpr->leftValue->valueType = rightBuiltIn->deepCopy();
+        infixOperatorExpr->leftValue->valueType->setIsLValue(false);
 
         resultType = rightBuiltIn;
     }
@@ -4048,6 +4376,127 @@ void gulc::CodeProcessor::processInfixOperatorExpr(gulc::InfixOperatorExpr*& inf
     // At this point is properly validated and any required casts are complete.
 }
 
+void gulc::CodeProcessor::processSimdInfixOperatorExpr(gulc::InfixOperatorExpr* infixOperatorExpr) {
+    // NOTE: By this point both sides have been converted to rvalues and dereferenced.
+    SimdType* simdType;
+
+    // If only one side is a `simd` then the other side is a scalar that is splat into every element
+    if (!llvm::isa<SimdType>(infixOperatorExpr->leftValue->valueType)) {
+        simdType = llvm::dyn_cast<SimdType>(infixOperatorExpr->rightValue->valueType);
+        infixOperatorExpr->leftValue = splatScalarToSimd(infixOperatorExpr->leftValue, simdType);
+    } else if (!llvm::isa<SimdType>(infixOperatorExpr->rightValue->valueType)) {
+        simdType = llvm::dyn_cast<SimdType>(infixOperatorExpr->leftValue->valueType);
+        infixOperatorExpr->rightValue = splatScalarToSimd(infixOperatorExpr->rightValue, simdType);
+    } else {
+        simdType = llvm::dyn_cast<SimdType>(infixOperatorExpr->leftValue->valueType);
+
+        // Unlike scalars there are no implicit casts between vectors, `simd<i16, 4>` to `simd<i32, 4>` changes the
+        // size of the entire vector.
+        TypeCompareUtil typeCompareUtil;
+
+        if (!typeCompareUtil.compareAreSame(simdType, infixOperatorExpr->rightValue->valueType)) {
+            printError("cannot implicitly convert between `" + simdType->toString() + "` and `" +
+                       infixOperatorExpr->rightValue->valueType->toString() + "`!",
+                       infixOperatorExpr->startPosition(), infixOperatorExpr->endPosition());
+        }
+    }
+
+    bool isBoolElement = llvm::isa<BoolType>(simdType->elementType);
+    bool isFloatElement = !isBoolElement && llvm::dyn_cast<BuiltInType>(simdType->elementType)->isFloating();
+
+    switch (infixOperatorExpr->infixOperator()) {
+        case InfixOperators::Add: // +
+        case InfixOperators::Subtract: // -
+        case InfixOperators::Multiply: // *
+        case InfixOperators::Divide: // /
+        case InfixOperators::Remainder: // %
+            if (isBoolElement) {
+                printError("arithmetic operators are not supported on `" + simdType->toString() + "`!",
+                           infixOperatorExpr->startPosition(), infixOperatorExpr->endPosition());
+            }
+
+            infixOperatorExpr->valueType = simdType->deepCopy();
+            break;
+        case InfixOperators::BitwiseAnd: // &
+        case InfixOperators::BitwiseOr: // |
+        case InfixOperators::BitwiseXor: // ^
+            if (isFloatElement) {
+                printError("bitwise operators are not supported on `" + simdType->toString() + "`!",
+                           infixOperatorExpr->startPosition(), infixOperatorExpr->endPosition());
+            }
+
+            infixOperatorExpr->valueType = simdType->deepCopy();
+            break;
+        case InfixOperators::BitshiftLeft: // <<
+        case InfixOperators::BitshiftRight: // >>
+            if (isBoolElement || isFloatElement) {
+                printError("bitshift operators are not supported on `" + simdType->toString() + "`!",
+                           infixOperatorExpr->startPosition(), infixOperatorExpr->endPosition());
+            }
+
+            infixOperatorExpr->valueType = simdType->deepCopy();
+            break;
+        case InfixOperators::EqualTo: // ==
+        case InfixOperators::NotEqualTo: // !=
+        case InfixOperators::GreaterThan: // >
+        case InfixOperators::LessThan: // <
+        case InfixOperators::GreaterThanEqualTo: // >=
+        case InfixOperators::LessThanEqualTo: // <=
+            // Comparisons are done element-wise, resulting in a mask with one `bool` per element
+            infixOperatorExpr->valueType = new SimdType(Type::Qualifier::Immut,
+                                                        new BoolType(Type::Qualifier::Immut, {}, {}),
+                                                        simdType->length(), {}, {});
+            break;
+        default:
+            // `&&` and `||` would be ambiguous for vectors (all elements vs. any element?), `&` and `|` are used
+            // for element-wise masks and `simd_reduce_and`/`simd_reduce_or` are used for "all" and "any"
+            printError("infix operator `" + getInfixOperatorStringValue(infixOperatorExpr->infixOperator()) +
+                       "` is not supported on `" + simdType->toString() + "`!",
+                       infixOperatorExpr->startPosition(), infixOperatorExpr->endPosition());
+            break;
+    }
+
+    infixOperatorExpr->valueType->setQualifier(Type::Qualifier::Immut);
+    infixOperatorExpr->valueType->setIsLValue(false);
+}
+
+gulc::Expr* gulc::CodeProcessor::splatScalarToSimd(gulc::Expr* scalar, gulc::SimdType* simdType) {
+    TypeCompareUtil typeCompareUtil;
+
+    if (!typeCompareUtil.compareAreSame(scalar->valueType, simdType->elementType)) {
+        // The only implicit conversion we allow is for untyped number literals, `vec * 2` should work for any
+        // `simd<iN, N>`. Everything else needs an explicit cast to the element type to make the splat obvious.
+        bool isConvertibleLiteral = false;
+
+        if (llvm::isa<ValueLiteralExpr>(scalar) && llvm::isa<BuiltInType>(simdType->elementType)) {
+            auto valueLiteralExpr = llvm::dyn_cast<ValueLiteralExpr>(scalar);
+            auto elementBuiltIn = llvm::dyn_cast<BuiltInType>(simdType->elementType);
+
+            isConvertibleLiteral = valueLiteralExpr->suffix().empty() &&
+                    (valueLiteralExpr->literalType() == ValueLiteralExpr::LiteralType::Integer ||
+                     (valueLiteralExpr->literalType() == ValueLiteralExpr::LiteralType::Float &&
+                      elementBuiltIn->isFloating()));
+        }
+
+        if (!isConvertibleLiteral) {
+            printError("cannot implicitly convert `" + scalar->valueType->toString() + "` to `" +
+                       simdType->toString() + "`, the scalar must be of type `" +
+                       simdType->elementType->toString() + "`!",
+                       scalar->startPosition(), scalar->endPosition());
+        }
+
+        auto castToElement = new ImplicitCastExpr(scalar, simdType->elementType->deepCopy());
+        castToElement->valueType = simdType->elementType->deepCopy();
+        castToElement->valueType->setIsLValue(false);
+        scalar = castToElement;
+    }
+
+    auto splat = new ImplicitCastExpr(scalar, simdType->deepCopy());
+    splat->valueType = simdType->deepCopy();
+    splat->valueType->setIsLValue(false);
+    return splat;
+}
+
 bool gulc::CodeProcessor::fillListOfMatchingInfixOperators(std::vector<Decl*>& decls, gulc::InfixOperators findOperator,
                                                            gulc::Type* argType,
                                                            std::vector<MatchingDecl>& matchingDecls) {
@@ -4416,6 +4865,11 @@ void gulc::CodeProcessor::processMemberAccessCallExpr(gulc::Expr*& expr) {
             }
 
             checkType = llvm::dyn_cast<PointerType>(checkType)->nestedType;
+
+            // The value of the pointer is the address of the struct, that is what the member is indexed out of
+            memberAccessCallExpr->objectRef = handleGetter(memberAccessCallExpr->objectRef);
+            memberAccessCallExpr->objectRef = convertLValueToRValue(memberAccessCallExpr->objectRef);
+            memberAccessCallExpr->objectRef = dereferenceReference(memberAccessCallExpr->objectRef);
         }
 
         if (memberAccessCallExpr->member->hasTemplateArguments()) {
@@ -4540,6 +4994,9 @@ void gulc::CodeProcessor::processMemberAccessCallExpr(gulc::Expr*& expr) {
                                 llvm::dyn_cast<StructDecl>(foundDecl->container),
                                 {}, {}
                             );
+                // `array[i].member` is the only valid use of an `@soa` array element
+                _unaccessedSoaElements.erase(memberAccessCallExpr->objectRef);
+
                 auto newExpr = new MemberVariableRefExpr(
                         expr->startPosition(),
                         expr->endPosition(),
@@ -4625,6 +5082,8 @@ gulc::Decl* gulc::CodeProcessor::findMatchingMemberDecl(std::vector<Decl*> const
 
 void gulc::CodeProcessor::processMemberPostfixOperatorCallExpr(
         gulc::MemberPostfixOperatorCallExpr* memberPostfixOperatorCallExpr) {
+    requireFunctionBody(memberPostfixOperatorCallExpr->postfixOperatorDecl);
+
     // TODO: Do we need to do `lvalue -> rvalue`?
     if (memberPostfixOperatorCallExpr->postfixOperatorDecl->returnType != nullptr) {
         memberPostfixOperatorCallExpr->valueType =
@@ -4635,6 +5094,8 @@ void gulc::CodeProcessor::processMemberPostfixOperatorCallExpr(
 
 void gulc::CodeProcessor::processMemberPrefixOperatorCallExpr(
         gulc::MemberPrefixOperatorCallExpr* memberPrefixOperatorCallExpr) {
+    requireFunctionBody(memberPrefixOperatorCallExpr->prefixOperatorDecl);
+
     // TODO: Do we need to do `lvalue -> rvalue`?
     if (memberPrefixOperatorCallExpr->prefixOperatorDecl->returnType != nullptr) {
         memberPrefixOperatorCallExpr->valueType =
@@ -4644,14 +5105,28 @@ void gulc::CodeProcessor::processMemberPrefixOperatorCallExpr(
 }
 
 void gulc::CodeProcessor::processMemberPropertyRefExpr(gulc::MemberPropertyRefExpr* memberPropertyRefExpr) {
-    // NOTE: This doesn't ever need to do anything. Properties are handled by the assignment operator handling it
-    //       as a special case. Any other function should make a call to convert any `get/set` decls into their getter
-    //       forms.
+    // NOTE: Properties are handled by the assignment operator handling it as a special case. Any other function
+    //       should make a call to convert any `get/set` decls into their getter forms. We don't know which one will be
+    //       used yet so every accessor body is required.
+    for (PropertyGetDecl* getter : memberPropertyRefExpr->propertyDecl->getters()) {
+        requireFunctionBody(getter);
+    }
+
+    if (memberPropertyRefExpr->propertyDecl->hasSetter()) {
+        requireFunctionBody(memberPropertyRefExpr->propertyDecl->setter());
+    }
 }
 
 void gulc::CodeProcessor::processMemberSubscriptOperatorRefExpr(
         gulc::MemberSubscriptOperatorRefExpr* memberSubscriptOperatorRefExpr) {
     // NOTE: Ditto to the above `processMemberPropertyRefExpr`.
+    for (SubscriptOperatorGetDecl* getter : memberSubscriptOperatorRefExpr->subscriptOperatorDecl->getters()) {
+        requireFunctionBody(getter);
+    }
+
+    if (memberSubscriptOperatorRefExpr->subscriptOperatorDecl->hasSetter()) {
+        requireFunctionBody(memberSubscriptOperatorRefExpr->subscriptOperatorDecl->setter());
+    }
 }
 
 void gulc::CodeProcessor::processMemberVariableRefExpr(gulc::MemberVariableRefExpr* memberVariableRefExpr) {
@@ -4663,6 +5138,31 @@ void gulc::CodeProcessor::processMemberVariableRefExpr(gulc::MemberVariableRefEx
     memberVariableRefExpr->valueType->setIsLValue(true);
 }
 
+void gulc::CodeProcessor::processNewExpr(gulc::NewExpr* newExpr) {
+    processExpr(newExpr->initializer);
+
+    auto constructorCallExpr = llvm::dyn_cast<ConstructorCallExpr>(newExpr->initializer);
+
+    if (constructorCallExpr == nullptr) {
+        printError("`@new` expects a constructor call (e.g. `@new Type()`), found `" +
+                   newExpr->initializer->toString() + "`!",
+                   newExpr->startPosition(), newExpr->endPosition());
+    }
+
+    auto constructorReferenceExpr = llvm::dyn_cast<ConstructorReferenceExpr>(constructorCallExpr->functionReference);
+
+    // There is no `try @new` yet, a throwing constructor would leak the memory allocated for it
+    if (constructorReferenceExpr->constructor->throws()) {
+        printError("`@new` cannot call a constructor that can throw!",
+                   newExpr->startPosition(), newExpr->endPosition());
+    }
+
+    auto structType = constructorCallExpr->valueType->deepCopy();
+    structType->setIsLValue(false);
+
+    newExpr->valueType = new PointerType(Type::Qualifier::Mut, structType);
+}
+
 void gulc::CodeProcessor::processParenExpr(gulc::ParenExpr* parenExpr) {
     processExpr(parenExpr->nestedExpr);
 
@@ -5100,9 +5600,16 @@ void gulc::CodeProcessor::processPrefixOperatorExpr(gulc::PrefixOperatorExpr*& p
 }
 
 void gulc::CodeProcessor::processPropertyRefExpr(gulc::PropertyRefExpr* propertyRefExpr) {
-    // NOTE: We don't do anything here. `PropertyRef` and `SubscriptRef` are special references to `get/set` decls that
-    //       are handled special within assignments. All other expressions should make a call to convert `get/set`
-    //       references to only their getter forms.
+    // NOTE: `PropertyRef` and `SubscriptRef` are special references to `get/set` decls that are handled special within
+    //       assignments. All other expressions should make a call to convert `get/set` references to only their
+    //       getter forms. All we do here is require every accessor body.
+    for (PropertyGetDecl* getter : propertyRefExpr->propertyDecl->getters()) {
+        requireFunctionBody(getter);
+    }
+
+    if (propertyRefExpr->propertyDecl->hasSetter()) {
+        requireFunctionBody(propertyRefExpr->propertyDecl->setter());
+    }
 }
 
 void gulc::CodeProcessor::processRefExpr(gulc::RefExpr* refExpr) {
@@ -5135,6 +5642,240 @@ void gulc::CodeProcessor::processRefExpr(gulc::RefExpr* refExpr) {
     }
 }
 
+void gulc::CodeProcessor::processSimdBuiltInCallExpr(gulc::Expr*& expr) {
+    auto functionCallExpr = llvm::dyn_cast<FunctionCallExpr>(expr);
+    auto identifierExpr = llvm::dyn_cast<IdentifierExpr>(functionCallExpr->functionReference);
+    std::string const& builtInName = identifierExpr->identifier().name();
+    SimdBuiltInCallExpr::BuiltIn builtIn;
+    SimdBuiltInCallExpr::getBuiltIn(builtInName, builtIn);
+
+    std::vector<Expr*> arguments;
+    std::vector<std::size_t> shuffleMask;
+
+    for (LabeledArgumentExpr* labeledArgument : functionCallExpr->arguments) {
+        if (labeledArgument->label().name() != "_") {
+            printError("arguments to `" + builtInName + "` cannot be labeled!",
+                       labeledArgument->startPosition(), labeledArgument->endPosition());
+        }
+
+        // We steal the argument
+        Expr* argument = labeledArgument->argument;
+        labeledArgument->argument = nullptr;
+
+        // The shuffle indices have to be known at compile time so we only accept integer literals for them
+        if (builtIn == SimdBuiltInCallExpr::BuiltIn::Shuffle && !arguments.empty() &&
+                llvm::isa<ValueLiteralExpr>(argument) &&
+                llvm::dyn_cast<ValueLiteralExpr>(argument)->literalType() == ValueLiteralExpr::LiteralType::Integer) {
+            shuffleMask.push_back(std::stoull(llvm::dyn_cast<ValueLiteralExpr>(argument)->value()));
+            delete argument;
+            continue;
+        }
+
+        if (!shuffleMask.empty()) {
+            printError("`simd_shuffle` indices must be integer literals and come after the vectors being shuffled!",
+                       argument->startPosition(), argument->endPosition());
+        }
+
+        processExpr(argument);
+        argument = handleGetter(argument);
+        argument = convertLValueToRValue(argument);
+        argument = dereferenceReference(argument);
+
+        arguments.push_back(argument);
+    }
+
+    auto simdBuiltInCallExpr = new SimdBuiltInCallExpr(builtIn, arguments,
+                                                       functionCallExpr->startPosition(),
+                                                       functionCallExpr->endPosition());
+    simdBuiltInCallExpr->shuffleMask = shuffleMask;
+    delete functionCallExpr;
+    expr = simdBuiltInCallExpr;
+
+    std::size_t expectedArgumentCount;
+
+    switch (builtIn) {
+        case SimdBuiltInCallExpr::BuiltIn::Shuffle:
+            expectedArgumentCount = arguments.size() == 2 ? 2 : 1;
+            break;
+        case SimdBuiltInCallExpr::BuiltIn::Extract:
+            expectedArgumentCount = 2;
+            break;
+        case SimdBuiltInCallExpr::BuiltIn::Select:
+        case SimdBuiltInCallExpr::BuiltIn::Insert:
+        case SimdBuiltInCallExpr::BuiltIn::MaskedLoad:
+        case SimdBuiltInCallExpr::BuiltIn::MaskedStore:
+            expectedArgumentCount = 3;
+            break;
+        default:
+            // `simd_reduce_*`
+            expectedArgumentCount = 1;
+            break;
+    }
+
+    if (arguments.size() != expectedArgumentCount) {
+        printError("`" + builtInName + "` expects " + std::to_string(expectedArgumentCount) + " argument(s), " +
+                   std::to_string(arguments.size()) + " were provided!",
+                   simdBuiltInCallExpr->startPosition(), simdBuiltInCallExpr->endPosition());
+    }
+
+    TypeCompareUtil typeCompareUtil;
+    Type* resultType = nullptr;
+
+    switch (builtIn) {
+        case SimdBuiltInCallExpr::BuiltIn::Shuffle: {
+            SimdType* vectorType = getSimdBuiltInArgumentType(simdBuiltInCallExpr, 0);
+
+            if (arguments.size() == 2 && !typeCompareUtil.compareAreSame(vectorType, arguments[1]->valueType)) {
+                printError("both vectors passed to `simd_shuffle` must be the same type!",
+                           arguments[1]->startPosition(), arguments[1]->endPosition());
+            }
+
+            if (shuffleMask.empty()) {
+                printError("`simd_shuffle` requires at least one index!",
+                           simdBuiltInCallExpr->startPosition(), simdBuiltInCallExpr->endPosition());
+            }
+
+            // With two vectors the indices continue from the first vector into the second
+            std::size_t sourceLength = vectorType->length() * arguments.size();
+
+            for (std::size_t shuffleIndex : shuffleMask) {
+                if (shuffleIndex >= sourceLength) {
+                    printError("`simd_shuffle` index `" + std::to_string(shuffleIndex) + "` is out of range!",
+                               simdBuiltInCallExpr->startPosition(), simdBuiltInCallExpr->endPosition());
+                }
+            }
+
+            resultType = new SimdType(Type::Qualifier::Immut, vectorType->elementType->deepCopy(),
+                                      shuffleMask.size(), {}, {});
+            break;
+        }
+        case SimdBuiltInCallExpr::BuiltIn::Select: {
+            SimdType* maskType = getSimdBuiltInArgumentType(simdBuiltInCallExpr, 0);
+            SimdType* vectorType = getSimdBuiltInArgumentType(simdBuiltInCallExpr, 1);
+
+            if (!llvm::isa<BoolType>(maskType->elementType) || maskType->length() != vectorType->length()) {
+                printError("`simd_select` mask must be of type `simd<bool, " +
+                           std::to_string(vectorType->length()) + ">`!",
+                           arguments[0]->startPosition(), arguments[0]->endPosition());
+            }
+
+            if (!typeCompareUtil.compareAreSame(vectorType, arguments[2]->valueType)) {
+                printError("both vectors passed to `simd_select` must be the same type!",
+                           arguments[2]->startPosition(), arguments[2]->endPosition());
+            }
+
+            resultType = vectorType->deepCopy();
+            break;
+        }
+        case SimdBuiltInCallExpr::BuiltIn::Extract: {
+            SimdType* vectorType = getSimdBuiltInArgumentType(simdBuiltInCallExpr, 0);
+            checkSimdBuiltInIndex(arguments[1]);
+
+            resultType = vectorType->elementType->deepCopy();
+            break;
+        }
+        case SimdBuiltInCallExpr::BuiltIn::Insert: {
+            SimdType* vectorType = getSimdBuiltInArgumentType(simdBuiltInCallExpr, 0);
+            checkSimdBuiltInIndex(arguments[1]);
+
+            if (!typeCompareUtil.compareAreSame(vectorType->elementType, arguments[2]->valueType)) {
+                printError("`simd_insert` value must be of type `" + vectorType->elementType->toString() + "`!",
+                           arguments[2]->startPosition(), arguments[2]->endPosition());
+            }
+
+            resultType = vectorType->deepCopy();
+            break;
+        }
+        case SimdBuiltInCallExpr::BuiltIn::ReduceAdd:
+        case SimdBuiltInCallExpr::BuiltIn::ReduceMul:
+        case SimdBuiltInCallExpr::BuiltIn::ReduceMin:
+        case SimdBuiltInCallExpr::BuiltIn::ReduceMax: {
+            SimdType* vectorType = getSimdBuiltInArgumentType(simdBuiltInCallExpr, 0);
+
+            if (!llvm::isa<BuiltInType>(vectorType->elementType)) {
+                printError("`" + builtInName + "` is not supported on `" + vectorType->toString() + "`!",
+                           simdBuiltInCallExpr->startPosition(), simdBuiltInCallExpr->endPosition());
+            }
+
+            resultType = vectorType->elementType->deepCopy();
+            break;
+        }
+        case SimdBuiltInCallExpr::BuiltIn::ReduceAnd:
+        case SimdBuiltInCallExpr::BuiltIn::ReduceOr:
+        case SimdBuiltInCallExpr::BuiltIn::ReduceXor: {
+            SimdType* vectorType = getSimdBuiltInArgumentType(simdBuiltInCallExpr, 0);
+
+            if (llvm::isa<BuiltInType>(vectorType->elementType) &&
+                    llvm::dyn_cast<BuiltInType>(vectorType->elementType)->isFloating()) {
+                printError("`" + builtInName + "` is not supported on `" + vectorType->toString() + "`!",
+                           simdBuiltInCallExpr->startPosition(), simdBuiltInCallExpr->endPosition());
+            }
+
+            resultType = vectorType->elementType->deepCopy();
+            break;
+        }
+        case SimdBuiltInCallExpr::BuiltIn::MaskedLoad:
+        case SimdBuiltInCallExpr::BuiltIn::MaskedStore: {
+            // `simd_masked_load(ptr, mask, passthru)` and `simd_masked_store(value, ptr, mask)`
+            bool isLoad = builtIn == SimdBuiltInCallExpr::BuiltIn::MaskedLoad;
+            std::size_t pointerIndex = isLoad ? 0 : 1;
+            SimdType* maskType = getSimdBuiltInArgumentType(simdBuiltInCallExpr, isLoad ? 1 : 2);
+            SimdType* vectorType = getSimdBuiltInArgumentType(simdBuiltInCallExpr, isLoad ? 2 : 0);
+            Type* pointerType = arguments[pointerIndex]->valueType;
+
+            if (!llvm::isa<PointerType>(pointerType) ||
+                    !typeCompareUtil.compareAreSame(llvm::dyn_cast<PointerType>(pointerType)->nestedType,
+                                                    vectorType->elementType)) {
+                printError("`" + builtInName + "` pointer must be of type `*" +
+                           vectorType->elementType->toString() + "`!",
+                           arguments[pointerIndex]->startPosition(), arguments[pointerIndex]->endPosition());
+            }
+
+            if (!isLoad && llvm::dyn_cast<PointerType>(pointerType)->nestedType->qualifier() == Type::Qualifier::Immut) {
+                printError("`simd_masked_store` cannot store through a pointer to immutable memory!",
+                           arguments[pointerIndex]->startPosition(), arguments[pointerIndex]->endPosition());
+            }
+
+            if (!llvm::isa<BoolType>(maskType->elementType) || maskType->length() != vectorType->length()) {
+                printError("`" + builtInName + "` mask must be of type `simd<bool, " +
+                           std::to_string(vectorType->length()) + ">`!",
+                           simdBuiltInCallExpr->startPosition(), simdBuiltInCallExpr->endPosition());
+            }
+
+            if (isLoad) {
+                resultType = vectorType->deepCopy();
+            } else {
+                resultType = BuiltInType::get(Type::Qualifier::Immut, "void", {}, {});
+            }
+            break;
+        }
+    }
+
+    simdBuiltInCallExpr->valueType = resultType;
+    simdBuiltInCallExpr->valueType->setQualifier(Type::Qualifier::Immut);
+    simdBuiltInCallExpr->valueType->setIsLValue(false);
+}
+
+gulc::SimdType* gulc::CodeProcessor::getSimdBuiltInArgumentType(gulc::SimdBuiltInCallExpr const* simdBuiltInCallExpr,
+                                                               std::size_t argumentIndex) const {
+    Expr* argument = simdBuiltInCallExpr->arguments[argumentIndex];
+
+    if (!llvm::isa<SimdType>(argument->valueType)) {
+        printError("`" + SimdBuiltInCallExpr::getBuiltInName(simdBuiltInCallExpr->builtIn()) + "` expected a `simd` "
+                   "vector, found `" + argument->valueType->toString() + "`!",
+                   argument->startPosition(), argument->endPosition());
+    }
+
+    return llvm::dyn_cast<SimdType>(argument->valueType);
+}
+
+void gulc::CodeProcessor::checkSimdBuiltInIndex(gulc::Expr const* index) const {
+    if (!llvm::isa<BuiltInType>(index->valueType) || llvm::dyn_cast<BuiltInType>(index->valueType)->isFloating()) {
+        printError("vector element index must be an integer, found `" + index->valueType->toString() + "`!",
+                   index->startPosition(), index->endPosition());
+    }
+}
+
 void gulc::CodeProcessor::processSubscriptCallExpr(gulc::Expr*& expr) {
     auto subscriptCallExpr = llvm::dyn_cast<SubscriptCallExpr>(expr);
 
@@ -5218,6 +5959,12 @@ void gulc::CodeProcessor::processSubscriptCallExpr(gulc::Expr*& expr) {
             searchType = llvm::dyn_cast<ReferenceType>(searchType)->nestedType;
         }
 
+        // Flat arrays use the built in subscript, there is no operator to search for
+        if (llvm::isa<FlatArrayType>(searchType)) {
+            processFlatArraySubscriptCallExpr(expr);
+            return;
+        }
+
         bool isAmbiguous = false;
         SubscriptOperatorDecl* foundSubscriptOperator = nullptr;
 
@@ -5277,6 +6024,78 @@ void gulc::CodeProcessor::processSubscriptCallExpr(gulc::Expr*& expr) {
     }
 }
 
+void gulc::CodeProcessor::processFlatArraySubscriptCallExpr(gulc::Expr*& expr) {
+    auto subscriptCallExpr = llvm::dyn_cast<SubscriptCallExpr>(expr);
+
+    if (subscriptCallExpr->arguments.size() != 1 || subscriptCallExpr->arguments[0]->label().name() != "_") {
+        printError("flat arrays can only be indexed with a single unlabeled integer!",
+                   subscriptCallExpr->startPosition(), subscriptCallExpr->endPosition());
+    }
+
+    Expr* arrayRef = handleGetter(subscriptCallExpr->subscriptReference);
+
+    // The same as member access, we need either an lvalue or a `ref` to the array to index into it.
+    if (llvm::isa<ReferenceType>(arrayRef->valueType)) {
+        arrayRef = convertLValueToRValue(arrayRef);
+    } else if (!arrayRef->valueType->isLValue()) {
+        printError("only flat array variables can be indexed!",
+                   subscriptCallExpr->startPosition(), subscriptCallExpr->endPosition());
+    }
+
+    Type* arrayType = arrayRef->valueType;
+
+    if (llvm::isa<ReferenceType>(arrayType)) {
+        arrayType = llvm::dyn_cast<ReferenceType>(arrayType)->nestedType;
+    }
+
+    auto flatArrayType = llvm::dyn_cast<FlatArrayType>(arrayType);
+
+    Expr* index = subscriptCallExpr->arguments[0]->argument;
+    index = handleGetter(index);
+    index = convertLValueToRValue(index);
+    index = dereferenceReference(index);
+
+    if (!llvm::isa<BuiltInType>(index->valueType) || llvm::dyn_cast<BuiltInType>(index->valueType)->isFloating()) {
+        printError("flat array index must be an integer, found `" + index->valueType->toString() + "`!",
+                   index->startPosition(), index->endPosition());
+    }
+
+    auto newFlatArrayIndexExpr = new FlatArrayIndexExpr(
+            subscriptCallExpr->startPosition(),
+            subscriptCallExpr->endPosition(),
+            arrayRef,
+            index
+    );
+    // The element is as mutable as the array that contains it
+    newFlatArrayIndexExpr->valueType = flatArrayType->indexType->deepCopy();
+    newFlatArrayIndexExpr->valueType->setQualifier(flatArrayType->qualifier());
+    newFlatArrayIndexExpr->valueType->setIsLValue(true);
+
+    if (llvm::isa<StructType>(flatArrayType->indexType) &&
+            llvm::dyn_cast<StructType>(flatArrayType->indexType)->decl()->hasAttr(Attr::Kind::Soa)) {
+        // Removed once the element is accessed through one of its members, see `checkSoaElementsAccessed`
+        _unaccessedSoaElements.insert(newFlatArrayIndexExpr);
+    }
+
+    // We steal the array reference and the index
+    subscriptCallExpr->subscriptReference = nullptr;
+    subscriptCallExpr->arguments[0]->argument = nullptr;
+    delete subscriptCallExpr;
+    expr = newFlatArrayIndexExpr;
+}
+
+void gulc::CodeProcessor::checkSoaElementsAccessed() {
+    if (_unaccessedSoaElements.empty()) {
+        return;
+    }
+
+    // The members of an `@soa` element are spread across the columns of the array, there is no element in memory to
+    // reference, copy, or call a member function on.
+    Expr const* soaElement = *_unaccessedSoaElements.begin();
+    printError("elements of an `@soa` array can only be accessed through their members (i.e. `array[i].member`)!",
+               soaElement->startPosition(), soaElement->endPosition());
+}
+
 gulc::SubscriptOperatorDecl* gulc::CodeProcessor::findMatchingSubscriptOperator(std::vector<Decl*>& searchDecls,
                                                                                 std::vector<LabeledArgumentExpr*>& arguments,
                                                                                 bool findStatic, bool* outIsAmbiguous) {
@@ -5328,7 +6147,14 @@ gulc::SubscriptOperatorDecl* gulc::CodeProcessor::findMatchingSubscriptOperator(
 }
 
 void gulc::CodeProcessor::processSubscriptOperatorRefExpr(gulc::SubscriptOperatorRefExpr* subscriptOperatorRefExpr) {
-    // NOTE: See `processMemberSubscriptOperatorRefExpr` for notes on why this is empty.
+    // NOTE: See `processPropertyRefExpr`
+    for (SubscriptOperatorGetDecl* getter : subscriptOperatorRefExpr->subscriptOperatorDecl->getters()) {
+        requireFunctionBody(getter);
+    }
+
+    if (subscriptOperatorRefExpr->subscriptOperatorDecl->hasSetter()) {
+        requireFunctionBody(subscriptOperatorRefExpr->subscriptOperatorDecl->setter());
+    }
 }
 
 void gulc::CodeProcessor::processTemplateConstRefExpr(gulc::TemplateConstRefExpr* templateConstRefExpr) {
@@ -5491,7 +6317,10 @@ void gulc::CodeProcessor::handleArgumentCasting(std::vector<ParameterDecl*> cons
 }
 
 bool gulc::CodeProcessor::handleArgumentCasting(gulc::ParameterDecl* parameter, gulc::Expr*& argument) {
-    if (llvm::isa<ReferenceType>(parameter->type)) {
+    if (llvm::isa<TraitType>(parameter->type) && !llvm::isa<TraitType>(argument->valueType)) {
+        argument = convertToTraitObject(argument, llvm::dyn_cast<TraitType>(parameter->type));
+        return true;
+    } else if (llvm::isa<ReferenceType>(parameter->type)) {
         if (argument->valueType->isLValue()) {
             // If the argument is an lvalue to a reference then we convert the lvalue to an rvalue, keeping the
             // implicit reference.
@@ -5579,6 +6408,47 @@ bool gulc::CodeProcessor::handleArgumentCasting(gulc::ParameterDecl* parameter,
     return false;
 }
 
+gulc::Expr* gulc::CodeProcessor::convertToTraitObject(gulc::Expr* argument, gulc::TraitType* traitType) {
+    // A trait object borrows the struct it is created from so the struct MUST already have an address
+    StructType* structType = nullptr;
+
+    if (llvm::isa<ReferenceType>(argument->valueType)) {
+        argument = convertLValueToRValue(argument);
+        structType = llvm::dyn_cast<StructType>(llvm::dyn_cast<ReferenceType>(argument->valueType)->nestedType);
+    } else if (argument->valueType->isLValue()) {
+        structType = llvm::dyn_cast<StructType>(argument->valueType);
+    } else {
+        printError("trait object `" + traitType->toString() + "` can only be created from a variable or a reference, "
+                   "store the value in a variable first!",
+                   argument->startPosition(), argument->endPosition());
+    }
+
+    if (structType == nullptr) {
+        printError("type `" + argument->valueType->toString() + "` cannot be converted to trait object `" +
+                   traitType->toString() + "`!",
+                   argument->startPosition(), argument->endPosition());
+    }
+
+    std::vector<FunctionDecl*> const* witnessTable =
+            WitnessTableUtil::getWitnessTable(structType->decl(), traitType->decl());
+
+    if (witnessTable == nullptr) {
+        printError("type `" + structType->toString() + "` does not implement every function of trait `" +
+                   traitType->toString() + "`, it cannot be converted to a trait object!",
+                   argument->startPosition(), argument->endPosition());
+    }
+
+    // The witness table references every implementation so they all must be generated
+    for (FunctionDecl* witnessFunction : *witnessTable) {
+        requireFunctionBody(witnessFunction);
+    }
+
+    auto result = new ImplicitCastExpr(argument, traitType->deepCopy());
+    result->valueType = traitType->deepCopy();
+    result->valueType->setIsLValue(false);
+    return result;
+}
+
 gulc::Expr* gulc::CodeProcessor::dereferenceReference(gulc::Expr* potentialReference) const {
     // All lvalues must be converted to rvalues before dereferencing
     if (potentialReference->valueType->isLValue()) {
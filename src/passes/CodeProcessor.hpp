@@ -19,6 +19,8 @@
 #define GULC_CODEPROCESSOR_HPP
 
 #include <vector>
+#include <queue>
+#include <set>
 #include <Target.hpp>
 #include <string>
 #include <parsing/ASTFile.hpp>
@@ -47,6 +49,7 @@
 #include <ast/stmts/LabeledStmt.hpp>
 #include <ast/stmts/ReturnStmt.hpp>
 #include <ast/stmts/SwitchStmt.hpp>
+#include <ast/stmts/ThrowStmt.hpp>
 #include <ast/stmts/DoCatchStmt.hpp>
 #include <ast/stmts/WhileStmt.hpp>
 #include <ast/exprs/ArrayLiteralExpr.hpp>
@@ -79,10 +82,15 @@
 #include <ast/exprs/TryExpr.hpp>
 #include <ast/exprs/BoolLiteralExpr.hpp>
 #include <ast/exprs/RefExpr.hpp>
+#include <ast/exprs/NewExpr.hpp>
+#include <ast/exprs/DeleteExpr.hpp>
 #include <ast/exprs/SubscriptOperatorRefExpr.hpp>
 #include <ast/exprs/MemberSubscriptOperatorRefExpr.hpp>
 #include <utilities/SignatureComparer.hpp>
 #include <ast/decls/TraitPrototypeDecl.hpp>
+#include <ast/types/SimdType.hpp>
+#include <ast/types/TraitType.hpp>
+#include <ast/exprs/SimdBuiltInCallExpr.hpp>
 
 namespace gulc {
     /**
@@ -102,8 +110,8 @@ namespace gulc {
     public:
         CodeProcessor(gulc::Target const& target, std::vector<std::string> const& filePaths,
                       std::vector<NamespaceDecl*>& namespacePrototypes)
-                : _target(target), _filePaths(filePaths), _namespacePrototypes(namespacePrototypes), _currentFile(),
-                  _currentContainer(nullptr), _currentParameters(nullptr) {}
+                : _target(target), _filePaths(filePaths), _namespacePrototypes(namespacePrototypes), _files(nullptr),
+                  _currentFile(), _currentContainer(nullptr), _currentParameters(nullptr) {}
 
         void processFiles(std::vector<ASTFile>& files);
 
@@ -164,6 +172,7 @@ namespace gulc {
         gulc::Target const& _target;
         std::vector<std::string> const& _filePaths;
         std::vector<NamespaceDecl*>& _namespacePrototypes;
+        std::vector<ASTFile>* _files;
         ASTFile* _currentFile;
         // The current container decl (NOTE: This is one of `NamespaceDecl`, `StructDecl`, etc. this is NOT the
         // current `Decl` being processed such as `FunctionDecl` etc.)
@@ -176,6 +185,13 @@ namespace gulc {
         std::vector<VariableDeclExpr*> _localVariables;
         // List of resolved and unresolved labels (if the boolean is true then it is resolved, else it isn't found)
         std::map<std::string, bool> _labelNames;
+        // Template instantiation member functions that have been referenced but don't have their body processed yet.
+        // These are processed once the current files are finished, see `requireFunctionBody`
+        std::set<FunctionDecl*> _pendingFunctionBodiesSet;
+        std::queue<FunctionDecl*> _pendingFunctionBodies;
+        // Indexed elements of `@soa` arrays that haven't been accessed through a member yet. There is no single element
+        // in memory for an `@soa` array so anything left here once the statement is processed is an error.
+        std::set<Expr const*> _unaccessedSoaElements;
 
         void printError(std::string const& message, TextPosition startPosition, TextPosition endPosition) const;
         void printWarning(std::string const& message, TextPosition startPosition, TextPosition endPosition) const;
@@ -189,6 +205,8 @@ namespace gulc {
         void processEnumDecl(EnumDecl* enumDecl);
         void processExtensionDecl(ExtensionDecl* extensionDecl);
         void processFunctionDecl(FunctionDecl* functionDecl);
+        void processFunctionContracts(FunctionDecl* functionDecl);
+        void checkErrorType(Type const* errorType);
         void processNamespaceDecl(NamespaceDecl* namespaceDecl);
         void processParameterDecl(ParameterDecl* parameterDecl);
         void processPropertyDecl(PropertyDecl* propertyDecl);
@@ -205,6 +223,12 @@ namespace gulc {
         void processTraitPrototypeDecl(TraitPrototypeDecl* traitPrototypeDecl);
         void processVariableDecl(VariableDecl* variableDecl);
 
+        /// Mark the body of `functionDecl` as needed, if it is a lazily instantiated template member it is queued
+        void requireFunctionBody(FunctionDecl* functionDecl);
+        /// Require every function body that is implicitly used once an instance of `structDecl` exists
+        void requireStructSpecialMembers(StructDecl* structDecl);
+        void processPendingFunctionBodies();
+
         void processBaseConstructorCall(StructDecl* structDecl, FunctionCallExpr*& functionCallExpr);
         ConstructorCallExpr* createBaseMoveCopyConstructorCall(ConstructorDecl* baseConstructorDecl,
                                                                ParameterDecl* otherParameterDecl,
@@ -231,6 +255,7 @@ namespace gulc {
         void processRepeatWhileStmt(RepeatWhileStmt* repeatWhileStmt);
         void processReturnStmt(ReturnStmt* returnStmt);
         void processSwitchStmt(SwitchStmt* switchStmt);
+        void processThrowStmt(ThrowStmt* throwStmt);
         void processWhileStmt(WhileStmt* whileStmt);
 
         void labelResolved(std::string const& labelName);
@@ -245,6 +270,7 @@ namespace gulc {
         void processCheckExtendsTypeExpr(CheckExtendsTypeExpr* checkExtendsTypeExpr);
         void processConstructorCallExpr(ConstructorCallExpr* constructorCallExpr);
         void processConstructorReferenceExpr(ConstructorReferenceExpr* constructorReferenceExpr);
+        void processDeleteExpr(DeleteExpr* deleteExpr);
         void processEnumConstRefExpr(EnumConstRefExpr* enumConstRefExpr);
         void processFunctionCallExpr(FunctionCallExpr*& functionCallExpr);
         void fillListOfMatchingTemplatesInContainer(Decl* container, std::string const& findName,
@@ -296,6 +322,8 @@ namespace gulc {
         bool findMatchingDecl(std::vector<Decl*> const& searchDecls, std::string const& findName,
                               Decl** outFoundDecl, bool* outIsAmbiguous);
         void processInfixOperatorExpr(InfixOperatorExpr*& infixOperatorExpr);
+        void processSimdInfixOperatorExpr(InfixOperatorExpr* infixOperatorExpr);
+        Expr* splatScalarToSimd(Expr* scalar, SimdType* simdType);
         bool fillListOfMatchingInfixOperators(std::vector<Decl*>& decls, InfixOperators findOperator, Type* argType,
                                               std::vector<MatchingDecl>& matchingDecls);
         void processIsExpr(IsExpr* isExpr);
@@ -308,12 +336,19 @@ namespace gulc {
         void processMemberPropertyRefExpr(MemberPropertyRefExpr* memberPropertyRefExpr);
         void processMemberSubscriptOperatorRefExpr(MemberSubscriptOperatorRefExpr* memberSubscriptOperatorRefExpr);
         void processMemberVariableRefExpr(MemberVariableRefExpr* memberVariableRefExpr);
+        void processNewExpr(NewExpr* newExpr);
         void processParenExpr(ParenExpr* parenExpr);
         void processPostfixOperatorExpr(PostfixOperatorExpr*& postfixOperatorExpr);
         void processPrefixOperatorExpr(PrefixOperatorExpr*& prefixOperatorExpr);
         void processPropertyRefExpr(PropertyRefExpr* propertyRefExpr);
         void processRefExpr(RefExpr* refExpr);
+        void processSimdBuiltInCallExpr(Expr*& expr);
+        SimdType* getSimdBuiltInArgumentType(SimdBuiltInCallExpr const* simdBuiltInCallExpr,
+                                             std::size_t argumentIndex) const;
+        void checkSimdBuiltInIndex(Expr const* index) const;
         void processSubscriptCallExpr(Expr*& expr);
+        void processFlatArraySubscriptCallExpr(Expr*& expr);
+        void checkSoaElementsAccessed();
         SubscriptOperatorDecl* findMatchingSubscriptOperator(std::vector<Decl*>& searchDecls,
                                                              std::vector<LabeledArgumentExpr*>& arguments,
                                                              bool findStatic, bool* outIsAmbiguous);
@@ -333,6 +368,8 @@ namespace gulc {
                                    std::vector<LabeledArgumentExpr*>& arguments);
         // Returns true if the argument potentially had a type change
         bool handleArgumentCasting(ParameterDecl* parameter, Expr*& argument);
+        // Wrap a struct lvalue or reference in the conversion to a trait object, requiring the struct's witness table
+        Expr* convertToTraitObject(Expr* argument, TraitType* traitType);
         // If the expression is a reference we dereference it.
         Expr* dereferenceReference(Expr* potentialReference) const;
 
@@ -25,7 +25,16 @@
 #include <ast/exprs/TemporaryValueRefExpr.hpp>
 #include <ast/exprs/StoreTemporaryValueExpr.hpp>
 #include <ast/exprs/MemberInfixOperatorCallExpr.hpp>
+#include <utilities/ConstInterpreter.hpp>
 #include <utilities/ConstSolver.hpp>
+#include <utilities/TypeCompareUtil.hpp>
+#include <ast/exprs/FunctionReferenceExpr.hpp>
+#include <ast/exprs/VTableFunctionReferenceExpr.hpp>
+#include <ast/exprs/WitnessFunctionReferenceExpr.hpp>
+#include <ast/exprs/ConstructorReferenceExpr.hpp>
+#include <ast/exprs/BoolLiteralExpr.hpp>
+#include <ast/exprs/SolvedConstExpr.hpp>
+#include <ast/exprs/ValueLiteralExpr.hpp>
 
 void gulc::CodeTransformer::processFiles(std::vector<ASTFile>& files) {
     for (ASTFile& file : files) {
@@ -40,8 +49,8 @@ void gulc::CodeTransformer::processFiles(std::vector<ASTFile>& files) {
 void gulc::CodeTransformer::printError(std::string const& message, gulc::TextPosition startPosition,
                                        gulc::TextPosition endPosition) const {
     std::cerr << "gulc error[" << _filePaths[_currentFile->sourceFileID] << ", "
-                            "{" << startPosition.line << ", " << startPosition.column << " "
-                            "to " << endPosition.line << ", " << endPosition.column << "}]: "
+                            "{" << startPosition.line() << ", " << startPosition.column() << " "
+                            "to " << endPosition.line() << ", " << endPosition.column() << "}]: "
               << message << std::endl;
     std::exit(1);
 }
@@ -49,8 +58,8 @@ void gulc::CodeTransformer::printError(std::string const& message, gulc::TextPos
 void gulc::CodeTransformer::printWarning(std::string const& message, gulc::TextPosition startPosition,
                                          gulc::TextPosition endPosition) const {
     std::cout << "gulc warning[" << _filePaths[_currentFile->sourceFileID] << ", "
-                              "{" << startPosition.line << ", " << startPosition.column << " "
-                              "to " << endPosition.line << ", " << endPosition.column << "}]: "
+                              "{" << startPosition.line() << ", " << startPosition.column() << " "
+                              "to " << endPosition.line() << ", " << endPosition.column() << "}]: "
               << message << std::endl;
 }
 
@@ -132,6 +141,11 @@ void gulc::CodeTransformer::processExtensionDecl(gulc::ExtensionDecl* extensionD
 }
 
 void gulc::CodeTransformer::processFunctionDecl(gulc::FunctionDecl* functionDecl) {
+    // Template instantiation members that were never referenced are never instantiated, there is nothing to transform
+    if (!functionDecl->bodyIsInstantiated) {
+        return;
+    }
+
     FunctionDecl* oldFunction = _currentFunction;
     _currentFunction = functionDecl;
     std::vector<ParameterDecl*>* oldParameters = _currentParameters;
@@ -145,6 +159,14 @@ void gulc::CodeTransformer::processFunctionDecl(gulc::FunctionDecl* functionDecl
 
     // Prototypes don't have bodies
     if (!functionDecl->isPrototype()) {
+        _localVariableReturnCleanups.clear();
+        _functionReturnCleanupIndex = createFunctionReturnCleanups(functionDecl);
+        _functionLocalVariables.clear();
+        _namedReturnValueCandidate = nullptr;
+        _namedReturnValueIsValid = true;
+        _errorHandlers.clear();
+        _currentTryExpr = nullptr;
+
         bool returnsOnAllCodePaths = processCompoundStmtHandleTempValues(functionDecl->body());
 
         if (!returnsOnAllCodePaths) {
@@ -166,6 +188,8 @@ void gulc::CodeTransformer::processFunctionDecl(gulc::FunctionDecl* functionDecl
                            functionDecl->startPosition(), functionDecl->endPosition());
             }
         }
+
+        applyNamedReturnValue(functionDecl);
     }
 
     _currentParameters = oldParameters;
@@ -259,6 +283,28 @@ void gulc::CodeTransformer::processTraitDecl(gulc::TraitDecl* traitDecl) {
 
 void gulc::CodeTransformer::processVariableDecl(gulc::VariableDecl* variableDecl) {
     if (variableDecl->hasInitialValue()) {
+        // Literals are already as solved as they can get
+        if (llvm::isa<ValueLiteralExpr>(variableDecl->initialValue) ||
+                llvm::isa<BoolLiteralExpr>(variableDecl->initialValue)) {
+            return;
+        }
+
+        ConstInterpreter constInterpreter;
+        Expr* solution = constInterpreter.solve(variableDecl->initialValue);
+
+        if (solution != nullptr) {
+            auto solvedConstExpr = new SolvedConstExpr(variableDecl->initialValue, solution);
+            solvedConstExpr->valueType = solution->valueType->deepCopy();
+            variableDecl->initialValue = solvedConstExpr;
+            return;
+        }
+
+        if (variableDecl->isConstExpr()) {
+            printError("`const` variable `" + variableDecl->identifier().name() + "` could not be solved at "
+                       "compile time: " + constInterpreter.errorMessage(),
+                       constInterpreter.errorStartPosition(), constInterpreter.errorEndPosition());
+        }
+
         processExpr(variableDecl->initialValue);
     }
 }
@@ -310,6 +356,9 @@ bool gulc::CodeTransformer::processStmt(gulc::Stmt*& stmt) {
         case Stmt::Kind::Switch:
             returnsOnAllCodePaths = processSwitchStmt(llvm::dyn_cast<SwitchStmt>(stmt));
             break;
+        case Stmt::Kind::Throw:
+            returnsOnAllCodePaths = processThrowStmt(llvm::dyn_cast<ThrowStmt>(stmt));
+            break;
         case Stmt::Kind::While:
             returnsOnAllCodePaths = processWhileStmt(llvm::dyn_cast<WhileStmt>(stmt));
             break;
@@ -398,6 +447,12 @@ bool gulc::CodeTransformer::processCaseStmtHandleTempValues(gulc::CaseStmt* case
 }
 
 bool gulc::CodeTransformer::processCatchStmt(gulc::CatchStmt* catchStmt) {
+    if (catchStmt->exceptionVariable != nullptr) {
+        // The caught error is never destructed so it doesn't need to be in `_localVariables`, we still need it in the
+        // function's list so the named return value can't share its name
+        _functionLocalVariables.push_back(catchStmt->exceptionVariable);
+    }
+
     return processCompoundStmtHandleTempValues(catchStmt->body());
 }
 
@@ -463,10 +518,15 @@ bool gulc::CodeTransformer::processDoCatchStmt(gulc::DoCatchStmt* doCatchStmt) {
     //       `finally` ALWAYS runs?
     bool returnsOnAllCodePaths = true;
 
+    // Errors thrown within the body go to our `catch`, errors thrown within the `catch` go to the `do` around us
+    _errorHandlers.emplace_back(doCatchStmt, _localVariables.size(), _temporaryValues.size());
+
     if (!processCompoundStmtHandleTempValues(doCatchStmt->body())) {
         returnsOnAllCodePaths = false;
     }
 
+    _errorHandlers.pop_back();
+
     for (CatchStmt* catchStmt : doCatchStmt->catchStatements()) {
         if (!processCatchStmt(catchStmt)) {
             returnsOnAllCodePaths = false;
@@ -643,29 +703,104 @@ bool gulc::CodeTransformer::processReturnStmt(gulc::ReturnStmt* returnStmt) {
         processExpr(returnStmt->returnValue);
     }
 
-    // Add the destructor calls to the pre return expression list
-    for (VariableDeclExpr* localVariable : gulc::reverse(_localVariables)) {
-        auto destructLocalVariableExpr = destructLocalVariable(localVariable);
+    checkNamedReturnValue(returnStmt);
+
+    // Instead of copying the destructor calls for every live value into every `return` we branch into the shared
+    // cleanup chain, starting with the innermost live local variable
+    returnStmt->cleanupIndex = getReturnCleanupIndex();
+
+    return true;
+}
+
+bool gulc::CodeTransformer::processSwitchStmt(gulc::SwitchStmt* switchStmt) {
+    // NOTE: If there is a single case in the switch then we start with the idea that it COULD return on all code paths
+    //       We then loop to check if it does. If a single case doesn't return then we revert to `false`
+    //       Obviously if there are no cases then the switch doesn't return.
+    bool returnsOnAllCodePaths = !switchStmt->cases.empty();
+
+    processExpr(switchStmt->condition);
+
+    for (CaseStmt* caseStmt : switchStmt->cases) {
+        if (!processCaseStmtHandleTempValues(caseStmt)) {
+            returnsOnAllCodePaths = false;
+        }
+    }
+
+    return returnsOnAllCodePaths;
+}
+
+bool gulc::CodeTransformer::processThrowStmt(gulc::ThrowStmt* throwStmt) {
+    Type const* thrownType = nullptr;
+
+    if (throwStmt->hasThrownValue()) {
+        processExpr(throwStmt->thrownValue);
+        thrownType = throwStmt->thrownValue->valueType;
+    }
+
+    // Like `return` we branch into a shared cleanup chain, it either ends at a `catch` or the function exit. The
+    // temporary values of the statements we are within are part of the chain.
+    throwStmt->errorDestination = getErrorDestination(thrownType, throwStmt->startPosition(),
+                                                      throwStmt->endPosition());
+
+    // `throw` never falls through to the code after it. Within a `do` the `catch` decides if the `do` as a whole
+    // returns on all code paths.
+    return true;
+}
+
+bool gulc::CodeTransformer::processWhileStmt(gulc::WhileStmt* whileStmt) {
+    Stmt* oldLoop = _currentLoop;
+    _currentLoop = whileStmt;
+
+    whileStmt->currentNumLocalVariables = _localVariables.size();
+    processExpr(whileStmt->condition);
+    processCompoundStmtHandleTempValues(whileStmt->body());
+
+    _currentLoop = oldLoop;
+
+    // TODO: Is this true? My logic is that the `condition` could be false therefore we don't know if it returns on all
+    //       code paths.
+    return false;
+}
+
+void gulc::CodeTransformer::destructLocalVariablesDeclaredAfterLoop(gulc::Stmt* loop, std::vector<Expr*>& addToList) {
+    unsigned int numLocalVariables = 0;
+
+    if (llvm::isa<ForStmt>(loop)) {
+        numLocalVariables = llvm::dyn_cast<ForStmt>(loop)->currentNumLocalVariables;
+    } else if (llvm::isa<RepeatWhileStmt>(loop)) {
+        numLocalVariables = llvm::dyn_cast<RepeatWhileStmt>(loop)->currentNumLocalVariables;
+    } else if (llvm::isa<WhileStmt>(loop)) {
+        numLocalVariables = llvm::dyn_cast<WhileStmt>(loop)->currentNumLocalVariables;
+    }
+
+    // If we've created new local variables then we have to destruct them
+    for (std::int64_t i = static_cast<int64_t>(_localVariables.size()) - 1;
+            i >= static_cast<int64_t>(numLocalVariables); --i) {
+        // Add the destructor call to the end of the compound statement...
+        auto destructLocalVariableExpr = destructLocalVariable(_localVariables[i]);
 
         if (destructLocalVariableExpr != nullptr) {
-            returnStmt->preReturnDeferred.push_back(destructLocalVariableExpr);
+            addToList.push_back(destructLocalVariableExpr);
         }
     }
+}
+
+std::int64_t gulc::CodeTransformer::createFunctionReturnCleanups(gulc::FunctionDecl* functionDecl) {
+    // These are in the order they have to be run in
+    std::vector<Expr*> cleanupExprs;
 
     // We only destruct parameters on return statements
-    if (_currentParameters != nullptr) {
-        for (std::int64_t i = static_cast<int64_t>(_currentParameters->size()) - 1; i >= 0; --i) {
-            auto destructParameterExpr = destructParameter(i, (*_currentParameters)[i]);
+    for (std::int64_t i = static_cast<int64_t>(functionDecl->parameters().size()) - 1; i >= 0; --i) {
+        auto destructParameterExpr = destructParameter(i, functionDecl->parameters()[i]);
 
-            if (destructParameterExpr != nullptr) {
-                returnStmt->preReturnDeferred.push_back(destructParameterExpr);
-            }
+        if (destructParameterExpr != nullptr) {
+            cleanupExprs.push_back(destructParameterExpr);
         }
     }
 
     // If the current function is a destructor we have to clean up the members automatically
-    if (llvm::isa<DestructorDecl>(_currentFunction)) {
-        auto currentStruct = llvm::dyn_cast<StructDecl>(_currentFunction->container);
+    if (llvm::isa<DestructorDecl>(functionDecl)) {
+        auto currentStruct = llvm::dyn_cast<StructDecl>(functionDecl->container);
 
         // TODO: We also need to support properties...
         for (Decl* checkDecl : gulc::reverse(currentStruct->ownedMembers())) {
@@ -714,69 +849,262 @@ bool gulc::CodeTransformer::processReturnStmt(gulc::ReturnStmt* returnStmt) {
 //            currentFileAst->addImportExtern(foundDestructor);
 //        }
 
-                    returnStmt->preReturnDeferred.push_back(
+                    cleanupExprs.push_back(
                             new DestructorCallExpr(destructorReferenceExpr, memberVariableRefExpr, {}, {}));
                 }
             }
         }
     }
 
-    return true;
+    // The chain is built back to front so each cleanup knows which cleanup comes after it
+    std::int64_t nextCleanupIndex = -1;
+
+    for (Expr* cleanupExpr : gulc::reverse(cleanupExprs)) {
+        functionDecl->returnCleanups.emplace_back(cleanupExpr, nextCleanupIndex);
+        nextCleanupIndex = static_cast<std::int64_t>(functionDecl->returnCleanups.size()) - 1;
+    }
+
+    return nextCleanupIndex;
 }
 
-bool gulc::CodeTransformer::processSwitchStmt(gulc::SwitchStmt* switchStmt) {
-    // NOTE: If there is a single case in the switch then we start with the idea that it COULD return on all code paths
-    //       We then loop to check if it does. If a single case doesn't return then we revert to `false`
-    //       Obviously if there are no cases then the switch doesn't return.
-    bool returnsOnAllCodePaths = !switchStmt->cases.empty();
+std::int64_t gulc::CodeTransformer::getReturnCleanupIndex() {
+    return getCleanupIndex(_currentFunction->returnCleanups, _localVariableReturnCleanups, 0,
+                           _functionReturnCleanupIndex);
+}
 
-    processExpr(switchStmt->condition);
+std::int64_t gulc::CodeTransformer::getCleanupIndex(std::vector<ReturnCleanup>& cleanups,
+                                                    std::map<VariableDeclExpr const*, std::int64_t>& localVariableCleanups,
+                                                    std::size_t firstLocalVariable, std::int64_t lastCleanupIndex) {
+    // Find the local variables that don't have a cleanup yet. Since a local variable can only ever see the variables
+    // declared before it, the first variable we find that already has a cleanup is where the rest of the chain is.
+    std::int64_t nextCleanupIndex = lastCleanupIndex;
+    std::size_t firstMissingCleanup = _localVariables.size();
 
-    for (CaseStmt* caseStmt : switchStmt->cases) {
-        if (!processCaseStmtHandleTempValues(caseStmt)) {
-            returnsOnAllCodePaths = false;
+    for (std::int64_t i = static_cast<std::int64_t>(_localVariables.size()) - 1;
+            i >= static_cast<std::int64_t>(firstLocalVariable); --i) {
+        auto foundCleanup = localVariableCleanups.find(_localVariables[i]);
+
+        if (foundCleanup != localVariableCleanups.end()) {
+            nextCleanupIndex = foundCleanup->second;
+            break;
         }
+
+        firstMissingCleanup = static_cast<std::size_t>(i);
     }
 
-    return returnsOnAllCodePaths;
+    // Create the missing cleanups from the outermost to the innermost variable. Variables without a destructor point
+    // to the cleanup of the variable before them so we don't have to search for them again.
+    for (std::size_t i = firstMissingCleanup; i < _localVariables.size(); ++i) {
+        auto destructLocalVariableExpr = destructLocalVariable(_localVariables[i]);
+
+        if (destructLocalVariableExpr != nullptr) {
+            cleanups.emplace_back(destructLocalVariableExpr, nextCleanupIndex);
+            nextCleanupIndex = static_cast<std::int64_t>(cleanups.size()) - 1;
+        }
+
+        localVariableCleanups[_localVariables[i]] = nextCleanupIndex;
+    }
+
+    return nextCleanupIndex;
 }
 
-bool gulc::CodeTransformer::processWhileStmt(gulc::WhileStmt* whileStmt) {
-    Stmt* oldLoop = _currentLoop;
-    _currentLoop = whileStmt;
+std::int64_t gulc::CodeTransformer::addTemporaryValueCleanups(std::vector<ReturnCleanup>& cleanups,
+                                                              std::size_t firstTemporaryValueList,
+                                                              std::int64_t nextCleanupIndex) {
+    // Temporary values are only ever used by the statement that creates them so unlike local variables they can't
+    // share their cleanups. Only the temporary values created so far are in the lists, anything after the throwing
+    // call hasn't been constructed yet. They are destructed in the reverse order they were created.
+    for (std::size_t i = firstTemporaryValueList; i < _temporaryValues.size(); ++i) {
+        for (VariableDeclExpr* temporaryValue : _temporaryValues[i]) {
+            auto destructTemporaryValueExpr = destructTemporaryValue(temporaryValue);
 
-    whileStmt->currentNumLocalVariables = _localVariables.size();
-    processExpr(whileStmt->condition);
-    processCompoundStmtHandleTempValues(whileStmt->body());
+            if (destructTemporaryValueExpr != nullptr) {
+                cleanups.emplace_back(destructTemporaryValueExpr, nextCleanupIndex);
+                nextCleanupIndex = static_cast<std::int64_t>(cleanups.size()) - 1;
+            }
+        }
+    }
 
-    _currentLoop = oldLoop;
+    return nextCleanupIndex;
+}
 
-    // TODO: Is this true? My logic is that the `condition` could be false therefore we don't know if it returns on all
-    //       code paths.
-    return false;
+void gulc::CodeTransformer::checkThrowingCall(gulc::Expr const* functionReference, gulc::TextPosition startPosition,
+                                              gulc::TextPosition endPosition) {
+    switch (functionReference->getExprKind()) {
+        case Expr::Kind::ConstructorReference:
+            checkThrowingCall(llvm::dyn_cast<ConstructorReferenceExpr>(functionReference)->constructor,
+                              startPosition, endPosition);
+            break;
+        case Expr::Kind::FunctionReference:
+            checkThrowingCall(llvm::dyn_cast<FunctionReferenceExpr>(functionReference)->functionDecl(),
+                              startPosition, endPosition);
+            break;
+        case Expr::Kind::VTableFunctionReference:
+            checkThrowingCall(llvm::dyn_cast<VTableFunctionReferenceExpr>(functionReference)->functionDecl(),
+                              startPosition, endPosition);
+            break;
+        case Expr::Kind::WitnessFunctionReference:
+            checkThrowingCall(llvm::dyn_cast<WitnessFunctionReferenceExpr>(functionReference)->functionDecl(),
+                              startPosition, endPosition);
+            break;
+        default:
+            // Function pointers can't be marked `throws` yet
+            break;
+    }
 }
 
-void gulc::CodeTransformer::destructLocalVariablesDeclaredAfterLoop(gulc::Stmt* loop, std::vector<Expr*>& addToList) {
-    unsigned int numLocalVariables = 0;
+void gulc::CodeTransformer::checkThrowingCall(gulc::FunctionDecl const* calledFunction,
+                                              gulc::TextPosition startPosition, gulc::TextPosition endPosition) {
+    if (calledFunction == nullptr || !calledFunction->throws()) {
+        return;
+    }
 
-    if (llvm::isa<ForStmt>(loop)) {
-        numLocalVariables = llvm::dyn_cast<ForStmt>(loop)->currentNumLocalVariables;
-    } else if (llvm::isa<RepeatWhileStmt>(loop)) {
-        numLocalVariables = llvm::dyn_cast<RepeatWhileStmt>(loop)->currentNumLocalVariables;
-    } else if (llvm::isa<WhileStmt>(loop)) {
-        numLocalVariables = llvm::dyn_cast<WhileStmt>(loop)->currentNumLocalVariables;
+    if (_currentTryExpr == nullptr) {
+        printError("call to `" + calledFunction->identifier().name() + "` can throw an error and must be marked "
+                   "with `try`!",
+                   startPosition, endPosition);
     }
 
-    // If we've created new local variables then we have to destruct them
-    for (std::int64_t i = static_cast<int64_t>(_localVariables.size()) - 1;
-            i >= static_cast<int64_t>(numLocalVariables); --i) {
-        // Add the destructor call to the end of the compound statement...
-        auto destructLocalVariableExpr = destructLocalVariable(_localVariables[i]);
+    // NOTE: This has to be called after the arguments are processed and before the temporary value for the result is
+    //       created, the temporary values created so far are exactly the ones that are alive when the call is made.
+    _currentTryExpr->callErrorDestinations.push_back(
+            getErrorDestination(calledFunction->throwsType(), startPosition, endPosition));
+}
 
-        if (destructLocalVariableExpr != nullptr) {
-            addToList.push_back(destructLocalVariableExpr);
+gulc::ErrorDestination gulc::CodeTransformer::getErrorDestination(gulc::Type const* errorType,
+                                                                 gulc::TextPosition startPosition,
+                                                                 gulc::TextPosition endPosition) {
+    ErrorDestination result;
+
+    // Every error has a known type so we find the `catch` at compile time. The innermost `do` with a `catch` that
+    // can handle the type wins, within a `do` the `catch` statements are checked in order.
+    for (auto errorHandler = _errorHandlers.rbegin(); errorHandler != _errorHandlers.rend(); ++errorHandler) {
+        for (CatchStmt* catchStmt : errorHandler->doCatchStmt->catchStatements()) {
+            if (catchStmt->hasExceptionType() && !errorTypesAreSame(catchStmt->exceptionType, errorType)) {
+                continue;
+            }
+
+            result.errorCatch = catchStmt;
+            result.errorTypeIndex = catchStmt->caughtErrorTypes.size();
+
+            for (std::size_t i = 0; i < catchStmt->caughtErrorTypes.size(); ++i) {
+                if (errorTypesAreSame(catchStmt->caughtErrorTypes[i], errorType)) {
+                    result.errorTypeIndex = i;
+                    break;
+                }
+            }
+
+            if (result.errorTypeIndex == catchStmt->caughtErrorTypes.size()) {
+                catchStmt->caughtErrorTypes.push_back(errorType == nullptr ? nullptr : errorType->deepCopy());
+            }
+
+            // Only the local variables and temporary values created within the `do` are destructed, the chain ends
+            // at the `catch`
+            std::int64_t localVariableCleanupIndex =
+                    getCleanupIndex(catchStmt->errorCleanups, errorHandler->localVariableCleanups[catchStmt],
+                                    errorHandler->firstLocalVariable, -1);
+            result.cleanupIndex = addTemporaryValueCleanups(catchStmt->errorCleanups,
+                                                            errorHandler->firstTemporaryValueList,
+                                                            localVariableCleanupIndex);
+
+            return result;
+        }
+    }
+
+    // Errors that aren't caught within the function are passed on to our caller through the same cleanups `return`
+    // uses, so the error has to be the type our own `throws` names
+    if (!_currentFunction->throws()) {
+        printError("errors thrown here are never caught, they must be within a `do` with a matching `catch` or the "
+                   "function must be marked `throws`!",
+                   startPosition, endPosition);
+    }
+
+    if (!errorTypesAreSame(_currentFunction->throwsType(), errorType)) {
+        printError("error type `" + (errorType == nullptr ? std::string("[untyped]") : errorType->toString()) +
+                   "` does not match the `throws` of function `" + _currentFunction->identifier().name() + "`!",
+                   startPosition, endPosition);
+    }
+
+    result.cleanupIndex = addTemporaryValueCleanups(_currentFunction->returnCleanups, 0, getReturnCleanupIndex());
+
+    return result;
+}
+
+bool gulc::CodeTransformer::errorTypesAreSame(gulc::Type const* left, gulc::Type const* right) {
+    if (left == nullptr || right == nullptr) {
+        return left == right;
+    }
+
+    TypeCompareUtil typeCompareUtil;
+    return typeCompareUtil.compareAreSame(left, right);
+}
+
+void gulc::CodeTransformer::checkNamedReturnValue(gulc::ReturnStmt* returnStmt) {
+    if (!_namedReturnValueIsValid) {
+        return;
+    }
+
+    VariableDeclExpr* returnedLocalVariable = nullptr;
+
+    // Returned values are always `LValueToRValue` by this point, we only care about a plain local variable
+    if (returnStmt->returnValue != nullptr && llvm::isa<LValueToRValueExpr>(returnStmt->returnValue)) {
+        auto returnedLValue = llvm::dyn_cast<LValueToRValueExpr>(returnStmt->returnValue)->lvalue;
+
+        if (llvm::isa<LocalVariableRefExpr>(returnedLValue)) {
+            auto localVariableRef = llvm::dyn_cast<LocalVariableRefExpr>(returnedLValue);
+
+            for (VariableDeclExpr* localVariable : gulc::reverse(_localVariables)) {
+                if (localVariable->identifier().name() == localVariableRef->variableName()) {
+                    returnedLocalVariable = localVariable;
+                    break;
+                }
+            }
         }
     }
+
+    if (returnedLocalVariable == nullptr ||
+            (_namedReturnValueCandidate != nullptr && _namedReturnValueCandidate != returnedLocalVariable)) {
+        _namedReturnValueIsValid = false;
+        return;
+    }
+
+    _namedReturnValueCandidate = returnedLocalVariable;
+}
+
+void gulc::CodeTransformer::applyNamedReturnValue(gulc::FunctionDecl* functionDecl) {
+    // NOTE: Errors passed on to our caller share the return cleanup chain, they still have to destruct the variable
+    if (functionDecl->throws() || !_namedReturnValueIsValid || _namedReturnValueCandidate == nullptr ||
+            !llvm::isa<StructType>(functionDecl->returnType) ||
+            !llvm::isa<StructType>(_namedReturnValueCandidate->type)) {
+        return;
+    }
+
+    // The variable can only share the return slot if it is exactly the return type, anything else needs a conversion
+    if (llvm::dyn_cast<StructType>(functionDecl->returnType)->decl() !=
+            llvm::dyn_cast<StructType>(_namedReturnValueCandidate->type)->decl()) {
+        return;
+    }
+
+    // `CodeGen` finds the return slot by the variable's name so the name has to be unique within the function
+    for (VariableDeclExpr* localVariable : _functionLocalVariables) {
+        if (localVariable != _namedReturnValueCandidate &&
+                localVariable->identifier().name() == _namedReturnValueCandidate->identifier().name()) {
+            return;
+        }
+    }
+
+    // Every `return` that can see the variable returns it, the caller now owns it so the cleanup chain has to skip
+    // its destructor.
+    auto foundCleanup = _localVariableReturnCleanups.find(_namedReturnValueCandidate);
+
+    if (foundCleanup != _localVariableReturnCleanups.end() && foundCleanup->second >= 0) {
+        ReturnCleanup& returnCleanup = functionDecl->returnCleanups[foundCleanup->second];
+
+        delete returnCleanup.destructExpr;
+        returnCleanup.destructExpr = nullptr;
+    }
+
+    functionDecl->namedReturnValue = _namedReturnValueCandidate;
 }
 
 gulc::DestructorCallExpr* gulc::CodeTransformer::destructLocalVariable(gulc::VariableDeclExpr* localVariable) {
@@ -813,6 +1141,34 @@ gulc::DestructorCallExpr* gulc::CodeTransformer::destructLocalVariable(gulc::Var
     }
 }
 
+gulc::DestructorCallExpr* gulc::CodeTransformer::destructTemporaryValue(gulc::VariableDeclExpr* temporaryValue) {
+    if (llvm::isa<StructType>(temporaryValue->type)) {
+        auto structType = llvm::dyn_cast<StructType>(temporaryValue->type);
+        auto foundDestructor = structType->decl()->destructor;
+
+        if (foundDestructor == nullptr) {
+            printError("[INTERNAL] struct `" + structType->decl()->identifier().name() + "` is missing a destructor!",
+                       temporaryValue->startPosition(), temporaryValue->endPosition());
+        }
+
+        auto destructorReferenceExpr = new DestructorReferenceExpr(
+                foundDestructor->startPosition(),
+                foundDestructor->endPosition(),
+                foundDestructor
+            );
+        auto temporaryValueRefExpr = new TemporaryValueRefExpr(
+                {}, {},
+                temporaryValue->identifier().name()
+            );
+        temporaryValueRefExpr->valueType = temporaryValue->type->deepCopy();
+        temporaryValueRefExpr->valueType->setIsLValue(true);
+
+        return new DestructorCallExpr(destructorReferenceExpr, temporaryValueRefExpr, {}, {});
+    } else {
+        return nullptr;
+    }
+}
+
 gulc::DestructorCallExpr* gulc::CodeTransformer::destructParameter(std::size_t paramIndex,
                                                                    gulc::ParameterDecl* parameterDecl) {
     // We only have to destruct `value` parameters. `in` and `out` are reference parameters.
@@ -879,10 +1235,16 @@ void gulc::CodeTransformer::processExpr(gulc::Expr*& expr) {
         case Expr::Kind::CurrentSelf:
             // Current self cannot have any temporary values and doesn't need destructed, nothing to do
             break;
+        case Expr::Kind::Delete:
+            processDeleteExpr(llvm::dyn_cast<DeleteExpr>(expr));
+            break;
         case Expr::Kind::EnumConstRef:
             // Enum const ref only references a decl
             // TODO: Do we need to handle temporary values? I think we only need that if we copy...
             break;
+        case Expr::Kind::FlatArrayIndex:
+            processFlatArrayIndexExpr(llvm::dyn_cast<FlatArrayIndexExpr>(expr));
+            break;
         case Expr::Kind::FunctionCall:
             processFunctionCallExpr(expr);
             break;
@@ -916,7 +1278,7 @@ void gulc::CodeTransformer::processExpr(gulc::Expr*& expr) {
             // Local variable ref doesn't hold any temporaries or do anything that needs processed here.
             break;
         case Expr::Kind::LValueToRValue:
-            processLValueToRValueExpr(llvm::dyn_cast<LValueToRValueExpr>(expr));
+            processLValueToRValueExpr(expr);
             break;
         case Expr::Kind::MemberAccessCall:
             printError("[INTERNAL] `MemberAccessCallExpr` found in `CodeTransformer::processExpr`, "
@@ -940,6 +1302,10 @@ void gulc::CodeTransformer::processExpr(gulc::Expr*& expr) {
             break;
         case Expr::Kind::MemberVariableRef:
             processMemberVariableRefExpr(llvm::dyn_cast<MemberVariableRefExpr>(expr));
+            break;
+        case Expr::Kind::New:
+            processNewExpr(llvm::dyn_cast<NewExpr>(expr));
+            break;
         case Expr::Kind::ParameterRef:
             // Parameter ref just holds the index to a parameter, it doesn't do anything that needs processed here.
             // If we `copy` a parameter it will be contained in another `Expr` that will be processed. The index itself
@@ -969,6 +1335,9 @@ void gulc::CodeTransformer::processExpr(gulc::Expr*& expr) {
         case Expr::Kind::RValueToInRef:
             processRValueToInRefExpr(llvm::dyn_cast<RValueToInRefExpr>(expr));
             break;
+        case Expr::Kind::SimdBuiltInCall:
+            processSimdBuiltInCallExpr(llvm::dyn_cast<SimdBuiltInCallExpr>(expr));
+            break;
         case Expr::Kind::SubscriptCall:
             // TODO: Remove this?? I think? We'll see when we try to add flat array and pointer support.
             printError("[INTERNAL] `SubscriptCallExpr` found in `CodeTransformer::processExpr`, "
@@ -1002,6 +1371,7 @@ void gulc::CodeTransformer::processExpr(gulc::Expr*& expr) {
             // Variable references don't need processed as they don't create temporary values
             break;
         case Expr::Kind::VTableFunctionReference:
+        case Expr::Kind::WitnessFunctionReference:
             break;
 
         default:
@@ -1027,9 +1397,18 @@ void gulc::CodeTransformer::processAssignmentOperatorExpr(gulc::AssignmentOperat
 }
 
 void gulc::CodeTransformer::processConstructorCallExpr(gulc::ConstructorCallExpr* constructorCallExpr) {
+    for (LabeledArgumentExpr* labeledArgumentExpr : constructorCallExpr->arguments) {
+        processExpr(labeledArgumentExpr->argument);
+    }
+
+    checkThrowingCall(constructorCallExpr->functionReference,
+                      constructorCallExpr->startPosition(), constructorCallExpr->endPosition());
+
     // If no `objectRef` is provided then we create a temporary value and use that as the object reference to be
     // constructed. In the future we should replace
     // `uninitializedVar = TypeInit()` with `TypeInit::init(self: ref mut uninitializedVar)`
+    // NOTE: The temporary value is created after the arguments, it isn't constructed if an argument or the
+    //       constructor itself throws.
     if (constructorCallExpr->objectRef == nullptr) {
         constructorCallExpr->objectRef = createTemporaryValue(
                 constructorCallExpr->valueType,
@@ -1037,10 +1416,15 @@ void gulc::CodeTransformer::processConstructorCallExpr(gulc::ConstructorCallExpr
                 constructorCallExpr->endPosition()
             );
     }
+}
 
-    for (LabeledArgumentExpr* labeledArgumentExpr : constructorCallExpr->arguments) {
-        processExpr(labeledArgumentExpr->argument);
-    }
+void gulc::CodeTransformer::processDeleteExpr(gulc::DeleteExpr* deleteExpr) {
+    processExpr(deleteExpr->pointer);
+}
+
+void gulc::CodeTransformer::processFlatArrayIndexExpr(gulc::FlatArrayIndexExpr* flatArrayIndexExpr) {
+    processExpr(flatArrayIndexExpr->array);
+    processExpr(flatArrayIndexExpr->index);
 }
 
 void gulc::CodeTransformer::processFunctionCallExpr(gulc::Expr*& expr) {
@@ -1052,6 +1436,9 @@ void gulc::CodeTransformer::processFunctionCallExpr(gulc::Expr*& expr) {
         processExpr(labeledArgumentExpr->argument);
     }
 
+    checkThrowingCall(functionCallExpr->functionReference,
+                      functionCallExpr->startPosition(), functionCallExpr->endPosition());
+
     // If the function doesn't return void then we have to store the value as a temporary value. The reason we do this
     // is to make the result able to be passed into a destructor when needed.
     if (!(llvm::isa<BuiltInType>(functionCallExpr->valueType) &&
@@ -1073,6 +1460,42 @@ void gulc::CodeTransformer::processFunctionCallExpr(gulc::Expr*& expr) {
     }
 }
 
+gulc::Expr* gulc::CodeTransformer::solveConstFunctionCall(gulc::FunctionCallExpr const* functionCallExpr) {
+    if (!llvm::isa<FunctionReferenceExpr>(functionCallExpr->functionReference)) {
+        return nullptr;
+    }
+
+    FunctionDecl const* functionDecl =
+            llvm::dyn_cast<FunctionReferenceExpr>(functionCallExpr->functionReference)->functionDecl();
+
+    if (!functionDecl->isConstExpr()) {
+        return nullptr;
+    }
+
+    ConstInterpreter constInterpreter;
+    Expr* solution = constInterpreter.solve(functionCallExpr);
+
+    if (solution == nullptr) {
+        // If the arguments are only known at runtime then there is nothing wrong, the call just has to be made at
+        // runtime. Otherwise the `const` function can't be run at compile time, which the user should know about.
+        if (!constInterpreter.dependsOnRuntimeValue()) {
+            printWarning("call to `const` function `" + functionDecl->identifier().name() + "` could not be solved "
+                         "at compile time: " + constInterpreter.errorMessage(),
+                         constInterpreter.errorStartPosition(), constInterpreter.errorEndPosition());
+        }
+
+        return nullptr;
+    }
+
+    // TODO: `CodeGen` can only output array literals as global constants so array results are left as runtime calls
+    if (llvm::isa<ArrayLiteralExpr>(solution)) {
+        delete solution;
+        return nullptr;
+    }
+
+    return solution;
+}
+
 void gulc::CodeTransformer::processHasExpr(gulc::Expr*& expr) {
     // We replace the `expr` with the `const` solution. That way we're not constantly resolving it.
     expr = ConstSolver::solveHasExpr(llvm::dyn_cast<HasExpr>(expr));
@@ -1099,7 +1522,21 @@ void gulc::CodeTransformer::processLabeledArgumentExpr(gulc::LabeledArgumentExpr
     processExpr(labeledArgumentExpr->argument);
 }
 
-void gulc::CodeTransformer::processLValueToRValueExpr(gulc::LValueToRValueExpr* lValueToRValueExpr) {
+void gulc::CodeTransformer::processLValueToRValueExpr(gulc::Expr*& expr) {
+    auto lValueToRValueExpr = llvm::dyn_cast<LValueToRValueExpr>(expr);
+
+    // Function results are `lvalue`s so calls to `const` functions are solved here, replacing the entire load
+    if (llvm::isa<FunctionCallExpr>(lValueToRValueExpr->lvalue)) {
+        Expr* solution = solveConstFunctionCall(llvm::dyn_cast<FunctionCallExpr>(lValueToRValueExpr->lvalue));
+
+        if (solution != nullptr) {
+            auto solvedConstExpr = new SolvedConstExpr(lValueToRValueExpr, solution);
+            solvedConstExpr->valueType = solution->valueType->deepCopy();
+            expr = solvedConstExpr;
+            return;
+        }
+    }
+
     processExpr(lValueToRValueExpr->lvalue);
 }
 
@@ -1113,6 +1550,9 @@ void gulc::CodeTransformer::processMemberFunctionCallExpr(gulc::Expr*& expr) {
         processExpr(labeledArgumentExpr->argument);
     }
 
+    checkThrowingCall(memberFunctionCallExpr->functionReference,
+                      memberFunctionCallExpr->startPosition(), memberFunctionCallExpr->endPosition());
+
     // If the function doesn't return void then we have to store the value as a temporary value. The reason we do this
     // is to make the result able to be passed into a destructor when needed.
     if (!(llvm::isa<BuiltInType>(memberFunctionCallExpr->valueType) &&
@@ -1139,6 +1579,8 @@ void gulc::CodeTransformer::processMemberInfixOperatorCallExpr(gulc::Expr*& expr
 
     processExpr(memberInfixOperatorCallExpr->leftValue);
     processExpr(memberInfixOperatorCallExpr->rightValue);
+    checkThrowingCall(memberInfixOperatorCallExpr->infixOperatorDecl,
+                      memberInfixOperatorCallExpr->startPosition(), memberInfixOperatorCallExpr->endPosition());
 
     // If the function doesn't return void then we have to store the value as a temporary value. The reason we do this
     // is to make the result able to be passed into a destructor when needed.
@@ -1165,6 +1607,8 @@ void gulc::CodeTransformer::processMemberPostfixOperatorCallExpr(Expr*& expr) {
     auto memberPostfixOperatorCallExpr = llvm::dyn_cast<MemberPostfixOperatorCallExpr>(expr);
 
     processExpr(memberPostfixOperatorCallExpr->nestedExpr);
+    checkThrowingCall(memberPostfixOperatorCallExpr->postfixOperatorDecl,
+                      memberPostfixOperatorCallExpr->startPosition(), memberPostfixOperatorCallExpr->endPosition());
 
     // If the function doesn't return void then we have to store the value as a temporary value. The reason we do this
     // is to make the result able to be passed into a destructor when needed.
@@ -1191,6 +1635,8 @@ void gulc::CodeTransformer::processMemberPrefixOperatorCallExpr(Expr*& expr) {
     auto memberPrefixOperatorCallExpr = llvm::dyn_cast<MemberPrefixOperatorCallExpr>(expr);
 
     processExpr(memberPrefixOperatorCallExpr->nestedExpr);
+    checkThrowingCall(memberPrefixOperatorCallExpr->prefixOperatorDecl,
+                      memberPrefixOperatorCallExpr->startPosition(), memberPrefixOperatorCallExpr->endPosition());
 
     // If the function doesn't return void then we have to store the value as a temporary value. The reason we do this
     // is to make the result able to be passed into a destructor when needed.
@@ -1227,6 +1673,16 @@ void gulc::CodeTransformer::processMemberVariableRefExpr(gulc::MemberVariableRef
     processExpr(memberVariableRefExpr->object);
 }
 
+void gulc::CodeTransformer::processNewExpr(gulc::NewExpr* newExpr) {
+    auto constructorCallExpr = llvm::dyn_cast<ConstructorCallExpr>(newExpr->initializer);
+
+    // Unlike `processConstructorCallExpr` no temporary value is created, `CodeGen` passes the memory `@new` allocated
+    // as `self` instead
+    for (LabeledArgumentExpr* labeledArgumentExpr : constructorCallExpr->arguments) {
+        processExpr(labeledArgumentExpr->argument);
+    }
+}
+
 void gulc::CodeTransformer::processParenExpr(gulc::ParenExpr* parenExpr) {
     processExpr(parenExpr->nestedExpr);
 }
@@ -1255,6 +1711,9 @@ void gulc::CodeTransformer::processPropertyGetCallExpr(gulc::Expr*& expr) {
             return;
     }
 
+    checkThrowingCall(propertyGetCallExpr->propertyGetter,
+                      propertyGetCallExpr->startPosition(), propertyGetCallExpr->endPosition());
+
     // We need to be able to call the destructor on the result of `prop::get`, to support that we store it in a
     // temporary value. This also gives us the added benefit of making the result an `lvalue` which is another thing we
     // want.
@@ -1289,6 +1748,8 @@ void gulc::CodeTransformer::processPropertySetCallExpr(gulc::PropertySetCallExpr
     }
 
     processExpr(propertySetCallExpr->value);
+    checkThrowingCall(propertySetCallExpr->propertySetter,
+                      propertySetCallExpr->startPosition(), propertySetCallExpr->endPosition());
 }
 
 void gulc::CodeTransformer::processRefExpr(gulc::RefExpr* refExpr) {
@@ -1299,6 +1760,12 @@ void gulc::CodeTransformer::processRValueToInRefExpr(gulc::RValueToInRefExpr* rv
     processExpr(rvalueToInRefExpr->rvalue);
 }
 
+void gulc::CodeTransformer::processSimdBuiltInCallExpr(gulc::SimdBuiltInCallExpr* simdBuiltInCallExpr) {
+    for (Expr*& argument : simdBuiltInCallExpr->arguments) {
+        processExpr(argument);
+    }
+}
+
 void gulc::CodeTransformer::processSubscriptOperatorGetCallExpr(gulc::Expr*& expr) {
     auto subscriptOperatorGetCallExpr = llvm::dyn_cast<SubscriptOperatorGetCallExpr>(expr);
 
@@ -1319,6 +1786,9 @@ void gulc::CodeTransformer::processSubscriptOperatorGetCallExpr(gulc::Expr*& exp
             return;
     }
 
+    checkThrowingCall(subscriptOperatorGetCallExpr->subscriptOperatorGetter,
+                      subscriptOperatorGetCallExpr->startPosition(), subscriptOperatorGetCallExpr->endPosition());
+
     // We need to be able to call the destructor on the result of `subscript::get`, to support that we store it in a
     // temporary value. This also gives us the added benefit of making the result an `lvalue` which is another thing we
     // want.
@@ -1364,6 +1834,8 @@ void gulc::CodeTransformer::processSubscriptOperatorSetCallExpr(
     }
 
     processExpr(subscriptOperatorSetCallExpr->value);
+    checkThrowingCall(subscriptOperatorSetCallExpr->subscriptOperatorSetter,
+                      subscriptOperatorSetCallExpr->startPosition(), subscriptOperatorSetCallExpr->endPosition());
 }
 
 void gulc::CodeTransformer::processTernaryExpr(gulc::TernaryExpr* ternaryExpr) {
@@ -1373,16 +1845,68 @@ void gulc::CodeTransformer::processTernaryExpr(gulc::TernaryExpr* ternaryExpr) {
 }
 
 void gulc::CodeTransformer::processTryExpr(gulc::TryExpr* tryExpr) {
+    TryExpr* oldTryExpr = _currentTryExpr;
+    _currentTryExpr = tryExpr;
+
+    // Each call to a throwing function within `nestedExpr` adds its own error destination, see `checkThrowingCall`
+    // NOTE: `let x = try ...` adds `x` to the local variables after the initial value so `x` is never destructed
+    //       when the initial value throws.
     processExpr(tryExpr->nestedExpr);
+
+    _currentTryExpr = oldTryExpr;
 }
 
 void gulc::CodeTransformer::processVariableDeclExpr(gulc::VariableDeclExpr* variableDeclExpr) {
     if (variableDeclExpr->initialValue != nullptr) {
         processExpr(variableDeclExpr->initialValue);
+
+        if (variableDeclExpr->initialValueAssignmentType == InitialValueAssignmentType::Copy ||
+                variableDeclExpr->initialValueAssignmentType == InitialValueAssignmentType::Move) {
+            elideInitialValueCopy(variableDeclExpr);
+        }
     }
 
     // The local variable list has already been validated so we just add to the list.
     _localVariables.push_back(variableDeclExpr);
+    _functionLocalVariables.push_back(variableDeclExpr);
+}
+
+void gulc::CodeTransformer::elideInitialValueCopy(gulc::VariableDeclExpr* variableDeclExpr) {
+    TemporaryValueRefExpr* temporaryValueRef = nullptr;
+
+    // `let x = Type()` and `let x = makeType()` both create a temporary only to copy it into `x` and destruct it.
+    // Instead we construct straight into `x` and never create the temporary.
+    switch (variableDeclExpr->initialValue->getExprKind()) {
+        case Expr::Kind::ConstructorCall: {
+            auto constructorCallExpr = llvm::dyn_cast<ConstructorCallExpr>(variableDeclExpr->initialValue);
+
+            if (llvm::isa<TemporaryValueRefExpr>(constructorCallExpr->objectRef)) {
+                temporaryValueRef = llvm::dyn_cast<TemporaryValueRefExpr>(constructorCallExpr->objectRef);
+            }
+
+            break;
+        }
+        case Expr::Kind::StoreTemporaryValue:
+            temporaryValueRef = llvm::dyn_cast<StoreTemporaryValueExpr>(variableDeclExpr->initialValue)->temporaryValue;
+            break;
+        default:
+            return;
+    }
+
+    if (temporaryValueRef == nullptr || !llvm::isa<StructType>(variableDeclExpr->type) ||
+            !llvm::isa<StructType>(temporaryValueRef->valueType)) {
+        return;
+    }
+
+    // If the temporary is a different struct (e.g. a derived struct) we still need the copy to convert it
+    if (llvm::dyn_cast<StructType>(variableDeclExpr->type)->decl() !=
+            llvm::dyn_cast<StructType>(temporaryValueRef->valueType)->decl()) {
+        return;
+    }
+
+    if (removeTemporaryValue(temporaryValueRef->temporaryName())) {
+        variableDeclExpr->initialValueAssignmentType = InitialValueAssignmentType::Elided;
+    }
 }
 
 gulc::TemporaryValueRefExpr* gulc::CodeTransformer::createTemporaryValue(gulc::Type* type,
@@ -1417,3 +1941,24 @@ gulc::TemporaryValueRefExpr* gulc::CodeTransformer::createTemporaryValue(gulc::T
 
     return tempValueLocalVarRef;
 }
+
+bool gulc::CodeTransformer::removeTemporaryValue(std::string const& temporaryName) {
+    if (_temporaryValues.empty()) {
+        return false;
+    }
+
+    std::vector<VariableDeclExpr*>& currentTemporaryValues = *(_temporaryValues.end() - 1);
+
+    for (auto checkTemporaryValue = currentTemporaryValues.begin();
+            checkTemporaryValue != currentTemporaryValues.end(); ++checkTemporaryValue) {
+        if ((*checkTemporaryValue)->identifier().name() == temporaryName) {
+            // The type is shared with the expression the temporary was created for so we don't free it here
+            (*checkTemporaryValue)->type = nullptr;
+            delete *checkTemporaryValue;
+            currentTemporaryValues.erase(checkTemporaryValue);
+            return true;
+        }
+    }
+
+    return false;
+}
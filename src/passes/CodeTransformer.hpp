@@ -45,6 +45,7 @@
 #include <ast/stmts/LabeledStmt.hpp>
 #include <ast/stmts/ReturnStmt.hpp>
 #include <ast/stmts/SwitchStmt.hpp>
+#include <ast/stmts/ThrowStmt.hpp>
 #include <ast/stmts/WhileStmt.hpp>
 #include <ast/exprs/ArrayLiteralExpr.hpp>
 #include <ast/exprs/AsExpr.hpp>
@@ -64,6 +65,8 @@
 #include <ast/exprs/IsExpr.hpp>
 #include <ast/exprs/LocalVariableRefExpr.hpp>
 #include <ast/exprs/DestructorCallExpr.hpp>
+#include <ast/exprs/NewExpr.hpp>
+#include <ast/exprs/DeleteExpr.hpp>
 #include <ast/stmts/BreakStmt.hpp>
 #include <ast/stmts/ContinueStmt.hpp>
 #include <ast/stmts/GotoStmt.hpp>
@@ -77,6 +80,9 @@
 #include <ast/exprs/SubscriptOperatorSetCallExpr.hpp>
 #include <ast/exprs/RValueToInRefExpr.hpp>
 #include <ast/exprs/HasExpr.hpp>
+#include <ast/exprs/FlatArrayIndexExpr.hpp>
+#include <ast/exprs/SimdBuiltInCallExpr.hpp>
+#include <map>
 
 namespace gulc {
     /**
@@ -107,11 +113,44 @@ namespace gulc {
         FunctionDecl* _currentFunction;
         std::vector<ParameterDecl*>* _currentParameters;
         std::vector<VariableDeclExpr*> _localVariables;
+        // The index into `_currentFunction->returnCleanups` of the cleanup for each local variable that has been used by a
+        // `return`. Cleanups are only created once a `return` needs them.
+        std::map<VariableDeclExpr const*, std::int64_t> _localVariableReturnCleanups;
+        // The first cleanup for parameters and members (for `deinit`), this is where every local cleanup chain ends
+        std::int64_t _functionReturnCleanupIndex = -1;
+        // Every local variable declared in the current function, used to make sure the named return value is unique
+        std::vector<VariableDeclExpr*> _functionLocalVariables;
+        // The local variable returned by every `return` so far. Once a `return` returns anything else the function can
+        // no longer construct the local directly in the return slot
+        VariableDeclExpr* _namedReturnValueCandidate = nullptr;
+        bool _namedReturnValueIsValid = true;
         // List of temporary values that will need cleaned up later.
         std::vector<std::vector<VariableDeclExpr*>> _temporaryValues;
         // This is a number kept just to keep temporary value variable names unique
         int _temporaryValueVarNumber = 0;
         Stmt* _currentLoop;
+        // The innermost `try` being processed, calls to throwing functions are only allowed within a `try`
+        TryExpr* _currentTryExpr = nullptr;
+
+        struct ErrorHandler {
+            DoCatchStmt* doCatchStmt;
+            // Local variables before this index were declared outside of the `do`, they are still alive in the `catch`
+            std::size_t firstLocalVariable;
+            // Same as `firstLocalVariable` but for the lists in `_temporaryValues`
+            std::size_t firstTemporaryValueList;
+            // The index into `CatchStmt::errorCleanups` of the cleanup for each local variable declared within the
+            // `do`, for each `catch`. Works the same as `_localVariableReturnCleanups`
+            std::map<CatchStmt const*, std::map<VariableDeclExpr const*, std::int64_t>> localVariableCleanups;
+
+            ErrorHandler(DoCatchStmt* doCatchStmt, std::size_t firstLocalVariable, std::size_t firstTemporaryValueList)
+                    : doCatchStmt(doCatchStmt), firstLocalVariable(firstLocalVariable),
+                      firstTemporaryValueList(firstTemporaryValueList) {}
+
+        };
+
+        // The `do` bodies we are currently within, errors go to the innermost one with a `catch` for the error type.
+        // If none of them can catch the error then it is passed on to the caller through `returnCleanups`
+        std::vector<ErrorHandler> _errorHandlers;
         /*
          * NOTES:
          * For every `goto` add it to a list of `validateGotoVariables` with the number of variables that have been
@@ -178,10 +217,27 @@ namespace gulc {
         bool processRepeatWhileStmt(RepeatWhileStmt* repeatWhileStmt);
         bool processReturnStmt(ReturnStmt* returnStmt);
         bool processSwitchStmt(SwitchStmt* switchStmt);
+        bool processThrowStmt(ThrowStmt* throwStmt);
         bool processWhileStmt(WhileStmt* whileStmt);
 
         void destructLocalVariablesDeclaredAfterLoop(Stmt* loop, std::vector<Expr*>& addToList);
+        std::int64_t createFunctionReturnCleanups(FunctionDecl* functionDecl);
+        std::int64_t getReturnCleanupIndex();
+        std::int64_t getCleanupIndex(std::vector<ReturnCleanup>& cleanups,
+                                     std::map<VariableDeclExpr const*, std::int64_t>& localVariableCleanups,
+                                     std::size_t firstLocalVariable, std::int64_t lastCleanupIndex);
+        std::int64_t addTemporaryValueCleanups(std::vector<ReturnCleanup>& cleanups, std::size_t firstTemporaryValueList,
+                                               std::int64_t nextCleanupIndex);
+        void checkThrowingCall(Expr const* functionReference, TextPosition startPosition, TextPosition endPosition);
+        void checkThrowingCall(FunctionDecl const* calledFunction, TextPosition startPosition,
+                               TextPosition endPosition);
+        ErrorDestination getErrorDestination(Type const* errorType, TextPosition startPosition,
+                                             TextPosition endPosition);
+        static bool errorTypesAreSame(Type const* left, Type const* right);
+        void checkNamedReturnValue(ReturnStmt* returnStmt);
+        void applyNamedReturnValue(FunctionDecl* functionDecl);
         DestructorCallExpr* destructLocalVariable(VariableDeclExpr* localVariable);
+        DestructorCallExpr* destructTemporaryValue(VariableDeclExpr* temporaryValue);
         DestructorCallExpr* destructParameter(std::size_t paramIndex, ParameterDecl* parameterDecl);
 
         void processExpr(Expr*& expr);
@@ -189,6 +245,8 @@ namespace gulc {
         void processAsExpr(AsExpr* asExpr);
         void processAssignmentOperatorExpr(AssignmentOperatorExpr* assignmentOperatorExpr);
         void processConstructorCallExpr(ConstructorCallExpr* constructorCallExpr);
+        void processDeleteExpr(DeleteExpr* deleteExpr);
+        void processFlatArrayIndexExpr(FlatArrayIndexExpr* flatArrayIndexExpr);
         void processFunctionCallExpr(Expr*& expr);
         void processImplicitCastExpr(ImplicitCastExpr* implicitCastExpr);
         void processHasExpr(Expr*& expr);
@@ -196,7 +254,7 @@ namespace gulc {
         void processInfixOperatorExpr(InfixOperatorExpr* infixOperatorExpr);
         void processIsExpr(IsExpr* isExpr);
         void processLabeledArgumentExpr(LabeledArgumentExpr* labeledArgumentExpr);
-        void processLValueToRValueExpr(LValueToRValueExpr* lValueToRValueExpr);
+        void processLValueToRValueExpr(Expr*& expr);
         void processMemberFunctionCallExpr(Expr*& expr);
         void processMemberInfixOperatorCallExpr(Expr*& expr);
         void processMemberPostfixOperatorCallExpr(Expr*& expr);
@@ -204,6 +262,7 @@ namespace gulc {
         void processMemberPropertyRefExpr(MemberPropertyRefExpr* memberPropertyRefExpr);
         void processMemberSubscriptOperatorRefExpr(MemberSubscriptOperatorRefExpr* memberSubscriptOperatorRefExpr);
         void processMemberVariableRefExpr(MemberVariableRefExpr* memberVariableRefExpr);
+        void processNewExpr(NewExpr* newExpr);
         void processParenExpr(ParenExpr* parenExpr);
         void processPostfixOperatorExpr(PostfixOperatorExpr* postfixOperatorExpr);
         void processPrefixOperatorExpr(PrefixOperatorExpr* prefixOperatorExpr);
@@ -211,6 +270,7 @@ namespace gulc {
         void processPropertySetCallExpr(PropertySetCallExpr* propertySetCallExpr);
         void processRefExpr(RefExpr* refExpr);
         void processRValueToInRefExpr(RValueToInRefExpr* rvalueToInRefExpr);
+        void processSimdBuiltInCallExpr(SimdBuiltInCallExpr* simdBuiltInCallExpr);
         void processSubscriptOperatorGetCallExpr(Expr*& expr);
         void processSubscriptOperatorRefExpr(SubscriptOperatorRefExpr* subscriptOperatorRefExpr);
         void processSubscriptOperatorSetCallExpr(SubscriptOperatorSetCallExpr* subscriptOperatorSetCallExpr);
@@ -219,6 +279,10 @@ namespace gulc {
         void processVariableDeclExpr(VariableDeclExpr* variableDeclExpr);
 
         TemporaryValueRefExpr* createTemporaryValue(Type* type, TextPosition startPosition, TextPosition endPosition);
+        bool removeTemporaryValue(std::string const& temporaryName);
+        void elideInitialValueCopy(VariableDeclExpr* variableDeclExpr);
+        // Returns the solution to a call to a `const` function or `nullptr` if the call has to be made at runtime
+        Expr* solveConstFunctionCall(FunctionCallExpr const* functionCallExpr);
 
     };
 }
@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <ast/types/ReferenceType.hpp>
+#include <ast/types/StructType.hpp>
+#include <ast/types/TraitType.hpp>
+#include <utilities/WitnessTableUtil.hpp>
+#include "DeadDeclEliminator.hpp"
+
+void gulc::DeadDeclEliminator::processFiles(std::vector<ASTFile>& files) {
+    for (ASTFile& file : files) {
+        for (Decl* decl : file.declarations) {
+            collectDecl(decl);
+        }
+    }
+
+    processPendingDecls();
+
+    for (Decl* candidateDecl : _candidateDecls) {
+        if (_reachableDecls.find(candidateDecl) == _reachableDecls.end()) {
+            candidateDecl->isReachable = false;
+        }
+    }
+}
+
+void gulc::DeadDeclEliminator::collectDecl(gulc::Decl* decl) {
+    switch (decl->getDeclKind()) {
+        case Decl::Kind::CallOperator:
+        case Decl::Kind::Function:
+        case Decl::Kind::Operator:
+        case Decl::Kind::Variable:
+            collectMemberDecl(decl, nullptr);
+            break;
+        case Decl::Kind::Extension: {
+            auto extensionDecl = llvm::dyn_cast<ExtensionDecl>(decl);
+
+            for (ConstructorDecl* constructor : extensionDecl->constructors()) {
+                markReachable(constructor);
+            }
+
+            for (Decl* member : extensionDecl->ownedMembers()) {
+                collectDecl(member);
+            }
+
+            break;
+        }
+        case Decl::Kind::Namespace:
+            for (Decl* nestedDecl : llvm::dyn_cast<NamespaceDecl>(decl)->nestedDecls()) {
+                collectDecl(nestedDecl);
+            }
+            break;
+        case Decl::Kind::Property: {
+            auto propertyDecl = llvm::dyn_cast<PropertyDecl>(decl);
+
+            for (PropertyGetDecl* getter : propertyDecl->getters()) {
+                collectMemberDecl(getter, propertyDecl);
+            }
+
+            if (propertyDecl->hasSetter()) {
+                collectMemberDecl(propertyDecl->setter(), propertyDecl);
+            }
+
+            break;
+        }
+        case Decl::Kind::SubscriptOperator: {
+            auto subscriptOperatorDecl = llvm::dyn_cast<SubscriptOperatorDecl>(decl);
+
+            for (SubscriptOperatorGetDecl* getter : subscriptOperatorDecl->getters()) {
+                collectMemberDecl(getter, subscriptOperatorDecl);
+            }
+
+            if (subscriptOperatorDecl->hasSetter()) {
+                collectMemberDecl(subscriptOperatorDecl->setter(), subscriptOperatorDecl);
+            }
+
+            break;
+        }
+        case Decl::Kind::TemplateStructInst:
+        case Decl::Kind::Struct: {
+            auto structDecl = llvm::dyn_cast<StructDecl>(decl);
+
+            // `CodeGen` references constructors and destructors implicitly (copies, moves, temporaries, etc.) so we
+            // never try to remove them.
+            for (ConstructorDecl* constructor : structDecl->constructors()) {
+                markReachable(constructor);
+            }
+
+            if (structDecl->destructor != nullptr) {
+                markReachable(structDecl->destructor);
+            }
+
+            for (Decl* member : structDecl->ownedMembers()) {
+                // Instance variables are part of the struct layout, they aren't generated separately
+                if (llvm::isa<VariableDecl>(member) && !member->isStatic()) {
+                    continue;
+                }
+
+                collectDecl(member);
+            }
+
+            break;
+        }
+        case Decl::Kind::TemplateStruct:
+            for (TemplateStructInstDecl* templateStructInst :
+                    llvm::dyn_cast<TemplateStructDecl>(decl)->templateInstantiations()) {
+                collectDecl(templateStructInst);
+            }
+            break;
+        default:
+            // Enums, traits, type aliases, imports, template functions (see the class note), etc. never generate
+            // anything that could be removed
+            break;
+    }
+}
+
+void gulc::DeadDeclEliminator::collectMemberDecl(gulc::Decl* decl, gulc::Decl* owner) {
+    if (decl->isAnyVirtual() || (owner != nullptr && owner->isAnyVirtual())) {
+        // The vtable references every virtual function, we can't tell which ones will be called
+        markReachable(decl);
+        return;
+    }
+
+    // Members of template instantiations are only generated when something references them.
+    for (Decl const* checkDecl = decl; checkDecl != nullptr; checkDecl = checkDecl->container) {
+        if (llvm::isa<TemplateStructInstDecl>(checkDecl) || llvm::isa<TemplateFunctionInstDecl>(checkDecl)) {
+            return;
+        }
+    }
+
+    if (isRootDecl(decl, owner)) {
+        markReachable(decl);
+    } else {
+        _candidateDecls.push_back(decl);
+    }
+}
+
+bool gulc::DeadDeclEliminator::isRootDecl(gulc::Decl const* decl, gulc::Decl const* owner) const {
+    if (decl->isExtern() || (owner != nullptr && owner->isExtern())) {
+        return true;
+    }
+
+    if (auto functionDecl = llvm::dyn_cast<FunctionDecl>(decl)) {
+        if (functionDecl->isMainEntry()) {
+            return true;
+        }
+    }
+
+    // Property and subscript accessors are exported if either they or their property/subscript are exported
+    for (Decl const* checkDecl : { decl, owner }) {
+        if (checkDecl == nullptr) {
+            continue;
+        }
+
+        if (checkDecl->visibility() == Decl::Visibility::Public) {
+            return true;
+        }
+
+        if (_keepNonPrivateDecls && checkDecl->visibility() != Decl::Visibility::Private) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void gulc::DeadDeclEliminator::markReachable(gulc::Decl* decl) {
+    if (decl == nullptr || !_reachableDecls.insert(decl).second) {
+        return;
+    }
+
+    _pendingDecls.push_back(decl);
+}
+
+void gulc::DeadDeclEliminator::processPendingDecls() {
+    // NOTE: Walking a decl can add more decls to `_pendingDecls`
+    while (!_pendingDecls.empty()) {
+        Decl* decl = _pendingDecls.back();
+        _pendingDecls.pop_back();
+
+        // Only functions and variables are ever added, walking them only walks their own parameters, contracts, body
+        // and initial value.
+        traverseDecl(decl);
+    }
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::CallOperatorReferenceExpr* callOperatorReferenceExpr) {
+    markReachable(callOperatorReferenceExpr->callOperator);
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::ConstructorReferenceExpr* constructorReferenceExpr) {
+    markReachable(constructorReferenceExpr->constructor);
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::DestructorReferenceExpr* destructorReferenceExpr) {
+    markReachable(destructorReferenceExpr->destructor);
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::FunctionReferenceExpr* functionReferenceExpr) {
+    markReachable(functionReferenceExpr->functionDecl());
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::ImplicitCastExpr* implicitCastExpr) {
+    // Creating a trait object references every function in the struct's witness table
+    if (auto traitType = llvm::dyn_cast<TraitType>(implicitCastExpr->castToType)) {
+        Type* fromType = implicitCastExpr->expr->valueType;
+
+        if (fromType != nullptr && llvm::isa<ReferenceType>(fromType)) {
+            fromType = llvm::dyn_cast<ReferenceType>(fromType)->nestedType;
+        }
+
+        if (fromType != nullptr && llvm::isa<StructType>(fromType)) {
+            std::vector<FunctionDecl*> const* witnessFunctions =
+                    WitnessTableUtil::getWitnessTable(llvm::dyn_cast<StructType>(fromType)->decl(),
+                                                      traitType->decl());
+
+            if (witnessFunctions != nullptr) {
+                for (FunctionDecl* witnessFunction : *witnessFunctions) {
+                    markReachable(witnessFunction);
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::MemberInfixOperatorCallExpr* memberInfixOperatorCallExpr) {
+    markReachable(memberInfixOperatorCallExpr->infixOperatorDecl);
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::MemberPostfixOperatorCallExpr* memberPostfixOperatorCallExpr) {
+    markReachable(memberPostfixOperatorCallExpr->postfixOperatorDecl);
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::MemberPrefixOperatorCallExpr* memberPrefixOperatorCallExpr) {
+    markReachable(memberPrefixOperatorCallExpr->prefixOperatorDecl);
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::PropertyGetCallExpr* propertyGetCallExpr) {
+    markReachable(propertyGetCallExpr->propertyGetter);
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::PropertySetCallExpr* propertySetCallExpr) {
+    markReachable(propertySetCallExpr->propertySetter);
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::SubscriptOperatorGetCallExpr* subscriptOperatorGetCallExpr) {
+    markReachable(subscriptOperatorGetCallExpr->subscriptOperatorGetter);
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::SubscriptOperatorSetCallExpr* subscriptOperatorSetCallExpr) {
+    markReachable(subscriptOperatorSetCallExpr->subscriptOperatorSetter);
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::VariableRefExpr* variableRefExpr) {
+    markReachable(variableRefExpr->variableDecl);
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::VTableFunctionReferenceExpr* vTableFunctionReferenceExpr) {
+    markReachable(vTableFunctionReferenceExpr->functionDecl());
+    return true;
+}
+
+bool gulc::DeadDeclEliminator::visit(gulc::WitnessFunctionReferenceExpr* witnessFunctionReferenceExpr) {
+    markReachable(witnessFunctionReferenceExpr->functionDecl());
+    return true;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_DEADDECLELIMINATOR_HPP
+#define GULC_DEADDECLELIMINATOR_HPP
+
+#include <string>
+#include <vector>
+#include <set>
+#include <parsing/ASTFile.hpp>
+#include <ast/ASTVisitor.hpp>
+
+namespace gulc {
+    /**
+     * DeadDeclEliminator marks every function and global variable that can never be called or referenced as
+     * unreachable so `CodeGen` doesn't generate them.
+     *
+     * The roots are `main`, `extern` decls, `public` decls (and every non-`private` decl when a module interface is
+     * being written, those can be used by whoever imports the interface) and the functions `CodeGen` always needs
+     * (constructors, destructors and anything that can be in a vtable). Everything referenced by the bodies of
+     * reachable functions is reachable. Any remaining `private`, `internal` or unassigned function, property accessor,
+     * subscript accessor or global variable is marked with `isReachable = false`.
+     *
+     * NOTE: Template instantiations don't need to be marked, `CodeGen` already only generates the instantiations that
+     *       are referenced (see `CodeGen::generateLinkOnceDecls`). We still walk the bodies of the instantiations that
+     *       are referenced so the decls they use are kept.
+     */
+    class DeadDeclEliminator : public ASTVisitor<DeadDeclEliminator> {
+    public:
+        DeadDeclEliminator(std::vector<std::string> const& filePaths, bool keepNonPrivateDecls)
+                : _filePaths(filePaths), _keepNonPrivateDecls(keepNonPrivateDecls) {}
+
+        void processFiles(std::vector<ASTFile>& files);
+
+    protected:
+        std::vector<std::string> const& _filePaths;
+        // True when a module interface is being written, anything that isn't `private` can be imported
+        bool _keepNonPrivateDecls;
+        // Decls that are known to be reachable, these are only ever processed once
+        std::set<Decl const*> _reachableDecls;
+        // Reachable decls that haven't had their bodies searched for references yet
+        std::vector<Decl*> _pendingDecls;
+        // Decls that will be marked as unreachable if they are never referenced
+        std::vector<Decl*> _candidateDecls;
+
+        void collectDecl(Decl* decl);
+        void collectMemberDecl(Decl* decl, Decl* owner);
+        bool isRootDecl(Decl const* decl, Decl const* owner) const;
+        void markReachable(Decl* decl);
+
+        void processPendingDecls();
+
+        friend class ASTVisitor<DeadDeclEliminator>;
+        using ASTVisitor<DeadDeclEliminator>::visit;
+
+        // These are the only nodes that reference another decl, everything else is just walked
+        bool visit(CallOperatorReferenceExpr* callOperatorReferenceExpr);
+        bool visit(ConstructorReferenceExpr* constructorReferenceExpr);
+        bool visit(DestructorReferenceExpr* destructorReferenceExpr);
+        bool visit(FunctionReferenceExpr* functionReferenceExpr);
+        bool visit(ImplicitCastExpr* implicitCastExpr);
+        bool visit(MemberInfixOperatorCallExpr* memberInfixOperatorCallExpr);
+        bool visit(MemberPostfixOperatorCallExpr* memberPostfixOperatorCallExpr);
+        bool visit(MemberPrefixOperatorCallExpr* memberPrefixOperatorCallExpr);
+        bool visit(PropertyGetCallExpr* propertyGetCallExpr);
+        bool visit(PropertySetCallExpr* propertySetCallExpr);
+        bool visit(SubscriptOperatorGetCallExpr* subscriptOperatorGetCallExpr);
+        bool visit(SubscriptOperatorSetCallExpr* subscriptOperatorSetCallExpr);
+        bool visit(VariableRefExpr* variableRefExpr);
+        bool visit(VTableFunctionReferenceExpr* vTableFunctionReferenceExpr);
+        bool visit(WitnessFunctionReferenceExpr* witnessFunctionReferenceExpr);
+
+    };
+}
+
+#endif //GULC_DEADDECLELIMINATOR_HPP
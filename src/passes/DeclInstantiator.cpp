@@ -37,6 +37,8 @@
 #include <ast/types/TemplateTraitType.hpp>
 #include <algorithm>
 #include <ast/conts/WhereCont.hpp>
+#include <ast/conts/RequiresCont.hpp>
+#include <ast/conts/EnsuresCont.hpp>
 #include <utilities/TypeCompareUtil.hpp>
 #include <utilities/ContractUtil.hpp>
 #include <ast/types/DependentType.hpp>
@@ -45,6 +47,7 @@
 #include <utilities/InheritUtil.hpp>
 #include <ast/types/ImaginaryType.hpp>
 #include <ast/exprs/ImaginaryRefExpr.hpp>
+#include <ast/attrs/DynAttr.hpp>
 
 void gulc::DeclInstantiator::processFiles(std::vector<ASTFile>& files) {
     _files = &files;
@@ -62,6 +65,9 @@ void gulc::DeclInstantiator::processFiles(std::vector<ASTFile>& files) {
         }
 
         handleDelayedInstantiationDecls();
+
+        // All extended types are resolved now, index them so extension lookups no longer need a linear search
+        file.indexTypeExtensions();
     }
 }
 
@@ -191,7 +197,22 @@ gulc::TemplateFunctionInstDecl* gulc::DeclInstantiator::instantiateTemplateFunct
                                 errorStartPosition, errorEndPosition);
 
     TemplateFunctionInstDecl* templateFunctionInstDecl = nullptr;
-    templateFunctionDecl->getInstantiation(templateArguments, &templateFunctionInstDecl);
+
+    if (isDynTemplateFunction(templateFunctionDecl)) {
+        // `@dyn` templates are only ever instantiated once. Every typename argument is replaced with the trait its
+        // parameter is bound to so all callers share the same instantiation and pass their values as trait objects.
+        std::vector<Expr*> dynTemplateArguments = getDynTemplateArguments(templateFunctionDecl, templateArguments,
+                                                                          errorMessageName, errorStartPosition,
+                                                                          errorEndPosition);
+
+        templateFunctionDecl->getInstantiation(dynTemplateArguments, &templateFunctionInstDecl);
+
+        for (Expr* dynTemplateArgument : dynTemplateArguments) {
+            delete dynTemplateArgument;
+        }
+    } else {
+        templateFunctionDecl->getInstantiation(templateArguments, &templateFunctionInstDecl);
+    }
 
     // NOTE: It is possible the template instantiation has already been instantiated.
     if (!templateFunctionInstDecl->isInstantiated) {
@@ -203,6 +224,56 @@ gulc::TemplateFunctionInstDecl* gulc::DeclInstantiator::instantiateTemplateFunct
     return templateFunctionInstDecl;
 }
 
+bool gulc::DeclInstantiator::isDynTemplateFunction(gulc::TemplateFunctionDecl const* templateFunctionDecl) const {
+    for (Attr const* attribute : templateFunctionDecl->attributes()) {
+        if (llvm::isa<DynAttr>(attribute)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::vector<gulc::Expr*> gulc::DeclInstantiator::getDynTemplateArguments(
+        gulc::TemplateFunctionDecl* templateFunctionDecl, std::vector<Expr*> const& templateArguments,
+        std::string const& errorMessageName, TextPosition errorStartPosition, TextPosition errorEndPosition) {
+    std::vector<Expr*> result;
+    result.reserve(templateArguments.size());
+
+    for (std::size_t i = 0; i < templateArguments.size(); ++i) {
+        TemplateParameterDecl* templateParameter = templateFunctionDecl->templateParameters()[i];
+
+        if (templateParameter->templateParameterKind() != TemplateParameterDecl::TemplateParameterKind::Typename) {
+            result.push_back(templateArguments[i]->deepCopy());
+            continue;
+        }
+
+        // The only types we can dispatch through are traits, the parameter MUST be bound to exactly one trait
+        TraitType* boundTraitType = nullptr;
+
+        for (Type* inheritedType : templateParameter->inheritedTypes) {
+            if (!llvm::isa<TraitType>(inheritedType) || boundTraitType != nullptr) {
+                boundTraitType = nullptr;
+                break;
+            }
+
+            boundTraitType = llvm::dyn_cast<TraitType>(inheritedType);
+        }
+
+        if (boundTraitType == nullptr) {
+            printError("`@dyn` template `" + errorMessageName + "` requires template parameter `" +
+                       templateParameter->identifier().name() + "` to be bound to exactly one trait "
+                       "(i.e. `where " + templateParameter->identifier().name() + " : Trait`)!",
+                       errorStartPosition, errorEndPosition);
+        }
+
+        result.push_back(new TypeExpr(new TraitType(Type::Qualifier::Unassigned, boundTraitType->decl(),
+                                                    {}, {})));
+    }
+
+    return result;
+}
+
 void gulc::DeclInstantiator::handleDelayedInstantiationDecls() {
     while (!_delayInstantiationDecls.empty()) {
         Decl* delayedInstantiation = _delayInstantiationDecls.front();
@@ -240,8 +311,8 @@ void gulc::DeclInstantiator::handleDelayedInstantiationDecls() {
 void gulc::DeclInstantiator::printError(std::string const& message, gulc::TextPosition startPosition,
                                         gulc::TextPosition endPosition) const {
     std::cerr << "gulc error[" << _filePaths[_currentFile->sourceFileID] << ", "
-                           "{" << startPosition.line << ", " << startPosition.column << " "
-                           "to " << endPosition.line << ", " << endPosition.column << "}]: "
+                           "{" << startPosition.line() << ", " << startPosition.column() << " "
+                           "to " << endPosition.line() << ", " << endPosition.column() << "}]: "
               << message << std::endl;
     std::exit(1);
 }
@@ -249,8 +320,8 @@ void gulc::DeclInstantiator::printError(std::string const& message, gulc::TextPo
 void gulc::DeclInstantiator::printWarning(std::string const& message, gulc::TextPosition startPosition,
                                           gulc::TextPosition endPosition) const {
     std::cout << "gulc warning[" << _filePaths[_currentFile->sourceFileID] << ", "
-                             "{" << startPosition.line << ", " << startPosition.column << " "
-                             "to " << endPosition.line << ", " << endPosition.column << "}]: "
+                             "{" << startPosition.line() << ", " << startPosition.column() << " "
+                             "to " << endPosition.line() << ", " << endPosition.column() << "}]: "
               << message << std::endl;
 }
 
@@ -1105,17 +1176,21 @@ void gulc::DeclInstantiator::processContract(gulc::Cont* contract) {
             break;
         }
         case Cont::Kind::Requires:
-            printError("`requires` not yet supported!",
-                       contract->startPosition(), contract->endPosition());
+            processExpr(llvm::dyn_cast<RequiresCont>(contract)->condition);
             break;
         case Cont::Kind::Ensures:
-            printError("`ensures` not yet supported!",
-                       contract->startPosition(), contract->endPosition());
+            processExpr(llvm::dyn_cast<EnsuresCont>(contract)->condition);
             break;
-        case Cont::Kind::Throws:
-            printError("`throws` not yet supported!",
-                       contract->startPosition(), contract->endPosition());
+        case Cont::Kind::Throws: {
+            auto throwsCont = llvm::dyn_cast<ThrowsCont>(contract);
+
+            if (throwsCont->hasExceptionType() && !resolveType(throwsCont->exceptionType)) {
+                printError("throws type `" + throwsCont->exceptionType->toString() + "` was not found!",
+                           throwsCont->exceptionType->startPosition(), throwsCont->exceptionType->endPosition());
+            }
+
             break;
+        }
         default:
             printError("unknown contract!",
                        contract->startPosition(), contract->endPosition());
@@ -1275,6 +1350,17 @@ void gulc::DeclInstantiator::processFunctionDecl(gulc::FunctionDecl* functionDec
         }
     }
 
+    for (Cont* contract : functionDecl->contracts()) {
+        if (llvm::isa<ThrowsCont>(contract)) {
+            auto throwsCont = llvm::dyn_cast<ThrowsCont>(contract);
+
+            if (throwsCont->hasExceptionType() && !resolveType(throwsCont->exceptionType)) {
+                printError("throws type `" + throwsCont->exceptionType->toString() + "` was not found!",
+                           throwsCont->exceptionType->startPosition(), throwsCont->exceptionType->endPosition());
+            }
+        }
+    }
+
     functionDecl->isInstantiated = true;
 }
 
@@ -1287,6 +1373,8 @@ void gulc::DeclInstantiator::processNamespaceDecl(gulc::NamespaceDecl* namespace
     for (Decl* nestedDecl : namespaceDecl->nestedDecls()) {
         processDecl(nestedDecl);
     }
+
+    namespaceDecl->indexTypeExtensions();
 }
 
 void gulc::DeclInstantiator::processParameterDecl(gulc::ParameterDecl* parameterDecl) {
@@ -1684,10 +1772,12 @@ void gulc::DeclInstantiator::processStructDecl(gulc::StructDecl* structDecl, boo
         }
 
         std::size_t sizeWithoutPadding = 0;
+        std::size_t structAlign = _target.alignofStruct();
 
         // If the struct isn't null it will be instantiated and have its size set already by this point
         if (structDecl->baseStruct != nullptr) {
             sizeWithoutPadding = structDecl->baseStruct->dataSizeWithoutPadding;
+            structAlign = std::max(structAlign, structDecl->baseStruct->dataAlignment);
         }
 
         // To make things easier and less verbose we add the vtable as a hidden member of the `ownedMembers`
@@ -1698,51 +1788,103 @@ void gulc::DeclInstantiator::processStructDecl(gulc::StructDecl* structDecl, boo
             structDecl->ownedMembers().insert(structDecl->ownedMembers().begin(), vtableMember);
         }
 
+        // Only `VariableDecl` can affect the actual size of the struct.
+        std::vector<std::pair<VariableDecl*, SizeAndAlignment>> dataMembers;
+
         for (Decl* checkDecl : structDecl->ownedMembers()) {
-            // Only `VariableDecl` can affect the actual size of the struct.
             if (llvm::isa<VariableDecl>(checkDecl)) {
                 auto dataMember = llvm::dyn_cast<VariableDecl>(checkDecl);
-                auto sizeAndAlignment = SizeofUtil::getSizeAndAlignmentOf(_target, dataMember->type);
 
-                std::size_t alignPadding = 0;
+                dataMembers.emplace_back(dataMember, SizeofUtil::getSizeAndAlignmentOf(_target, dataMember->type));
+            }
+        }
 
-                // `align` can't be zero, `n % 0` is illegal since `n / 0` is illegal
-                if (sizeAndAlignment.align != 0) {
-                    alignPadding = sizeAndAlignment.align - (sizeWithoutPadding % sizeAndAlignment.align);
+        // Unless the struct is `@pod` (meaning it must keep the C declaration order) we are free to reorder the data
+        // members. Sorting by descending alignment removes all interior padding between members, only the tail padding
+        // is left. The sort is stable so members with the same alignment keep their declaration order. The vtable
+        // pointer is always kept as the first member.
+        if (!structDecl->hasAttr(Attr::Kind::Pod) && structDecl->structKind() != StructDecl::Kind::Union) {
+            auto sortBegin = dataMembers.begin();
 
-                    // Rather than deal with casting to a signed type and rearrange the above algorithm to prevent
-                    // this from happening, we just check if the `alignPadding` is equal to the `align` and set
-                    // `alignPadding` to zero if it happens
-                    if (alignPadding == sizeAndAlignment.align) {
-                        alignPadding = 0;
-                    }
-                }
+            if (structDecl->vtableOwner == structDecl) {
+                ++sortBegin;
+            }
 
-                // If there is an alignment padding then we have to add hidden "_" members to pad the memory layout
-                if (alignPadding > 0) {
-                    auto i8Type = gulc::BuiltInType::get(Type::Qualifier::Immut, "i8", {}, {});
-                    auto lengthLiteral = new ValueLiteralExpr(ValueLiteralExpr::LiteralType::Integer,
-                                                              std::to_string(alignPadding), "", {}, {});
-                    auto paddingType = new FlatArrayType(Type::Qualifier::Immut, i8Type, lengthLiteral);
-                    auto paddingExpr = new VariableDecl(structDecl->sourceFileID(), {}, Decl::Visibility::Private,
-                                                        false, Identifier({}, {}, "_"),
-                                                        DeclModifiers::None,
-                                                        paddingType, nullptr, {}, {});
-
-                    structDecl->memoryLayout.push_back(paddingExpr);
-                    // We have to add the padding expression here too so that it is deleted properly...
-                    structDecl->ownedPaddingMembers.push_back(paddingExpr);
-                }
+            std::stable_sort(sortBegin, dataMembers.end(),
+                             [](std::pair<VariableDecl*, SizeAndAlignment> const& left,
+                                std::pair<VariableDecl*, SizeAndAlignment> const& right) {
+                return left.second.align > right.second.align;
+            });
+        }
+
+        for (auto const& dataMemberPair : dataMembers) {
+            VariableDecl* dataMember = dataMemberPair.first;
+            SizeAndAlignment const& sizeAndAlignment = dataMemberPair.second;
 
-                structDecl->memoryLayout.push_back(dataMember);
+            std::size_t alignPadding = 0;
 
-                sizeWithoutPadding += alignPadding;
-                sizeWithoutPadding += sizeAndAlignment.size;
+            // `align` can't be zero, `n % 0` is illegal since `n / 0` is illegal
+            if (sizeAndAlignment.align != 0) {
+                alignPadding = sizeAndAlignment.align - (sizeWithoutPadding % sizeAndAlignment.align);
+
+                // Rather than deal with casting to a signed type and rearrange the above algorithm to prevent
+                // this from happening, we just check if the `alignPadding` is equal to the `align` and set
+                // `alignPadding` to zero if it happens
+                if (alignPadding == sizeAndAlignment.align) {
+                    alignPadding = 0;
+                }
             }
+
+            // If there is an alignment padding then we have to add hidden "_" members to pad the memory layout
+            if (alignPadding > 0) {
+                auto i8Type = gulc::BuiltInType::get(Type::Qualifier::Immut, "i8", {}, {});
+                auto lengthLiteral = new ValueLiteralExpr(ValueLiteralExpr::LiteralType::Integer,
+                                                          std::to_string(alignPadding), "", {}, {});
+                auto paddingType = new FlatArrayType(Type::Qualifier::Immut, i8Type, lengthLiteral);
+                auto paddingExpr = new VariableDecl(structDecl->sourceFileID(), {}, Decl::Visibility::Private,
+                                                    false, Identifier({}, {}, "_"),
+                                                    DeclModifiers::None,
+                                                    paddingType, nullptr, {}, {});
+
+                structDecl->memoryLayout.push_back(paddingExpr);
+                // We have to add the padding expression here too so that it is deleted properly...
+                structDecl->ownedPaddingMembers.push_back(paddingExpr);
+            }
+
+            structDecl->memoryLayout.push_back(dataMember);
+
+            sizeWithoutPadding += alignPadding;
+            sizeWithoutPadding += sizeAndAlignment.size;
+
+            // The member offsets above are only aligned relative to the start of the struct, the struct itself has to
+            // be at least as aligned as its most aligned member for them to be aligned in memory
+            structAlign = std::max(structAlign, sizeAndAlignment.align);
         }
 
         structDecl->dataSizeWithoutPadding = sizeWithoutPadding;
-        structDecl->dataSizeWithPadding = _target.alignofStruct() - (structDecl->dataSizeWithoutPadding % _target.alignofStruct());
+        structDecl->dataAlignment = structAlign;
+        // The full size is rounded up to the next multiple of the struct alignment (this is the tail padding that
+        // `CodeGen` adds to the end of the LLVM struct type)
+        structDecl->dataSizeWithPadding = ((sizeWithoutPadding + structAlign - 1) / structAlign) * structAlign;
+
+        // `@soa` splits each member into its own column so there can't be anything that relies on the members of a
+        // single element being stored together
+        if (structDecl->hasAttr(Attr::Kind::Soa)) {
+            if (structDecl->structKind() == StructDecl::Kind::Union) {
+                printError("`@soa` cannot be applied to a `union`!",
+                           structDecl->startPosition(), structDecl->endPosition());
+            }
+
+            if (structDecl->baseStruct != nullptr) {
+                printError("`@soa` struct `" + structDecl->identifier().name() + "` cannot inherit a base struct!",
+                           structDecl->startPosition(), structDecl->endPosition());
+            }
+
+            if (structDecl->vtableOwner != nullptr) {
+                printError("`@soa` struct `" + structDecl->identifier().name() + "` cannot have virtual members!",
+                           structDecl->startPosition(), structDecl->endPosition());
+            }
+        }
     }
 
     _workingDecls.pop_back();
@@ -2070,6 +2212,16 @@ void gulc::DeclInstantiator::processTraitDecl(gulc::TraitDecl* traitDecl) {
         processDecl(member, false);
     }
 
+    // Every non-static member function gets a slot in the witness table of the structs that implement the trait
+    // NOTE: `allMembers` includes the members of our inherited traits so a trait object can call those as well
+    traitDecl->witnessTable.clear();
+
+    for (Decl* member : traitDecl->allMembers) {
+        if (member->getDeclKind() == Decl::Kind::Function && !member->isStatic()) {
+            traitDecl->witnessTable.push_back(llvm::dyn_cast<FunctionDecl>(member));
+        }
+    }
+
     _workingDecls.pop_back();
 
     traitDecl->isInstantiated = true;
@@ -2457,6 +2609,9 @@ void gulc::DeclInstantiator::processStmt(gulc::Stmt* stmt) {
         case Stmt::Kind::Switch:
             processSwitchStmt(llvm::dyn_cast<SwitchStmt>(stmt));
             break;
+        case Stmt::Kind::Throw:
+            processThrowStmt(llvm::dyn_cast<ThrowStmt>(stmt));
+            break;
         case Stmt::Kind::While:
             processWhileStmt(llvm::dyn_cast<WhileStmt>(stmt));
             break;
@@ -2554,6 +2709,12 @@ void gulc::DeclInstantiator::processSwitchStmt(gulc::SwitchStmt* switchStmt) {
     }
 }
 
+void gulc::DeclInstantiator::processThrowStmt(gulc::ThrowStmt* throwStmt) {
+    if (throwStmt->hasThrownValue()) {
+        processExpr(throwStmt->thrownValue);
+    }
+}
+
 void gulc::DeclInstantiator::processWhileStmt(gulc::WhileStmt* whileStmt) {
     processExpr(whileStmt->condition);
     processCompoundStmt(whileStmt->body());
@@ -2591,6 +2752,9 @@ void gulc::DeclInstantiator::processExpr(gulc::Expr* expr) {
         case Expr::Kind::CheckExtendsType:
             processCheckExtendsTypeExpr(llvm::dyn_cast<CheckExtendsTypeExpr>(expr));
             break;
+        case Expr::Kind::Delete:
+            processDeleteExpr(llvm::dyn_cast<DeleteExpr>(expr));
+            break;
         case Expr::Kind::FunctionCall:
             processFunctionCallExpr(llvm::dyn_cast<FunctionCallExpr>(expr));
             break;
@@ -2613,6 +2777,9 @@ void gulc::DeclInstantiator::processExpr(gulc::Expr* expr) {
         case Expr::Kind::MemberAccessCall:
             processMemberAccessCallExpr(llvm::dyn_cast<MemberAccessCallExpr>(expr));
             break;
+        case Expr::Kind::New:
+            processNewExpr(llvm::dyn_cast<NewExpr>(expr));
+            break;
         case Expr::Kind::Paren:
             processParenExpr(llvm::dyn_cast<ParenExpr>(expr));
             break;
@@ -2683,6 +2850,10 @@ void gulc::DeclInstantiator::processCheckExtendsTypeExpr(gulc::CheckExtendsTypeE
     }
 }
 
+void gulc::DeclInstantiator::processDeleteExpr(gulc::DeleteExpr* deleteExpr) {
+    processExpr(deleteExpr->pointer);
+}
+
 void gulc::DeclInstantiator::processFunctionCallExpr(gulc::FunctionCallExpr* functionCallExpr) {
     processExpr(functionCallExpr->functionReference);
 
@@ -2724,6 +2895,10 @@ void gulc::DeclInstantiator::processMemberAccessCallExpr(gulc::MemberAccessCallE
     processExpr(memberAccessCallExpr->objectRef);
 }
 
+void gulc::DeclInstantiator::processNewExpr(gulc::NewExpr* newExpr) {
+    processExpr(newExpr->initializer);
+}
+
 void gulc::DeclInstantiator::processParenExpr(gulc::ParenExpr* parenExpr) {
     processExpr(parenExpr->nestedExpr);
 }
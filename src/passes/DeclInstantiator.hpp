@@ -43,6 +43,9 @@
 #include <ast/conts/WhereCont.hpp>
 #include <ast/exprs/TemplateConstRefExpr.hpp>
 #include <ast/exprs/TryExpr.hpp>
+#include <ast/exprs/NewExpr.hpp>
+#include <ast/exprs/DeleteExpr.hpp>
+#include <ast/stmts/ThrowStmt.hpp>
 #include <ast/decls/TraitPrototypeDecl.hpp>
 #include <ast/decls/ImaginaryTypeDecl.hpp>
 
@@ -121,6 +124,13 @@ namespace gulc {
         std::queue<gulc::Decl*> _delayInstantiationDecls;
 
         void handleDelayedInstantiationDecls();
+        bool isDynTemplateFunction(TemplateFunctionDecl const* templateFunctionDecl) const;
+        // Create the template arguments a `@dyn` template is instantiated with, every typename argument is replaced
+        // with the trait its parameter is bound to. The returned `Expr`s are owned by the caller.
+        std::vector<Expr*> getDynTemplateArguments(TemplateFunctionDecl* templateFunctionDecl,
+                                                   std::vector<Expr*> const& templateArguments,
+                                                   std::string const& errorMessageName,
+                                                   TextPosition errorStartPosition, TextPosition errorEndPosition);
 
         void printError(std::string const& message, TextPosition startPosition, TextPosition endPosition) const;
         void printWarning(std::string const& message, TextPosition startPosition, TextPosition endPosition) const;
@@ -204,6 +214,7 @@ namespace gulc {
         void processRepeatWhileStmt(RepeatWhileStmt* repeatWhileStmt);
         void processReturnStmt(ReturnStmt* returnStmt);
         void processSwitchStmt(SwitchStmt* switchStmt);
+        void processThrowStmt(ThrowStmt* throwStmt);
         void processWhileStmt(WhileStmt* whileStmt);
 
         void processConstExpr(Expr* expr);
@@ -212,6 +223,7 @@ namespace gulc {
         void processAsExpr(AsExpr* asExpr);
         void processAssignmentOperatorExpr(AssignmentOperatorExpr* assignmentOperatorExpr);
         void processCheckExtendsTypeExpr(CheckExtendsTypeExpr* checkExtendsTypeExpr);
+        void processDeleteExpr(DeleteExpr* deleteExpr);
         void processFunctionCallExpr(FunctionCallExpr* functionCallExpr);
         void processHasExpr(HasExpr* hasExpr);
         void processIdentifierExpr(IdentifierExpr* identifierExpr);
@@ -219,6 +231,7 @@ namespace gulc {
         void processIsExpr(IsExpr* isExpr);
         void processLabeledArgumentExpr(LabeledArgumentExpr* labeledArgumentExpr);
         void processMemberAccessCallExpr(MemberAccessCallExpr* memberAccessCallExpr);
+        void processNewExpr(NewExpr* newExpr);
         void processParenExpr(ParenExpr* parenExpr);
         void processPostfixOperatorExpr(PostfixOperatorExpr* postfixOperatorExpr);
         void processPrefixOperatorExpr(PrefixOperatorExpr* prefixOperatorExpr);
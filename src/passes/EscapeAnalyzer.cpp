@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <ast/types/PointerType.hpp>
+#include <ast/types/StructType.hpp>
+#include "EscapeAnalyzer.hpp"
+
+void gulc::EscapeAnalyzer::processFiles(std::vector<ASTFile>& files) {
+    traverseFiles(files);
+
+    for (NewLocalVariable& newLocalVariable : _newLocalVariables) {
+        if (newLocalVariable.escapes) {
+            continue;
+        }
+
+        auto structType = llvm::dyn_cast<StructType>(newLocalVariable.newExpr->initializer->valueType);
+
+        if (structType == nullptr || structType->decl()->dataSizeWithPadding > maxStackAllocationSize) {
+            continue;
+        }
+
+        newLocalVariable.newExpr->isStackAllocated = true;
+
+        // The stack slot is released with the function, `free` would be called on stack memory
+        for (DeleteExpr* deleteExpr : newLocalVariable.deleteExprs) {
+            deleteExpr->freesMemory = false;
+        }
+    }
+}
+
+bool gulc::EscapeAnalyzer::capturesSelf(gulc::FunctionDecl* functionDecl) {
+    // Structs without a destructor have nothing that could capture `self`
+    if (functionDecl == nullptr) {
+        return false;
+    }
+
+    auto foundResult = _capturesSelfResults.find(functionDecl);
+
+    if (foundResult != _capturesSelfResults.end()) {
+        return foundResult->second;
+    }
+
+    // We can't see what a function without a body does with `self`. This also stops any recursion while the function
+    // is being walked.
+    _capturesSelfResults[functionDecl] = true;
+
+    if (functionDecl->body() == nullptr) {
+        return true;
+    }
+
+    EscapeAnalyzer selfChecker(*this);
+    selfChecker.traverseDecl(functionDecl);
+
+    _capturesSelfResults[functionDecl] = selfChecker._selfEscapes;
+    return selfChecker._selfEscapes;
+}
+
+gulc::EscapeAnalyzer::NewLocalVariable* gulc::EscapeAnalyzer::findNewLocalVariable(gulc::Expr const* expr) {
+    if (_isCheckingSelf || !llvm::isa<LocalVariableRefExpr>(expr)) {
+        return nullptr;
+    }
+
+    auto foundIndex = _visibleNewLocalVariables.find(llvm::dyn_cast<LocalVariableRefExpr>(expr)->variableName());
+
+    if (foundIndex == _visibleNewLocalVariables.end()) {
+        return nullptr;
+    }
+
+    return &_newLocalVariables[foundIndex->second];
+}
+
+bool gulc::EscapeAnalyzer::isObjectAddress(gulc::Expr const* expr) {
+    // The tracked object is either the object a `let p = @new ...` points to or `self` of the constructor or destructor
+    // being checked, a member of the object is part of the object.
+    switch (expr->getExprKind()) {
+        case Expr::Kind::CurrentSelf:
+            return _isCheckingSelf;
+        case Expr::Kind::ImplicitDeref:
+            return isObjectAddress(llvm::dyn_cast<ImplicitDerefExpr>(expr)->nestedExpr);
+        case Expr::Kind::LValueToRValue: {
+            Expr const* lvalue = llvm::dyn_cast<LValueToRValueExpr>(expr)->lvalue;
+
+            if (llvm::isa<CurrentSelfExpr>(lvalue)) {
+                return _isCheckingSelf;
+            }
+
+            // The value of `p` is the address of the object
+            return findNewLocalVariable(lvalue) != nullptr;
+        }
+        case Expr::Kind::MemberVariableRef:
+            return isObjectAddress(llvm::dyn_cast<MemberVariableRefExpr>(expr)->object);
+        default:
+            return false;
+    }
+}
+
+void gulc::EscapeAnalyzer::markEscaped(gulc::Expr const* expr) {
+    if (llvm::isa<CurrentSelfExpr>(expr)) {
+        if (_isCheckingSelf) {
+            _selfEscapes = true;
+        }
+    } else if (NewLocalVariable* newLocalVariable = findNewLocalVariable(expr)) {
+        newLocalVariable->escapes = true;
+    }
+}
+
+bool gulc::EscapeAnalyzer::visit(gulc::AssignmentOperatorExpr* assignmentOperatorExpr) {
+    // `p->member = value` only stores into the object, only `value` can escape
+    if (llvm::isa<MemberVariableRefExpr>(assignmentOperatorExpr->leftValue) &&
+            isObjectAddress(assignmentOperatorExpr->leftValue)) {
+        traverseExpr(assignmentOperatorExpr->rightValue);
+        return false;
+    }
+
+    return true;
+}
+
+bool gulc::EscapeAnalyzer::visit(gulc::ConstructorCallExpr* constructorCallExpr) {
+    // Base and member constructors called on the object
+    if (constructorCallExpr->objectRef != nullptr && isObjectAddress(constructorCallExpr->objectRef)) {
+        auto constructorReferenceExpr = llvm::dyn_cast<ConstructorReferenceExpr>(
+                constructorCallExpr->functionReference);
+
+        if (capturesSelf(constructorReferenceExpr->constructor)) {
+            markEscaped(constructorCallExpr->objectRef);
+            // `markEscaped` only handles the roots, a member of `self` is the same as `self` here
+            _selfEscapes = _selfEscapes || _isCheckingSelf;
+        }
+
+        traverseExprs(constructorCallExpr->arguments);
+        return false;
+    }
+
+    return true;
+}
+
+bool gulc::EscapeAnalyzer::visit(gulc::CurrentSelfExpr* currentSelfExpr) {
+    markEscaped(currentSelfExpr);
+    return true;
+}
+
+bool gulc::EscapeAnalyzer::visit(gulc::DeleteExpr* deleteExpr) {
+    if (llvm::isa<LValueToRValueExpr>(deleteExpr->pointer)) {
+        NewLocalVariable* newLocalVariable =
+                findNewLocalVariable(llvm::dyn_cast<LValueToRValueExpr>(deleteExpr->pointer)->lvalue);
+
+        if (newLocalVariable != nullptr) {
+            auto pointerType = llvm::dyn_cast<PointerType>(deleteExpr->pointer->valueType);
+
+            if (capturesSelf(llvm::dyn_cast<StructType>(pointerType->nestedType)->decl()->destructor)) {
+                newLocalVariable->escapes = true;
+            }
+
+            newLocalVariable->deleteExprs.push_back(deleteExpr);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool gulc::EscapeAnalyzer::visit(gulc::DestructorCallExpr* destructorCallExpr) {
+    // Base and member destructors called on the object
+    if (destructorCallExpr->objectRef != nullptr && isObjectAddress(destructorCallExpr->objectRef)) {
+        auto destructorReferenceExpr = llvm::dyn_cast<DestructorReferenceExpr>(
+                destructorCallExpr->functionReference);
+
+        if (capturesSelf(destructorReferenceExpr->destructor)) {
+            markEscaped(destructorCallExpr->objectRef);
+            _selfEscapes = _selfEscapes || _isCheckingSelf;
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+bool gulc::EscapeAnalyzer::visit(gulc::LocalVariableRefExpr* localVariableRefExpr) {
+    // Any use of `p` that wasn't one of the allowed uses
+    markEscaped(localVariableRefExpr);
+    return true;
+}
+
+bool gulc::EscapeAnalyzer::visit(gulc::LValueToRValueExpr* lValueToRValueExpr) {
+    // Loading `p->member` copies the member out, the object itself isn't used
+    if (llvm::isa<MemberVariableRefExpr>(lValueToRValueExpr->lvalue) && isObjectAddress(lValueToRValueExpr->lvalue)) {
+        return false;
+    }
+
+    return true;
+}
+
+bool gulc::EscapeAnalyzer::visit(gulc::VariableDeclExpr* variableDeclExpr) {
+    if (_isCheckingSelf) {
+        return true;
+    }
+
+    std::string const& variableName = variableDeclExpr->identifier().name();
+
+    // Any earlier variable with this name has gone out of scope
+    _visibleNewLocalVariables.erase(variableName);
+
+    if (variableDeclExpr->initialValue != nullptr && llvm::isa<NewExpr>(variableDeclExpr->initialValue)) {
+        auto newExpr = llvm::dyn_cast<NewExpr>(variableDeclExpr->initialValue);
+        auto constructorCallExpr = llvm::dyn_cast<ConstructorCallExpr>(newExpr->initializer);
+        auto constructorReferenceExpr = llvm::dyn_cast<ConstructorReferenceExpr>(
+                constructorCallExpr->functionReference);
+
+        _newLocalVariables.push_back(NewLocalVariable {
+                newExpr,
+                capturesSelf(constructorReferenceExpr->constructor),
+                {}
+            });
+        _visibleNewLocalVariables[variableName] = _newLocalVariables.size() - 1;
+    }
+
+    return true;
+}
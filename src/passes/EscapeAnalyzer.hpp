@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_ESCAPEANALYZER_HPP
+#define GULC_ESCAPEANALYZER_HPP
+
+#include <map>
+#include <string>
+#include <vector>
+#include <parsing/ASTFile.hpp>
+#include <ast/ASTVisitor.hpp>
+
+namespace gulc {
+    /**
+     * EscapeAnalyzer finds `@new` allocations that never outlive the function that made them and moves them to the
+     * stack, `CodeGen` then constructs them in a stack slot instead of calling `malloc` and their `@delete` only calls
+     * the destructor.
+     *
+     * Only `let p = @new Type(...)` is considered. The object escapes unless every use of `p` is one of:
+     *  * `p->member` (through any number of nested members) that is loaded or assigned to
+     *  * `@delete p`
+     * Anything else (passing `p` to a function, copying it, returning it, taking a reference to `p` or a member of
+     * `p`, calling a member function, etc.) could store the pointer somewhere and the object stays on the heap. Objects
+     * larger than `maxStackAllocationSize` stay on the heap either way.
+     *
+     * The constructor and destructor see the object as `self` so they are held to the same rules, `self` may only be
+     * used for its members or to call base and member constructors and destructors that follow the same rules. A
+     * constructor or destructor without a body (e.g. one from an imported module) is assumed to capture `self`.
+     *
+     * NOTE: This has to run after `CodeTransformer`, every use of a local variable has to be a `LocalVariableRefExpr`
+     *       by then.
+     */
+    class EscapeAnalyzer : public ASTVisitor<EscapeAnalyzer> {
+    public:
+        // Objects larger than this stay on the heap even when they don't escape. Every stack allocated `@new` gets its
+        // own slot for the whole function, anything bigger than a page would also need stack probing.
+        static constexpr std::size_t maxStackAllocationSize = 4096;
+
+        EscapeAnalyzer()
+                : _capturesSelfResults(_ownCapturesSelfResults), _isCheckingSelf(false), _selfEscapes(false) {}
+
+        void processFiles(std::vector<ASTFile>& files);
+
+    protected:
+        // Walks a constructor or destructor with `self` as the tracked object, the results are shared with `parent`
+        explicit EscapeAnalyzer(EscapeAnalyzer& parent)
+                : _capturesSelfResults(parent._capturesSelfResults), _isCheckingSelf(true), _selfEscapes(false) {}
+
+        struct NewLocalVariable {
+            NewExpr* newExpr;
+            bool escapes;
+            std::vector<DeleteExpr*> deleteExprs;
+        };
+
+        std::map<FunctionDecl const*, bool> _ownCapturesSelfResults;
+        // Whether each constructor or destructor checked so far lets `self` escape
+        std::map<FunctionDecl const*, bool>& _capturesSelfResults;
+        // Every `let p = @new ...` found so far
+        std::vector<NewLocalVariable> _newLocalVariables;
+        // The index into `_newLocalVariables` for each local variable name in scope that was initialized by `@new`.
+        // Local variables can't shadow each other so the latest declaration of a name is the one every
+        // `LocalVariableRefExpr` after it refers to.
+        std::map<std::string, std::size_t> _visibleNewLocalVariables;
+        // True when walking a constructor or destructor to check if `self` escapes
+        bool _isCheckingSelf;
+        bool _selfEscapes;
+
+        bool capturesSelf(FunctionDecl* functionDecl);
+        NewLocalVariable* findNewLocalVariable(Expr const* expr);
+        bool isObjectAddress(Expr const* expr);
+        void markEscaped(Expr const* expr);
+
+        friend class ASTVisitor<EscapeAnalyzer>;
+        using ASTVisitor<EscapeAnalyzer>::visit;
+
+        bool visit(AssignmentOperatorExpr* assignmentOperatorExpr);
+        bool visit(ConstructorCallExpr* constructorCallExpr);
+        bool visit(CurrentSelfExpr* currentSelfExpr);
+        bool visit(DeleteExpr* deleteExpr);
+        bool visit(DestructorCallExpr* destructorCallExpr);
+        bool visit(LocalVariableRefExpr* localVariableRefExpr);
+        bool visit(LValueToRValueExpr* lValueToRValueExpr);
+        bool visit(VariableDeclExpr* variableDeclExpr);
+
+    };
+}
+
+#endif //GULC_ESCAPEANALYZER_HPP
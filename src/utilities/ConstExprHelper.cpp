@@ -17,12 +17,24 @@
  */
 #include <ast/exprs/TypeExpr.hpp>
 #include <llvm/Support/Casting.h>
+#include <cstdint>
 #include <iostream>
 #include <ast/exprs/ValueLiteralExpr.hpp>
+#include <ast/exprs/BoolLiteralExpr.hpp>
+#include <ast/types/AliasType.hpp>
+#include <ast/types/BuiltInType.hpp>
+#include <ast/types/DependentType.hpp>
 #include <ast/types/DimensionType.hpp>
+#include <ast/types/EnumType.hpp>
 #include <ast/types/FlatArrayType.hpp>
 #include <ast/types/PointerType.hpp>
 #include <ast/types/ReferenceType.hpp>
+#include <ast/types/SimdType.hpp>
+#include <ast/types/StructType.hpp>
+#include <ast/types/TemplateStructType.hpp>
+#include <ast/types/TemplateTraitType.hpp>
+#include <ast/types/TemplateTypenameRefType.hpp>
+#include <ast/types/TraitType.hpp>
 #include "ConstExprHelper.hpp"
 #include "TypeCompareUtil.hpp"
 
@@ -63,6 +75,107 @@ bool gulc::ConstExprHelper::compareAreSame(const gulc::Expr* left, const gulc::E
     return false;
 }
 
+// Decls are identified by address since the same name can be declared in multiple namespaces
+static std::string getDeclKey(void const* decl) {
+    return std::to_string(reinterpret_cast<std::uintptr_t>(decl));
+}
+
+std::string gulc::ConstExprHelper::getCanonicalKey(gulc::Expr const* expr) {
+    switch (expr->getExprKind()) {
+        case Expr::Kind::BoolLiteral:
+            return llvm::dyn_cast<BoolLiteralExpr>(expr)->value() ? "b1" : "b0";
+        case Expr::Kind::Type:
+            return getCanonicalTypeKey(llvm::dyn_cast<TypeExpr>(expr)->type);
+        case Expr::Kind::ValueLiteral: {
+            auto valueLiteralExpr = llvm::dyn_cast<ValueLiteralExpr>(expr);
+            std::string result = "v" + std::to_string(static_cast<int>(valueLiteralExpr->literalType())) + ":" +
+                                 valueLiteralExpr->value() + ":" + valueLiteralExpr->suffix();
+
+            if (valueLiteralExpr->valueType != nullptr) {
+                result += ":" + getCanonicalTypeKey(valueLiteralExpr->valueType);
+            }
+
+            return result;
+        }
+        default:
+            // Anything else should have been solved by now, the string is still unique enough to be used as a key
+            return "e" + std::to_string(static_cast<int>(expr->getExprKind())) + ":" + expr->toString();
+    }
+}
+
+std::string gulc::ConstExprHelper::getCanonicalKey(std::vector<Expr*> const& templateArguments) {
+    std::string result = "<";
+
+    for (std::size_t i = 0; i < templateArguments.size(); ++i) {
+        if (i != 0) result += ",";
+
+        result += getCanonicalKey(templateArguments[i]);
+    }
+
+    return result + ">";
+}
+
+std::string gulc::ConstExprHelper::getCanonicalTypeKey(gulc::Type const* type, bool includeQualifier) {
+    std::string result = includeQualifier ? std::to_string(static_cast<int>(type->qualifier())) : "";
+
+    switch (type->getTypeKind()) {
+        case Type::Kind::Alias:
+            // An alias is the same type as the type it aliases
+            return result + getCanonicalTypeKey(llvm::dyn_cast<AliasType>(type)->decl()->typeValue, false);
+        case Type::Kind::Bool:
+            return result + "bool";
+        case Type::Kind::BuiltIn:
+            return result + llvm::dyn_cast<BuiltInType>(type)->name();
+        case Type::Kind::Dependent: {
+            auto dependentType = llvm::dyn_cast<DependentType>(type);
+
+            return result + "d(" + getCanonicalTypeKey(dependentType->container) + "," +
+                   getCanonicalTypeKey(dependentType->dependent) + ")";
+        }
+        case Type::Kind::Dimension:
+            return result + "[" + getCanonicalTypeKey(llvm::dyn_cast<DimensionType>(type)->nestedType) + "]";
+        case Type::Kind::Enum:
+            return result + "e" + getDeclKey(llvm::dyn_cast<EnumType>(type)->decl());
+        case Type::Kind::FlatArray: {
+            auto flatArrayType = llvm::dyn_cast<FlatArrayType>(type);
+
+            return result + "[" + getCanonicalTypeKey(flatArrayType->indexType) + ";" +
+                   getCanonicalKey(flatArrayType->length) + "]";
+        }
+        case Type::Kind::Pointer:
+            return result + "*" + getCanonicalTypeKey(llvm::dyn_cast<PointerType>(type)->nestedType);
+        case Type::Kind::Reference:
+            return result + "&" + getCanonicalTypeKey(llvm::dyn_cast<ReferenceType>(type)->nestedType);
+        case Type::Kind::Simd: {
+            auto simdType = llvm::dyn_cast<SimdType>(type);
+
+            return result + "simd<" + getCanonicalTypeKey(simdType->elementType) + "," +
+                   std::to_string(simdType->length()) + ">";
+        }
+        case Type::Kind::Struct:
+            return result + "s" + getDeclKey(llvm::dyn_cast<StructType>(type)->decl());
+        case Type::Kind::TemplateStruct: {
+            auto templateStructType = llvm::dyn_cast<TemplateStructType>(type);
+
+            return result + "S" + getDeclKey(templateStructType->decl()) +
+                   getCanonicalKey(templateStructType->templateArguments());
+        }
+        case Type::Kind::TemplateTrait: {
+            auto templateTraitType = llvm::dyn_cast<TemplateTraitType>(type);
+
+            return result + "T" + getDeclKey(templateTraitType->decl()) +
+                   getCanonicalKey(templateTraitType->templateArguments());
+        }
+        case Type::Kind::TemplateTypenameRef:
+            return result + "p" +
+                   getDeclKey(llvm::dyn_cast<TemplateTypenameRefType>(type)->refTemplateParameter());
+        case Type::Kind::Trait:
+            return result + "t" + getDeclKey(llvm::dyn_cast<TraitType>(type)->decl());
+        default:
+            return result + "k" + std::to_string(static_cast<int>(type->getTypeKind())) + ":" + type->toString();
+    }
+}
+
 bool gulc::ConstExprHelper::templateArgumentsAreSolved(std::vector<Expr*>& templateArguments) {
     for (Expr* checkArgument : templateArguments) {
         if (!templateArgumentIsSolved(checkArgument)) {
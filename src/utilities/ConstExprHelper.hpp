@@ -20,6 +20,7 @@
 
 #include <ast/Expr.hpp>
 #include <ast/Type.hpp>
+#include <string>
 #include <vector>
 
 namespace gulc {
@@ -28,6 +29,15 @@ namespace gulc {
         static bool compareAreSame(Expr const* left, Expr const* right);
         static bool templateArgumentsAreSolved(std::vector<Expr*>& templateArguments);
 
+        // Canonical keys are used to memoize `const` questions (`has`, `where`) that are asked with the same arguments
+        // over and over again. Two keys are equal only if the arguments are the exact same, decls are identified by
+        // their address so two different structs with the same name never share a key.
+        // NOTE: `includeQualifier` only applies to the outermost type, nested qualifiers are always included the same
+        //       as `TypeCompareUtil::compareAreSame`
+        static std::string getCanonicalKey(Expr const* expr);
+        static std::string getCanonicalKey(std::vector<Expr*> const& templateArguments);
+        static std::string getCanonicalTypeKey(Type const* type, bool includeQualifier = true);
+
     private:
         static bool templateArgumentIsSolved(Expr* checkArgument);
         static bool templateTypeArgumentIsSolved(Type* checkType);
@@ -0,0 +1,1534 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <llvm/Support/Casting.h>
+#include <ast/decls/EnumConstDecl.hpp>
+#include <ast/decls/EnumDecl.hpp>
+#include <ast/decls/FunctionDecl.hpp>
+#include <ast/decls/ParameterDecl.hpp>
+#include <ast/exprs/AsExpr.hpp>
+#include <ast/exprs/BoolLiteralExpr.hpp>
+#include <ast/exprs/EnumConstRefExpr.hpp>
+#include <ast/exprs/FlatArrayIndexExpr.hpp>
+#include <ast/exprs/FunctionReferenceExpr.hpp>
+#include <ast/exprs/ImplicitCastExpr.hpp>
+#include <ast/exprs/LabeledArgumentExpr.hpp>
+#include <ast/exprs/LocalVariableRefExpr.hpp>
+#include <ast/exprs/LValueToRValueExpr.hpp>
+#include <ast/exprs/ParameterRefExpr.hpp>
+#include <ast/exprs/ParenExpr.hpp>
+#include <ast/exprs/SolvedConstExpr.hpp>
+#include <ast/exprs/StoreTemporaryValueExpr.hpp>
+#include <ast/exprs/TemporaryValueRefExpr.hpp>
+#include <ast/exprs/TernaryExpr.hpp>
+#include <ast/exprs/VariableRefExpr.hpp>
+#include <ast/stmts/BreakStmt.hpp>
+#include <ast/stmts/ContinueStmt.hpp>
+#include <ast/stmts/LabeledStmt.hpp>
+#include <ast/types/BoolType.hpp>
+#include <ast/types/BuiltInType.hpp>
+#include <ast/types/EnumType.hpp>
+#include <ast/types/FlatArrayType.hpp>
+#include "ConstInterpreter.hpp"
+
+gulc::Expr* gulc::ConstInterpreter::solve(gulc::Expr const* expr) {
+    _frames.clear();
+    _frames.emplace_back();
+    _constVariables.clear();
+    _steps = 0;
+    _arrayElements = 0;
+    _errorMessage.clear();
+    _dependsOnRuntimeValue = false;
+
+    ConstValue result;
+
+    if (!evaluateFullExpr(expr, result)) {
+        return nullptr;
+    }
+
+    return createLiteral(result, expr->valueType, expr->startPosition(), expr->endPosition());
+}
+
+bool gulc::ConstInterpreter::fail(std::string const& message,
+                                  gulc::TextPosition startPosition, gulc::TextPosition endPosition) {
+    // We only keep the first error, anything after it is just the error being passed back up
+    if (_errorMessage.empty()) {
+        _errorMessage = message;
+        _errorStartPosition = startPosition;
+        _errorEndPosition = endPosition;
+    }
+
+    return false;
+}
+
+bool gulc::ConstInterpreter::failRuntimeValue(std::string const& message,
+                                              gulc::TextPosition startPosition, gulc::TextPosition endPosition) {
+    // Locals and parameters can only be unknown within the expression we were asked to solve. Within a `const`
+    // function they will always have a value.
+    if (_errorMessage.empty() && _frames.size() == 1) {
+        _dependsOnRuntimeValue = true;
+    }
+
+    return fail(message, startPosition, endPosition);
+}
+
+bool gulc::ConstInterpreter::countStep(gulc::TextPosition startPosition, gulc::TextPosition endPosition) {
+    ++_steps;
+
+    if (_steps > maxSteps) {
+        return fail("exceeded the maximum of " + std::to_string(maxSteps) + " steps allowed for compile time "
+                    "evaluation", startPosition, endPosition);
+    }
+
+    return true;
+}
+
+bool gulc::ConstInterpreter::executeStmt(gulc::Stmt const* stmt, gulc::ConstInterpreter::Flow& outFlow) {
+    if (!countStep(stmt->startPosition(), stmt->endPosition())) {
+        return false;
+    }
+
+    outFlow = Flow::Normal;
+
+    switch (stmt->getStmtKind()) {
+        case Stmt::Kind::Break: {
+            auto breakStmt = llvm::dyn_cast<BreakStmt>(stmt);
+
+            if (breakStmt->hasBreakLabel()) {
+                return fail("labeled `break` is not supported in compile time evaluation",
+                            breakStmt->startPosition(), breakStmt->endPosition());
+            }
+
+            outFlow = Flow::Break;
+            return true;
+        }
+        case Stmt::Kind::Compound:
+            return executeCompoundStmt(llvm::dyn_cast<CompoundStmt>(stmt), outFlow);
+        case Stmt::Kind::Continue: {
+            auto continueStmt = llvm::dyn_cast<ContinueStmt>(stmt);
+
+            if (continueStmt->hasContinueLabel()) {
+                return fail("labeled `continue` is not supported in compile time evaluation",
+                            continueStmt->startPosition(), continueStmt->endPosition());
+            }
+
+            outFlow = Flow::Continue;
+            return true;
+        }
+        case Stmt::Kind::Expr: {
+            ConstValue ignored;
+            return evaluateFullExpr(llvm::dyn_cast<Expr>(stmt), ignored);
+        }
+        case Stmt::Kind::For:
+            return executeForStmt(llvm::dyn_cast<ForStmt>(stmt), outFlow);
+        case Stmt::Kind::If:
+            return executeIfStmt(llvm::dyn_cast<IfStmt>(stmt), outFlow);
+        case Stmt::Kind::Labeled:
+            return executeStmt(llvm::dyn_cast<LabeledStmt>(stmt)->labeledStmt, outFlow);
+        case Stmt::Kind::RepeatWhile:
+            return executeRepeatWhileStmt(llvm::dyn_cast<RepeatWhileStmt>(stmt), outFlow);
+        case Stmt::Kind::Return:
+            return executeReturnStmt(llvm::dyn_cast<ReturnStmt>(stmt), outFlow);
+        case Stmt::Kind::While:
+            return executeWhileStmt(llvm::dyn_cast<WhileStmt>(stmt), outFlow);
+        default:
+            return fail("statement is not supported in compile time evaluation",
+                        stmt->startPosition(), stmt->endPosition());
+    }
+}
+
+bool gulc::ConstInterpreter::executeCompoundStmt(gulc::CompoundStmt const* compoundStmt,
+                                                 gulc::ConstInterpreter::Flow& outFlow) {
+    auto& localVariables = _frames.back().localVariables;
+    std::size_t oldLocalVariableCount = localVariables.size();
+    bool result = true;
+
+    outFlow = Flow::Normal;
+
+    for (Stmt const* statement : compoundStmt->statements) {
+        if (!executeStmt(statement, outFlow)) {
+            result = false;
+            break;
+        }
+
+        if (outFlow != Flow::Normal) {
+            break;
+        }
+    }
+
+    // Any variables declared within the compound statement go out of scope here
+    localVariables.resize(oldLocalVariableCount);
+
+    return result;
+}
+
+bool gulc::ConstInterpreter::executeForStmt(gulc::ForStmt const* forStmt, gulc::ConstInterpreter::Flow& outFlow) {
+    auto& localVariables = _frames.back().localVariables;
+    std::size_t oldLocalVariableCount = localVariables.size();
+    bool result = true;
+
+    outFlow = Flow::Normal;
+
+    if (forStmt->init != nullptr) {
+        ConstValue ignored;
+        result = evaluateFullExpr(forStmt->init, ignored);
+    }
+
+    while (result) {
+        if (!countStep(forStmt->startPosition(), forStmt->endPosition())) {
+            result = false;
+            break;
+        }
+
+        if (forStmt->condition != nullptr) {
+            bool conditionResult = false;
+
+            if (!evaluateCondition(forStmt->condition, conditionResult)) {
+                result = false;
+                break;
+            }
+
+            if (!conditionResult) {
+                break;
+            }
+        }
+
+        bool exitLoop = false;
+
+        if (!executeLoopBody(forStmt->body(), outFlow, exitLoop)) {
+            result = false;
+            break;
+        }
+
+        if (exitLoop) {
+            break;
+        }
+
+        if (forStmt->iteration != nullptr) {
+            ConstValue ignored;
+
+            if (!evaluateFullExpr(forStmt->iteration, ignored)) {
+                result = false;
+                break;
+            }
+        }
+    }
+
+    localVariables.resize(oldLocalVariableCount);
+
+    return result;
+}
+
+bool gulc::ConstInterpreter::executeIfStmt(gulc::IfStmt const* ifStmt, gulc::ConstInterpreter::Flow& outFlow) {
+    bool conditionResult = false;
+
+    if (!evaluateCondition(ifStmt->condition, conditionResult)) {
+        return false;
+    }
+
+    if (conditionResult) {
+        return executeCompoundStmt(ifStmt->trueBody(), outFlow);
+    } else if (ifStmt->hasFalseBody()) {
+        return executeStmt(ifStmt->falseBody(), outFlow);
+    }
+
+    outFlow = Flow::Normal;
+    return true;
+}
+
+bool gulc::ConstInterpreter::executeRepeatWhileStmt(gulc::RepeatWhileStmt const* repeatWhileStmt,
+                                                    gulc::ConstInterpreter::Flow& outFlow) {
+    while (true) {
+        if (!countStep(repeatWhileStmt->startPosition(), repeatWhileStmt->endPosition())) {
+            return false;
+        }
+
+        bool exitLoop = false;
+
+        if (!executeLoopBody(repeatWhileStmt->body(), outFlow, exitLoop)) {
+            return false;
+        }
+
+        if (exitLoop) {
+            return true;
+        }
+
+        bool conditionResult = false;
+
+        if (!evaluateCondition(repeatWhileStmt->condition, conditionResult)) {
+            return false;
+        }
+
+        if (!conditionResult) {
+            return true;
+        }
+    }
+}
+
+bool gulc::ConstInterpreter::executeReturnStmt(gulc::ReturnStmt const* returnStmt,
+                                               gulc::ConstInterpreter::Flow& outFlow) {
+    if (returnStmt->returnValue != nullptr) {
+        if (!evaluateFullExpr(returnStmt->returnValue, _frames.back().returnValue)) {
+            return false;
+        }
+    }
+
+    outFlow = Flow::Return;
+    return true;
+}
+
+bool gulc::ConstInterpreter::executeWhileStmt(gulc::WhileStmt const* whileStmt,
+                                              gulc::ConstInterpreter::Flow& outFlow) {
+    outFlow = Flow::Normal;
+
+    while (true) {
+        if (!countStep(whileStmt->startPosition(), whileStmt->endPosition())) {
+            return false;
+        }
+
+        bool conditionResult = false;
+
+        if (!evaluateCondition(whileStmt->condition, conditionResult)) {
+            return false;
+        }
+
+        if (!conditionResult) {
+            return true;
+        }
+
+        bool exitLoop = false;
+
+        if (!executeLoopBody(whileStmt->body(), outFlow, exitLoop)) {
+            return false;
+        }
+
+        if (exitLoop) {
+            return true;
+        }
+    }
+}
+
+bool gulc::ConstInterpreter::executeLoopBody(gulc::CompoundStmt const* body, gulc::ConstInterpreter::Flow& outFlow,
+                                             bool& outExitLoop) {
+    if (!executeCompoundStmt(body, outFlow)) {
+        return false;
+    }
+
+    switch (outFlow) {
+        case Flow::Break:
+            outFlow = Flow::Normal;
+            outExitLoop = true;
+            break;
+        case Flow::Continue:
+            outFlow = Flow::Normal;
+            outExitLoop = false;
+            break;
+        case Flow::Return:
+            outExitLoop = true;
+            break;
+        default:
+            outExitLoop = false;
+            break;
+    }
+
+    return true;
+}
+
+bool gulc::ConstInterpreter::evaluateCondition(gulc::Expr const* condition, bool& outResult) {
+    ConstValue conditionValue;
+
+    if (!evaluateFullExpr(condition, conditionValue)) {
+        return false;
+    }
+
+    if (conditionValue.kind != ConstValue::Kind::Bool) {
+        return fail("condition did not evaluate to a `bool`", condition->startPosition(), condition->endPosition());
+    }
+
+    outResult = conditionValue.boolValue;
+    return true;
+}
+
+bool gulc::ConstInterpreter::evaluateFullExpr(gulc::Expr const* expr, gulc::ConstValue& outValue) {
+    auto& temporaryValues = _frames.back().temporaryValues;
+    std::size_t oldTemporaryValueCount = temporaryValues.size();
+
+    bool result = evaluateExpr(expr, outValue);
+
+    temporaryValues.resize(oldTemporaryValueCount);
+
+    return result;
+}
+
+bool gulc::ConstInterpreter::evaluateExpr(gulc::Expr const* expr, gulc::ConstValue& outValue) {
+    switch (expr->getExprKind()) {
+        case Expr::Kind::ArrayLiteral:
+            return evaluateArrayLiteralExpr(llvm::dyn_cast<ArrayLiteralExpr>(expr), outValue);
+        case Expr::Kind::As: {
+            auto asExpr = llvm::dyn_cast<AsExpr>(expr);
+            ConstValue value;
+
+            if (!evaluateExpr(asExpr->expr, value)) {
+                return false;
+            }
+
+            return convertValue(value, asExpr->asType, outValue, asExpr->startPosition(), asExpr->endPosition());
+        }
+        case Expr::Kind::AssignmentOperator:
+            return evaluateAssignmentOperatorExpr(llvm::dyn_cast<AssignmentOperatorExpr>(expr), outValue);
+        case Expr::Kind::BoolLiteral:
+            outValue = ConstValue();
+            outValue.kind = ConstValue::Kind::Bool;
+            outValue.boolValue = llvm::dyn_cast<BoolLiteralExpr>(expr)->value();
+            return true;
+        case Expr::Kind::EnumConstRef: {
+            auto enumConstRefExpr = llvm::dyn_cast<EnumConstRefExpr>(expr);
+
+            return evaluateExpr(enumConstRefExpr->enumConst()->constValue, outValue);
+        }
+        case Expr::Kind::FunctionCall:
+            return evaluateFunctionCallExpr(llvm::dyn_cast<FunctionCallExpr>(expr), outValue);
+        case Expr::Kind::ImplicitCast: {
+            auto implicitCastExpr = llvm::dyn_cast<ImplicitCastExpr>(expr);
+            ConstValue value;
+
+            if (!evaluateExpr(implicitCastExpr->expr, value)) {
+                return false;
+            }
+
+            return convertValue(value, implicitCastExpr->castToType, outValue,
+                                implicitCastExpr->startPosition(), implicitCastExpr->endPosition());
+        }
+        case Expr::Kind::InfixOperator:
+            return evaluateInfixOperatorExpr(llvm::dyn_cast<InfixOperatorExpr>(expr), outValue);
+        case Expr::Kind::LValueToRValue:
+            return evaluateExpr(llvm::dyn_cast<LValueToRValueExpr>(expr)->lvalue, outValue);
+        case Expr::Kind::FlatArrayIndex:
+        case Expr::Kind::LocalVariableRef:
+        case Expr::Kind::ParameterRef:
+        case Expr::Kind::TemporaryValueRef:
+        case Expr::Kind::VariableRef: {
+            ConstValue* location = nullptr;
+
+            if (!evaluateLValue(expr, location)) {
+                return false;
+            }
+
+            if (!checkInitialized(*location, expr->startPosition(), expr->endPosition())) {
+                return false;
+            }
+
+            outValue = *location;
+            return true;
+        }
+        case Expr::Kind::Paren:
+            return evaluateExpr(llvm::dyn_cast<ParenExpr>(expr)->nestedExpr, outValue);
+        case Expr::Kind::PostfixOperator:
+            return evaluatePostfixOperatorExpr(llvm::dyn_cast<PostfixOperatorExpr>(expr), outValue);
+        case Expr::Kind::PrefixOperator:
+            return evaluatePrefixOperatorExpr(llvm::dyn_cast<PrefixOperatorExpr>(expr), outValue);
+        case Expr::Kind::SolvedConst:
+            return evaluateExpr(llvm::dyn_cast<SolvedConstExpr>(expr)->solution, outValue);
+        case Expr::Kind::StoreTemporaryValue:
+            // The temporary value is only needed if something references it, which is handled in `evaluateLValue`
+            return evaluateExpr(llvm::dyn_cast<StoreTemporaryValueExpr>(expr)->storeValue, outValue);
+        case Expr::Kind::Ternary: {
+            auto ternaryExpr = llvm::dyn_cast<TernaryExpr>(expr);
+            bool conditionResult = false;
+
+            if (!evaluateCondition(ternaryExpr->condition, conditionResult)) {
+                return false;
+            }
+
+            if (conditionResult) {
+                return evaluateExpr(ternaryExpr->trueExpr, outValue);
+            } else {
+                return evaluateExpr(ternaryExpr->falseExpr, outValue);
+            }
+        }
+        case Expr::Kind::ValueLiteral:
+            return evaluateValueLiteralExpr(llvm::dyn_cast<ValueLiteralExpr>(expr), outValue);
+        case Expr::Kind::VariableDecl:
+            return evaluateVariableDeclExpr(llvm::dyn_cast<VariableDeclExpr>(expr), outValue);
+        default:
+            return fail("`" + expr->toString() + "` cannot be evaluated at compile time",
+                        expr->startPosition(), expr->endPosition());
+    }
+}
+
+bool gulc::ConstInterpreter::evaluateLValue(gulc::Expr const* expr, gulc::ConstValue*& outLocation) {
+    switch (expr->getExprKind()) {
+        case Expr::Kind::FlatArrayIndex: {
+            auto flatArrayIndexExpr = llvm::dyn_cast<FlatArrayIndexExpr>(expr);
+            ConstValue* arrayLocation = nullptr;
+            ConstValue index;
+
+            if (!evaluateLValue(flatArrayIndexExpr->array, arrayLocation) ||
+                    !evaluateExpr(flatArrayIndexExpr->index, index)) {
+                return false;
+            }
+
+            if (arrayLocation->kind != ConstValue::Kind::Array || index.kind != ConstValue::Kind::Integer) {
+                return fail("invalid array index in compile time evaluation",
+                            flatArrayIndexExpr->startPosition(), flatArrayIndexExpr->endPosition());
+            }
+
+            std::size_t length = arrayLocation->elements.size();
+
+            if ((index.isSigned && signExtendInteger(index.integerValue, index.integerBits) < 0) ||
+                    index.integerValue >= length) {
+                std::string indexString = index.isSigned
+                        ? std::to_string(signExtendInteger(index.integerValue, index.integerBits))
+                        : std::to_string(index.integerValue);
+
+                return fail("index `" + indexString + "` is out of bounds for an array of length `" +
+                            std::to_string(length) + "`",
+                            flatArrayIndexExpr->index->startPosition(), flatArrayIndexExpr->index->endPosition());
+            }
+
+            outLocation = &arrayLocation->elements[index.integerValue];
+            return true;
+        }
+        case Expr::Kind::LocalVariableRef: {
+            auto localVariableRefExpr = llvm::dyn_cast<LocalVariableRefExpr>(expr);
+
+            outLocation = findLocalVariable(localVariableRefExpr->variableName());
+
+            if (outLocation == nullptr) {
+                return failRuntimeValue("local variable `" + localVariableRefExpr->variableName() + "` is not "
+                                        "known at compile time",
+                                        expr->startPosition(), expr->endPosition());
+            }
+
+            return true;
+        }
+        case Expr::Kind::ParameterRef: {
+            auto parameterRefExpr = llvm::dyn_cast<ParameterRefExpr>(expr);
+            auto& parameters = _frames.back().parameters;
+
+            if (parameterRefExpr->parameterIndex() >= parameters.size()) {
+                return failRuntimeValue("parameter `" + parameterRefExpr->parameterRef() + "` is not known at "
+                                        "compile time",
+                                        expr->startPosition(), expr->endPosition());
+            }
+
+            outLocation = &parameters[parameterRefExpr->parameterIndex()];
+            return true;
+        }
+        case Expr::Kind::Paren:
+            return evaluateLValue(llvm::dyn_cast<ParenExpr>(expr)->nestedExpr, outLocation);
+        case Expr::Kind::StoreTemporaryValue: {
+            auto storeTemporaryValueExpr = llvm::dyn_cast<StoreTemporaryValueExpr>(expr);
+            ConstValue value;
+
+            if (!evaluateExpr(storeTemporaryValueExpr->storeValue, value)) {
+                return false;
+            }
+
+            auto& temporaryValues = _frames.back().temporaryValues;
+            temporaryValues.emplace_back(storeTemporaryValueExpr->temporaryValue->temporaryName(), value);
+            outLocation = &temporaryValues.back().second;
+            return true;
+        }
+        case Expr::Kind::TemporaryValueRef: {
+            auto temporaryValueRefExpr = llvm::dyn_cast<TemporaryValueRefExpr>(expr);
+            auto& temporaryValues = _frames.back().temporaryValues;
+
+            for (auto temporaryValue = temporaryValues.rbegin(); temporaryValue != temporaryValues.rend();
+                    ++temporaryValue) {
+                if (temporaryValue->first == temporaryValueRefExpr->temporaryName()) {
+                    outLocation = &temporaryValue->second;
+                    return true;
+                }
+            }
+
+            return failRuntimeValue("temporary value `" + temporaryValueRefExpr->temporaryName() + "` is not "
+                                    "known at compile time",
+                                    expr->startPosition(), expr->endPosition());
+        }
+        case Expr::Kind::VariableRef: {
+            auto variableDecl = llvm::dyn_cast<VariableRefExpr>(expr)->variableDecl;
+
+            if (!variableDecl->isConstExpr() || !variableDecl->hasInitialValue()) {
+                return failRuntimeValue("variable `" + variableDecl->identifier().name() + "` is not `const`",
+                                        expr->startPosition(), expr->endPosition());
+            }
+
+            auto foundVariable = _constVariables.find(variableDecl);
+
+            if (foundVariable != _constVariables.end()) {
+                outLocation = &foundVariable->second;
+                return true;
+            }
+
+            // We insert an uninitialized value before solving so a variable that references itself is caught by
+            // `checkInitialized` instead of recursing forever
+            outLocation = &_constVariables[variableDecl];
+
+            ConstValue initialValue;
+
+            if (!evaluateFullExpr(variableDecl->initialValue, initialValue) ||
+                    !convertValue(initialValue, variableDecl->type, *outLocation,
+                                  expr->startPosition(), expr->endPosition())) {
+                return false;
+            }
+
+            return true;
+        }
+        default: {
+            // Anything else is an rvalue, we store it in a temporary value so it can be used as an lvalue
+            ConstValue value;
+
+            if (!evaluateExpr(expr, value)) {
+                return false;
+            }
+
+            auto& temporaryValues = _frames.back().temporaryValues;
+            temporaryValues.emplace_back(std::string(), value);
+            outLocation = &temporaryValues.back().second;
+            return true;
+        }
+    }
+}
+
+bool gulc::ConstInterpreter::evaluateArrayLiteralExpr(gulc::ArrayLiteralExpr const* arrayLiteralExpr,
+                                                      gulc::ConstValue& outValue) {
+    Type const* elementType = nullptr;
+
+    if (arrayLiteralExpr->valueType != nullptr && llvm::isa<FlatArrayType>(arrayLiteralExpr->valueType)) {
+        elementType = llvm::dyn_cast<FlatArrayType>(arrayLiteralExpr->valueType)->indexType;
+    }
+
+    _arrayElements += arrayLiteralExpr->indexes.size();
+
+    if (_arrayElements > maxArrayElements) {
+        return fail("exceeded the maximum of " + std::to_string(maxArrayElements) + " array elements allowed for "
+                    "compile time evaluation",
+                    arrayLiteralExpr->startPosition(), arrayLiteralExpr->endPosition());
+    }
+
+    outValue = ConstValue();
+    outValue.kind = ConstValue::Kind::Array;
+    outValue.elements.reserve(arrayLiteralExpr->indexes.size());
+
+    for (Expr const* index : arrayLiteralExpr->indexes) {
+        ConstValue element;
+
+        if (!evaluateExpr(index, element)) {
+            return false;
+        }
+
+        if (elementType != nullptr) {
+            ConstValue convertedElement;
+
+            if (!convertValue(element, elementType, convertedElement, index->startPosition(), index->endPosition())) {
+                return false;
+            }
+
+            outValue.elements.push_back(convertedElement);
+        } else {
+            outValue.elements.push_back(element);
+        }
+    }
+
+    return true;
+}
+
+bool gulc::ConstInterpreter::evaluateAssignmentOperatorExpr(
+        gulc::AssignmentOperatorExpr const* assignmentOperatorExpr, gulc::ConstValue& outValue) {
+    ConstValue rightValue;
+    ConstValue* leftLocation = nullptr;
+
+    if (!evaluateExpr(assignmentOperatorExpr->rightValue, rightValue) ||
+            !evaluateLValue(assignmentOperatorExpr->leftValue, leftLocation)) {
+        return false;
+    }
+
+    if (assignmentOperatorExpr->hasNestedOperator()) {
+        ConstValue result;
+
+        if (!evaluateInfixOperator(assignmentOperatorExpr->nestedOperator(), *leftLocation, rightValue, result,
+                                   assignmentOperatorExpr->startPosition(), assignmentOperatorExpr->endPosition())) {
+            return false;
+        }
+
+        *leftLocation = result;
+    } else {
+        *leftLocation = rightValue;
+    }
+
+    outValue = *leftLocation;
+    return true;
+}
+
+bool gulc::ConstInterpreter::evaluateFunctionCallExpr(gulc::FunctionCallExpr const* functionCallExpr,
+                                                      gulc::ConstValue& outValue) {
+    if (!llvm::isa<FunctionReferenceExpr>(functionCallExpr->functionReference)) {
+        return fail("only direct calls to `const` functions can be evaluated at compile time",
+                    functionCallExpr->startPosition(), functionCallExpr->endPosition());
+    }
+
+    FunctionDecl const* functionDecl =
+            llvm::dyn_cast<FunctionReferenceExpr>(functionCallExpr->functionReference)->functionDecl();
+
+    if (!functionDecl->isConstExpr() || functionDecl->body() == nullptr) {
+        return fail("function `" + functionDecl->identifier().name() + "` is not `const`",
+                    functionCallExpr->startPosition(), functionCallExpr->endPosition());
+    }
+
+    if (!countStep(functionCallExpr->startPosition(), functionCallExpr->endPosition())) {
+        return false;
+    }
+
+    if (_frames.size() > maxCallDepth) {
+        return fail("exceeded the maximum call depth of " + std::to_string(maxCallDepth) + " allowed for compile "
+                    "time evaluation",
+                    functionCallExpr->startPosition(), functionCallExpr->endPosition());
+    }
+
+    auto const& parameters = functionDecl->parameters();
+    std::vector<ConstValue> argumentValues;
+    argumentValues.reserve(parameters.size());
+
+    for (std::size_t i = 0; i < parameters.size(); ++i) {
+        ParameterDecl const* parameter = parameters[i];
+        Expr const* argument = nullptr;
+
+        if (parameter->parameterKind() != ParameterDecl::ParameterKind::Val) {
+            return fail("`in` and `out` parameters are not supported in compile time evaluation",
+                        parameter->startPosition(), parameter->endPosition());
+        }
+
+        if (i < functionCallExpr->arguments.size()) {
+            argument = functionCallExpr->arguments[i]->argument;
+        } else if (parameter->defaultValue != nullptr) {
+            argument = parameter->defaultValue;
+        } else {
+            return fail("missing argument for parameter `" + parameter->identifier().name() + "`",
+                        functionCallExpr->startPosition(), functionCallExpr->endPosition());
+        }
+
+        ConstValue argumentValue;
+        ConstValue convertedArgumentValue;
+
+        if (!evaluateExpr(argument, argumentValue) ||
+                !checkInitialized(argumentValue, argument->startPosition(), argument->endPosition()) ||
+                !convertValue(argumentValue, parameter->type, convertedArgumentValue,
+                              argument->startPosition(), argument->endPosition())) {
+            return false;
+        }
+
+        argumentValues.push_back(convertedArgumentValue);
+    }
+
+    _frames.emplace_back();
+    _frames.back().parameters = std::move(argumentValues);
+
+    Flow flow = Flow::Normal;
+    bool result = executeCompoundStmt(functionDecl->body(), flow);
+    ConstValue returnValue = _frames.back().returnValue;
+
+    _frames.pop_back();
+
+    if (!result) {
+        return false;
+    }
+
+    if (functionDecl->returnType == nullptr) {
+        outValue = ConstValue();
+        return true;
+    }
+
+    if (returnValue.kind == ConstValue::Kind::Uninitialized) {
+        return fail("function `" + functionDecl->identifier().name() + "` did not return a value",
+                    functionCallExpr->startPosition(), functionCallExpr->endPosition());
+    }
+
+    return convertValue(returnValue, functionDecl->returnType, outValue,
+                        functionCallExpr->startPosition(), functionCallExpr->endPosition());
+}
+
+bool gulc::ConstInterpreter::evaluateInfixOperatorExpr(gulc::InfixOperatorExpr const* infixOperatorExpr,
+                                                       gulc::ConstValue& outValue) {
+    InfixOperators infixOperator = infixOperatorExpr->infixOperator();
+
+    // `&&` and `||` have to short circuit so the right side is only evaluated when needed
+    if (infixOperator == InfixOperators::LogicalAnd || infixOperator == InfixOperators::LogicalOr) {
+        bool leftResult = false;
+
+        if (!evaluateCondition(infixOperatorExpr->leftValue, leftResult)) {
+            return false;
+        }
+
+        outValue = ConstValue();
+        outValue.kind = ConstValue::Kind::Bool;
+
+        if (leftResult == (infixOperator == InfixOperators::LogicalOr)) {
+            outValue.boolValue = leftResult;
+            return true;
+        }
+
+        return evaluateCondition(infixOperatorExpr->rightValue, outValue.boolValue);
+    }
+
+    ConstValue leftValue;
+    ConstValue rightValue;
+
+    if (!evaluateExpr(infixOperatorExpr->leftValue, leftValue) ||
+            !evaluateExpr(infixOperatorExpr->rightValue, rightValue)) {
+        return false;
+    }
+
+    return evaluateInfixOperator(infixOperator, leftValue, rightValue, outValue,
+                                 infixOperatorExpr->startPosition(), infixOperatorExpr->endPosition());
+}
+
+bool gulc::ConstInterpreter::evaluateInfixOperator(gulc::InfixOperators infixOperator, gulc::ConstValue const& left,
+                                                   gulc::ConstValue const& right, gulc::ConstValue& outValue,
+                                                   gulc::TextPosition startPosition,
+                                                   gulc::TextPosition endPosition) {
+    if (!checkInitialized(left, startPosition, endPosition) ||
+            !checkInitialized(right, startPosition, endPosition)) {
+        return false;
+    }
+
+    if (left.kind != right.kind) {
+        return fail("operands of `" + getInfixOperatorStringValue(infixOperator) + "` have mismatched types in compile "
+                    "time evaluation", startPosition, endPosition);
+    }
+
+    ConstValue result;
+
+    // Comparisons always result in a `bool`, we set `kind` to the operand kind for the arithmetic operators below
+    result.kind = ConstValue::Kind::Bool;
+
+    switch (left.kind) {
+        case ConstValue::Kind::Bool:
+            switch (infixOperator) {
+                case InfixOperators::EqualTo:
+                    result.boolValue = left.boolValue == right.boolValue;
+                    break;
+                case InfixOperators::NotEqualTo:
+                    result.boolValue = left.boolValue != right.boolValue;
+                    break;
+                case InfixOperators::BitwiseAnd:
+                case InfixOperators::LogicalAnd:
+                    result.boolValue = left.boolValue && right.boolValue;
+                    break;
+                case InfixOperators::BitwiseOr:
+                case InfixOperators::LogicalOr:
+                    result.boolValue = left.boolValue || right.boolValue;
+                    break;
+                case InfixOperators::BitwiseXor:
+                    result.boolValue = left.boolValue != right.boolValue;
+                    break;
+                default:
+                    return fail("operator `" + getInfixOperatorStringValue(infixOperator) + "` is not supported for "
+                                "`bool` in compile time evaluation", startPosition, endPosition);
+            }
+            break;
+        case ConstValue::Kind::Float: {
+            double leftFloat = left.floatValue;
+            double rightFloat = right.floatValue;
+            bool isComparison = false;
+
+            switch (infixOperator) {
+                case InfixOperators::Add:
+                    result.floatValue = leftFloat + rightFloat;
+                    break;
+                case InfixOperators::Subtract:
+                    result.floatValue = leftFloat - rightFloat;
+                    break;
+                case InfixOperators::Multiply:
+                    result.floatValue = leftFloat * rightFloat;
+                    break;
+                case InfixOperators::Divide:
+                    result.floatValue = leftFloat / rightFloat;
+                    break;
+                case InfixOperators::Remainder:
+                    result.floatValue = std::fmod(leftFloat, rightFloat);
+                    break;
+                case InfixOperators::Power:
+                    result.floatValue = std::pow(leftFloat, rightFloat);
+                    break;
+                case InfixOperators::EqualTo:
+                    isComparison = true;
+                    result.boolValue = leftFloat == rightFloat;
+                    break;
+                case InfixOperators::NotEqualTo:
+                    isComparison = true;
+                    result.boolValue = leftFloat != rightFloat;
+                    break;
+                case InfixOperators::GreaterThan:
+                    isComparison = true;
+                    result.boolValue = leftFloat > rightFloat;
+                    break;
+                case InfixOperators::LessThan:
+                    isComparison = true;
+                    result.boolValue = leftFloat < rightFloat;
+                    break;
+                case InfixOperators::GreaterThanEqualTo:
+                    isComparison = true;
+                    result.boolValue = leftFloat >= rightFloat;
+                    break;
+                case InfixOperators::LessThanEqualTo:
+                    isComparison = true;
+                    result.boolValue = leftFloat <= rightFloat;
+                    break;
+                default:
+                    return fail("operator `" + getInfixOperatorStringValue(infixOperator) + "` is not supported for "
+                                "floating point values in compile time evaluation", startPosition, endPosition);
+            }
+
+            if (!isComparison) {
+                result.kind = ConstValue::Kind::Float;
+                result.isDouble = left.isDouble;
+                result.floatValue = roundFloat(result.floatValue, left.isDouble);
+            }
+            break;
+        }
+        case ConstValue::Kind::Integer: {
+            unsigned short bits = left.integerBits;
+            bool isSigned = left.isSigned;
+            std::uint64_t leftInteger = left.integerValue;
+            std::uint64_t rightInteger = right.integerValue;
+            std::int64_t leftSigned = signExtendInteger(leftInteger, bits);
+            std::int64_t rightSigned = signExtendInteger(rightInteger, right.integerBits);
+            std::uint64_t integerResult = 0;
+            bool isComparison = false;
+
+            switch (infixOperator) {
+                case InfixOperators::Add:
+                    integerResult = leftInteger + rightInteger;
+                    break;
+                case InfixOperators::Subtract:
+                    integerResult = leftInteger - rightInteger;
+                    break;
+                case InfixOperators::Multiply:
+                    integerResult = leftInteger * rightInteger;
+                    break;
+                case InfixOperators::Divide:
+                case InfixOperators::Remainder: {
+                    if (rightInteger == 0) {
+                        return fail("division by zero in compile time evaluation", startPosition, endPosition);
+                    }
+
+                    bool isDivide = infixOperator == InfixOperators::Divide;
+
+                    if (isSigned) {
+                        // The minimum value divided by `-1` overflows
+                        if (rightSigned == -1) {
+                            integerResult = isDivide ? 0 - leftInteger : 0;
+                        } else {
+                            integerResult = static_cast<std::uint64_t>(isDivide ? leftSigned / rightSigned
+                                                                                : leftSigned % rightSigned);
+                        }
+                    } else {
+                        integerResult = isDivide ? leftInteger / rightInteger : leftInteger % rightInteger;
+                    }
+                    break;
+                }
+                case InfixOperators::Power: {
+                    if (isSigned && rightSigned < 0) {
+                        return fail("negative exponent for an integer in compile time evaluation",
+                                    startPosition, endPosition);
+                    }
+
+                    std::uint64_t base = leftInteger;
+                    std::uint64_t exponent = rightInteger;
+                    integerResult = 1;
+
+                    while (exponent != 0) {
+                        if ((exponent & 1u) != 0) {
+                            integerResult *= base;
+                        }
+
+                        base *= base;
+                        exponent >>= 1u;
+                    }
+                    break;
+                }
+                case InfixOperators::BitwiseAnd:
+                    integerResult = leftInteger & rightInteger;
+                    break;
+                case InfixOperators::BitwiseOr:
+                    integerResult = leftInteger | rightInteger;
+                    break;
+                case InfixOperators::BitwiseXor:
+                    integerResult = leftInteger ^ rightInteger;
+                    break;
+                case InfixOperators::BitshiftLeft:
+                case InfixOperators::BitshiftRight: {
+                    if ((right.isSigned && rightSigned < 0) || rightInteger >= bits) {
+                        return fail("shift amount is out of range for a " + std::to_string(bits) + "-bit integer "
+                                    "in compile time evaluation", startPosition, endPosition);
+                    }
+
+                    if (infixOperator == InfixOperators::BitshiftLeft) {
+                        integerResult = leftInteger << rightInteger;
+                    } else if (isSigned && leftSigned < 0) {
+                        // Arithmetic shift, written so we don't rely on the host's handling of negative shifts
+                        integerResult = ~(~static_cast<std::uint64_t>(leftSigned) >> rightInteger);
+                    } else {
+                        integerResult = leftInteger >> rightInteger;
+                    }
+                    break;
+                }
+                case InfixOperators::EqualTo:
+                    isComparison = true;
+                    result.boolValue = leftInteger == rightInteger;
+                    break;
+                case InfixOperators::NotEqualTo:
+                    isComparison = true;
+                    result.boolValue = leftInteger != rightInteger;
+                    break;
+                case InfixOperators::GreaterThan:
+                    isComparison = true;
+                    result.boolValue = isSigned ? leftSigned > rightSigned : leftInteger > rightInteger;
+                    break;
+                case InfixOperators::LessThan:
+                    isComparison = true;
+                    result.boolValue = isSigned ? leftSigned < rightSigned : leftInteger < rightInteger;
+                    break;
+                case InfixOperators::GreaterThanEqualTo:
+                    isComparison = true;
+                    result.boolValue = isSigned ? leftSigned >= rightSigned : leftInteger >= rightInteger;
+                    break;
+                case InfixOperators::LessThanEqualTo:
+                    isComparison = true;
+                    result.boolValue = isSigned ? leftSigned <= rightSigned : leftInteger <= rightInteger;
+                    break;
+                default:
+                    return fail("operator `" + getInfixOperatorStringValue(infixOperator) + "` is not supported for "
+                                "integers in compile time evaluation", startPosition, endPosition);
+            }
+
+            if (!isComparison) {
+                result.kind = ConstValue::Kind::Integer;
+                result.integerBits = bits;
+                result.isSigned = isSigned;
+                result.integerValue = truncateInteger(integerResult, bits);
+            }
+            break;
+        }
+        default:
+            return fail("operator `" + getInfixOperatorStringValue(infixOperator) + "` is not supported for arrays in "
+                        "compile time evaluation", startPosition, endPosition);
+    }
+
+    outValue = result;
+    return true;
+}
+
+bool gulc::ConstInterpreter::evaluatePostfixOperatorExpr(gulc::PostfixOperatorExpr const* postfixOperatorExpr,
+                                                         gulc::ConstValue& outValue) {
+    ConstValue* location = nullptr;
+
+    if (!evaluateLValue(postfixOperatorExpr->nestedExpr, location) ||
+            !checkInitialized(*location, postfixOperatorExpr->startPosition(), postfixOperatorExpr->endPosition())) {
+        return false;
+    }
+
+    // Postfix operators result in the value from before the operator was applied
+    outValue = *location;
+
+    ConstValue one = *location;
+    one.integerValue = 1;
+    one.floatValue = 1.0;
+
+    InfixOperators infixOperator = postfixOperatorExpr->postfixOperator() == PostfixOperators::Increment
+            ? InfixOperators::Add
+            : InfixOperators::Subtract;
+
+    return evaluateInfixOperator(infixOperator, outValue, one, *location,
+                                 postfixOperatorExpr->startPosition(), postfixOperatorExpr->endPosition());
+}
+
+bool gulc::ConstInterpreter::evaluatePrefixOperatorExpr(gulc::PrefixOperatorExpr const* prefixOperatorExpr,
+                                                        gulc::ConstValue& outValue) {
+    TextPosition startPosition = prefixOperatorExpr->startPosition();
+    TextPosition endPosition = prefixOperatorExpr->endPosition();
+
+    switch (prefixOperatorExpr->prefixOperator()) {
+        case PrefixOperators::Increment:
+        case PrefixOperators::Decrement: {
+            ConstValue* location = nullptr;
+
+            if (!evaluateLValue(prefixOperatorExpr->nestedExpr, location) ||
+                    !checkInitialized(*location, startPosition, endPosition)) {
+                return false;
+            }
+
+            ConstValue one = *location;
+            one.integerValue = 1;
+            one.floatValue = 1.0;
+
+            InfixOperators infixOperator = prefixOperatorExpr->prefixOperator() == PrefixOperators::Increment
+                    ? InfixOperators::Add
+                    : InfixOperators::Subtract;
+
+            if (!evaluateInfixOperator(infixOperator, *location, one, *location, startPosition, endPosition)) {
+                return false;
+            }
+
+            outValue = *location;
+            return true;
+        }
+        case PrefixOperators::Positive:
+        case PrefixOperators::Negative:
+        case PrefixOperators::LogicalNot:
+        case PrefixOperators::BitwiseNot:
+            break;
+        default:
+            return fail("operator `" + prefixOperatorExpr->toString() + "` cannot be evaluated at compile time",
+                        startPosition, endPosition);
+    }
+
+    ConstValue value;
+
+    if (!evaluateExpr(prefixOperatorExpr->nestedExpr, value) ||
+            !checkInitialized(value, startPosition, endPosition)) {
+        return false;
+    }
+
+    outValue = value;
+
+    switch (prefixOperatorExpr->prefixOperator()) {
+        case PrefixOperators::Positive:
+            if (value.kind == ConstValue::Kind::Integer || value.kind == ConstValue::Kind::Float) {
+                return true;
+            }
+            break;
+        case PrefixOperators::Negative:
+            if (value.kind == ConstValue::Kind::Integer) {
+                outValue.integerValue = truncateInteger(0 - value.integerValue, value.integerBits);
+                return true;
+            } else if (value.kind == ConstValue::Kind::Float) {
+                outValue.floatValue = -value.floatValue;
+                return true;
+            }
+            break;
+        case PrefixOperators::LogicalNot:
+            if (value.kind == ConstValue::Kind::Bool) {
+                outValue.boolValue = !value.boolValue;
+                return true;
+            }
+            break;
+        case PrefixOperators::BitwiseNot:
+            if (value.kind == ConstValue::Kind::Integer) {
+                outValue.integerValue = truncateInteger(~value.integerValue, value.integerBits);
+                return true;
+            } else if (value.kind == ConstValue::Kind::Bool) {
+                outValue.boolValue = !value.boolValue;
+                return true;
+            }
+            break;
+        default:
+            break;
+    }
+
+    return fail("operator `" + prefixOperatorExpr->toString() + "` is not supported for this type in compile time "
+                "evaluation", startPosition, endPosition);
+}
+
+bool gulc::ConstInterpreter::evaluateValueLiteralExpr(gulc::ValueLiteralExpr const* valueLiteralExpr,
+                                                      gulc::ConstValue& outValue) {
+    if (valueLiteralExpr->hasSuffix()) {
+        return fail("value literals with suffixes cannot be evaluated at compile time",
+                    valueLiteralExpr->startPosition(), valueLiteralExpr->endPosition());
+    }
+
+    auto builtInType = llvm::dyn_cast_or_null<BuiltInType>(valueLiteralExpr->valueType);
+    std::string const& value = valueLiteralExpr->value();
+
+    outValue = ConstValue();
+    errno = 0;
+
+    switch (valueLiteralExpr->literalType()) {
+        case ValueLiteralExpr::LiteralType::Integer: {
+            char* end = nullptr;
+            std::uint64_t integerValue = std::strtoull(value.c_str(), &end, 10);
+
+            if (errno != 0 || end == value.c_str() || *end != '\0') {
+                return fail("integer literal `" + value + "` is out of range",
+                            valueLiteralExpr->startPosition(), valueLiteralExpr->endPosition());
+            }
+
+            if (builtInType != nullptr && builtInType->isFloating()) {
+                outValue.kind = ConstValue::Kind::Float;
+                outValue.isDouble = builtInType->sizeInBytes() == 8;
+                outValue.floatValue = roundFloat(static_cast<double>(integerValue), outValue.isDouble);
+            } else {
+                outValue.kind = ConstValue::Kind::Integer;
+                // Literals without a type default to `i32`, the same as `CodeGen`
+                outValue.integerBits = builtInType == nullptr ? 32 : builtInType->sizeInBytes() * 8;
+                outValue.isSigned = builtInType == nullptr || builtInType->isSigned();
+                outValue.integerValue = truncateInteger(integerValue, outValue.integerBits);
+            }
+
+            return true;
+        }
+        case ValueLiteralExpr::LiteralType::Float: {
+            char* end = nullptr;
+            double floatValue = std::strtod(value.c_str(), &end);
+
+            if (end == value.c_str() || *end != '\0') {
+                return fail("invalid float literal `" + value + "`",
+                            valueLiteralExpr->startPosition(), valueLiteralExpr->endPosition());
+            }
+
+            outValue.kind = ConstValue::Kind::Float;
+            outValue.isDouble = builtInType != nullptr && builtInType->sizeInBytes() == 8;
+            outValue.floatValue = roundFloat(floatValue, outValue.isDouble);
+            return true;
+        }
+        default:
+            return fail("character and string literals cannot be evaluated at compile time",
+                        valueLiteralExpr->startPosition(), valueLiteralExpr->endPosition());
+    }
+}
+
+bool gulc::ConstInterpreter::evaluateVariableDeclExpr(gulc::VariableDeclExpr const* variableDeclExpr,
+                                                      gulc::ConstValue& outValue) {
+    ConstValue value;
+
+    if (variableDeclExpr->initialValue != nullptr) {
+        ConstValue initialValue;
+
+        if (!evaluateExpr(variableDeclExpr->initialValue, initialValue)) {
+            return false;
+        }
+
+        if (variableDeclExpr->type != nullptr) {
+            if (!convertValue(initialValue, variableDeclExpr->type, value,
+                              variableDeclExpr->startPosition(), variableDeclExpr->endPosition())) {
+                return false;
+            }
+        } else {
+            value = initialValue;
+        }
+    } else if (!createDefaultValue(variableDeclExpr->type, value,
+                                   variableDeclExpr->startPosition(), variableDeclExpr->endPosition())) {
+        return false;
+    }
+
+    auto& localVariables = _frames.back().localVariables;
+    localVariables.emplace_back(variableDeclExpr->identifier().name(), value);
+    outValue = value;
+    return true;
+}
+
+bool gulc::ConstInterpreter::convertValue(gulc::ConstValue const& value, gulc::Type const* toType,
+                                          gulc::ConstValue& outValue,
+                                          gulc::TextPosition startPosition, gulc::TextPosition endPosition) {
+    if (!checkInitialized(value, startPosition, endPosition)) {
+        return false;
+    }
+
+    if (toType == nullptr) {
+        outValue = value;
+        return true;
+    }
+
+    if (llvm::isa<EnumType>(toType)) {
+        Type const* constType = llvm::dyn_cast<EnumType>(toType)->decl()->constType;
+
+        if (constType == nullptr) {
+            // Enums default to `i32`
+            outValue = value;
+            return true;
+        }
+
+        return convertValue(value, constType, outValue, startPosition, endPosition);
+    }
+
+    if (llvm::isa<BoolType>(toType)) {
+        if (value.kind != ConstValue::Kind::Bool) {
+            return fail("cannot convert to `bool` in compile time evaluation", startPosition, endPosition);
+        }
+
+        outValue = value;
+        return true;
+    }
+
+    if (llvm::isa<FlatArrayType>(toType)) {
+        auto flatArrayType = llvm::dyn_cast<FlatArrayType>(toType);
+
+        if (value.kind != ConstValue::Kind::Array) {
+            return fail("cannot convert to `" + toType->toString() + "` in compile time evaluation",
+                        startPosition, endPosition);
+        }
+
+        std::uint64_t length = 0;
+
+        if (getArrayLength(flatArrayType->length, length) && length != value.elements.size()) {
+            return fail("expected `" + std::to_string(length) + "` elements for `" + toType->toString() +
+                        "`, found `" + std::to_string(value.elements.size()) + "`", startPosition, endPosition);
+        }
+
+        ConstValue result;
+        result.kind = ConstValue::Kind::Array;
+        result.elements.reserve(value.elements.size());
+
+        for (ConstValue const& element : value.elements) {
+            ConstValue convertedElement;
+
+            if (!convertValue(element, flatArrayType->indexType, convertedElement, startPosition, endPosition)) {
+                return false;
+            }
+
+            result.elements.push_back(convertedElement);
+        }
+
+        outValue = std::move(result);
+        return true;
+    }
+
+    if (!llvm::isa<BuiltInType>(toType) || llvm::dyn_cast<BuiltInType>(toType)->sizeInBytes() == 0) {
+        return fail("type `" + toType->toString() + "` is not supported in compile time evaluation",
+                    startPosition, endPosition);
+    }
+
+    auto builtInType = llvm::dyn_cast<BuiltInType>(toType);
+    ConstValue result;
+
+    if (builtInType->isFloating()) {
+        result.kind = ConstValue::Kind::Float;
+        result.isDouble = builtInType->sizeInBytes() == 8;
+
+        if (value.kind == ConstValue::Kind::Float) {
+            result.floatValue = value.floatValue;
+        } else if (value.kind == ConstValue::Kind::Integer) {
+            result.floatValue = value.isSigned
+                    ? static_cast<double>(signExtendInteger(value.integerValue, value.integerBits))
+                    : static_cast<double>(value.integerValue);
+        } else {
+            return fail("cannot convert to `" + toType->toString() + "` in compile time evaluation",
+                        startPosition, endPosition);
+        }
+
+        result.floatValue = roundFloat(result.floatValue, result.isDouble);
+    } else {
+        result.kind = ConstValue::Kind::Integer;
+        result.integerBits = builtInType->sizeInBytes() * 8;
+        result.isSigned = builtInType->isSigned();
+
+        if (value.kind == ConstValue::Kind::Integer) {
+            // Sign extend before truncating so widening a signed value keeps its sign
+            std::uint64_t integerValue = value.isSigned
+                    ? static_cast<std::uint64_t>(signExtendInteger(value.integerValue, value.integerBits))
+                    : value.integerValue;
+            result.integerValue = truncateInteger(integerValue, result.integerBits);
+        } else if (value.kind == ConstValue::Kind::Float) {
+            double floatValue = std::trunc(value.floatValue);
+
+            // Converting an out of range float is undefined at runtime, we refuse to pick a value for it
+            if (!std::isfinite(floatValue) ||
+                    floatValue < (result.isSigned ? -9223372036854775808.0 : 0.0) ||
+                    floatValue >= (result.isSigned ? 9223372036854775808.0 : 18446744073709551616.0)) {
+                return fail("floating point value is out of range for `" + toType->toString() + "`",
+                            startPosition, endPosition);
+            }
+
+            std::uint64_t integerValue = result.isSigned
+                    ? static_cast<std::uint64_t>(static_cast<std::int64_t>(floatValue))
+                    : static_cast<std::uint64_t>(floatValue);
+            result.integerValue = truncateInteger(integerValue, result.integerBits);
+        } else {
+            return fail("cannot convert to `" + toType->toString() + "` in compile time evaluation",
+                        startPosition, endPosition);
+        }
+    }
+
+    outValue = result;
+    return true;
+}
+
+bool gulc::ConstInterpreter::createDefaultValue(gulc::Type const* type, gulc::ConstValue& outValue,
+                                                gulc::TextPosition startPosition, gulc::TextPosition endPosition) {
+    outValue = ConstValue();
+
+    if (type == nullptr || !llvm::isa<FlatArrayType>(type)) {
+        // Variables without an initial value have to be assigned before they are read
+        return true;
+    }
+
+    auto flatArrayType = llvm::dyn_cast<FlatArrayType>(type);
+    std::uint64_t length = 0;
+
+    if (!getArrayLength(flatArrayType->length, length)) {
+        return fail("array length `" + flatArrayType->length->toString() + "` is not known at compile time",
+                    startPosition, endPosition);
+    }
+
+    _arrayElements += length;
+
+    if (_arrayElements > maxArrayElements) {
+        return fail("exceeded the maximum of " + std::to_string(maxArrayElements) + " array elements allowed for "
+                    "compile time evaluation", startPosition, endPosition);
+    }
+
+    outValue.kind = ConstValue::Kind::Array;
+    outValue.elements.resize(length);
+
+    for (ConstValue& element : outValue.elements) {
+        if (!createDefaultValue(flatArrayType->indexType, element, startPosition, endPosition)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool gulc::ConstInterpreter::getArrayLength(gulc::Expr const* length, std::uint64_t& outLength) {
+    auto valueLiteralExpr = llvm::dyn_cast_or_null<ValueLiteralExpr>(length);
+
+    if (valueLiteralExpr == nullptr || valueLiteralExpr->literalType() != ValueLiteralExpr::LiteralType::Integer) {
+        return false;
+    }
+
+    char* end = nullptr;
+    errno = 0;
+    outLength = std::strtoull(valueLiteralExpr->value().c_str(), &end, 10);
+
+    return errno == 0 && *end == '\0';
+}
+
+bool gulc::ConstInterpreter::checkInitialized(gulc::ConstValue const& value,
+                                              gulc::TextPosition startPosition, gulc::TextPosition endPosition) {
+    if (value.kind == ConstValue::Kind::Uninitialized) {
+        return fail("use of an uninitialized value in compile time evaluation", startPosition, endPosition);
+    }
+
+    return true;
+}
+
+gulc::Expr* gulc::ConstInterpreter::createLiteral(gulc::ConstValue const& value, gulc::Type const* type,
+                                                  gulc::TextPosition startPosition, gulc::TextPosition endPosition) {
+    switch (value.kind) {
+        case ConstValue::Kind::Bool: {
+            auto result = new BoolLiteralExpr(startPosition, endPosition, value.boolValue);
+            result->valueType = new BoolType(Type::Qualifier::Immut, startPosition, endPosition);
+            return result;
+        }
+        case ConstValue::Kind::Integer: {
+            std::string integerString = value.isSigned
+                    ? std::to_string(signExtendInteger(value.integerValue, value.integerBits))
+                    : std::to_string(value.integerValue);
+            std::string typeName = (value.isSigned ? "i" : "u") + std::to_string(value.integerBits);
+
+            auto result = new ValueLiteralExpr(ValueLiteralExpr::LiteralType::Integer, integerString, "",
+                                               startPosition, endPosition);
+            result->valueType = BuiltInType::get(Type::Qualifier::Immut, typeName, startPosition, endPosition);
+            return result;
+        }
+        case ConstValue::Kind::Float: {
+            if (!std::isfinite(value.floatValue)) {
+                fail("result is not a finite number", startPosition, endPosition);
+                return nullptr;
+            }
+
+            // `max_digits10` is the number of digits needed to get the exact same value back out of the string
+            std::ostringstream floatString;
+            floatString << std::setprecision(value.isDouble ? std::numeric_limits<double>::max_digits10
+                                                            : std::numeric_limits<float>::max_digits10)
+                        << value.floatValue;
+
+            auto result = new ValueLiteralExpr(ValueLiteralExpr::LiteralType::Float, floatString.str(), "",
+                                               startPosition, endPosition);
+            result->valueType = BuiltInType::get(Type::Qualifier::Immut, value.isDouble ? "f64" : "f32",
+                                                 startPosition, endPosition);
+            return result;
+        }
+        case ConstValue::Kind::Array: {
+            if (type == nullptr || !llvm::isa<FlatArrayType>(type)) {
+                fail("array result does not have an array type", startPosition, endPosition);
+                return nullptr;
+            }
+
+            auto flatArrayType = llvm::dyn_cast<FlatArrayType>(type);
+            std::vector<Expr*> indexes;
+            indexes.reserve(value.elements.size());
+
+            for (ConstValue const& element : value.elements) {
+                Expr* index = createLiteral(element, flatArrayType->indexType, startPosition, endPosition);
+
+                if (index == nullptr) {
+                    for (Expr* createdIndex : indexes) {
+                        delete createdIndex;
+                    }
+
+                    return nullptr;
+                }
+
+                indexes.push_back(index);
+            }
+
+            auto result = new ArrayLiteralExpr(indexes, startPosition, endPosition);
+            result->valueType = type->deepCopy();
+            result->valueType->setIsLValue(false);
+            return result;
+        }
+        default:
+            fail("expression did not result in a value", startPosition, endPosition);
+            return nullptr;
+    }
+}
+
+gulc::ConstValue* gulc::ConstInterpreter::findLocalVariable(std::string const& name) {
+    auto& localVariables = _frames.back().localVariables;
+
+    // We search backwards so shadowed variables are found correctly
+    for (auto localVariable = localVariables.rbegin(); localVariable != localVariables.rend(); ++localVariable) {
+        if (localVariable->first == name) {
+            return &localVariable->second;
+        }
+    }
+
+    return nullptr;
+}
+
+std::uint64_t gulc::ConstInterpreter::truncateInteger(std::uint64_t value, unsigned short bits) {
+    if (bits >= 64) {
+        return value;
+    }
+
+    return value & ((std::uint64_t(1) << bits) - 1);
+}
+
+std::int64_t gulc::ConstInterpreter::signExtendInteger(std::uint64_t value, unsigned short bits) {
+    if (bits >= 64 || bits == 0) {
+        return static_cast<std::int64_t>(value);
+    }
+
+    std::uint64_t signBit = std::uint64_t(1) << (bits - 1);
+    return static_cast<std::int64_t>((truncateInteger(value, bits) ^ signBit) - signBit);
+}
+
+double gulc::ConstInterpreter::roundFloat(double value, bool isDouble) {
+    if (isDouble) {
+        return value;
+    }
+
+    return static_cast<double>(static_cast<float>(value));
+}
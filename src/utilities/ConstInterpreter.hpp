@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_CONSTINTERPRETER_HPP
+#define GULC_CONSTINTERPRETER_HPP
+
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+#include <ast/Expr.hpp>
+#include <ast/Stmt.hpp>
+#include <ast/Type.hpp>
+#include <ast/decls/VariableDecl.hpp>
+#include <ast/exprs/ArrayLiteralExpr.hpp>
+#include <ast/exprs/AssignmentOperatorExpr.hpp>
+#include <ast/exprs/FunctionCallExpr.hpp>
+#include <ast/exprs/InfixOperatorExpr.hpp>
+#include <ast/exprs/PostfixOperatorExpr.hpp>
+#include <ast/exprs/PrefixOperatorExpr.hpp>
+#include <ast/exprs/ValueLiteralExpr.hpp>
+#include <ast/exprs/VariableDeclExpr.hpp>
+#include <ast/stmts/CompoundStmt.hpp>
+#include <ast/stmts/ForStmt.hpp>
+#include <ast/stmts/IfStmt.hpp>
+#include <ast/stmts/RepeatWhileStmt.hpp>
+#include <ast/stmts/ReturnStmt.hpp>
+#include <ast/stmts/WhileStmt.hpp>
+
+namespace gulc {
+    // A value computed by `ConstInterpreter`. Integers are kept truncated to the width of their type so overflow wraps
+    // the same way it would at runtime.
+    struct ConstValue {
+        enum class Kind {
+            Uninitialized,
+            Integer,
+            Float,
+            Bool,
+            Array
+        };
+
+        Kind kind = Kind::Uninitialized;
+        std::uint64_t integerValue = 0;
+        unsigned short integerBits = 0;
+        bool isSigned = false;
+        double floatValue = 0.0;
+        // `f64` is kept as a `double`, every other float is rounded to `float` after each operation
+        bool isDouble = false;
+        bool boolValue = false;
+        std::vector<ConstValue> elements;
+
+    };
+
+    /**
+     * ConstInterpreter executes `const` functions and solves `const` initializers at compile time.
+     *
+     * It walks the `Stmt`s and `Expr`s after `CodeProcessor` has processed them (it also understands the temporary
+     * values added by `CodeTransformer`). Only built in types, `bool` and flat arrays of them are supported. Anything
+     * it can't solve is reported through `errorMessage` so the caller can either fall back to a runtime call or error.
+     */
+    class ConstInterpreter {
+    public:
+        // These keep a runaway `const` function from hanging the compiler or using all of its memory
+        static constexpr std::size_t maxSteps = 1000000;
+        static constexpr std::size_t maxCallDepth = 256;
+        static constexpr std::size_t maxArrayElements = 1u << 20u;
+
+        // Returns a new literal (`ValueLiteralExpr`, `BoolLiteralExpr` or `ArrayLiteralExpr`) for the result of `expr`
+        // or `nullptr` if `expr` cannot be solved at compile time.
+        Expr* solve(Expr const* expr);
+
+        std::string const& errorMessage() const { return _errorMessage; }
+        TextPosition errorStartPosition() const { return _errorStartPosition; }
+        TextPosition errorEndPosition() const { return _errorEndPosition; }
+        // True when `solve` failed because `expr` uses a value that is only known at runtime (e.g. a local variable)
+        bool dependsOnRuntimeValue() const { return _dependsOnRuntimeValue; }
+
+    protected:
+        enum class Flow {
+            Normal,
+            Break,
+            Continue,
+            Return
+        };
+
+        struct Frame {
+            std::vector<ConstValue> parameters;
+            // NOTE: These are `std::deque` so references to values stay valid while new values are added
+            std::deque<std::pair<std::string, ConstValue>> localVariables;
+            std::deque<std::pair<std::string, ConstValue>> temporaryValues;
+            ConstValue returnValue;
+
+        };
+
+        std::deque<Frame> _frames;
+        // The solved values of the global `const` variables that have been referenced
+        std::map<VariableDecl const*, ConstValue> _constVariables;
+        std::size_t _steps = 0;
+        std::size_t _arrayElements = 0;
+        std::string _errorMessage;
+        TextPosition _errorStartPosition;
+        TextPosition _errorEndPosition;
+        bool _dependsOnRuntimeValue = false;
+
+        bool fail(std::string const& message, TextPosition startPosition, TextPosition endPosition);
+        bool failRuntimeValue(std::string const& message, TextPosition startPosition, TextPosition endPosition);
+        bool countStep(TextPosition startPosition, TextPosition endPosition);
+
+        bool executeStmt(Stmt const* stmt, Flow& outFlow);
+        bool executeCompoundStmt(CompoundStmt const* compoundStmt, Flow& outFlow);
+        bool executeForStmt(ForStmt const* forStmt, Flow& outFlow);
+        bool executeIfStmt(IfStmt const* ifStmt, Flow& outFlow);
+        bool executeRepeatWhileStmt(RepeatWhileStmt const* repeatWhileStmt, Flow& outFlow);
+        bool executeReturnStmt(ReturnStmt const* returnStmt, Flow& outFlow);
+        bool executeWhileStmt(WhileStmt const* whileStmt, Flow& outFlow);
+        // Runs a loop body and sorts out `break` and `continue`, returns false on error. `outExitLoop` is set when the
+        // loop has to stop.
+        bool executeLoopBody(CompoundStmt const* body, Flow& outFlow, bool& outExitLoop);
+        bool evaluateCondition(Expr const* condition, bool& outResult);
+
+        // Evaluates an expression that isn't part of another expression, temporary values are removed after
+        bool evaluateFullExpr(Expr const* expr, ConstValue& outValue);
+        bool evaluateExpr(Expr const* expr, ConstValue& outValue);
+        bool evaluateLValue(Expr const* expr, ConstValue*& outLocation);
+        bool evaluateArrayLiteralExpr(ArrayLiteralExpr const* arrayLiteralExpr, ConstValue& outValue);
+        bool evaluateAssignmentOperatorExpr(AssignmentOperatorExpr const* assignmentOperatorExpr,
+                                            ConstValue& outValue);
+        bool evaluateFunctionCallExpr(FunctionCallExpr const* functionCallExpr, ConstValue& outValue);
+        bool evaluateInfixOperatorExpr(InfixOperatorExpr const* infixOperatorExpr, ConstValue& outValue);
+        bool evaluateInfixOperator(InfixOperators infixOperator, ConstValue const& left, ConstValue const& right,
+                                   ConstValue& outValue, TextPosition startPosition, TextPosition endPosition);
+        bool evaluatePostfixOperatorExpr(PostfixOperatorExpr const* postfixOperatorExpr, ConstValue& outValue);
+        bool evaluatePrefixOperatorExpr(PrefixOperatorExpr const* prefixOperatorExpr, ConstValue& outValue);
+        bool evaluateValueLiteralExpr(ValueLiteralExpr const* valueLiteralExpr, ConstValue& outValue);
+        bool evaluateVariableDeclExpr(VariableDeclExpr const* variableDeclExpr, ConstValue& outValue);
+
+        bool convertValue(ConstValue const& value, Type const* toType, ConstValue& outValue,
+                          TextPosition startPosition, TextPosition endPosition);
+        bool createDefaultValue(Type const* type, ConstValue& outValue,
+                                TextPosition startPosition, TextPosition endPosition);
+        bool getArrayLength(Expr const* length, std::uint64_t& outLength);
+        bool checkInitialized(ConstValue const& value, TextPosition startPosition, TextPosition endPosition);
+        Expr* createLiteral(ConstValue const& value, Type const* type,
+                            TextPosition startPosition, TextPosition endPosition);
+        ConstValue* findLocalVariable(std::string const& name);
+
+        static std::uint64_t truncateInteger(std::uint64_t value, unsigned short bits);
+        static std::int64_t signExtendInteger(std::uint64_t value, unsigned short bits);
+        static double roundFloat(double value, bool isDouble);
+
+    };
+}
+
+#endif //GULC_CONSTINTERPRETER_HPP
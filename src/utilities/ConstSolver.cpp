@@ -25,148 +25,202 @@
 #include <ast/exprs/BoolLiteralExpr.hpp>
 #include <ast/types/BoolType.hpp>
 #include <ast/exprs/SolvedConstExpr.hpp>
+#include "ConstExprHelper.hpp"
 #include "ConstSolver.hpp"
 #include "TypeCompareUtil.hpp"
 
-// TODO: This is very context specific. We will need to know what visibility levels are accessible to handle this
-//       properly
+std::unordered_map<std::string, bool> gulc::ConstSolver::_solvedHasExprs;
+
 gulc::SolvedConstExpr* gulc::ConstSolver::solveHasExpr(gulc::HasExpr* hasExpr) {
     if (llvm::isa<TypeExpr>(hasExpr->expr)) {
         auto typeExpr = llvm::dyn_cast<TypeExpr>(hasExpr->expr);
-        // We preset the `solution` to `false` and then if we find the `trait` we set to `true` and stop all
-        // searches.
-        bool solution = false;
-
-        // TODO: We'll have to account for extensions at some point. Which can add functions, traits, operators, props,
-        //       subscripts, and traits to anything.
-        if (llvm::isa<TraitPrototypeDecl>(hasExpr->decl)) {
-            auto findTraitType = llvm::dyn_cast<TraitType>(
-                    llvm::dyn_cast<TraitPrototypeDecl>(hasExpr->decl)->traitType);
-            std::vector<Type*>* searchTypes;
-
-            if (llvm::isa<StructType>(typeExpr->type)) {
-                searchTypes = &llvm::dyn_cast<StructType>(typeExpr->type)->decl()->inheritedTypes();
-            } else if (llvm::isa<TraitType>(typeExpr->type)) {
-                auto checkTrait = llvm::dyn_cast<TraitType>(typeExpr->type);
-
-                // For checking if `has trait` is true, we also return true when the type IS the trait. I.e.:
-                //     Addable has Addable == true
-                if (checkTrait->decl() == findTraitType->decl()) {
-                    solution = true;
-                    searchTypes = nullptr;
-                } else {
-                    searchTypes = &checkTrait->decl()->inheritedTypes();
-                }
-            } else {
-                // TODO: Anything else we should do here?
+        std::string key = ConstExprHelper::getCanonicalTypeKey(typeExpr->type) + " has " +
+                          getHasDeclKey(hasExpr->decl);
+        bool solution;
+
+        auto foundSolution = _solvedHasExprs.find(key);
+
+        if (foundSolution != _solvedHasExprs.end()) {
+            solution = foundSolution->second;
+        } else {
+            solution = solveHasExprUncached(hasExpr, typeExpr);
+            _solvedHasExprs.insert({key, solution});
+        }
+
+        auto boolResult = new BoolLiteralExpr(hasExpr->startPosition(), hasExpr->endPosition(), solution);
+        boolResult->valueType = new BoolType(Type::Qualifier::Immut, {}, {});
+        auto constResult = new SolvedConstExpr(hasExpr, boolResult);
+        constResult->valueType = hasExpr->valueType->deepCopy();
+
+        return constResult;
+    } else {
+        return nullptr;
+    }
+}
+
+std::string gulc::ConstSolver::getHasDeclKey(gulc::Decl const* decl) {
+    // The prototype string holds the names, labels, and modifiers of the decl. Type names aren't unique across
+    // namespaces so all types are added again using their canonical key.
+    std::string result = std::to_string(static_cast<int>(decl->getDeclKind())) + ":" + decl->getPrototypeString();
+
+    if (llvm::isa<FunctionDecl>(decl)) {
+        auto functionDecl = llvm::dyn_cast<FunctionDecl>(decl);
+
+        for (ParameterDecl const* parameter : functionDecl->parameters()) {
+            result += "," + ConstExprHelper::getCanonicalTypeKey(parameter->type);
+        }
+
+        if (functionDecl->returnType != nullptr) {
+            result += "->" + ConstExprHelper::getCanonicalTypeKey(functionDecl->returnType);
+        }
+    } else if (llvm::isa<SubscriptOperatorDecl>(decl)) {
+        auto subscriptOperatorDecl = llvm::dyn_cast<SubscriptOperatorDecl>(decl);
+
+        for (ParameterDecl const* parameter : subscriptOperatorDecl->parameters()) {
+            result += "," + ConstExprHelper::getCanonicalTypeKey(parameter->type);
+        }
+
+        result += "->" + ConstExprHelper::getCanonicalTypeKey(subscriptOperatorDecl->type);
+    } else if (llvm::isa<PropertyDecl>(decl)) {
+        result += ":" + ConstExprHelper::getCanonicalTypeKey(llvm::dyn_cast<PropertyDecl>(decl)->type);
+    } else if (llvm::isa<VariableDecl>(decl)) {
+        result += ":" + ConstExprHelper::getCanonicalTypeKey(llvm::dyn_cast<VariableDecl>(decl)->type);
+    } else if (llvm::isa<TraitPrototypeDecl>(decl)) {
+        result += ":" + ConstExprHelper::getCanonicalTypeKey(llvm::dyn_cast<TraitPrototypeDecl>(decl)->traitType);
+    }
+
+    return result;
+}
+
+// TODO: This is very context specific. We will need to know what visibility levels are accessible to handle this
+//       properly
+bool gulc::ConstSolver::solveHasExprUncached(gulc::HasExpr const* hasExpr, gulc::TypeExpr const* typeExpr) {
+    // We preset the `solution` to `false` and then if we find the `trait` we set to `true` and stop all
+    // searches.
+    bool solution = false;
+
+    // TODO: We'll have to account for extensions at some point. Which can add functions, traits, operators, props,
+    //       subscripts, and traits to anything.
+    if (llvm::isa<TraitPrototypeDecl>(hasExpr->decl)) {
+        auto findTraitType = llvm::dyn_cast<TraitType>(
+                llvm::dyn_cast<TraitPrototypeDecl>(hasExpr->decl)->traitType);
+        std::vector<Type*>* searchTypes;
+
+        if (llvm::isa<StructType>(typeExpr->type)) {
+            searchTypes = &llvm::dyn_cast<StructType>(typeExpr->type)->decl()->inheritedTypes();
+        } else if (llvm::isa<TraitType>(typeExpr->type)) {
+            auto checkTrait = llvm::dyn_cast<TraitType>(typeExpr->type);
+
+            // For checking if `has trait` is true, we also return true when the type IS the trait. I.e.:
+            //     Addable has Addable == true
+            if (checkTrait->decl() == findTraitType->decl()) {
+                solution = true;
                 searchTypes = nullptr;
+            } else {
+                searchTypes = &checkTrait->decl()->inheritedTypes();
             }
+        } else {
+            // TODO: Anything else we should do here?
+            searchTypes = nullptr;
+        }
 
-            if (searchTypes != nullptr) {
-                for (Type* checkType : *searchTypes) {
-                    if (llvm::isa<TraitType>(checkType)) {
-                        auto potentialTrait = llvm::dyn_cast<TraitType>(checkType);
+        if (searchTypes != nullptr) {
+            for (Type* checkType : *searchTypes) {
+                if (llvm::isa<TraitType>(checkType)) {
+                    auto potentialTrait = llvm::dyn_cast<TraitType>(checkType);
 
-                        if (potentialTrait->decl() == findTraitType->decl()) {
-                            solution = true;
-                            break;
-                        }
-                    }
-                }
-            }
-        } else if (llvm::isa<ConstructorDecl>(hasExpr->decl)) {
-            TypeCompareUtil typeCompareUtil;
-
-            if (llvm::isa<StructType>(typeExpr->type)) {
-                solution = containsMatchingConstructorDecl(llvm::dyn_cast<StructType>(typeExpr->type)->decl()->constructors(),
-                                                           typeCompareUtil,
-                                                           llvm::dyn_cast<ConstructorDecl>(hasExpr->decl));
-            } else if (llvm::isa<TraitType>(typeExpr->type)) {
-                // TODO: Can't `trait` contain `init` for when whatever implements the `trait` should be constructable
-                //       that way? Where is the `constructors`?
-            }
-        } else if (llvm::isa<DestructorDecl>(hasExpr->decl)) {
-            auto findDestructor = llvm::dyn_cast<DestructorDecl>(hasExpr->decl);
-
-            if (llvm::isa<StructType>(typeExpr->type)) {
-                auto checkStruct = llvm::dyn_cast<StructType>(typeExpr->type)->decl();
-
-                if (checkStruct->destructor != nullptr) {
-                    // If `find` is `virtual` then `check` must be too, else we just default to `true` since we found a
-                    // valid destructor
-                    if (findDestructor->isAnyVirtual()) {
-                        solution = checkStruct->destructor->isAnyVirtual();
-                    } else {
+                    if (potentialTrait->decl() == findTraitType->decl()) {
                         solution = true;
+                        break;
                     }
                 }
             }
-        } else if (llvm::isa<EnumConstDecl>(hasExpr->decl)) {
-            auto findCase = llvm::dyn_cast<EnumConstDecl>(hasExpr->decl);
+        }
+    } else if (llvm::isa<ConstructorDecl>(hasExpr->decl)) {
+        TypeCompareUtil typeCompareUtil;
+
+        if (llvm::isa<StructType>(typeExpr->type)) {
+            solution = containsMatchingConstructorDecl(llvm::dyn_cast<StructType>(typeExpr->type)->decl()->constructors(),
+                                                       typeCompareUtil,
+                                                       llvm::dyn_cast<ConstructorDecl>(hasExpr->decl));
+        } else if (llvm::isa<TraitType>(typeExpr->type)) {
+            // TODO: Can't `trait` contain `init` for when whatever implements the `trait` should be constructable
+            //       that way? Where is the `constructors`?
+        }
+    } else if (llvm::isa<DestructorDecl>(hasExpr->decl)) {
+        auto findDestructor = llvm::dyn_cast<DestructorDecl>(hasExpr->decl);
 
-            if (llvm::isa<EnumType>(typeExpr->type)) {
-                auto checkEnum = llvm::dyn_cast<EnumType>(typeExpr->type)->decl();
+        if (llvm::isa<StructType>(typeExpr->type)) {
+            auto checkStruct = llvm::dyn_cast<StructType>(typeExpr->type)->decl();
 
-                for (EnumConstDecl* checkCase : checkEnum->enumConsts()) {
-                    if (findCase->identifier().name() == checkCase->identifier().name()) {
-                        solution = true;
-                        break;
-                    }
+            if (checkStruct->destructor != nullptr) {
+                // If `find` is `virtual` then `check` must be too, else we just default to `true` since we found a
+                // valid destructor
+                if (findDestructor->isAnyVirtual()) {
+                    solution = checkStruct->destructor->isAnyVirtual();
+                } else {
+                    solution = true;
                 }
             }
-        } else {
-            TypeCompareUtil typeCompareUtil;
-            std::vector<Decl*>* searchDecls;
+        }
+    } else if (llvm::isa<EnumConstDecl>(hasExpr->decl)) {
+        auto findCase = llvm::dyn_cast<EnumConstDecl>(hasExpr->decl);
 
-            if (llvm::isa<StructType>(typeExpr->type)) {
-                searchDecls = &llvm::dyn_cast<StructType>(typeExpr->type)->decl()->allMembers;
-            } else if (llvm::isa<TraitType>(typeExpr->type)) {
-                searchDecls = &llvm::dyn_cast<TraitType>(typeExpr->type)->decl()->allMembers;
-            } else {
-                searchDecls = nullptr;
-            }
+        if (llvm::isa<EnumType>(typeExpr->type)) {
+            auto checkEnum = llvm::dyn_cast<EnumType>(typeExpr->type)->decl();
 
-            if (searchDecls != nullptr) {
-                switch (hasExpr->decl->getDeclKind()) {
-                    case Decl::Kind::Variable:
-                        solution = containsMatchingVariableDecl(*searchDecls, typeCompareUtil,
-                                                                llvm::dyn_cast<VariableDecl>(hasExpr->decl));
-                        break;
-                    case Decl::Kind::Property:
-                        solution = containsMatchingPropertyDecl(*searchDecls, typeCompareUtil,
-                                                                llvm::dyn_cast<PropertyDecl>(hasExpr->decl));
-                        break;
-                    case Decl::Kind::SubscriptOperator:
-                        solution = containsMatchingSubscriptOperatorDecl(*searchDecls, typeCompareUtil,
-                                                                         llvm::dyn_cast<SubscriptOperatorDecl>(hasExpr->decl));
-                        break;
-                    case Decl::Kind::Function:
-                        solution = containsMatchingFunctionDecl(*searchDecls, typeCompareUtil,
-                                                                llvm::dyn_cast<FunctionDecl>(hasExpr->decl));
-                        break;
-                    case Decl::Kind::Operator:
-                        solution = containsMatchingOperatorDecl(*searchDecls, typeCompareUtil,
-                                                                llvm::dyn_cast<OperatorDecl>(hasExpr->decl));
-                        break;
-                    case Decl::Kind::CallOperator:
-                        solution = containsMatchingCallOperatorDecl(*searchDecls, typeCompareUtil,
-                                                                    llvm::dyn_cast<CallOperatorDecl>(hasExpr->decl));
-                        break;
-                    default:
-                        break;
+            for (EnumConstDecl* checkCase : checkEnum->enumConsts()) {
+                if (findCase->identifier().name() == checkCase->identifier().name()) {
+                    solution = true;
+                    break;
                 }
             }
         }
+    } else {
+        TypeCompareUtil typeCompareUtil;
+        std::vector<Decl*>* searchDecls;
 
-        auto boolResult = new BoolLiteralExpr(hasExpr->startPosition(), hasExpr->endPosition(), solution);
-        boolResult->valueType = new BoolType(Type::Qualifier::Immut, {}, {});
-        auto constResult = new SolvedConstExpr(hasExpr, boolResult);
-        constResult->valueType = hasExpr->valueType->deepCopy();
+        if (llvm::isa<StructType>(typeExpr->type)) {
+            searchDecls = &llvm::dyn_cast<StructType>(typeExpr->type)->decl()->allMembers;
+        } else if (llvm::isa<TraitType>(typeExpr->type)) {
+            searchDecls = &llvm::dyn_cast<TraitType>(typeExpr->type)->decl()->allMembers;
+        } else {
+            searchDecls = nullptr;
+        }
 
-        return constResult;
-    } else {
-        return nullptr;
+        if (searchDecls != nullptr) {
+            switch (hasExpr->decl->getDeclKind()) {
+                case Decl::Kind::Variable:
+                    solution = containsMatchingVariableDecl(*searchDecls, typeCompareUtil,
+                                                            llvm::dyn_cast<VariableDecl>(hasExpr->decl));
+                    break;
+                case Decl::Kind::Property:
+                    solution = containsMatchingPropertyDecl(*searchDecls, typeCompareUtil,
+                                                            llvm::dyn_cast<PropertyDecl>(hasExpr->decl));
+                    break;
+                case Decl::Kind::SubscriptOperator:
+                    solution = containsMatchingSubscriptOperatorDecl(*searchDecls, typeCompareUtil,
+                                                                     llvm::dyn_cast<SubscriptOperatorDecl>(hasExpr->decl));
+                    break;
+                case Decl::Kind::Function:
+                    solution = containsMatchingFunctionDecl(*searchDecls, typeCompareUtil,
+                                                            llvm::dyn_cast<FunctionDecl>(hasExpr->decl));
+                    break;
+                case Decl::Kind::Operator:
+                    solution = containsMatchingOperatorDecl(*searchDecls, typeCompareUtil,
+                                                            llvm::dyn_cast<OperatorDecl>(hasExpr->decl));
+                    break;
+                case Decl::Kind::CallOperator:
+                    solution = containsMatchingCallOperatorDecl(*searchDecls, typeCompareUtil,
+                                                                llvm::dyn_cast<CallOperatorDecl>(hasExpr->decl));
+                    break;
+                default:
+                    break;
+            }
+        }
     }
+
+    return solution;
 }
 
 bool gulc::ConstSolver::containsMatchingVariableDecl(std::vector<Decl*> const& checkDecls,
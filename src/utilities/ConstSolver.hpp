@@ -20,10 +20,13 @@
 
 #include <ast/exprs/SolvedConstExpr.hpp>
 #include <ast/exprs/HasExpr.hpp>
+#include <ast/exprs/TypeExpr.hpp>
 #include <ast/decls/PropertyDecl.hpp>
 #include <ast/decls/SubscriptOperatorDecl.hpp>
 #include <ast/decls/OperatorDecl.hpp>
 #include <ast/decls/CallOperatorDecl.hpp>
+#include <string>
+#include <unordered_map>
 #include "TypeCompareUtil.hpp"
 
 namespace gulc {
@@ -48,6 +51,14 @@ namespace gulc {
         static bool containsMatchingConstructorDecl(std::vector<ConstructorDecl*> const& checkConstructors,
                                                     TypeCompareUtil& typeCompareUtil, ConstructorDecl* findConstructor);
 
+    protected:
+        // Every template instantiation gets its own copy of a `has` expression, this is used to only search the
+        // members of a type once per `has` question instead of once per copy
+        static std::unordered_map<std::string, bool> _solvedHasExprs;
+
+        static std::string getHasDeclKey(Decl const* decl);
+        static bool solveHasExprUncached(HasExpr const* hasExpr, TypeExpr const* typeExpr);
+
     };
 }
 
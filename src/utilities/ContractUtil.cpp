@@ -24,26 +24,39 @@
 #include <ast/types/TemplateStructType.hpp>
 #include <ast/types/TemplateTraitType.hpp>
 #include <ast/types/DependentType.hpp>
+#include "ConstExprHelper.hpp"
 #include "ContractUtil.hpp"
 #include "TypeCompareUtil.hpp"
 
 bool gulc::ContractUtil::checkWhereCont(gulc::WhereCont* whereCont) {
+    std::string argumentsKey = ConstExprHelper::getCanonicalKey(*_templateArguments);
+    auto foundResult = whereCont->solvedResults.find(argumentsKey);
+
+    if (foundResult != whereCont->solvedResults.end()) {
+        return foundResult->second;
+    }
+
+    bool result = false;
+
     switch (whereCont->condition->getExprKind()) {
         case Expr::Kind::CheckExtendsType:
-            return checkCheckExtendsTypeExpr(llvm::dyn_cast<CheckExtendsTypeExpr>(whereCont->condition));
+            result = checkCheckExtendsTypeExpr(llvm::dyn_cast<CheckExtendsTypeExpr>(whereCont->condition));
+            break;
         default:
             printError("unsupported expression found in `where` clause!",
                        whereCont->startPosition(), whereCont->endPosition());
             break;
     }
-    return false;
+
+    whereCont->solvedResults.insert({argumentsKey, result});
+    return result;
 }
 
 void gulc::ContractUtil::printError(const std::string& message, gulc::TextPosition startPosition,
                                     gulc::TextPosition endPosition) const {
     std::cerr << "gulc error[" << _fileName << ", "
-                            "{" << startPosition.line << ", " << startPosition.column << " "
-                            "to " << endPosition.line << ", " << endPosition.column << "}]: "
+                            "{" << startPosition.line() << ", " << startPosition.column() << " "
+                            "to " << endPosition.line() << ", " << endPosition.column() << "}]: "
               << message << std::endl;
     std::exit(1);
 }
@@ -51,8 +64,8 @@ void gulc::ContractUtil::printError(const std::string& message, gulc::TextPositi
 void gulc::ContractUtil::printWarning(const std::string& message, gulc::TextPosition startPosition,
                                       gulc::TextPosition endPosition) const {
     std::cerr << "gulc warning[" << _fileName << ", "
-                              "{" << startPosition.line << ", " << startPosition.column << " "
-                              "to " << endPosition.line << ", " << endPosition.column << "}]: "
+                              "{" << startPosition.line() << ", " << startPosition.column() << " "
+                              "to " << endPosition.line() << ", " << endPosition.column() << "}]: "
               << message << std::endl;
 }
 
@@ -121,6 +134,11 @@ bool gulc::ContractUtil::checkCheckExtendsTypeExpr(gulc::CheckExtendsTypeExpr* c
 
                 TypeCompareUtil typeCompareUtil;
 
+                // A trait always satisfies itself (this is what lets `@dyn` templates be instantiated with their trait)
+                if (typeCompareUtil.compareAreSame(traitType, checkExtendsTypeExpr->extendsType)) {
+                    return true;
+                }
+
                 // We check `allInheritedTypes` as it holds all types, even the ones not explicitly stated by the
                 // currently being checked struct decl
                 for (Type const* checkType : traitType->decl()->inheritedTypes()) {
@@ -22,6 +22,8 @@
 #include <algorithm>
 #include <ast/exprs/TypeExpr.hpp>
 #include <ast/types/StructType.hpp>
+#include <ast/types/TraitType.hpp>
+#include "WitnessTableUtil.hpp"
 
 using namespace gulc;
 
@@ -249,6 +251,14 @@ SignatureComparer::ArgMatchResult SignatureComparer::compareArgumentsToParameter
 
             // Compare the type of the argument to the type of the parameter...
             if (!typeCompareUtil.compareAreSame(checkArgType, parameters[i]->type)) {
+                // A struct that implements a trait can be passed as a trait object of that trait
+                if (llvm::isa<TraitType>(parameters[i]->type) && llvm::isa<StructType>(checkArgType) &&
+                        WitnessTableUtil::implementsTrait(llvm::dyn_cast<StructType>(checkArgType)->decl(),
+                                                          llvm::dyn_cast<TraitType>(parameters[i]->type)->decl())) {
+                    currentResult = ArgMatchResult::Castable;
+                    continue;
+                }
+
                 // TODO: Check if the argument type can be casted to the parameter type...
                 return ArgMatchResult::Fail;
             }
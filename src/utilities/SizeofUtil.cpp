@@ -20,9 +20,14 @@
 #include <ast/types/PointerType.hpp>
 #include <ast/types/ReferenceType.hpp>
 #include <ast/types/StructType.hpp>
+#include <ast/types/TraitType.hpp>
 #include <iostream>
 #include <ast/types/VTableType.hpp>
 #include <ast/types/BoolType.hpp>
+#include <ast/types/FlatArrayType.hpp>
+#include <ast/types/SimdType.hpp>
+#include <ast/exprs/ValueLiteralExpr.hpp>
+#include <algorithm>
 #include "SizeofUtil.hpp"
 
 gulc::SizeAndAlignment gulc::SizeofUtil::getSizeAndAlignmentOf(const gulc::Target& target, gulc::Type* type) {
@@ -35,6 +40,9 @@ gulc::SizeAndAlignment gulc::SizeofUtil::getSizeAndAlignmentOf(const gulc::Targe
     } else if (llvm::isa<PointerType>(type) || llvm::isa<ReferenceType>(type) || llvm::isa<VTableType>(type)) {
         // TODO: This is the same for `FunctionPointerType`
         return gulc::SizeAndAlignment(target.sizeofPtr(), target.sizeofPtr());
+    } else if (llvm::isa<TraitType>(type)) {
+        // Trait objects are `{ self*, witness table* }`
+        return gulc::SizeAndAlignment(target.sizeofPtr() * 2, target.sizeofPtr());
     } else if (llvm::isa<StructType>(type)) {
         auto structType = llvm::dyn_cast<StructType>(type);
 
@@ -43,7 +51,58 @@ gulc::SizeAndAlignment gulc::SizeofUtil::getSizeAndAlignmentOf(const gulc::Targe
             std::exit(1);
         }
 
-        return gulc::SizeAndAlignment(structType->decl()->dataSizeWithPadding, target.alignofStruct());
+        return gulc::SizeAndAlignment(structType->decl()->dataSizeWithPadding, structType->decl()->dataAlignment);
+    } else if (llvm::isa<SimdType>(type)) {
+        auto simdType = llvm::dyn_cast<SimdType>(type);
+        std::size_t dataSize;
+
+        // `simd<bool, N>` masks are stored as one bit per element
+        if (llvm::isa<BoolType>(simdType->elementType)) {
+            dataSize = (simdType->length() + 7) / 8;
+        } else {
+            dataSize = getSizeAndAlignmentOf(target, simdType->elementType).size * simdType->length();
+        }
+
+        // Like LLVM vectors are padded and aligned to the next power of two (`simd<f32, 3>` is the same as
+        // `simd<f32, 4>` in memory)
+        std::size_t size = 1;
+
+        while (size < dataSize) {
+            size *= 2;
+        }
+
+        return gulc::SizeAndAlignment(size, size);
+    } else if (llvm::isa<FlatArrayType>(type)) {
+        auto flatArrayType = llvm::dyn_cast<FlatArrayType>(type);
+
+        if (!llvm::isa<ValueLiteralExpr>(flatArrayType->length)) {
+            std::cerr << "[INTERNAL ERROR] unsolved flat array length found in `SizeofUtil::getSizeAndAlignmentOf`!" << std::endl;
+            std::exit(1);
+        }
+
+        auto lengthLiteral = llvm::dyn_cast<ValueLiteralExpr>(flatArrayType->length);
+        std::size_t length = std::stoull(lengthLiteral->value());
+
+        // Arrays of `@soa` structs store each member in its own column
+        if (llvm::isa<StructType>(flatArrayType->indexType) &&
+                llvm::dyn_cast<StructType>(flatArrayType->indexType)->decl()->hasAttr(Attr::Kind::Soa)) {
+            auto soaColumns = getSoaColumns(target, llvm::dyn_cast<StructType>(flatArrayType->indexType)->decl(),
+                                            length);
+            std::size_t size = 0;
+            std::size_t align = 1;
+
+            for (SoaColumn const& soaColumn : soaColumns) {
+                size = soaColumn.offset + soaColumn.sizeAndAlignment.size;
+                align = std::max(align, soaColumn.sizeAndAlignment.align);
+            }
+
+            return gulc::SizeAndAlignment(((size + align - 1) / align) * align, align);
+        }
+
+        auto elementSizeAndAlignment = getSizeAndAlignmentOf(target, flatArrayType->indexType);
+
+        // A flat array is laid out exactly like its element type repeated `length` times
+        return gulc::SizeAndAlignment(elementSizeAndAlignment.size * length, elementSizeAndAlignment.align);
     }
 
     std::cerr << "[INTERNAL ERROR] unknown type found in `SizeofUtil::getSizeAndAlignmentOf`!" << std::endl;
@@ -51,3 +110,29 @@ gulc::SizeAndAlignment gulc::SizeofUtil::getSizeAndAlignmentOf(const gulc::Targe
 
     return gulc::SizeAndAlignment(0, 0);
 }
+
+std::vector<gulc::SoaColumn> gulc::SizeofUtil::getSoaColumns(gulc::Target const& target,
+                                                              gulc::StructDecl const* structDecl, std::size_t length) {
+    std::vector<SoaColumn> result;
+    std::size_t offset = 0;
+
+    for (VariableDecl* member : structDecl->memoryLayout) {
+        if (std::find(structDecl->ownedPaddingMembers.begin(), structDecl->ownedPaddingMembers.end(),
+                      member) != structDecl->ownedPaddingMembers.end()) {
+            continue;
+        }
+
+        auto memberSizeAndAlignment = getSizeAndAlignmentOf(target, member->type);
+
+        if (memberSizeAndAlignment.align != 0 && offset % memberSizeAndAlignment.align != 0) {
+            offset += memberSizeAndAlignment.align - (offset % memberSizeAndAlignment.align);
+        }
+
+        result.emplace_back(member, offset,
+                            SizeAndAlignment(memberSizeAndAlignment.size * length, memberSizeAndAlignment.align));
+
+        offset += memberSizeAndAlignment.size * length;
+    }
+
+    return result;
+}
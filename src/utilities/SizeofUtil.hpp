@@ -21,6 +21,8 @@
 #include <cstddef>
 #include <Target.hpp>
 #include <ast/Type.hpp>
+#include <ast/decls/StructDecl.hpp>
+#include <vector>
 
 namespace gulc {
     struct SizeAndAlignment {
@@ -31,9 +33,24 @@ namespace gulc {
 
     };
 
+    /// A single column of a flat array of an `@soa` struct, `offset` is relative to the start of the array
+    struct SoaColumn {
+        VariableDecl* member;
+        std::size_t offset;
+        SizeAndAlignment sizeAndAlignment;
+
+        SoaColumn(VariableDecl* member, std::size_t offset, SizeAndAlignment sizeAndAlignment)
+                : member(member), offset(offset), sizeAndAlignment(sizeAndAlignment) {}
+
+    };
+
     class SizeofUtil {
     public:
         static SizeAndAlignment getSizeAndAlignmentOf(Target const& target, Type* type);
+        /// Returns the columns (in `memoryLayout` order, padding members skipped) for `[structDecl; length]` where
+        /// `structDecl` is `@soa`
+        static std::vector<SoaColumn> getSoaColumns(Target const& target, StructDecl const* structDecl,
+                                                    std::size_t length);
 
     };
 }
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <ast/decls/NamespaceDecl.hpp>
+#include <ast/decls/TemplateStructDecl.hpp>
+#include <ast/decls/TemplateStructInstDecl.hpp>
+#include <ast/types/FlatArrayType.hpp>
+#include <algorithm>
+#include <iomanip>
+#include "SizeofUtil.hpp"
+#include "StructLayoutUtil.hpp"
+
+void gulc::StructLayoutUtil::printStructLayouts(gulc::Target const& target, std::vector<ASTFile> const& files,
+                                                std::vector<std::string> const& filePaths, std::ostream& out) {
+    for (ASTFile const& file : files) {
+        for (Decl const* decl : file.declarations) {
+            printDeclLayouts(target, decl, filePaths, out);
+        }
+    }
+}
+
+void gulc::StructLayoutUtil::printDeclLayouts(gulc::Target const& target, gulc::Decl const* decl,
+                                              std::vector<std::string> const& filePaths, std::ostream& out) {
+    if (llvm::isa<NamespaceDecl>(decl)) {
+        auto namespaceDecl = llvm::dyn_cast<NamespaceDecl>(decl);
+
+        for (Decl const* nestedDecl : namespaceDecl->nestedDecls()) {
+            printDeclLayouts(target, nestedDecl, filePaths, out);
+        }
+    } else if (llvm::isa<TemplateStructDecl>(decl)) {
+        auto templateStructDecl = llvm::dyn_cast<TemplateStructDecl>(decl);
+
+        for (TemplateStructInstDecl const* templateInstantiation : templateStructDecl->templateInstantiations()) {
+            printDeclLayouts(target, templateInstantiation, filePaths, out);
+        }
+    } else if (llvm::isa<StructDecl>(decl)) {
+        auto structDecl = llvm::dyn_cast<StructDecl>(decl);
+
+        // Structs that were never instantiated (e.g. the validation instance of a template) have no layout
+        if (!structDecl->isInstantiated) {
+            return;
+        }
+
+        printStructLayout(target, structDecl, filePaths, out);
+
+        for (Decl const* ownedMember : structDecl->ownedMembers()) {
+            printDeclLayouts(target, ownedMember, filePaths, out);
+        }
+    }
+}
+
+void gulc::StructLayoutUtil::printStructLayout(gulc::Target const& target, gulc::StructDecl const* structDecl,
+                                               std::vector<std::string> const& filePaths, std::ostream& out) {
+    std::string structName = structDecl->identifier().name();
+
+    if (llvm::isa<TemplateStructInstDecl>(structDecl)) {
+        auto templateStructInstDecl = llvm::dyn_cast<TemplateStructInstDecl>(structDecl);
+
+        structName += "<";
+
+        for (std::size_t i = 0; i < templateStructInstDecl->templateArguments().size(); ++i) {
+            if (i != 0) structName += ", ";
+
+            structName += templateStructInstDecl->templateArguments()[i]->toString();
+        }
+
+        structName += ">";
+    }
+
+    std::size_t totalSize = structDecl->dataSizeWithPadding;
+    std::size_t paddingSize = totalSize;
+    std::size_t offset = 0;
+
+    out << structDecl->structKindName() << " " << structName
+        << " (" << filePaths[structDecl->sourceFileID()] << ")"
+        << (structDecl->hasAttr(Attr::Kind::Pod) ? " @pod" : "")
+        << (structDecl->hasAttr(Attr::Kind::Soa) ? " @soa" : "") << "\n";
+
+    if (structDecl->baseStruct != nullptr) {
+        offset = structDecl->baseStruct->dataSizeWithoutPadding;
+        // The base struct's own padding is reported with the base struct
+        paddingSize -= offset;
+
+        out << "    [" << std::setw(4) << 0 << "] base `" << structDecl->baseStruct->identifier().name() << "` ("
+            << offset << " bytes)\n";
+    }
+
+    for (VariableDecl const* member : structDecl->memoryLayout) {
+        auto sizeAndAlignment = SizeofUtil::getSizeAndAlignmentOf(target, member->type);
+        bool isPadding = std::find(structDecl->ownedPaddingMembers.begin(), structDecl->ownedPaddingMembers.end(),
+                                   member) != structDecl->ownedPaddingMembers.end();
+
+        if (isPadding) {
+            out << "    [" << std::setw(4) << offset << "] <padding> (" << sizeAndAlignment.size << " bytes)\n";
+        } else {
+            paddingSize -= sizeAndAlignment.size;
+
+            out << "    [" << std::setw(4) << offset << "] " << member->identifier().name() << ": "
+                << member->type->toString() << " (size " << sizeAndAlignment.size
+                << ", align " << sizeAndAlignment.align << ")\n";
+        }
+
+        offset += sizeAndAlignment.size;
+    }
+
+    if (totalSize > offset) {
+        out << "    [" << std::setw(4) << offset << "] <tail padding> (" << (totalSize - offset) << " bytes)\n";
+    }
+
+    double paddingPercent = totalSize == 0 ? 0.0 : (100.0 * paddingSize) / totalSize;
+
+    out << "    size " << totalSize << " bytes, padding " << paddingSize << " bytes ("
+        << std::fixed << std::setprecision(1) << paddingPercent << "%)";
+
+    std::size_t declarationOrderSize = getDeclarationOrderSize(target, structDecl);
+
+    if (declarationOrderSize != totalSize) {
+        out << ", " << declarationOrderSize << " bytes in declaration order";
+    }
+
+    out << std::endl;
+}
+
+std::size_t gulc::StructLayoutUtil::getDeclarationOrderSize(gulc::Target const& target,
+                                                            gulc::StructDecl const* structDecl) {
+    std::size_t size = 0;
+
+    if (structDecl->baseStruct != nullptr) {
+        size = structDecl->baseStruct->dataSizeWithoutPadding;
+    }
+
+    // NOTE: `ownedMembers` is still in declaration order (with the vtable member inserted at the front), only the
+    //       `memoryLayout` is reordered
+    for (Decl const* ownedMember : structDecl->ownedMembers()) {
+        if (llvm::isa<VariableDecl>(ownedMember)) {
+            auto sizeAndAlignment = SizeofUtil::getSizeAndAlignmentOf(
+                    target, llvm::dyn_cast<VariableDecl>(ownedMember)->type);
+
+            if (sizeAndAlignment.align != 0 && size % sizeAndAlignment.align != 0) {
+                size += sizeAndAlignment.align - (size % sizeAndAlignment.align);
+            }
+
+            size += sizeAndAlignment.size;
+        }
+    }
+
+    return ((size + structDecl->dataAlignment - 1) / structDecl->dataAlignment) * structDecl->dataAlignment;
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_STRUCTLAYOUTUTIL_HPP
+#define GULC_STRUCTLAYOUTUTIL_HPP
+
+#include <Target.hpp>
+#include <parsing/ASTFile.hpp>
+#include <ast/decls/StructDecl.hpp>
+#include <ostream>
+
+namespace gulc {
+    /**
+     * Reports the final memory layout `DeclInstantiator` chose for each struct (used by `--print-struct-layouts`)
+     */
+    class StructLayoutUtil {
+    public:
+        /// Prints the layout of every instantiated struct (including template instantiations) within `files`
+        static void printStructLayouts(Target const& target, std::vector<ASTFile> const& files,
+                                       std::vector<std::string> const& filePaths, std::ostream& out);
+        static void printStructLayout(Target const& target, StructDecl const* structDecl,
+                                      std::vector<std::string> const& filePaths, std::ostream& out);
+        /// Calculates the size `structDecl` would have if its members were laid out in declaration order (like C)
+        static std::size_t getDeclarationOrderSize(Target const& target, StructDecl const* structDecl);
+
+    private:
+        static void printDeclLayouts(Target const& target, Decl const* decl,
+                                     std::vector<std::string> const& filePaths, std::ostream& out);
+
+    };
+}
+
+#endif //GULC_STRUCTLAYOUTUTIL_HPP
@@ -125,7 +125,11 @@ void gulc::TemplateCopyUtil::instantiateCont(gulc::Cont* cont) const {
 
         instantiateExpr(requiresCont->condition);
     } else if (llvm::isa<ThrowsCont>(cont)) {
-        // TODO: Is there anything to do here? Exceptions are special types but can they be templated?
+        auto throwsCont = llvm::dyn_cast<ThrowsCont>(cont);
+
+        if (throwsCont->hasExceptionType()) {
+            instantiateType(throwsCont->exceptionType);
+        }
     } else if (llvm::isa<WhereCont>(cont)) {
         auto whereCont = llvm::dyn_cast<WhereCont>(cont);
 
@@ -316,6 +320,9 @@ void gulc::TemplateCopyUtil::instantiateStmt(gulc::Stmt* stmt) const {
         case Stmt::Kind::Switch:
             instantiateSwitchStmt(llvm::dyn_cast<SwitchStmt>(stmt));
             break;
+        case Stmt::Kind::Throw:
+            instantiateThrowStmt(llvm::dyn_cast<ThrowStmt>(stmt));
+            break;
         case Stmt::Kind::While:
             instantiateWhileStmt((llvm::dyn_cast<WhileStmt>(stmt)));
             break;
@@ -672,6 +679,12 @@ void gulc::TemplateCopyUtil::instantiateSwitchStmt(gulc::SwitchStmt* switchStmt)
     }
 }
 
+void gulc::TemplateCopyUtil::instantiateThrowStmt(gulc::ThrowStmt* throwStmt) const {
+    if (throwStmt->hasThrownValue()) {
+        instantiateExpr(throwStmt->thrownValue);
+    }
+}
+
 void gulc::TemplateCopyUtil::instantiateWhileStmt(gulc::WhileStmt* whileStmt) const {
     instantiateExpr(whileStmt->condition);
     instantiateStmt(whileStmt->body());
@@ -104,6 +104,7 @@ namespace gulc {
         void instantiateRepeatWhileStmt(RepeatWhileStmt* repeatWhileStmt) const;
         void instantiateReturnStmt(ReturnStmt* returnStmt) const;
         void instantiateSwitchStmt(SwitchStmt* switchStmt) const;
+        void instantiateThrowStmt(ThrowStmt* throwStmt) const;
         void instantiateWhileStmt(WhileStmt* whileStmt) const;
 
         void instantiateArrayLiteralExpr(ArrayLiteralExpr* arrayLiteralExpr) const;
@@ -80,6 +80,9 @@ void gulc::TemplateInstHelper::instantiateTemplateStructInstDecl(gulc::TemplateS
         instantiateType(inheritedType);
     }
 
+    // The functions were copied without their bodies, until a body is instantiated it is shared with the template
+    shareFunctionBodies(parentTemplateStruct, templateStructInstDecl);
+
     for (Decl* ownedMember : templateStructInstDecl->ownedMembers()) {
         instantiateDecl(ownedMember);
     }
@@ -139,6 +142,8 @@ void gulc::TemplateInstHelper::instantiateTemplateTraitInstDecl(gulc::TemplateTr
         instantiateType(inheritedType);
     }
 
+    shareFunctionBodies(parentTemplateTrait, templateTraitInstDecl);
+
     for (Decl* ownedMember : templateTraitInstDecl->ownedMembers()) {
         instantiateDecl(ownedMember);
     }
@@ -194,6 +199,134 @@ void gulc::TemplateInstHelper::instantiateType(gulc::Type*& type,
     instantiateType(type);
 }
 
+void gulc::TemplateInstHelper::instantiateFunctionDeclBody(gulc::FunctionDecl* functionDecl) {
+    if (functionDecl->bodyIsInstantiated) {
+        return;
+    }
+
+    _processBodyStmts = true;
+    // Lazily instantiated bodies only ever come from instantiations outside of a template, the container template
+    // type is not needed for these
+    _currentContainerTemplateType = nullptr;
+    _templateParameters = nullptr;
+    _templateArguments = nullptr;
+
+    for (Decl* checkContainer = functionDecl->container; checkContainer != nullptr;
+            checkContainer = checkContainer->container) {
+        if (llvm::isa<TemplateStructInstDecl>(checkContainer)) {
+            auto templateStructInstDecl = llvm::dyn_cast<TemplateStructInstDecl>(checkContainer);
+
+            _templateParameters = &templateStructInstDecl->parentTemplateStruct()->templateParameters();
+            _templateArguments = &templateStructInstDecl->templateArguments();
+            break;
+        } else if (llvm::isa<TemplateTraitInstDecl>(checkContainer)) {
+            auto templateTraitInstDecl = llvm::dyn_cast<TemplateTraitInstDecl>(checkContainer);
+
+            _templateParameters = &templateTraitInstDecl->parentTemplateTrait()->templateParameters();
+            _templateArguments = &templateTraitInstDecl->templateArguments();
+            break;
+        }
+    }
+
+    if (_templateParameters == nullptr) {
+        std::cerr << "[INTERNAL ERROR] `TemplateInstHelper::instantiateFunctionDeclBody` called on a function that "
+                     "isn't contained within a template instantiation!" << std::endl;
+        std::exit(1);
+    }
+
+    // Up until now the body was shared with the template, we need our own copy to replace the template parameters
+    functionDecl->materializeBody();
+    instantiateStmt(functionDecl->body());
+    functionDecl->bodyIsInstantiated = true;
+}
+
+void gulc::TemplateInstHelper::shareFunctionBodies(gulc::Decl const* templateDecl, gulc::Decl* instDecl) const {
+    // NOTE: `instDecl` is a `deepCopy` of `templateDecl` so all members are in the same order. Nested templates are
+    //       skipped, they were copied with their bodies since their instantiations are copied from them.
+    switch (instDecl->getDeclKind()) {
+        case Decl::Kind::CallOperator:
+        case Decl::Kind::Constructor:
+        case Decl::Kind::Destructor:
+        case Decl::Kind::Function:
+        case Decl::Kind::Operator:
+        case Decl::Kind::PropertyGet:
+        case Decl::Kind::PropertySet:
+        case Decl::Kind::SubscriptOperatorGet:
+        case Decl::Kind::SubscriptOperatorSet: {
+            // NOTE: `FunctionDecl::classof` doesn't include the `get`/`set` accessors so we can't `dyn_cast` here
+            auto templateFunctionDecl = static_cast<FunctionDecl const*>(templateDecl);
+
+            if (templateFunctionDecl->body() != nullptr) {
+                static_cast<FunctionDecl*>(instDecl)->shareBody(templateFunctionDecl->body());
+            }
+
+            break;
+        }
+        case Decl::Kind::Property: {
+            auto templatePropertyDecl = llvm::dyn_cast<PropertyDecl>(templateDecl);
+            auto instPropertyDecl = llvm::dyn_cast<PropertyDecl>(instDecl);
+
+            for (std::size_t i = 0; i < instPropertyDecl->getters().size(); ++i) {
+                shareFunctionBodies(templatePropertyDecl->getters()[i], instPropertyDecl->getters()[i]);
+            }
+
+            if (instPropertyDecl->hasSetter()) {
+                shareFunctionBodies(templatePropertyDecl->setter(), instPropertyDecl->setter());
+            }
+
+            break;
+        }
+        case Decl::Kind::SubscriptOperator: {
+            auto templateSubscriptDecl = llvm::dyn_cast<SubscriptOperatorDecl>(templateDecl);
+            auto instSubscriptDecl = llvm::dyn_cast<SubscriptOperatorDecl>(instDecl);
+
+            for (std::size_t i = 0; i < instSubscriptDecl->getters().size(); ++i) {
+                shareFunctionBodies(templateSubscriptDecl->getters()[i], instSubscriptDecl->getters()[i]);
+            }
+
+            if (instSubscriptDecl->hasSetter()) {
+                shareFunctionBodies(templateSubscriptDecl->setter(), instSubscriptDecl->setter());
+            }
+
+            break;
+        }
+        case Decl::Kind::Struct:
+        case Decl::Kind::TemplateStructInst: {
+            // NOTE: For the outermost call `templateDecl` is the `TemplateStructDecl` which `StructDecl::classof` excludes
+            auto templateStructDecl = static_cast<StructDecl const*>(templateDecl);
+            auto instStructDecl = llvm::dyn_cast<StructDecl>(instDecl);
+
+            for (std::size_t i = 0; i < instStructDecl->ownedMembers().size(); ++i) {
+                shareFunctionBodies(templateStructDecl->ownedMembers()[i], instStructDecl->ownedMembers()[i]);
+            }
+
+            for (std::size_t i = 0; i < instStructDecl->constructors().size(); ++i) {
+                shareFunctionBodies(templateStructDecl->constructors()[i], instStructDecl->constructors()[i]);
+            }
+
+            if (instStructDecl->destructor != nullptr) {
+                shareFunctionBodies(templateStructDecl->destructor, instStructDecl->destructor);
+            }
+
+            break;
+        }
+        case Decl::Kind::Trait:
+        case Decl::Kind::TemplateTraitInst: {
+            // NOTE: Ditto, `TraitDecl::classof` excludes the `TemplateTraitDecl`
+            auto templateTraitDecl = static_cast<TraitDecl const*>(templateDecl);
+            auto instTraitDecl = llvm::dyn_cast<TraitDecl>(instDecl);
+
+            for (std::size_t i = 0; i < instTraitDecl->ownedMembers().size(); ++i) {
+                shareFunctionBodies(templateTraitDecl->ownedMembers()[i], instTraitDecl->ownedMembers()[i]);
+            }
+
+            break;
+        }
+        default:
+            break;
+    }
+}
+
 void gulc::TemplateInstHelper::instantiateAttr(gulc::Attr* attr) const {
     // TODO: There currently isn't anything to do here...
 }
@@ -208,7 +341,11 @@ void gulc::TemplateInstHelper::instantiateCont(gulc::Cont* cont) {
 
         instantiateExpr(requiresCont->condition);
     } else if (llvm::isa<ThrowsCont>(cont)) {
-        // TODO: Is there anything to do here? Exceptions are special types but can they be templated?
+        auto throwsCont = llvm::dyn_cast<ThrowsCont>(cont);
+
+        if (throwsCont->hasExceptionType()) {
+            instantiateType(throwsCont->exceptionType);
+        }
     } else if (llvm::isa<WhereCont>(cont)) {
         auto whereCont = llvm::dyn_cast<WhereCont>(cont);
 
@@ -405,6 +542,9 @@ void gulc::TemplateInstHelper::instantiateStmt(gulc::Stmt* stmt) {
         case Stmt::Kind::Switch:
             instantiateSwitchStmt(llvm::dyn_cast<SwitchStmt>(stmt));
             break;
+        case Stmt::Kind::Throw:
+            instantiateThrowStmt(llvm::dyn_cast<ThrowStmt>(stmt));
+            break;
         case Stmt::Kind::While:
             instantiateWhileStmt((llvm::dyn_cast<WhileStmt>(stmt)));
             break;
@@ -428,9 +568,16 @@ void gulc::TemplateInstHelper::instantiateExpr(gulc::Expr* expr) {
         case Expr::Kind::AssignmentOperator:
             instantiateAssignmentOperatorExpr(llvm::dyn_cast<AssignmentOperatorExpr>(expr));
             break;
+        case Expr::Kind::BoolLiteral:
+        case Expr::Kind::ValueLiteral:
+            // Literals can't reference a template parameter, there is nothing to instantiate
+            break;
         case Expr::Kind::CheckExtendsType:
             instantiateCheckExtendsTypeExpr(llvm::dyn_cast<CheckExtendsTypeExpr>(expr));
             break;
+        case Expr::Kind::Delete:
+            instantiateDeleteExpr(llvm::dyn_cast<DeleteExpr>(expr));
+            break;
         case Expr::Kind::FunctionCall:
             instantiateFunctionCallExpr(llvm::dyn_cast<FunctionCallExpr>(expr));
             break;
@@ -452,6 +599,9 @@ void gulc::TemplateInstHelper::instantiateExpr(gulc::Expr* expr) {
         case Expr::Kind::MemberAccessCall:
             instantiateMemberAccessCallExpr(llvm::dyn_cast<MemberAccessCallExpr>(expr));
             break;
+        case Expr::Kind::New:
+            instantiateNewExpr(llvm::dyn_cast<NewExpr>(expr));
+            break;
         case Expr::Kind::Paren:
             instantiateParenExpr(llvm::dyn_cast<ParenExpr>(expr));
             break;
@@ -461,12 +611,18 @@ void gulc::TemplateInstHelper::instantiateExpr(gulc::Expr* expr) {
         case Expr::Kind::PrefixOperator:
             instantiatePrefixOperatorExpr(llvm::dyn_cast<PrefixOperatorExpr>(expr));
             break;
+        case Expr::Kind::Ref:
+            instantiateRefExpr(llvm::dyn_cast<RefExpr>(expr));
+            break;
         case Expr::Kind::SubscriptCall:
             instantiateSubscriptCallExpr(llvm::dyn_cast<SubscriptCallExpr>(expr));
             break;
         case Expr::Kind::Ternary:
             instantiateTernaryExpr(llvm::dyn_cast<TernaryExpr>(expr));
             break;
+        case Expr::Kind::Try:
+            instantiateTryExpr(llvm::dyn_cast<TryExpr>(expr));
+            break;
         case Expr::Kind::Type:
             instantiateTypeExpr(llvm::dyn_cast<TypeExpr>(expr));
             break;
@@ -522,7 +678,11 @@ void gulc::TemplateInstHelper::instantiateFunctionDecl(gulc::FunctionDecl* funct
     }
 
     if (_processBodyStmts) {
+        functionDecl->materializeBody();
         instantiateStmt(functionDecl->body());
+    } else {
+        // The body is instantiated on demand by `CodeProcessor` through `instantiateFunctionDeclBody`
+        functionDecl->bodyIsInstantiated = false;
     }
 }
 
@@ -925,6 +1085,12 @@ void gulc::TemplateInstHelper::instantiateSwitchStmt(gulc::SwitchStmt* switchStm
     }
 }
 
+void gulc::TemplateInstHelper::instantiateThrowStmt(gulc::ThrowStmt* throwStmt) {
+    if (throwStmt->hasThrownValue()) {
+        instantiateExpr(throwStmt->thrownValue);
+    }
+}
+
 void gulc::TemplateInstHelper::instantiateWhileStmt(gulc::WhileStmt* whileStmt) {
     instantiateExpr(whileStmt->condition);
     instantiateStmt(whileStmt->body());
@@ -951,6 +1117,10 @@ void gulc::TemplateInstHelper::instantiateCheckExtendsTypeExpr(gulc::CheckExtend
     instantiateType(checkExtendsTypeExpr->extendsType);
 }
 
+void gulc::TemplateInstHelper::instantiateDeleteExpr(gulc::DeleteExpr* deleteExpr) {
+    instantiateExpr(deleteExpr->pointer);
+}
+
 void gulc::TemplateInstHelper::instantiateFunctionCallExpr(gulc::FunctionCallExpr* functionCallExpr) {
     instantiateExpr(functionCallExpr->functionReference);
 
@@ -989,6 +1159,10 @@ void gulc::TemplateInstHelper::instantiateMemberAccessCallExpr(gulc::MemberAcces
     instantiateExpr(memberAccessCallExpr->member);
 }
 
+void gulc::TemplateInstHelper::instantiateNewExpr(gulc::NewExpr* newExpr) {
+    instantiateExpr(newExpr->initializer);
+}
+
 void gulc::TemplateInstHelper::instantiateParenExpr(gulc::ParenExpr* parenExpr) {
     instantiateExpr(parenExpr->nestedExpr);
 }
@@ -1001,6 +1175,10 @@ void gulc::TemplateInstHelper::instantiatePrefixOperatorExpr(gulc::PrefixOperato
     instantiateExpr(prefixOperatorExpr->nestedExpr);
 }
 
+void gulc::TemplateInstHelper::instantiateRefExpr(gulc::RefExpr* refExpr) {
+    instantiateExpr(refExpr->nestedExpr);
+}
+
 void gulc::TemplateInstHelper::instantiateSubscriptCallExpr(gulc::SubscriptCallExpr* subscriptCallExpr) {
     instantiateExpr(subscriptCallExpr->subscriptReference);
 
@@ -1015,6 +1193,10 @@ void gulc::TemplateInstHelper::instantiateTernaryExpr(gulc::TernaryExpr* ternary
     instantiateExpr(ternaryExpr->falseExpr);
 }
 
+void gulc::TemplateInstHelper::instantiateTryExpr(gulc::TryExpr* tryExpr) {
+    instantiateExpr(tryExpr->nestedExpr);
+}
+
 void gulc::TemplateInstHelper::instantiateTypeExpr(gulc::TypeExpr* typeExpr) {
     instantiateType(typeExpr->type);
 }
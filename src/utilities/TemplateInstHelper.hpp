@@ -29,21 +29,26 @@
 #include <ast/stmts/LabeledStmt.hpp>
 #include <ast/stmts/ReturnStmt.hpp>
 #include <ast/stmts/SwitchStmt.hpp>
+#include <ast/stmts/ThrowStmt.hpp>
 #include <ast/stmts/DoCatchStmt.hpp>
 #include <ast/stmts/WhileStmt.hpp>
 #include <ast/exprs/ArrayLiteralExpr.hpp>
 #include <ast/exprs/AsExpr.hpp>
 #include <ast/exprs/AssignmentOperatorExpr.hpp>
+#include <ast/exprs/DeleteExpr.hpp>
 #include <ast/exprs/FunctionCallExpr.hpp>
 #include <ast/exprs/HasExpr.hpp>
 #include <ast/exprs/SubscriptCallExpr.hpp>
 #include <ast/exprs/IsExpr.hpp>
 #include <ast/exprs/LabeledArgumentExpr.hpp>
 #include <ast/exprs/MemberAccessCallExpr.hpp>
+#include <ast/exprs/NewExpr.hpp>
 #include <ast/exprs/ParenExpr.hpp>
 #include <ast/exprs/PostfixOperatorExpr.hpp>
 #include <ast/exprs/PrefixOperatorExpr.hpp>
+#include <ast/exprs/RefExpr.hpp>
 #include <ast/exprs/TernaryExpr.hpp>
+#include <ast/exprs/TryExpr.hpp>
 #include <ast/exprs/VariableDeclExpr.hpp>
 #include <ast/decls/TemplateTraitDecl.hpp>
 #include <ast/decls/CallOperatorDecl.hpp>
@@ -74,8 +79,8 @@ namespace gulc {
          * @param parentTemplateStruct
          * @param templateStructInstDecl
          * @param processBodyStmts Tells the function if it should also process the body `Stmt` for `FunctionDecl`s
-         *                         etc. If this is false we will only deep copy the `Stmt` without processing it.
-         *                         (NOTE: This will leave template parameter references)
+         *                         etc. If this is false the bodies stay shared with the template until
+         *                         `instantiateFunctionDeclBody` is called for them.
          */
         void instantiateTemplateStructInstDecl(TemplateStructDecl* parentTemplateStruct,
                                                TemplateStructInstDecl* templateStructInstDecl,
@@ -87,6 +92,12 @@ namespace gulc {
                                                  TemplateFunctionInstDecl* templateFunctionInstDecl);
         void instantiateType(Type*& type, std::vector<TemplateParameterDecl*>* templateParameters,
                              std::vector<Expr*>* templateArguments);
+        /**
+         * Instantiate the body of a member function that was skipped when its template instantiation was created with
+         * `processBodyStmts` set to false. The template arguments are taken from the closest template instantiation
+         * containing `functionDecl`.
+         */
+        void instantiateFunctionDeclBody(FunctionDecl* functionDecl);
 
     protected:
         std::vector<TemplateParameterDecl*>* _templateParameters;
@@ -95,6 +106,9 @@ namespace gulc {
         // This is null unless we're processing decls within a template.
         Type* _currentContainerTemplateType;
 
+        /// Make the functions of `instDecl` share the bodies of the matching functions in `templateDecl`
+        void shareFunctionBodies(Decl const* templateDecl, Decl* instDecl) const;
+
         void instantiateAttr(Attr* attr) const;
         void instantiateCont(Cont* cont);
         void instantiateType(Type*& type);
@@ -141,12 +155,14 @@ namespace gulc {
         void instantiateRepeatWhileStmt(RepeatWhileStmt* repeatWhileStmt);
         void instantiateReturnStmt(ReturnStmt* returnStmt);
         void instantiateSwitchStmt(SwitchStmt* switchStmt);
+        void instantiateThrowStmt(ThrowStmt* throwStmt);
         void instantiateWhileStmt(WhileStmt* whileStmt);
 
         void instantiateArrayLiteralExpr(ArrayLiteralExpr* arrayLiteralExpr);
         void instantiateAsExpr(AsExpr* asExpr);
         void instantiateAssignmentOperatorExpr(AssignmentOperatorExpr* assignmentOperatorExpr);
         void instantiateCheckExtendsTypeExpr(CheckExtendsTypeExpr* checkExtendsTypeExpr);
+        void instantiateDeleteExpr(DeleteExpr* deleteExpr);
         void instantiateFunctionCallExpr(FunctionCallExpr* functionCallExpr);
         void instantiateHasExpr(HasExpr* hasExpr);
         void instantiateIdentifierExpr(IdentifierExpr* identifierExpr);
@@ -154,11 +170,14 @@ namespace gulc {
         void instantiateIsExpr(IsExpr* isExpr);
         void instantiateLabeledArgumentExpr(LabeledArgumentExpr* labeledArgumentExpr);
         void instantiateMemberAccessCallExpr(MemberAccessCallExpr* memberAccessCallExpr);
+        void instantiateNewExpr(NewExpr* newExpr);
         void instantiateParenExpr(ParenExpr* parenExpr);
         void instantiatePostfixOperatorExpr(PostfixOperatorExpr* postfixOperatorExpr);
         void instantiatePrefixOperatorExpr(PrefixOperatorExpr* prefixOperatorExpr);
+        void instantiateRefExpr(RefExpr* refExpr);
         void instantiateSubscriptCallExpr(SubscriptCallExpr* subscriptCallExpr);
         void instantiateTernaryExpr(TernaryExpr* ternaryExpr);
+        void instantiateTryExpr(TryExpr* tryExpr);
         void instantiateTypeExpr(TypeExpr* typeExpr);
 //        void instantiateValueLiteralExpr(ValueLiteralExpr* valueLiteralExpr) const;
         void instantiateVariableDeclExpr(VariableDeclExpr* variableDeclExpr);
@@ -22,6 +22,7 @@
 #include <ast/types/PointerType.hpp>
 #include <ast/types/ReferenceType.hpp>
 #include <ast/types/StructType.hpp>
+#include <ast/types/SimdType.hpp>
 #include <ast/types/TraitType.hpp>
 #include <ast/types/TemplateStructType.hpp>
 #include <ast/types/TemplateTraitType.hpp>
@@ -29,6 +30,15 @@
 
 bool gulc::TypeCompareUtil::compareAreSame(const gulc::Type* left, const gulc::Type* right,
                                            TemplateComparePlan templateComparePlan) {
+    // When we were given template arguments any reference to their parameters is compared as the argument instead
+    if (llvm::isa<TemplateTypenameRefType>(left)) {
+        left = getTemplateTypenameArg(llvm::dyn_cast<TemplateTypenameRefType>(left));
+    }
+
+    if (llvm::isa<TemplateTypenameRefType>(right)) {
+        right = getTemplateTypenameArg(llvm::dyn_cast<TemplateTypenameRefType>(right));
+    }
+
     if (left->getTypeKind() != right->getTypeKind()) {
         return false;
     }
@@ -61,6 +71,13 @@ bool gulc::TypeCompareUtil::compareAreSame(const gulc::Type* left, const gulc::T
 
             return leftEnum->decl() == rightEnum->decl();
         }
+        case Type::Kind::Simd: {
+            auto leftSimd = llvm::dyn_cast<SimdType>(left);
+            auto rightSimd = llvm::dyn_cast<SimdType>(right);
+
+            return leftSimd->length() == rightSimd->length() &&
+                   compareAreSame(leftSimd->elementType, rightSimd->elementType, templateComparePlan);
+        }
         case Type::Kind::Pointer: {
             auto leftPointer = llvm::dyn_cast<PointerType>(left);
             auto rightPointer = llvm::dyn_cast<PointerType>(right);
@@ -233,9 +250,10 @@ bool gulc::TypeCompareUtil::compareAreSameOrInherits(const gulc::Type* checkType
     return false;
 }
 
-const gulc::Type* gulc::TypeCompareUtil::getTemplateTypenameArg(gulc::TemplateTypenameRefType* templateTypenameRefType) const {
+const gulc::Type* gulc::TypeCompareUtil::getTemplateTypenameArg(
+        gulc::TemplateTypenameRefType const* templateTypenameRefType) const {
     if (_templateParameters != nullptr) {
-        for (std::size_t i = 0; i < _templateParameters->size(); ++i) {
+        for (std::size_t i = 0; i < _templateParameters->size() && i < _templateArguments->size(); ++i) {
             if ((*_templateParameters)[i] == templateTypenameRefType->refTemplateParameter()) {
                 if (!llvm::isa<TypeExpr>((*_templateArguments)[i])) {
                     std::cerr << "[INTERNAL ERROR] expected `TypeExpr`!" << std::endl;
@@ -47,7 +47,7 @@ namespace gulc {
         std::vector<TemplateParameterDecl*> const* _templateParameters = nullptr;
         std::vector<Expr*> const* _templateArguments = nullptr;
 
-        Type const* getTemplateTypenameArg(TemplateTypenameRefType* templateTypenameRefType) const;
+        Type const* getTemplateTypenameArg(TemplateTypenameRefType const* templateTypenameRefType) const;
 
     };
 }
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <algorithm>
+#include <ast/decls/ExtensionDecl.hpp>
+#include <ast/types/StructType.hpp>
+#include <ast/types/TraitType.hpp>
+#include "TypeExtensionIndex.hpp"
+#include "ConstExprHelper.hpp"
+#include "TypeCompareUtil.hpp"
+
+void gulc::TypeExtensionIndex::build(std::vector<ExtensionDecl*> const& extensions) {
+    _extensions = extensions;
+    _extensionBuckets.clear();
+
+    for (ExtensionDecl* extension : _extensions) {
+        _extensionBuckets[getTypeKey(extension->typeToExtend)].push_back(extension);
+    }
+
+    _isBuilt = true;
+}
+
+void gulc::TypeExtensionIndex::findExtensions(gulc::Type const* forType,
+                                              std::vector<ExtensionDecl*>& result) const {
+    if (_extensions.empty()) {
+        return;
+    }
+
+    switch (forType->getTypeKind()) {
+        // Template types and template typename references can only be compared properly with their template context,
+        // the index has no way to key those so we fall back to the old linear search for them.
+        case Type::Kind::TemplateStruct:
+        case Type::Kind::TemplateTrait:
+        case Type::Kind::TemplateTypenameRef:
+            findExtensionsLinear(forType, result);
+            return;
+        default:
+            break;
+    }
+
+    auto foundBucket = _extensionBuckets.find(getTypeKey(forType));
+
+    if (foundBucket != _extensionBuckets.end()) {
+        for (ExtensionDecl* extension : foundBucket->second) {
+            if (std::find(result.begin(), result.end(), extension) == result.end()) {
+                result.push_back(extension);
+            }
+        }
+    }
+
+    // TODO: We MIGHT have the possibility for circular references here, same as `compareAreSameOrInherits`
+    if (auto structType = llvm::dyn_cast<StructType>(forType)) {
+        for (Type const* inheritedType : structType->decl()->inheritedTypes()) {
+            findExtensions(inheritedType, result);
+        }
+    } else if (auto traitType = llvm::dyn_cast<TraitType>(forType)) {
+        for (Type const* inheritedType : traitType->decl()->inheritedTypes()) {
+            findExtensions(inheritedType, result);
+        }
+    }
+}
+
+std::string gulc::TypeExtensionIndex::getTypeKey(gulc::Type const* type) {
+    return ConstExprHelper::getCanonicalTypeKey(type, false);
+}
+
+void gulc::TypeExtensionIndex::findExtensionsLinear(gulc::Type const* forType,
+                                                    std::vector<ExtensionDecl*>& result) const {
+    TypeCompareUtil typeCompareUtil;
+
+    for (ExtensionDecl* checkExtension : _extensions) {
+        if (std::find(result.begin(), result.end(), checkExtension) != result.end()) {
+            continue;
+        }
+
+        if (typeCompareUtil.compareAreSameOrInherits(forType, checkExtension->typeToExtend)) {
+            result.push_back(checkExtension);
+        }
+    }
+}
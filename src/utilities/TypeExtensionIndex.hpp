@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_TYPEEXTENSIONINDEX_HPP
+#define GULC_TYPEEXTENSIONINDEX_HPP
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <ast/Type.hpp>
+
+namespace gulc {
+    class ExtensionDecl;
+
+    /**
+     * Index of the `ExtensionDecl`s within a single scope (file or namespace), bucketed by the canonical key of the
+     * type they extend.
+     *
+     * The key comes from `ConstExprHelper::getCanonicalTypeKey` without the outermost qualifier so it follows the same
+     * rules as `TypeCompareUtil::compareAreSame` (decl based types are keyed by their `Decl`, template instantiations
+     * by their instantiated `Decl`, aliases by the type they alias). Two separately allocated `Type`s for the same
+     * type will always share a bucket.
+     *
+     * NOTE: This must only be built after `DeclInstantiator` has resolved every `ExtensionDecl::typeToExtend`
+     */
+    class TypeExtensionIndex {
+    public:
+        TypeExtensionIndex() = default;
+
+        void build(std::vector<ExtensionDecl*> const& extensions);
+        bool isBuilt() const { return _isBuilt; }
+
+        // Appends every extension for `forType` and every type `forType` inherits to `result`, skipping any extension
+        // already found in `result`
+        void findExtensions(Type const* forType, std::vector<ExtensionDecl*>& result) const;
+
+        static std::string getTypeKey(Type const* type);
+
+    protected:
+        bool _isBuilt = false;
+        // We only hold these so template types that cannot be keyed without their template arguments can still fall
+        // back to a linear search.
+        std::vector<ExtensionDecl*> _extensions;
+        std::unordered_map<std::string, std::vector<ExtensionDecl*>> _extensionBuckets;
+
+        void findExtensionsLinear(Type const* forType, std::vector<ExtensionDecl*>& result) const;
+
+    };
+}
+
+#endif //GULC_TYPEEXTENSIONINDEX_HPP
@@ -42,6 +42,9 @@
 #include <ast/types/TemplateTraitType.hpp>
 #include <ast/types/SelfType.hpp>
 #include <ast/types/BoolType.hpp>
+#include <ast/types/SimdType.hpp>
+#include <ast/exprs/IdentifierExpr.hpp>
+#include <ast/exprs/ValueLiteralExpr.hpp>
 #include "TypeHelper.hpp"
 
 bool gulc::TypeHelper::resolveType(gulc::Type*& type, ASTFile const* currentFile,
@@ -57,6 +60,8 @@ bool gulc::TypeHelper::resolveType(gulc::Type*& type, ASTFile const* currentFile
             return true;
         case Type::Kind::BuiltIn:
             return true;
+        case Type::Kind::Simd:
+            return true;
         case Type::Kind::Dimension: {
             auto dimensionType = llvm::dyn_cast<DimensionType>(type);
             return resolveType(dimensionType->nestedType, currentFile, namespacePrototypes,
@@ -272,6 +277,11 @@ bool gulc::TypeHelper::resolveType(gulc::Type*& type, ASTFile const* currentFile
                 bool templated = unresolvedType->hasTemplateArguments();
                 std::vector<Decl*> potentialTemplates;
 
+                // `simd<T, N>` is a built in type
+                if (templated && checkName == "simd" && resolveSimdType(type, unresolvedType)) {
+                    return true;
+                }
+
                 if (!templated) {
                     // First check if it is a built in type
                     if (BuiltInType::isBuiltInType(checkName)) {
@@ -418,6 +428,8 @@ bool gulc::TypeHelper::typeIsConstExpr(gulc::Type* resolvedType) {
             return true;
         case Type::Kind::BuiltIn:
             return true;
+        case Type::Kind::Simd:
+            return true;
         case Type::Kind::Dimension:
             // TODO: We cannot know if `[]` is const or not...
             return false;
@@ -994,6 +1006,48 @@ bool gulc::TypeHelper::resolveNamespacePathToDecl(const std::vector<Identifier>&
     return false;
 }
 
+bool gulc::TypeHelper::resolveSimdType(gulc::Type*& type, gulc::UnresolvedType* unresolvedType) {
+    if (unresolvedType->templateArguments.size() != 2 ||
+            !llvm::isa<IdentifierExpr>(unresolvedType->templateArguments[0]) ||
+            !llvm::isa<ValueLiteralExpr>(unresolvedType->templateArguments[1])) {
+        return false;
+    }
+
+    // NOTE: Only built in element types and literal lengths are accepted here, anything else (e.g. a template
+    //       parameter) is left to the normal type lookup.
+    auto elementIdentifier = llvm::dyn_cast<IdentifierExpr>(unresolvedType->templateArguments[0]);
+    auto lengthLiteral = llvm::dyn_cast<ValueLiteralExpr>(unresolvedType->templateArguments[1]);
+    std::string const& elementName = elementIdentifier->identifier().name();
+
+    if (elementIdentifier->hasTemplateArguments() ||
+            lengthLiteral->literalType() != ValueLiteralExpr::LiteralType::Integer ||
+            std::stoull(lengthLiteral->value()) == 0) {
+        return false;
+    }
+
+    Type* elementType = nullptr;
+
+    if (elementName == "bool") {
+        elementType = new BoolType(Type::Qualifier::Unassigned,
+                                   elementIdentifier->startPosition(), elementIdentifier->endPosition());
+    } else if (BuiltInType::isBuiltInType(elementName) && elementName != "void") {
+        elementType = BuiltInType::get(Type::Qualifier::Unassigned, elementName,
+                                       elementIdentifier->startPosition(), elementIdentifier->endPosition());
+    } else {
+        return false;
+    }
+
+    auto result = new SimdType(unresolvedType->qualifier(), elementType, std::stoull(lengthLiteral->value()),
+                               unresolvedType->startPosition(), unresolvedType->endPosition());
+    result->setIsLValue(unresolvedType->isLValue());
+
+    delete unresolvedType;
+
+    type = result;
+
+    return true;
+}
+
 bool gulc::TypeHelper::checkImportForAmbiguity(gulc::ImportDecl* importDecl, const std::string& checkName,
                                                gulc::Decl* skipDecl) {
     for (Decl* checkDecl : importDecl->pointToNamespace->nestedDecls()) {
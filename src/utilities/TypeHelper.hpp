@@ -24,6 +24,7 @@
 #include <parsing/ASTFile.hpp>
 #include <ast/types/FunctionPointerType.hpp>
 #include <ast/decls/FunctionDecl.hpp>
+#include <ast/types/UnresolvedType.hpp>
 
 namespace gulc {
     class TypeHelper {
@@ -48,6 +49,9 @@ namespace gulc {
         static bool resolveNamespacePathToDecl(std::vector<Identifier> const& namespacePath, std::size_t pathIndex,
                                                std::vector<Decl*> const& declList, Decl** resultDecl);
         static bool checkImportForAmbiguity(ImportDecl* importDecl, std::string const& checkName, Decl* skipDecl);
+        /// Creates the built in `simd<T, N>` from `unresolvedType`, returns false if the arguments aren't a valid
+        /// built in element type and integer literal length
+        static bool resolveSimdType(Type*& type, UnresolvedType* unresolvedType);
 
     };
 }
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#include <ast/types/StructType.hpp>
+#include <ast/types/TraitType.hpp>
+#include "WitnessTableUtil.hpp"
+#include "InheritUtil.hpp"
+#include "TypeCompareUtil.hpp"
+
+bool gulc::WitnessTableUtil::implementsTrait(gulc::StructDecl* structDecl, gulc::TraitDecl* traitDecl) {
+    StructType checkType(Type::Qualifier::Unassigned, structDecl, {}, {});
+    TraitType traitType(Type::Qualifier::Unassigned, traitDecl, {}, {});
+
+    TypeCompareUtil typeCompareUtil;
+    return typeCompareUtil.compareAreSameOrInherits(&checkType, &traitType);
+}
+
+std::vector<gulc::FunctionDecl*> const* gulc::WitnessTableUtil::getWitnessTable(gulc::StructDecl* structDecl,
+                                                                                gulc::TraitDecl* traitDecl) {
+    auto foundWitnessTable = structDecl->witnessTables.find(traitDecl);
+
+    if (foundWitnessTable != structDecl->witnessTables.end()) {
+        return &foundWitnessTable->second;
+    }
+
+    if (!implementsTrait(structDecl, traitDecl)) {
+        return nullptr;
+    }
+
+    std::vector<FunctionDecl*> witnessTable;
+    witnessTable.reserve(traitDecl->witnessTable.size());
+
+    for (FunctionDecl* traitFunction : traitDecl->witnessTable) {
+        FunctionDecl* implementation = nullptr;
+
+        // `allMembers` also holds the trait prototypes we haven't shadowed, those can't be called so we skip them.
+        for (Decl* checkMember : structDecl->allMembers) {
+            if (checkMember->getDeclKind() != Decl::Kind::Function || checkMember->isStatic() ||
+                    llvm::dyn_cast<FunctionDecl>(checkMember)->isPrototype()) {
+                continue;
+            }
+
+            if (InheritUtil::overridesOrShadows(checkMember, traitFunction)) {
+                implementation = llvm::dyn_cast<FunctionDecl>(checkMember);
+                break;
+            }
+        }
+
+        // TODO: Trait functions with a default body aren't generated yet so they can't fill a witness table slot
+        if (implementation == nullptr) {
+            return nullptr;
+        }
+
+        witnessTable.push_back(implementation);
+    }
+
+    auto insertedWitnessTable = structDecl->witnessTables.emplace(traitDecl, std::move(witnessTable));
+    return &insertedWitnessTable.first->second;
+}
+
+long gulc::WitnessTableUtil::getWitnessIndex(gulc::TraitDecl const* traitDecl,
+                                             gulc::FunctionDecl const* functionDecl) {
+    for (std::size_t i = 0; i < traitDecl->witnessTable.size(); ++i) {
+        if (traitDecl->witnessTable[i] == functionDecl) {
+            return static_cast<long>(i);
+        }
+    }
+
+    return -1;
+}
+
+std::string gulc::WitnessTableUtil::getWitnessTableName(gulc::StructDecl const* structDecl,
+                                                        gulc::TraitDecl const* traitDecl) {
+    // NOTE: `mangledName` for a type decl is its `<type>` mangling, both are self delimiting so they can follow each
+    //       other directly. The name is kept out of the `_Z` namespace, there is no Itanium special name for a witness
+    //       table and borrowing one (e.g. `_ZTC`) would collide with the C++ symbols it actually means.
+    return "__gulc_witness_" + structDecl->mangledName() + traitDecl->mangledName();
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2020 Brandon Huddle
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+#ifndef GULC_WITNESSTABLEUTIL_HPP
+#define GULC_WITNESSTABLEUTIL_HPP
+
+#include <ast/decls/StructDecl.hpp>
+#include <ast/decls/TraitDecl.hpp>
+#include <ast/decls/FunctionDecl.hpp>
+#include <vector>
+
+namespace gulc {
+    /**
+     * Trait objects are a pair of `{ self*, witness table* }`. The witness table for a `struct` holds the struct's
+     * implementation of every function in `TraitDecl::witnessTable`, in the same order, so a call through a trait
+     * object is a single indirect call to `witnessTable[index](self, ...)`.
+     */
+    class WitnessTableUtil {
+    public:
+        /// Checks if `structDecl` can be converted to a trait object of `traitDecl`
+        static bool implementsTrait(StructDecl* structDecl, TraitDecl* traitDecl);
+        /// Get the implementations `structDecl` provides for `traitDecl`, returns `nullptr` if `structDecl` is missing
+        /// an implementation. The result is cached on `structDecl`.
+        static std::vector<FunctionDecl*> const* getWitnessTable(StructDecl* structDecl, TraitDecl* traitDecl);
+        /// Get the index of `functionDecl` within `traitDecl`'s witness table, returns `-1` if it isn't dispatchable
+        static long getWitnessIndex(TraitDecl const* traitDecl, FunctionDecl const* functionDecl);
+        /// Get the vendor symbol we use for the witness table global, `__gulc_witness_ <struct type> <trait type>`
+        static std::string getWitnessTableName(StructDecl const* structDecl, TraitDecl const* traitDecl);
+
+    };
+}
+
+#endif //GULC_WITNESSTABLEUTIL_HPP